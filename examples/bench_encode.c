@@ -0,0 +1,126 @@
+#include "image/bc/bc.h"
+#include "image/bc/encode.h"
+#include "image/format/format.h"
+#include "utility/job.h"
+#include <SDL.h>
+#include <SDL_image.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// block compression throughput of the textures compressed on load, bc1 for
+// the opaque planet and bc3 and bc7 for the ring, on one thread and then on
+// every core, with the error of each through the cpu decoder
+
+typedef struct EncodeTarget {
+    const char *fileName;
+    VkFormat format;
+    const char *name;
+} EncodeTarget;
+
+static const EncodeTarget targets[] = {
+    {"../assets/2k_saturn.jpg", VK_FORMAT_BC1_RGB_SRGB_BLOCK, "bc1"},
+    {"../assets/2k_saturn_ring_alpha.png", VK_FORMAT_BC3_SRGB_BLOCK, "bc3"},
+    {"../assets/2k_saturn_ring_alpha.png", VK_FORMAT_BC7_SRGB_BLOCK, "bc7"},
+};
+
+#define REPEATS 5
+
+static double elapsedMs(const struct timespec *start) {
+    struct timespec end;
+    timespec_get(&end, TIME_UTC);
+    return (end.tv_sec - start->tv_sec) * 1e3 +
+           (end.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+static unsigned char *loadRgba(const char *fileName, uint32_t *width,
+                               uint32_t *height) {
+    SDL_Surface *image = IMG_Load(fileName);
+    if (!image) {
+        printf("could not load %s: %s\n", fileName, SDL_GetError());
+        exit(EXIT_FAILURE);
+    }
+    SDL_Surface *converted =
+        SDL_ConvertSurfaceFormat(image, SDL_PIXELFORMAT_ABGR8888, 0);
+    SDL_FreeSurface(image);
+
+    *width = (uint32_t)converted->w;
+    *height = (uint32_t)converted->h;
+    unsigned char *rgba = malloc((size_t)*width * *height * 4);
+    const unsigned char *pixels = converted->pixels;
+    for (uint32_t y = 0; y < *height; y++) {
+        memcpy(&rgba[(size_t)y * *width * 4],
+               &pixels[(size_t)y * converted->pitch], (size_t)*width * 4);
+    }
+
+    SDL_FreeSurface(converted);
+    return rgba;
+}
+
+// psnr over the channels the format keeps
+static double psnr(const ImageFormat *imageFormat, const unsigned char *rgba,
+                   const unsigned char *blocks, uint32_t width,
+                   uint32_t height) {
+    size_t count = (size_t)width * height;
+    unsigned char *decoded = malloc(count * 4);
+    decodeBcImage(imageFormat, blocks, width, height, decoded);
+
+    uint32_t channels = imageFormat->blockBytes == 8 ? 3 : 4;
+    double error = 0.0;
+    for (size_t i = 0; i < count; i++) {
+        for (uint32_t c = 0; c < channels; c++) {
+            double d = (double)rgba[i * 4 + c] - decoded[i * 4 + c];
+            error += d * d;
+        }
+    }
+
+    free(decoded);
+    error /= count * channels;
+    return error > 0.0 ? 10.0 * log10(255.0 * 255.0 / error) : INFINITY;
+}
+
+static void benchTarget(const EncodeTarget *target, const char *threads) {
+    uint32_t width, height;
+    unsigned char *rgba = loadRgba(target->fileName, &width, &height);
+    const ImageFormat *imageFormat = findImageFormat(target->format);
+    unsigned char *blocks =
+        malloc(imageLevelSize(imageFormat, width, height));
+
+    // the best of a few runs, the first pays for faulting the output in
+    double best = INFINITY;
+    for (uint32_t i = 0; i < REPEATS; i++) {
+        struct timespec start;
+        timespec_get(&start, TIME_UTC);
+        encodeBcImage(imageFormat, rgba, width, height, blocks);
+        double ms = elapsedMs(&start);
+        best = ms < best ? ms : best;
+    }
+
+    size_t size = (size_t)width * height * 4;
+    printf("%-4s %4ux%-4u %-11s %8.1f ms | %7.1f MB/s | %6.2f dB\n",
+           target->name, width, height, threads, best, size / 1e3 / best,
+           psnr(imageFormat, rgba, blocks, width, height));
+
+    free(blocks);
+    free(rgba);
+}
+
+int main(void) {
+    // without a job system every block row runs on the calling thread
+    for (uint32_t i = 0; i < sizeof(targets) / sizeof(*targets); i++) {
+        benchTarget(&targets[i], "one thread");
+    }
+
+    startJobSystem(0, 0);
+    printf("%u workers and the main thread\n", jobWorkersCount());
+
+    for (uint32_t i = 0; i < sizeof(targets) / sizeof(*targets); i++) {
+        benchTarget(&targets[i], "every core");
+    }
+
+    stopJobSystem();
+
+    return 0;
+}
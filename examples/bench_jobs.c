@@ -0,0 +1,96 @@
+#include "utility/job.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// scheduling overhead of the job system, a million empty jobs queued from
+// one thread, spawned by other jobs, and as a chain where every job waits on
+// the one before it, pass pin to pin the workers
+
+#define JOBS_COUNT 1000000
+#define SPAWNERS_COUNT 1000
+#define CHAIN_LENGTH 100000
+
+static double elapsedMs(const struct timespec *start) {
+    struct timespec end;
+    timespec_get(&end, TIME_UTC);
+    return (end.tv_sec - start->tv_sec) * 1e3 +
+           (end.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+static void report(const char *name, double ms, uint32_t jobsCount) {
+    printf("%-28s %8.1f ms | %6.1f ns per job\n", name, ms,
+           ms * 1e6 / jobsCount);
+}
+
+static void emptyJob(void *data) {
+    (void)data;
+}
+
+static Job emptyJobs[JOBS_COUNT / SPAWNERS_COUNT];
+
+static void spawnJobs(void *data) {
+    (void)data;
+    JobCounter counter = {0};
+    runJobs(emptyJobs, JOBS_COUNT / SPAWNERS_COUNT, &counter);
+    waitForJobs(&counter);
+}
+
+int main(int argc, char **argv) {
+    JobSystemFlags flags =
+        argc > 1 && strcmp(argv[1], "pin") == 0 ? JOB_SYSTEM_PIN_THREADS : 0;
+    startJobSystem(0, flags);
+
+    printf("%u workers and the main thread%s\n", jobWorkersCount(),
+           flags ? ", pinned" : "");
+
+    Job *jobs = malloc(JOBS_COUNT * sizeof(*jobs));
+    for (uint32_t i = 0; i < JOBS_COUNT; i++) {
+        jobs[i] = (Job){.function = emptyJob};
+    }
+    for (uint32_t i = 0; i < JOBS_COUNT / SPAWNERS_COUNT; i++) {
+        emptyJobs[i] = (Job){.function = emptyJob};
+    }
+
+    // the floor every queued job is measured against
+    void (*volatile call)(void *) = emptyJob;
+    struct timespec start;
+    timespec_get(&start, TIME_UTC);
+    for (uint32_t i = 0; i < JOBS_COUNT; i++) {
+        call(NULL);
+    }
+    report("plain calls", elapsedMs(&start), JOBS_COUNT);
+
+    // past a full queue the main thread runs them itself
+    JobCounter counter = {0};
+    timespec_get(&start, TIME_UTC);
+    runJobs(jobs, JOBS_COUNT, &counter);
+    waitForJobs(&counter);
+    report("queued from the main thread", elapsedMs(&start), JOBS_COUNT);
+
+    Job spawners[SPAWNERS_COUNT];
+    for (uint32_t i = 0; i < SPAWNERS_COUNT; i++) {
+        spawners[i] = (Job){.function = spawnJobs};
+    }
+    timespec_get(&start, TIME_UTC);
+    runJobs(spawners, SPAWNERS_COUNT, &counter);
+    waitForJobs(&counter);
+    report("spawned by jobs", elapsedMs(&start), JOBS_COUNT);
+
+    JobCounter *links = calloc(CHAIN_LENGTH, sizeof(*links));
+    timespec_get(&start, TIME_UTC);
+    runJobs(jobs, 1, &links[0]);
+    for (uint32_t i = 1; i < CHAIN_LENGTH; i++) {
+        runJobsAfter(&links[i - 1], jobs, 1, &links[i]);
+    }
+    waitForJobs(&links[CHAIN_LENGTH - 1]);
+    report("dependency chain", elapsedMs(&start), CHAIN_LENGTH);
+
+    stopJobSystem();
+
+    free(jobs);
+    free(links);
+
+    return 0;
+}
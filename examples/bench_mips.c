@@ -0,0 +1,199 @@
+#include "image/format/format.h"
+#include "image/mip/mip.h"
+#include "utility/job.h"
+#include "vulkan_handle/mipmap.h"
+#include "vulkan_handle/texture.h"
+#include "vulkan_handle/vulkan_handle.h"
+#include <SDL.h>
+#include <SDL_image.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// mip chain generation of the scene's textures, the blit chain and the
+// compute dispatch timed on the device around their command buffers, less
+// the copy of level 0 they both start with, and the cpu filter on every core
+
+static const char *textures[] = {
+    "../assets/2k_saturn.jpg",
+    "../assets/2k_saturn_ring_alpha.png",
+};
+
+#define REPEATS 5
+
+static double elapsedMs(const struct timespec *start) {
+    struct timespec end;
+    timespec_get(&end, TIME_UTC);
+    return (end.tv_sec - start->tv_sec) * 1e3 +
+           (end.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+static bool canBlit(Vulkan *vulkan, VkFormat format) {
+    VkFormatProperties properties;
+    vkGetPhysicalDeviceFormatProperties(vulkan->device.physicalDevice, format,
+                                        &properties);
+    VkFormatFeatureFlags blit =
+        VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT |
+        VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT;
+    return (properties.optimalTilingFeatures & blit) == blit;
+}
+
+// the best of a few uploads of level 0 and however the rest is generated
+static double timeUpload(Vulkan *vulkan, VkQueryPool queryPool,
+                         const TexturePixels *pixels, VkBuffer stagingBuffer) {
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(vulkan->device.physicalDevice, &properties);
+
+    double best = INFINITY;
+    for (uint32_t i = 0; i < REPEATS; i++) {
+        Texture texture = {0};
+        createTextureImage(vulkan, &texture, pixels);
+
+        VkCommandBuffer commandBuffer = beginSingleTimeCommands(vulkan);
+        vkCmdResetQueryPool(commandBuffer, queryPool, 0, 2);
+        vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                            queryPool, 0);
+        recordTextureUpload(vulkan, commandBuffer, &texture, pixels,
+                            stagingBuffer, 0);
+        vkCmdWriteTimestamp(commandBuffer,
+                            VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryPool,
+                            1);
+        endSingleTimeCommands(vulkan, commandBuffer);
+        releaseMipScratch(vulkan);
+
+        uint64_t timestamps[2];
+        vkGetQueryPoolResults(vulkan->device.device, queryPool, 0, 2,
+                              sizeof(timestamps), timestamps,
+                              sizeof(*timestamps),
+                              VK_QUERY_RESULT_64_BIT |
+                                  VK_QUERY_RESULT_WAIT_BIT);
+        double ms = (timestamps[1] - timestamps[0]) *
+                    properties.limits.timestampPeriod / 1e6;
+        best = ms < best ? ms : best;
+
+        vkDestroyImage(vulkan->device.device, texture.textureImage, NULL);
+        vkFreeMemory(vulkan->device.device, texture.textureImageMemory, NULL);
+    }
+
+    return best;
+}
+
+static unsigned char *loadRgba(SDL_Surface *image) {
+    SDL_Surface *converted =
+        SDL_ConvertSurfaceFormat(image, SDL_PIXELFORMAT_ABGR8888, 0);
+    unsigned char *rgba = malloc((size_t)converted->w * converted->h * 4);
+    const unsigned char *pixels = converted->pixels;
+    for (int32_t y = 0; y < converted->h; y++) {
+        memcpy(&rgba[(size_t)y * converted->w * 4],
+               &pixels[(size_t)y * converted->pitch],
+               (size_t)converted->w * 4);
+    }
+
+    SDL_FreeSurface(converted);
+    return rgba;
+}
+
+static double timeCpu(SDL_Surface *image) {
+    unsigned char *rgba = loadRgba(image);
+
+    double best = INFINITY;
+    for (uint32_t i = 0; i < REPEATS; i++) {
+        struct timespec start;
+        timespec_get(&start, TIME_UTC);
+        MipChain chain;
+        generateMipChain(rgba, (uint32_t)image->w, (uint32_t)image->h,
+                         MIP_SRGB, &chain);
+        double ms = elapsedMs(&start);
+        best = ms < best ? ms : best;
+        freeMipChain(&chain);
+    }
+
+    free(rgba);
+    return best;
+}
+
+static void benchTexture(Vulkan *vulkan, VkQueryPool queryPool,
+                         const char *fileName) {
+    TexturePixels pixels;
+    loadTexturePixels(vulkan, fileName, 0, &pixels);
+    if (!pixels.surface || pixels.levelsCount != 1) {
+        printf("%s is stored with its mips, or only the cpu can make them\n",
+               fileName);
+        freeTexturePixels(&pixels);
+        return;
+    }
+    MipGeneration chosen = pixels.mipGeneration;
+
+    VkBuffer stagingBuffer;
+    VkDeviceMemory stagingBufferMemory;
+    createBuffer(pixels.size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                 VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                     VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                 vulkan, &stagingBuffer, &stagingBufferMemory);
+
+    void *staging;
+    vkMapMemory(vulkan->device.device, stagingBufferMemory, 0, pixels.size, 0,
+                &staging);
+    writeTexturePixels(&pixels, staging);
+    vkUnmapMemory(vulkan->device.device, stagingBufferMemory);
+
+    // level 0 on its own, which every device path pays for
+    TexturePixels copyOnly = pixels;
+    copyOnly.mipLevels = 1;
+    copyOnly.mipGeneration = MIP_GENERATION_NONE;
+    double copy = timeUpload(vulkan, queryPool, &copyOnly, stagingBuffer);
+
+    printf("%-36s %4ux%-4u %2u levels, level 0 copy %7.3f ms\n", fileName,
+           pixels.width, pixels.height, pixels.mipLevels, copy);
+
+    if (canBlit(vulkan, pixels.format)) {
+        pixels.mipGeneration = MIP_GENERATION_BLIT;
+        printf("  blit chain  %8.3f ms\n",
+               timeUpload(vulkan, queryPool, &pixels, stagingBuffer) - copy);
+    } else {
+        printf("  blit chain  unsupported\n");
+    }
+
+    if (chosen == MIP_GENERATION_COMPUTE) {
+        pixels.mipGeneration = MIP_GENERATION_COMPUTE;
+        printf("  compute     %8.3f ms\n",
+               timeUpload(vulkan, queryPool, &pixels, stagingBuffer) - copy);
+    } else {
+        printf("  compute     unsupported\n");
+    }
+
+    printf("  cpu lanczos %8.3f ms on %u workers and the main thread\n",
+           timeCpu(pixels.surface), jobWorkersCount());
+
+    vkDestroyBuffer(vulkan->device.device, stagingBuffer, NULL);
+    vkFreeMemory(vulkan->device.device, stagingBufferMemory, NULL);
+    freeTexturePixels(&pixels);
+}
+
+int main(void) {
+    Vulkan vulkan = initialise();
+
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(vulkan.device.physicalDevice, &properties);
+    printf("%s\n", properties.deviceName);
+
+    VkQueryPoolCreateInfo queryPoolInfo = {
+        .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+        .queryType = VK_QUERY_TYPE_TIMESTAMP,
+        .queryCount = 2,
+    };
+    VkQueryPool queryPool;
+    vkCreateQueryPool(vulkan.device.device, &queryPoolInfo, NULL, &queryPool);
+
+    for (uint32_t i = 0; i < sizeof(textures) / sizeof(*textures); i++) {
+        benchTexture(&vulkan, queryPool, textures[i]);
+    }
+
+    vkDestroyQueryPool(vulkan.device.device, queryPool, NULL);
+
+    terminate(&vulkan);
+
+    return 0;
+}
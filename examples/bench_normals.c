@@ -0,0 +1,142 @@
+#include "geometry/geometry.h"
+#include "geometry/mesh/mesh.h"
+#include "geometry/normals/normals.h"
+#include "geometry/shpere/sphere.h"
+#include "utility/job.h"
+#include <cglm/vec3.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vulkan/vulkan.h>
+
+// smooth normals for a mesh given on the command line, or a bumpy million
+// triangle sphere without one, against a plain loop over the vertices, on
+// one thread and then on every core
+
+#define TESSELLATION 708
+
+static double elapsedMs(const struct timespec *start) {
+    struct timespec end;
+    timespec_get(&end, TIME_UTC);
+    return (end.tv_sec - start->tv_sec) * 1e3 +
+           (end.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+// displaced by position alone, so vertices split on the uv seam stay together
+static void makeBumpySphere(Shape *shape) {
+    makeSphere(shape, TESSELLATION, TESSELLATION, 1.0f);
+    shape->graphicsPipeline.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    shape->indexed = true;
+
+    for (uint32_t i = 0; i < shape->verticesCount; i++) {
+        float *pos = shape->vertices[i].pos;
+        float bump = 1.0f + 0.05f * sinf(8.0f * pos[0]) * cosf(6.0f * pos[1]);
+        for (uint32_t k = 0; k < 3; k++) {
+            pos[k] *= bump;
+        }
+    }
+}
+
+// area weighted, scattered straight into the vertices
+static void plainNormals(Shape *shape) {
+    for (uint32_t i = 0; i < shape->verticesCount; i++) {
+        glm_vec3_zero(shape->vertices[i].normal);
+    }
+
+    for (uint32_t i = 0; i + 2 < shape->indicesCount; i += 3) {
+        const uint32_t *triangle = &shape->indices[i];
+
+        vec3 e1, e2, normal;
+        glm_vec3_sub(shape->vertices[triangle[1]].pos,
+                     shape->vertices[triangle[0]].pos, e1);
+        glm_vec3_sub(shape->vertices[triangle[2]].pos,
+                     shape->vertices[triangle[0]].pos, e2);
+        glm_vec3_cross(e1, e2, normal);
+
+        for (uint32_t k = 0; k < 3; k++) {
+            glm_vec3_add(shape->vertices[triangle[k]].normal, normal,
+                         shape->vertices[triangle[k]].normal);
+        }
+    }
+
+    for (uint32_t i = 0; i < shape->verticesCount; i++) {
+        glm_vec3_normalize(shape->vertices[i].normal);
+    }
+}
+
+// largest angle in degrees between the shape's normals and the reference,
+// past vertices with no faces of any area like the sphere's poles
+static float largestDifference(const Shape *shape, const vec3 *reference) {
+    float smallest = 1.0f;
+    for (uint32_t i = 0; i < shape->verticesCount; i++) {
+        if (glm_vec3_norm2((float *)reference[i]) == 0.0f) {
+            continue;
+        }
+        float cosine = glm_vec3_dot(shape->vertices[i].normal,
+                                    (float *)reference[i]);
+        smallest = cosine < smallest ? cosine : smallest;
+    }
+    return acosf(smallest > -1.0f ? smallest : -1.0f) * 180.0f / GLM_PIf;
+}
+
+static void report(const char *name, double ms, const Shape *shape,
+                   const vec3 *reference) {
+    printf("%-26s %8.1f ms | %6.1f M triangles/s | off by %.3f degrees\n",
+           name, ms, shape->indicesCount / 3 / ms / 1e3,
+           largestDifference(shape, reference));
+}
+
+static void benchWeighting(Shape *shape, NormalWeighting weighting,
+                           const char *name, const vec3 *reference) {
+    struct timespec start;
+    timespec_get(&start, TIME_UTC);
+    generateNormals(shape, weighting, NULL);
+    report(name, elapsedMs(&start), shape, reference);
+}
+
+int main(int argc, char **argv) {
+    Shape shape = {0};
+    if (argc > 1) {
+        loadMesh(&shape, argv[1]);
+    } else {
+        makeBumpySphere(&shape);
+    }
+
+    printf("input %u triangles, %u vertices\n", shape.indicesCount / 3,
+           shape.verticesCount);
+
+    struct timespec start;
+    timespec_get(&start, TIME_UTC);
+    plainNormals(&shape);
+    double plainMs = elapsedMs(&start);
+
+    vec3 *reference = malloc(shape.verticesCount * sizeof(*reference));
+    for (uint32_t i = 0; i < shape.verticesCount; i++) {
+        glm_vec3_copy(shape.vertices[i].normal, reference[i]);
+    }
+    report("plain loop", plainMs, &shape, reference);
+
+    // without a job system every pass runs on the calling thread
+    benchWeighting(&shape, NORMALS_AREA_WEIGHTED, "area, one thread",
+                   reference);
+    benchWeighting(&shape, NORMALS_ANGLE_WEIGHTED, "angle, one thread",
+                   reference);
+
+    startJobSystem(0, 0);
+    printf("%u workers and the main thread\n", jobWorkersCount());
+
+    benchWeighting(&shape, NORMALS_AREA_WEIGHTED, "area, every core",
+                   reference);
+    benchWeighting(&shape, NORMALS_ANGLE_WEIGHTED, "angle, every core",
+                   reference);
+
+    stopJobSystem();
+
+    free(shape.vertices);
+    free(shape.indices);
+    free(reference);
+
+    return 0;
+}
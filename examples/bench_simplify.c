@@ -0,0 +1,96 @@
+#include "geometry/geometry.h"
+#include "geometry/lod/lod.h"
+#include "geometry/optimise/optimise.h"
+#include "geometry/shpere/sphere.h"
+#include "geometry/simplify/simplify.h"
+#include "utility/job.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vulkan/vulkan.h>
+
+// simplifies a bumpy million triangle sphere one level at a time, then builds
+// the whole chain with a job per level
+
+#define TESSELLATION 708
+
+static double elapsedMs(const struct timespec *start) {
+    struct timespec end;
+    timespec_get(&end, TIME_UTC);
+    return (end.tv_sec - start->tv_sec) * 1e3 +
+           (end.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+// displaced by position alone, so vertices split on the uv seam stay together
+static void makeBumpySphere(Shape *shape) {
+    makeSphere(shape, TESSELLATION, TESSELLATION, 1.0f);
+    shape->graphicsPipeline.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    shape->indexed = true;
+
+    for (uint32_t i = 0; i < shape->verticesCount; i++) {
+        float *pos = shape->vertices[i].pos;
+        float bump = 1.0f + 0.05f * sinf(8.0f * pos[0]) * cosf(6.0f * pos[1]);
+        for (uint32_t k = 0; k < 3; k++) {
+            pos[k] *= bump;
+        }
+    }
+}
+
+int main(void) {
+    startJobSystem(0, 0);
+
+    Shape shape = {0};
+    makeBumpySphere(&shape);
+
+    printf("input %u triangles, %u vertices\n", shape.indicesCount / 3,
+           shape.verticesCount);
+
+    uint32_t *indices = malloc(shape.indicesCount * sizeof(*indices));
+    double serialMs = 0.0;
+
+    for (uint32_t i = 1; i < LOD_MAX_LEVELS; i++) {
+        uint32_t targetTriangles = shape.indicesCount / 3 >> i;
+        if (targetTriangles < LOD_MIN_TRIANGLES) {
+            break;
+        }
+
+        float error;
+        struct timespec start;
+        timespec_get(&start, TIME_UTC);
+        uint32_t indicesCount =
+            simplify(indices, shape.indices, shape.indicesCount,
+                     shape.vertices, shape.verticesCount,
+                     targetTriangles * 3, INFINITY, &error);
+        double ms = elapsedMs(&start);
+        serialMs += ms;
+
+        printf("level %u | target %8u triangles | got %8u | error %.5f | "
+               "%8.1f ms\n",
+               i, targetTriangles, indicesCount / 3, error, ms);
+    }
+
+    struct timespec start;
+    timespec_get(&start, TIME_UTC);
+    makeSimplifiedLodChain(&shape, 0);
+    double chainMs = elapsedMs(&start);
+
+    printf("levels one after another %.1f ms | chain of jobs with cache "
+           "optimisation %.1f ms, %u levels\n",
+           serialMs, chainMs, shape.lodCount);
+
+    for (uint32_t i = 0; i < shape.lodCount; i++) {
+        printf("lod %u | %8u triangles | error %.5f\n", i,
+               shape.lods[i].indicesCount / 3, shape.lods[i].error);
+    }
+
+    free(shape.vertices);
+    free(shape.indices);
+    free(shape.lods);
+    free(indices);
+
+    stopJobSystem();
+
+    return 0;
+}
@@ -0,0 +1,84 @@
+#include "geometry/geometry.h"
+#include "geometry/optimise/optimise.h"
+#include "geometry/optimise/strip.h"
+#include "geometry/shpere/sphere.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// compares cache optimised triangle lists against restart separated strips
+// of the same order, for increasingly tessellated spheres
+
+static double elapsedMs(const struct timespec *start) {
+    struct timespec end;
+    timespec_get(&end, TIME_UTC);
+    return (end.tv_sec - start->tv_sec) * 1e3 +
+           (end.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+static void benchSphere(uint32_t sectors, uint32_t stacks) {
+    Shape shape = {0};
+    makeSphere(&shape, sectors, stacks, 1.0f);
+
+    optimiseVertexCache(shape.indices, shape.indicesCount,
+                        shape.verticesCount);
+    optimiseVertexFetch(&shape);
+
+    uint32_t *strip = malloc(STRIP_BOUND(shape.indicesCount) * sizeof(*strip));
+
+    struct timespec start;
+    timespec_get(&start, TIME_UTC);
+    uint32_t stripCount = stripify(strip, shape.indices, shape.indicesCount,
+                                   shape.verticesCount);
+    double stripMs = elapsedMs(&start);
+
+    uint32_t restarts = 0;
+    for (uint32_t i = 0; i < stripCount; i++) {
+        restarts += strip[i] == STRIP_RESTART_INDEX;
+    }
+
+    // the triangles the strip actually rasterises, in the order it does
+    uint32_t *list = malloc(stripCount * 3 * sizeof(*list));
+    uint32_t listCount = unstripify(list, strip, stripCount);
+
+    VertexCacheStats listStats =
+        analyseVertexCache(shape.indices, shape.indicesCount,
+                           shape.verticesCount, VERTEX_CACHE_SIZE);
+    VertexCacheStats stripStats = analyseVertexCache(
+        list, listCount, shape.verticesCount, VERTEX_CACHE_SIZE);
+
+    // 0xffff is the restart index, so strips narrow one vertex earlier
+    uint32_t listIndexSize = shape.verticesCount > UINT16_MAX + 1 ? 4 : 2;
+    uint32_t stripIndexSize = shape.verticesCount > UINT16_MAX ? 4 : 2;
+
+    printf("%7u triangles | list %8u indices %9u bytes acmr %.3f | strip "
+           "%8u indices %9u bytes acmr %.3f %6u strips %7.2f ms | %.1f%%\n",
+           shape.indicesCount / 3, shape.indicesCount,
+           shape.indicesCount * listIndexSize, listStats.acmr, stripCount,
+           stripCount * stripIndexSize, stripStats.acmr, restarts + 1,
+           stripMs,
+           100.0 * stripCount * stripIndexSize /
+               (shape.indicesCount * listIndexSize));
+
+    if (listCount != shape.indicesCount) {
+        printf("strip lost triangles: %u of %u indices\n", listCount,
+               shape.indicesCount);
+    }
+
+    free(shape.vertices);
+    free(shape.indices);
+    free(strip);
+    free(list);
+}
+
+int main(void) {
+    const uint32_t tessellations[] = {40, 64, 128, 180, 256, 512};
+
+    for (uint32_t i = 0; i < sizeof(tessellations) / sizeof(*tessellations);
+         i++) {
+        benchSphere(tessellations[i], tessellations[i]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,24 @@
+#ifndef INCLUDE_GEOMETRY_BAKED_BAKED
+#define INCLUDE_GEOMETRY_BAKED_BAKED
+
+#include <stdbool.h>
+
+typedef unsigned int uint32_t;
+typedef struct Shape Shape;
+typedef struct Vertex Vertex;
+typedef struct ShapeParameters ShapeParameters;
+typedef enum ShapeType ShapeType;
+
+// a parametric shape generated at build time by tools/bake_meshes.c, see the
+// bake_meshes make target
+typedef struct BakedMesh {
+    const ShapeParameters *parameters;
+    const Vertex *vertices;
+    uint32_t verticesCount;
+    const uint32_t *indices;
+    uint32_t indicesCount;
+} BakedMesh;
+
+bool copyBakedMesh(Shape *, ShapeType, const ShapeParameters *);
+
+#endif /* INCLUDE_GEOMETRY_BAKED_BAKED */
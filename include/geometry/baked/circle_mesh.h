@@ -0,0 +1,162 @@
+#ifndef INCLUDE_GEOMETRY_BAKED_CIRCLE_MESH
+#define INCLUDE_GEOMETRY_BAKED_CIRCLE_MESH
+
+// generated by tools/bake_meshes.c, do not edit
+
+#include "geometry/geometry.h"
+
+static const ShapeParameters BAKED_CIRCLE_PARAMETERS = {
+    .detail = {40, 0},
+    .radius = 2.0,
+};
+
+static const Vertex BAKED_CIRCLE_VERTICES[] = {
+    {{-8.74227766e-08, -0.0, 0.0}, {1.0, 1.0, 1.0}, {-2.18556941e-08, -0.0, 0.0}, {0.0, 0.0}},
+    {{-8.63464535e-08, -1.36759359e-08, 0.0}, {1.0, 1.0, 1.0}, {-2.15866134e-08, -3.41898398e-09, 0.0}, {0.0, 0.0250000004}},
+    {{-8.31440019e-08, -2.70151244e-08, 0.0}, {1.0, 1.0, 1.0}, {-2.07860005e-08, -6.75378109e-09, 0.0}, {0.0, 0.0500000007}},
+    {{-7.78942635e-08, -3.96891124e-08, 0.0}, {1.0, 1.0, 1.0}, {-1.94735659e-08, -9.92227811e-09, 0.0}, {0.0, 0.075000003}},
+    {{-7.07265144e-08, -5.13858183e-08, 0.0}, {1.0, 1.0, 1.0}, {-1.76816286e-08, -1.28464546e-08, 0.0}, {0.0, 0.100000001}},
+    {{-6.18172393e-08, -6.18172393e-08, 0.0}, {1.0, 1.0, 1.0}, {-1.54543098e-08, -1.54543098e-08, 0.0}, {0.0, 0.125}},
+    {{-5.13858183e-08, -7.07265144e-08, 0.0}, {1.0, 1.0, 1.0}, {-1.28464546e-08, -1.76816286e-08, 0.0}, {0.0, 0.150000006}},
+    {{-3.96891124e-08, -7.78942635e-08, 0.0}, {1.0, 1.0, 1.0}, {-9.92227811e-09, -1.94735659e-08, 0.0}, {0.0, 0.174999997}},
+    {{-2.70151208e-08, -8.31440019e-08, 0.0}, {1.0, 1.0, 1.0}, {-6.7537802e-09, -2.07860005e-08, 0.0}, {0.0, 0.200000003}},
+    {{-1.36759271e-08, -8.63464606e-08, 0.0}, {1.0, 1.0, 1.0}, {-3.41898176e-09, -2.15866152e-08, 0.0}, {0.0, 0.224999994}},
+    {{3.82137093e-15, -8.74227766e-08, 0.0}, {1.0, 1.0, 1.0}, {9.55342733e-16, -2.18556941e-08, 0.0}, {0.0, 0.25}},
+    {{1.36759342e-08, -8.63464606e-08, 0.0}, {1.0, 1.0, 1.0}, {3.41898354e-09, -2.15866152e-08, 0.0}, {0.0, 0.275000006}},
+    {{2.70151279e-08, -8.31440019e-08, 0.0}, {1.0, 1.0, 1.0}, {6.75378198e-09, -2.07860005e-08, 0.0}, {0.0, 0.300000012}},
+    {{3.96891195e-08, -7.78942564e-08, 0.0}, {1.0, 1.0, 1.0}, {9.92227989e-09, -1.94735641e-08, 0.0}, {0.0, 0.324999988}},
+    {{5.13858147e-08, -7.07265144e-08, 0.0}, {1.0, 1.0, 1.0}, {1.28464537e-08, -1.76816286e-08, 0.0}, {0.0, 0.349999994}},
+    {{6.18172393e-08, -6.18172393e-08, 0.0}, {1.0, 1.0, 1.0}, {1.54543098e-08, -1.54543098e-08, 0.0}, {0.0, 0.375}},
+    {{7.07265144e-08, -5.13858147e-08, 0.0}, {1.0, 1.0, 1.0}, {1.76816286e-08, -1.28464537e-08, 0.0}, {0.0, 0.400000006}},
+    {{7.78942706e-08, -3.96890982e-08, 0.0}, {1.0, 1.0, 1.0}, {1.94735676e-08, -9.92227456e-09, 0.0}, {0.0, 0.425000012}},
+    {{8.3144009e-08, -2.70151066e-08, 0.0}, {1.0, 1.0, 1.0}, {2.07860023e-08, -6.75377665e-09, 0.0}, {0.0, 0.449999988}},
+    {{8.63464606e-08, -1.36759333e-08, 0.0}, {1.0, 1.0, 1.0}, {2.15866152e-08, -3.41898332e-09, 0.0}, {0.0, 0.474999994}},
+    {{8.74227766e-08, 7.64274186e-15, 0.0}, {1.0, 1.0, 1.0}, {2.18556941e-08, 1.91068547e-15, 0.0}, {0.0, 0.5}},
+    {{8.63464535e-08, 1.36759484e-08, 0.0}, {1.0, 1.0, 1.0}, {2.15866134e-08, 3.41898709e-09, 0.0}, {0.0, 0.524999976}},
+    {{8.31440019e-08, 2.70151226e-08, 0.0}, {1.0, 1.0, 1.0}, {2.07860005e-08, 6.75378065e-09, 0.0}, {0.0, 0.550000012}},
+    {{7.78942635e-08, 3.96891124e-08, 0.0}, {1.0, 1.0, 1.0}, {1.94735659e-08, 9.92227811e-09, 0.0}, {0.0, 0.574999988}},
+    {{7.07265073e-08, 5.13858254e-08, 0.0}, {1.0, 1.0, 1.0}, {1.76816268e-08, 1.28464563e-08, 0.0}, {0.0, 0.600000024}},
+    {{6.18172251e-08, 6.18172464e-08, 0.0}, {1.0, 1.0, 1.0}, {1.54543063e-08, 1.54543116e-08, 0.0}, {0.0, 0.625}},
+    {{5.13858041e-08, 7.07265215e-08, 0.0}, {1.0, 1.0, 1.0}, {1.2846451e-08, 1.76816304e-08, 0.0}, {0.0, 0.649999976}},
+    {{3.96890876e-08, 7.78942777e-08, 0.0}, {1.0, 1.0, 1.0}, {9.92227189e-09, 1.94735694e-08, 0.0}, {0.0, 0.675000012}},
+    {{2.70151332e-08, 8.31439948e-08, 0.0}, {1.0, 1.0, 1.0}, {6.75378331e-09, 2.07859987e-08, 0.0}, {0.0, 0.699999988}},
+    {{1.36759395e-08, 8.63464535e-08, 0.0}, {1.0, 1.0, 1.0}, {3.41898487e-09, 2.15866134e-08, 0.0}, {0.0, 0.725000024}},
+    {{-1.04250613e-15, 8.74227766e-08, 0.0}, {1.0, 1.0, 1.0}, {-2.60626532e-16, 2.18556941e-08, 0.0}, {0.0, 0.75}},
+    {{-1.36759422e-08, 8.63464535e-08, 0.0}, {1.0, 1.0, 1.0}, {-3.41898554e-09, 2.15866134e-08, 0.0}, {0.0, 0.774999976}},
+    {{-2.7015135e-08, 8.31439948e-08, 0.0}, {1.0, 1.0, 1.0}, {-6.75378375e-09, 2.07859987e-08, 0.0}, {0.0, 0.800000012}},
+    {{-3.96891267e-08, 7.78942564e-08, 0.0}, {1.0, 1.0, 1.0}, {-9.92228166e-09, 1.94735641e-08, 0.0}, {0.0, 0.824999988}},
+    {{-5.1385836e-08, 7.07265002e-08, 0.0}, {1.0, 1.0, 1.0}, {-1.2846459e-08, 1.76816251e-08, 0.0}, {0.0, 0.850000024}},
+    {{-6.18172606e-08, 6.1817218e-08, 0.0}, {1.0, 1.0, 1.0}, {-1.54543152e-08, 1.54543045e-08, 0.0}, {0.0, 0.875}},
+    {{-7.07265357e-08, 5.13857898e-08, 0.0}, {1.0, 1.0, 1.0}, {-1.76816339e-08, 1.28464475e-08, 0.0}, {0.0, 0.899999976}},
+    {{-7.78942635e-08, 3.96891124e-08, 0.0}, {1.0, 1.0, 1.0}, {-1.94735659e-08, 9.92227811e-09, 0.0}, {0.0, 0.925000012}},
+    {{-8.31440019e-08, 2.7015119e-08, 0.0}, {1.0, 1.0, 1.0}, {-2.07860005e-08, 6.75377976e-09, 0.0}, {0.0, 0.949999988}},
+    {{-8.63464606e-08, 1.36759253e-08, 0.0}, {1.0, 1.0, 1.0}, {-2.15866152e-08, 3.41898132e-09, 0.0}, {0.0, 0.975000024}},
+    {{-8.74227766e-08, -1.52854837e-14, 0.0}, {1.0, 1.0, 1.0}, {-2.18556941e-08, -3.82137093e-15, 0.0}, {0.0, 1.0}},
+    {{2.0, 0.0, 0.0}, {1.0, 1.0, 1.0}, {0.5, 0.0, 0.0}, {0.5, 0.0}},
+    {{1.97537673, 0.312868953, 0.0}, {1.0, 1.0, 1.0}, {0.493844181, 0.0782172382, 0.0}, {0.5, 0.0250000004}},
+    {{1.90211308, 0.618034005, 0.0}, {1.0, 1.0, 1.0}, {0.47552827, 0.154508501, 0.0}, {0.5, 0.0500000007}},
+    {{1.78201306, 0.907981038, 0.0}, {1.0, 1.0, 1.0}, {0.445503265, 0.22699526, 0.0}, {0.5, 0.075000003}},
+    {{1.61803401, 1.17557049, 0.0}, {1.0, 1.0, 1.0}, {0.404508501, 0.293892622, 0.0}, {0.5, 0.100000001}},
+    {{1.41421354, 1.41421354, 0.0}, {1.0, 1.0, 1.0}, {0.353553385, 0.353553385, 0.0}, {0.5, 0.125}},
+    {{1.17557049, 1.61803401, 0.0}, {1.0, 1.0, 1.0}, {0.293892622, 0.404508501, 0.0}, {0.5, 0.150000006}},
+    {{0.907981038, 1.78201306, 0.0}, {1.0, 1.0, 1.0}, {0.22699526, 0.445503265, 0.0}, {0.5, 0.174999997}},
+    {{0.618033946, 1.90211308, 0.0}, {1.0, 1.0, 1.0}, {0.154508486, 0.47552827, 0.0}, {0.5, 0.200000003}},
+    {{0.312868744, 1.97537673, 0.0}, {1.0, 1.0, 1.0}, {0.078217186, 0.493844181, 0.0}, {0.5, 0.224999994}},
+    {{-8.74227766e-08, 2.0, 0.0}, {1.0, 1.0, 1.0}, {-2.18556941e-08, 0.5, 0.0}, {0.5, 0.25}},
+    {{-0.312868893, 1.97537673, 0.0}, {1.0, 1.0, 1.0}, {-0.0782172233, 0.493844181, 0.0}, {0.5, 0.275000006}},
+    {{-0.618034065, 1.90211296, 0.0}, {1.0, 1.0, 1.0}, {-0.154508516, 0.47552824, 0.0}, {0.5, 0.300000012}},
+    {{-0.907981217, 1.78201294, 0.0}, {1.0, 1.0, 1.0}, {-0.226995304, 0.445503235, 0.0}, {0.5, 0.324999988}},
+    {{-1.17557037, 1.61803401, 0.0}, {1.0, 1.0, 1.0}, {-0.293892592, 0.404508501, 0.0}, {0.5, 0.349999994}},
+    {{-1.41421354, 1.41421354, 0.0}, {1.0, 1.0, 1.0}, {-0.353553385, 0.353553385, 0.0}, {0.5, 0.375}},
+    {{-1.61803412, 1.17557037, 0.0}, {1.0, 1.0, 1.0}, {-0.404508531, 0.293892592, 0.0}, {0.5, 0.400000006}},
+    {{-1.78201318, 0.90798074, 0.0}, {1.0, 1.0, 1.0}, {-0.445503294, 0.226995185, 0.0}, {0.5, 0.425000012}},
+    {{-1.9021132, 0.618033588, 0.0}, {1.0, 1.0, 1.0}, {-0.4755283, 0.154508397, 0.0}, {0.5, 0.449999988}},
+    {{-1.97537673, 0.312868893, 0.0}, {1.0, 1.0, 1.0}, {-0.493844181, 0.0782172233, 0.0}, {0.5, 0.474999994}},
+    {{-2.0, -1.74845553e-07, 0.0}, {1.0, 1.0, 1.0}, {-0.5, -4.37113883e-08, 0.0}, {0.5, 0.5}},
+    {{-1.97537661, -0.312869221, 0.0}, {1.0, 1.0, 1.0}, {-0.493844151, -0.0782173052, 0.0}, {0.5, 0.524999976}},
+    {{-1.90211308, -0.618033946, 0.0}, {1.0, 1.0, 1.0}, {-0.47552827, -0.154508486, 0.0}, {0.5, 0.550000012}},
+    {{-1.78201306, -0.907981098, 0.0}, {1.0, 1.0, 1.0}, {-0.445503265, -0.226995274, 0.0}, {0.5, 0.574999988}},
+    {{-1.61803389, -1.17557073, 0.0}, {1.0, 1.0, 1.0}, {-0.404508471, -0.293892682, 0.0}, {0.5, 0.600000024}},
+    {{-1.4142133, -1.41421378, 0.0}, {1.0, 1.0, 1.0}, {-0.353553325, -0.353553444, 0.0}, {0.5, 0.625}},
+    {{-1.17557013, -1.61803424, 0.0}, {1.0, 1.0, 1.0}, {-0.293892533, -0.404508561, 0.0}, {0.5, 0.649999976}},
+    {{-0.907980442, -1.7820133, 0.0}, {1.0, 1.0, 1.0}, {-0.226995111, -0.445503324, 0.0}, {0.5, 0.675000012}},
+    {{-0.618034184, -1.90211296, 0.0}, {1.0, 1.0, 1.0}, {-0.154508546, -0.47552824, 0.0}, {0.5, 0.699999988}},
+    {{-0.312869042, -1.97537661, 0.0}, {1.0, 1.0, 1.0}, {-0.0782172605, -0.493844151, 0.0}, {0.5, 0.725000024}},
+    {{2.38497613e-08, -2.0, 0.0}, {1.0, 1.0, 1.0}, {5.96244032e-09, -0.5, 0.0}, {0.5, 0.75}},
+    {{0.312869072, -1.97537661, 0.0}, {1.0, 1.0, 1.0}, {0.078217268, -0.493844151, 0.0}, {0.5, 0.774999976}},
+    {{0.618034244, -1.90211296, 0.0}, {1.0, 1.0, 1.0}, {0.154508561, -0.47552824, 0.0}, {0.5, 0.800000012}},
+    {{0.907981336, -1.78201282, 0.0}, {1.0, 1.0, 1.0}, {0.226995334, -0.445503205, 0.0}, {0.5, 0.824999988}},
+    {{1.17557096, -1.61803365, 0.0}, {1.0, 1.0, 1.0}, {0.293892741, -0.404508412, 0.0}, {0.5, 0.850000024}},
+    {{1.41421402, -1.41421306, 0.0}, {1.0, 1.0, 1.0}, {0.353553504, -0.353553265, 0.0}, {0.5, 0.875}},
+    {{1.61803448, -1.17556989, 0.0}, {1.0, 1.0, 1.0}, {0.404508621, -0.293892473, 0.0}, {0.5, 0.899999976}},
+    {{1.78201306, -0.907981038, 0.0}, {1.0, 1.0, 1.0}, {0.445503265, -0.22699526, 0.0}, {0.5, 0.925000012}},
+    {{1.90211308, -0.618033886, 0.0}, {1.0, 1.0, 1.0}, {0.47552827, -0.154508471, 0.0}, {0.5, 0.949999988}},
+    {{1.97537673, -0.312868714, 0.0}, {1.0, 1.0, 1.0}, {0.493844181, -0.0782171786, 0.0}, {0.5, 0.975000024}},
+    {{2.0, 3.49691106e-07, 0.0}, {1.0, 1.0, 1.0}, {0.5, 8.74227766e-08, 0.0}, {0.5, 1.0}},
+    {{-8.74227766e-08, -0.0, 0.0}, {1.0, 1.0, 1.0}, {-2.18556941e-08, -0.0, 0.0}, {1.0, 0.0}},
+    {{-8.63464535e-08, -1.36759359e-08, 0.0}, {1.0, 1.0, 1.0}, {-2.15866134e-08, -3.41898398e-09, 0.0}, {1.0, 0.0250000004}},
+    {{-8.31440019e-08, -2.70151244e-08, 0.0}, {1.0, 1.0, 1.0}, {-2.07860005e-08, -6.75378109e-09, 0.0}, {1.0, 0.0500000007}},
+    {{-7.78942635e-08, -3.96891124e-08, 0.0}, {1.0, 1.0, 1.0}, {-1.94735659e-08, -9.92227811e-09, 0.0}, {1.0, 0.075000003}},
+    {{-7.07265144e-08, -5.13858183e-08, 0.0}, {1.0, 1.0, 1.0}, {-1.76816286e-08, -1.28464546e-08, 0.0}, {1.0, 0.100000001}},
+    {{-6.18172393e-08, -6.18172393e-08, 0.0}, {1.0, 1.0, 1.0}, {-1.54543098e-08, -1.54543098e-08, 0.0}, {1.0, 0.125}},
+    {{-5.13858183e-08, -7.07265144e-08, 0.0}, {1.0, 1.0, 1.0}, {-1.28464546e-08, -1.76816286e-08, 0.0}, {1.0, 0.150000006}},
+    {{-3.96891124e-08, -7.78942635e-08, 0.0}, {1.0, 1.0, 1.0}, {-9.92227811e-09, -1.94735659e-08, 0.0}, {1.0, 0.174999997}},
+    {{-2.70151208e-08, -8.31440019e-08, 0.0}, {1.0, 1.0, 1.0}, {-6.7537802e-09, -2.07860005e-08, 0.0}, {1.0, 0.200000003}},
+    {{-1.36759271e-08, -8.63464606e-08, 0.0}, {1.0, 1.0, 1.0}, {-3.41898176e-09, -2.15866152e-08, 0.0}, {1.0, 0.224999994}},
+    {{3.82137093e-15, -8.74227766e-08, 0.0}, {1.0, 1.0, 1.0}, {9.55342733e-16, -2.18556941e-08, 0.0}, {1.0, 0.25}},
+    {{1.36759342e-08, -8.63464606e-08, 0.0}, {1.0, 1.0, 1.0}, {3.41898354e-09, -2.15866152e-08, 0.0}, {1.0, 0.275000006}},
+    {{2.70151279e-08, -8.31440019e-08, 0.0}, {1.0, 1.0, 1.0}, {6.75378198e-09, -2.07860005e-08, 0.0}, {1.0, 0.300000012}},
+    {{3.96891195e-08, -7.78942564e-08, 0.0}, {1.0, 1.0, 1.0}, {9.92227989e-09, -1.94735641e-08, 0.0}, {1.0, 0.324999988}},
+    {{5.13858147e-08, -7.07265144e-08, 0.0}, {1.0, 1.0, 1.0}, {1.28464537e-08, -1.76816286e-08, 0.0}, {1.0, 0.349999994}},
+    {{6.18172393e-08, -6.18172393e-08, 0.0}, {1.0, 1.0, 1.0}, {1.54543098e-08, -1.54543098e-08, 0.0}, {1.0, 0.375}},
+    {{7.07265144e-08, -5.13858147e-08, 0.0}, {1.0, 1.0, 1.0}, {1.76816286e-08, -1.28464537e-08, 0.0}, {1.0, 0.400000006}},
+    {{7.78942706e-08, -3.96890982e-08, 0.0}, {1.0, 1.0, 1.0}, {1.94735676e-08, -9.92227456e-09, 0.0}, {1.0, 0.425000012}},
+    {{8.3144009e-08, -2.70151066e-08, 0.0}, {1.0, 1.0, 1.0}, {2.07860023e-08, -6.75377665e-09, 0.0}, {1.0, 0.449999988}},
+    {{8.63464606e-08, -1.36759333e-08, 0.0}, {1.0, 1.0, 1.0}, {2.15866152e-08, -3.41898332e-09, 0.0}, {1.0, 0.474999994}},
+    {{8.74227766e-08, 7.64274186e-15, 0.0}, {1.0, 1.0, 1.0}, {2.18556941e-08, 1.91068547e-15, 0.0}, {1.0, 0.5}},
+    {{8.63464535e-08, 1.36759484e-08, 0.0}, {1.0, 1.0, 1.0}, {2.15866134e-08, 3.41898709e-09, 0.0}, {1.0, 0.524999976}},
+    {{8.31440019e-08, 2.70151226e-08, 0.0}, {1.0, 1.0, 1.0}, {2.07860005e-08, 6.75378065e-09, 0.0}, {1.0, 0.550000012}},
+    {{7.78942635e-08, 3.96891124e-08, 0.0}, {1.0, 1.0, 1.0}, {1.94735659e-08, 9.92227811e-09, 0.0}, {1.0, 0.574999988}},
+    {{7.07265073e-08, 5.13858254e-08, 0.0}, {1.0, 1.0, 1.0}, {1.76816268e-08, 1.28464563e-08, 0.0}, {1.0, 0.600000024}},
+    {{6.18172251e-08, 6.18172464e-08, 0.0}, {1.0, 1.0, 1.0}, {1.54543063e-08, 1.54543116e-08, 0.0}, {1.0, 0.625}},
+    {{5.13858041e-08, 7.07265215e-08, 0.0}, {1.0, 1.0, 1.0}, {1.2846451e-08, 1.76816304e-08, 0.0}, {1.0, 0.649999976}},
+    {{3.96890876e-08, 7.78942777e-08, 0.0}, {1.0, 1.0, 1.0}, {9.92227189e-09, 1.94735694e-08, 0.0}, {1.0, 0.675000012}},
+    {{2.70151332e-08, 8.31439948e-08, 0.0}, {1.0, 1.0, 1.0}, {6.75378331e-09, 2.07859987e-08, 0.0}, {1.0, 0.699999988}},
+    {{1.36759395e-08, 8.63464535e-08, 0.0}, {1.0, 1.0, 1.0}, {3.41898487e-09, 2.15866134e-08, 0.0}, {1.0, 0.725000024}},
+    {{-1.04250613e-15, 8.74227766e-08, 0.0}, {1.0, 1.0, 1.0}, {-2.60626532e-16, 2.18556941e-08, 0.0}, {1.0, 0.75}},
+    {{-1.36759422e-08, 8.63464535e-08, 0.0}, {1.0, 1.0, 1.0}, {-3.41898554e-09, 2.15866134e-08, 0.0}, {1.0, 0.774999976}},
+    {{-2.7015135e-08, 8.31439948e-08, 0.0}, {1.0, 1.0, 1.0}, {-6.75378375e-09, 2.07859987e-08, 0.0}, {1.0, 0.800000012}},
+    {{-3.96891267e-08, 7.78942564e-08, 0.0}, {1.0, 1.0, 1.0}, {-9.92228166e-09, 1.94735641e-08, 0.0}, {1.0, 0.824999988}},
+    {{-5.1385836e-08, 7.07265002e-08, 0.0}, {1.0, 1.0, 1.0}, {-1.2846459e-08, 1.76816251e-08, 0.0}, {1.0, 0.850000024}},
+    {{-6.18172606e-08, 6.1817218e-08, 0.0}, {1.0, 1.0, 1.0}, {-1.54543152e-08, 1.54543045e-08, 0.0}, {1.0, 0.875}},
+    {{-7.07265357e-08, 5.13857898e-08, 0.0}, {1.0, 1.0, 1.0}, {-1.76816339e-08, 1.28464475e-08, 0.0}, {1.0, 0.899999976}},
+    {{-7.78942635e-08, 3.96891124e-08, 0.0}, {1.0, 1.0, 1.0}, {-1.94735659e-08, 9.92227811e-09, 0.0}, {1.0, 0.925000012}},
+    {{-8.31440019e-08, 2.7015119e-08, 0.0}, {1.0, 1.0, 1.0}, {-2.07860005e-08, 6.75377976e-09, 0.0}, {1.0, 0.949999988}},
+    {{-8.63464606e-08, 1.36759253e-08, 0.0}, {1.0, 1.0, 1.0}, {-2.15866152e-08, 3.41898132e-09, 0.0}, {1.0, 0.975000024}},
+    {{-8.74227766e-08, -1.52854837e-14, 0.0}, {1.0, 1.0, 1.0}, {-2.18556941e-08, -3.82137093e-15, 0.0}, {1.0, 1.0}},
+};
+
+static const uint32_t BAKED_CIRCLE_INDICES[] = {
+    1, 41, 42, 2, 42, 43, 3, 43, 44, 4, 44, 45,
+    5, 45, 46, 6, 46, 47, 7, 47, 48, 8, 48, 49,
+    9, 49, 50, 10, 50, 51, 11, 51, 52, 12, 52, 53,
+    13, 53, 54, 14, 54, 55, 15, 55, 56, 16, 56, 57,
+    17, 57, 58, 18, 58, 59, 19, 59, 60, 20, 60, 61,
+    21, 61, 62, 22, 62, 63, 23, 63, 64, 24, 64, 65,
+    25, 65, 66, 26, 66, 67, 27, 67, 68, 28, 68, 69,
+    29, 69, 70, 30, 70, 71, 31, 71, 72, 32, 72, 73,
+    33, 73, 74, 34, 74, 75, 35, 75, 76, 36, 76, 77,
+    37, 77, 78, 38, 78, 79, 39, 79, 80, 40, 80, 81,
+    41, 82, 42, 42, 83, 43, 43, 84, 44, 44, 85, 45,
+    45, 86, 46, 46, 87, 47, 47, 88, 48, 48, 89, 49,
+    49, 90, 50, 50, 91, 51, 51, 92, 52, 52, 93, 53,
+    53, 94, 54, 54, 95, 55, 55, 96, 56, 56, 97, 57,
+    57, 98, 58, 58, 99, 59, 59, 100, 60, 60, 101, 61,
+    61, 102, 62, 62, 103, 63, 63, 104, 64, 64, 105, 65,
+    65, 106, 66, 66, 107, 67, 67, 108, 68, 68, 109, 69,
+    69, 110, 70, 70, 111, 71, 71, 112, 72, 72, 113, 73,
+    73, 114, 74, 74, 115, 75, 75, 116, 76, 76, 117, 77,
+    77, 118, 78, 78, 119, 79, 79, 120, 80, 80, 121, 81,
+};
+
+#endif /* INCLUDE_GEOMETRY_BAKED_CIRCLE_MESH */
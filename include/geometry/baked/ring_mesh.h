@@ -0,0 +1,171 @@
+#ifndef INCLUDE_GEOMETRY_BAKED_RING_MESH
+#define INCLUDE_GEOMETRY_BAKED_RING_MESH
+
+// generated by tools/bake_meshes.c, do not edit
+
+#include "geometry/geometry.h"
+
+static const ShapeParameters BAKED_RING_PARAMETERS = {
+    .detail = {60, 0},
+    .radius = 2.0,
+};
+
+static const Vertex BAKED_RING_VERTICES[] = {
+    {{1.0, 0.0, 0.0}, {1.0, 1.0, 1.0}, {0.5, 0.0, 0.0}, {0.0, 0.0}},
+    {{0.499314755, 0.0261679795, 0.0}, {1.0, 1.0, 1.0}, {0.249657378, 0.0130839897, 0.0}, {1.0, 1.0}},
+    {{0.994521916, 0.104528464, 0.0}, {1.0, 1.0, 1.0}, {0.497260958, 0.0522642322, 0.0}, {0.0, 0.0}},
+    {{0.493844181, 0.0782172382, 0.0}, {1.0, 1.0, 1.0}, {0.246922091, 0.0391086191, 0.0}, {1.0, 1.0}},
+    {{0.978147626, 0.2079117, 0.0}, {1.0, 1.0, 1.0}, {0.489073813, 0.10395585, 0.0}, {0.0, 0.0}},
+    {{0.482962906, 0.129409522, 0.0}, {1.0, 1.0, 1.0}, {0.241481453, 0.0647047609, 0.0}, {1.0, 1.0}},
+    {{0.95105654, 0.309017003, 0.0}, {1.0, 1.0, 1.0}, {0.47552827, 0.154508501, 0.0}, {0.0, 0.0}},
+    {{0.466790199, 0.179183975, 0.0}, {1.0, 1.0, 1.0}, {0.2333951, 0.0895919874, 0.0}, {1.0, 1.0}},
+    {{0.91354543, 0.406736642, 0.0}, {1.0, 1.0, 1.0}, {0.456772715, 0.203368321, 0.0}, {0.0, 0.0}},
+    {{0.445503265, 0.22699526, 0.0}, {1.0, 1.0, 1.0}, {0.222751632, 0.11349763, 0.0}, {1.0, 1.0}},
+    {{0.866025388, 0.5, 0.0}, {1.0, 1.0, 1.0}, {0.433012694, 0.25, 0.0}, {0.0, 0.0}},
+    {{0.419335276, 0.272319525, 0.0}, {1.0, 1.0, 1.0}, {0.209667638, 0.136159763, 0.0}, {1.0, 1.0}},
+    {{0.809017003, 0.587785244, 0.0}, {1.0, 1.0, 1.0}, {0.404508501, 0.293892622, 0.0}, {0.0, 0.0}},
+    {{0.388572961, 0.314660192, 0.0}, {1.0, 1.0, 1.0}, {0.194286481, 0.157330096, 0.0}, {1.0, 1.0}},
+    {{0.74314481, 0.669130623, 0.0}, {1.0, 1.0, 1.0}, {0.371572405, 0.334565312, 0.0}, {0.0, 0.0}},
+    {{0.353553385, 0.353553385, 0.0}, {1.0, 1.0, 1.0}, {0.176776692, 0.176776692, 0.0}, {1.0, 1.0}},
+    {{0.669130564, 0.74314487, 0.0}, {1.0, 1.0, 1.0}, {0.334565282, 0.371572435, 0.0}, {0.0, 0.0}},
+    {{0.314660162, 0.388573021, 0.0}, {1.0, 1.0, 1.0}, {0.157330081, 0.19428651, 0.0}, {1.0, 1.0}},
+    {{0.587785244, 0.809017003, 0.0}, {1.0, 1.0, 1.0}, {0.293892622, 0.404508501, 0.0}, {0.0, 0.0}},
+    {{0.272319496, 0.419335306, 0.0}, {1.0, 1.0, 1.0}, {0.136159748, 0.209667653, 0.0}, {1.0, 1.0}},
+    {{0.49999997, 0.866025448, 0.0}, {1.0, 1.0, 1.0}, {0.249999985, 0.433012724, 0.0}, {0.0, 0.0}},
+    {{0.226995215, 0.445503294, 0.0}, {1.0, 1.0, 1.0}, {0.113497607, 0.222751647, 0.0}, {1.0, 1.0}},
+    {{0.406736612, 0.913545489, 0.0}, {1.0, 1.0, 1.0}, {0.203368306, 0.456772745, 0.0}, {0.0, 0.0}},
+    {{0.17918399, 0.466790199, 0.0}, {1.0, 1.0, 1.0}, {0.0895919949, 0.2333951, 0.0}, {1.0, 1.0}},
+    {{0.309016973, 0.95105654, 0.0}, {1.0, 1.0, 1.0}, {0.154508486, 0.47552827, 0.0}, {0.0, 0.0}},
+    {{0.129409477, 0.482962936, 0.0}, {1.0, 1.0, 1.0}, {0.0647047386, 0.241481468, 0.0}, {1.0, 1.0}},
+    {{0.207911655, 0.978147626, 0.0}, {1.0, 1.0, 1.0}, {0.103955828, 0.489073813, 0.0}, {0.0, 0.0}},
+    {{0.0782172456, 0.493844181, 0.0}, {1.0, 1.0, 1.0}, {0.0391086228, 0.246922091, 0.0}, {1.0, 1.0}},
+    {{0.10452842, 0.994521916, 0.0}, {1.0, 1.0, 1.0}, {0.0522642098, 0.497260958, 0.0}, {0.0, 0.0}},
+    {{0.0261679273, 0.499314755, 0.0}, {1.0, 1.0, 1.0}, {0.0130839637, 0.249657378, 0.0}, {1.0, 1.0}},
+    {{-4.37113883e-08, 1.0, 0.0}, {1.0, 1.0, 1.0}, {-2.18556941e-08, 0.5, 0.0}, {0.0, 0.0}},
+    {{-0.0261679702, 0.499314755, 0.0}, {1.0, 1.0, 1.0}, {-0.0130839851, 0.249657378, 0.0}, {1.0, 1.0}},
+    {{-0.104528509, 0.994521916, 0.0}, {1.0, 1.0, 1.0}, {-0.0522642545, 0.497260958, 0.0}, {0.0, 0.0}},
+    {{-0.0782172233, 0.493844181, 0.0}, {1.0, 1.0, 1.0}, {-0.0391086116, 0.246922091, 0.0}, {1.0, 1.0}},
+    {{-0.207911849, 0.978147566, 0.0}, {1.0, 1.0, 1.0}, {-0.103955925, 0.489073783, 0.0}, {0.0, 0.0}},
+    {{-0.129409581, 0.482962906, 0.0}, {1.0, 1.0, 1.0}, {-0.0647047907, 0.241481453, 0.0}, {1.0, 1.0}},
+    {{-0.309017032, 0.95105648, 0.0}, {1.0, 1.0, 1.0}, {-0.154508516, 0.47552824, 0.0}, {0.0, 0.0}},
+    {{-0.179184034, 0.466790199, 0.0}, {1.0, 1.0, 1.0}, {-0.0895920172, 0.2333951, 0.0}, {1.0, 1.0}},
+    {{-0.406736702, 0.91354543, 0.0}, {1.0, 1.0, 1.0}, {-0.203368351, 0.456772715, 0.0}, {0.0, 0.0}},
+    {{-0.226995304, 0.445503235, 0.0}, {1.0, 1.0, 1.0}, {-0.113497652, 0.222751617, 0.0}, {1.0, 1.0}},
+    {{-0.50000006, 0.866025388, 0.0}, {1.0, 1.0, 1.0}, {-0.25000003, 0.433012694, 0.0}, {0.0, 0.0}},
+    {{-0.272319525, 0.419335276, 0.0}, {1.0, 1.0, 1.0}, {-0.136159763, 0.209667638, 0.0}, {1.0, 1.0}},
+    {{-0.587785423, 0.809016883, 0.0}, {1.0, 1.0, 1.0}, {-0.293892711, 0.404508442, 0.0}, {0.0, 0.0}},
+    {{-0.314660251, 0.388572931, 0.0}, {1.0, 1.0, 1.0}, {-0.157330126, 0.194286466, 0.0}, {1.0, 1.0}},
+    {{-0.669130683, 0.74314481, 0.0}, {1.0, 1.0, 1.0}, {-0.334565341, 0.371572405, 0.0}, {0.0, 0.0}},
+    {{-0.353553385, 0.353553385, 0.0}, {1.0, 1.0, 1.0}, {-0.176776692, 0.176776692, 0.0}, {1.0, 1.0}},
+    {{-0.74314481, 0.669130623, 0.0}, {1.0, 1.0, 1.0}, {-0.371572405, 0.334565312, 0.0}, {0.0, 0.0}},
+    {{-0.388573021, 0.314660132, 0.0}, {1.0, 1.0, 1.0}, {-0.19428651, 0.157330066, 0.0}, {1.0, 1.0}},
+    {{-0.809017062, 0.587785184, 0.0}, {1.0, 1.0, 1.0}, {-0.404508531, 0.293892592, 0.0}, {0.0, 0.0}},
+    {{-0.419335365, 0.272319406, 0.0}, {1.0, 1.0, 1.0}, {-0.209667683, 0.136159703, 0.0}, {1.0, 1.0}},
+    {{-0.866025507, 0.499999821, 0.0}, {1.0, 1.0, 1.0}, {-0.433012754, 0.249999911, 0.0}, {0.0, 0.0}},
+    {{-0.445503294, 0.226995185, 0.0}, {1.0, 1.0, 1.0}, {-0.222751647, 0.113497593, 0.0}, {1.0, 1.0}},
+    {{-0.913545489, 0.406736583, 0.0}, {1.0, 1.0, 1.0}, {-0.456772745, 0.203368291, 0.0}, {0.0, 0.0}},
+    {{-0.466790229, 0.17918396, 0.0}, {1.0, 1.0, 1.0}, {-0.233395115, 0.08959198, 0.0}, {1.0, 1.0}},
+    {{-0.95105648, 0.309017032, 0.0}, {1.0, 1.0, 1.0}, {-0.47552824, 0.154508516, 0.0}, {0.0, 0.0}},
+    {{-0.482962936, 0.129409462, 0.0}, {1.0, 1.0, 1.0}, {-0.241481468, 0.0647047311, 0.0}, {1.0, 1.0}},
+    {{-0.978147626, 0.207911611, 0.0}, {1.0, 1.0, 1.0}, {-0.489073813, 0.103955805, 0.0}, {0.0, 0.0}},
+    {{-0.493844181, 0.0782172233, 0.0}, {1.0, 1.0, 1.0}, {-0.246922091, 0.0391086116, 0.0}, {1.0, 1.0}},
+    {{-0.994521916, 0.104528263, 0.0}, {1.0, 1.0, 1.0}, {-0.497260958, 0.0522641316, 0.0}, {0.0, 0.0}},
+    {{-0.499314755, 0.0261680242, 0.0}, {1.0, 1.0, 1.0}, {-0.249657378, 0.0130840121, 0.0}, {1.0, 1.0}},
+    {{-1.0, -8.74227766e-08, 0.0}, {1.0, 1.0, 1.0}, {-0.5, -4.37113883e-08, 0.0}, {0.0, 0.0}},
+    {{-0.499314755, -0.0261681117, 0.0}, {1.0, 1.0, 1.0}, {-0.249657378, -0.0130840559, 0.0}, {1.0, 1.0}},
+    {{-0.994521916, -0.104528435, 0.0}, {1.0, 1.0, 1.0}, {-0.497260958, -0.0522642173, 0.0}, {0.0, 0.0}},
+    {{-0.493844151, -0.0782173052, 0.0}, {1.0, 1.0, 1.0}, {-0.246922076, -0.0391086526, 0.0}, {1.0, 1.0}},
+    {{-0.978147566, -0.207911789, 0.0}, {1.0, 1.0, 1.0}, {-0.489073783, -0.103955895, 0.0}, {0.0, 0.0}},
+    {{-0.482962877, -0.129409656, 0.0}, {1.0, 1.0, 1.0}, {-0.241481438, -0.064704828, 0.0}, {1.0, 1.0}},
+    {{-0.95105654, -0.309016973, 0.0}, {1.0, 1.0, 1.0}, {-0.47552827, -0.154508486, 0.0}, {0.0, 0.0}},
+    {{-0.466790199, -0.179184049, 0.0}, {1.0, 1.0, 1.0}, {-0.2333951, -0.0895920247, 0.0}, {1.0, 1.0}},
+    {{-0.91354531, -0.40673694, 0.0}, {1.0, 1.0, 1.0}, {-0.456772655, -0.20336847, 0.0}, {0.0, 0.0}},
+    {{-0.445503265, -0.226995274, 0.0}, {1.0, 1.0, 1.0}, {-0.222751632, -0.113497637, 0.0}, {1.0, 1.0}},
+    {{-0.866025269, -0.500000179, 0.0}, {1.0, 1.0, 1.0}, {-0.433012635, -0.250000089, 0.0}, {0.0, 0.0}},
+    {{-0.419335306, -0.272319496, 0.0}, {1.0, 1.0, 1.0}, {-0.209667653, -0.136159748, 0.0}, {1.0, 1.0}},
+    {{-0.809016943, -0.587785363, 0.0}, {1.0, 1.0, 1.0}, {-0.404508471, -0.293892682, 0.0}, {0.0, 0.0}},
+    {{-0.388572961, -0.314660221, 0.0}, {1.0, 1.0, 1.0}, {-0.194286481, -0.157330111, 0.0}, {1.0, 1.0}},
+    {{-0.743144691, -0.669130802, 0.0}, {1.0, 1.0, 1.0}, {-0.371572345, -0.334565401, 0.0}, {0.0, 0.0}},
+    {{-0.353553414, -0.353553355, 0.0}, {1.0, 1.0, 1.0}, {-0.176776707, -0.176776677, 0.0}, {1.0, 1.0}},
+    {{-0.669130504, -0.74314487, 0.0}, {1.0, 1.0, 1.0}, {-0.334565252, -0.371572435, 0.0}, {0.0, 0.0}},
+    {{-0.314660162, -0.388572991, 0.0}, {1.0, 1.0, 1.0}, {-0.157330081, -0.194286495, 0.0}, {1.0, 1.0}},
+    {{-0.587785065, -0.809017122, 0.0}, {1.0, 1.0, 1.0}, {-0.293892533, -0.404508561, 0.0}, {0.0, 0.0}},
+    {{-0.272319347, -0.419335395, 0.0}, {1.0, 1.0, 1.0}, {-0.136159673, -0.209667698, 0.0}, {1.0, 1.0}},
+    {{-0.499999911, -0.866025448, 0.0}, {1.0, 1.0, 1.0}, {-0.249999955, -0.433012724, 0.0}, {0.0, 0.0}},
+    {{-0.226995111, -0.445503324, 0.0}, {1.0, 1.0, 1.0}, {-0.113497555, -0.222751662, 0.0}, {1.0, 1.0}},
+    {{-0.406736642, -0.91354543, 0.0}, {1.0, 1.0, 1.0}, {-0.203368321, -0.456772715, 0.0}, {0.0, 0.0}},
+    {{-0.179183885, -0.466790259, 0.0}, {1.0, 1.0, 1.0}, {-0.0895919427, -0.233395129, 0.0}, {1.0, 1.0}},
+    {{-0.309016645, -0.9510566, 0.0}, {1.0, 1.0, 1.0}, {-0.154508322, -0.4755283, 0.0}, {0.0, 0.0}},
+    {{-0.129409492, -0.482962936, 0.0}, {1.0, 1.0, 1.0}, {-0.064704746, -0.241481468, 0.0}, {1.0, 1.0}},
+    {{-0.207911447, -0.978147626, 0.0}, {1.0, 1.0, 1.0}, {-0.103955723, -0.489073813, 0.0}, {0.0, 0.0}},
+    {{-0.0782172605, -0.493844151, 0.0}, {1.0, 1.0, 1.0}, {-0.0391086303, -0.246922076, 0.0}, {1.0, 1.0}},
+    {{-0.104528338, -0.994521916, 0.0}, {1.0, 1.0, 1.0}, {-0.0522641689, -0.497260958, 0.0}, {0.0, 0.0}},
+    {{-0.0261680614, -0.499314755, 0.0}, {1.0, 1.0, 1.0}, {-0.0130840307, -0.249657378, 0.0}, {1.0, 1.0}},
+    {{1.19248806e-08, -1.0, 0.0}, {1.0, 1.0, 1.0}, {5.96244032e-09, -0.5, 0.0}, {0.0, 0.0}},
+    {{0.0261680745, -0.499314755, 0.0}, {1.0, 1.0, 1.0}, {0.0130840372, -0.249657378, 0.0}, {1.0, 1.0}},
+    {{0.10452836, -0.994521916, 0.0}, {1.0, 1.0, 1.0}, {0.05226418, -0.497260958, 0.0}, {0.0, 0.0}},
+    {{0.078217268, -0.493844151, 0.0}, {1.0, 1.0, 1.0}, {0.039108634, -0.246922076, 0.0}, {1.0, 1.0}},
+    {{0.207911938, -0.978147566, 0.0}, {1.0, 1.0, 1.0}, {0.103955969, -0.489073783, 0.0}, {0.0, 0.0}},
+    {{0.12940973, -0.482962847, 0.0}, {1.0, 1.0, 1.0}, {0.0647048652, -0.241481423, 0.0}, {1.0, 1.0}},
+    {{0.309017122, -0.95105648, 0.0}, {1.0, 1.0, 1.0}, {0.154508561, -0.47552824, 0.0}, {0.0, 0.0}},
+    {{0.179184124, -0.466790169, 0.0}, {1.0, 1.0, 1.0}, {0.0895920619, -0.233395085, 0.0}, {1.0, 1.0}},
+    {{0.406737089, -0.913545251, 0.0}, {1.0, 1.0, 1.0}, {0.203368545, -0.456772625, 0.0}, {0.0, 0.0}},
+    {{0.226995334, -0.445503205, 0.0}, {1.0, 1.0, 1.0}, {0.113497667, -0.222751603, 0.0}, {1.0, 1.0}},
+    {{0.500000358, -0.866025209, 0.0}, {1.0, 1.0, 1.0}, {0.250000179, -0.433012605, 0.0}, {0.0, 0.0}},
+    {{0.272319555, -0.419335246, 0.0}, {1.0, 1.0, 1.0}, {0.136159778, -0.209667623, 0.0}, {1.0, 1.0}},
+    {{0.587785482, -0.809016824, 0.0}, {1.0, 1.0, 1.0}, {0.293892741, -0.404508412, 0.0}, {0.0, 0.0}},
+    {{0.314660192, -0.388572991, 0.0}, {1.0, 1.0, 1.0}, {0.157330096, -0.194286495, 0.0}, {1.0, 1.0}},
+    {{0.669130743, -0.743144751, 0.0}, {1.0, 1.0, 1.0}, {0.334565371, -0.371572375, 0.0}, {0.0, 0.0}},
+    {{0.353553325, -0.353553444, 0.0}, {1.0, 1.0, 1.0}, {0.176776662, -0.176776722, 0.0}, {1.0, 1.0}},
+    {{0.74314487, -0.669130564, 0.0}, {1.0, 1.0, 1.0}, {0.371572435, -0.334565282, 0.0}, {0.0, 0.0}},
+    {{0.38857305, -0.314660102, 0.0}, {1.0, 1.0, 1.0}, {0.194286525, -0.157330051, 0.0}, {1.0, 1.0}},
+    {{0.809016943, -0.587785304, 0.0}, {1.0, 1.0, 1.0}, {0.404508471, -0.293892652, 0.0}, {0.0, 0.0}},
+    {{0.419335306, -0.272319466, 0.0}, {1.0, 1.0, 1.0}, {0.209667653, -0.136159733, 0.0}, {1.0, 1.0}},
+    {{0.866025567, -0.499999762, 0.0}, {1.0, 1.0, 1.0}, {0.433012784, -0.249999881, 0.0}, {0.0, 0.0}},
+    {{0.445503265, -0.22699526, 0.0}, {1.0, 1.0, 1.0}, {0.222751632, -0.11349763, 0.0}, {1.0, 1.0}},
+    {{0.913545549, -0.406736493, 0.0}, {1.0, 1.0, 1.0}, {0.456772774, -0.203368247, 0.0}, {0.0, 0.0}},
+    {{0.466790289, -0.179183811, 0.0}, {1.0, 1.0, 1.0}, {0.233395144, -0.0895919055, 0.0}, {1.0, 1.0}},
+    {{0.95105654, -0.309016943, 0.0}, {1.0, 1.0, 1.0}, {0.47552827, -0.154508471, 0.0}, {0.0, 0.0}},
+    {{0.482962936, -0.129409418, 0.0}, {1.0, 1.0, 1.0}, {0.241481468, -0.0647047088, 0.0}, {1.0, 1.0}},
+    {{0.978147686, -0.207911298, 0.0}, {1.0, 1.0, 1.0}, {0.489073843, -0.103955649, 0.0}, {0.0, 0.0}},
+    {{0.493844211, -0.0782169402, 0.0}, {1.0, 1.0, 1.0}, {0.246922106, -0.0391084701, 0.0}, {1.0, 1.0}},
+    {{0.994521856, -0.104528651, 0.0}, {1.0, 1.0, 1.0}, {0.497260928, -0.0522643253, 0.0}, {0.0, 0.0}},
+    {{0.499314755, -0.0261679813, 0.0}, {1.0, 1.0, 1.0}, {0.249657378, -0.0130839907, 0.0}, {1.0, 1.0}},
+    {{1.0, 1.74845553e-07, 0.0}, {1.0, 1.0, 1.0}, {0.5, 8.74227766e-08, 0.0}, {0.0, 0.0}},
+    {{0.499314755, 0.0261681546, 0.0}, {1.0, 1.0, 1.0}, {0.249657378, 0.0130840773, 0.0}, {1.0, 1.0}},
+};
+
+static const uint32_t BAKED_RING_INDICES[] = {
+    1, 61, 62, 2, 62, 63, 3, 63, 64, 4, 64, 65,
+    5, 65, 66, 6, 66, 67, 7, 67, 68, 8, 68, 69,
+    9, 69, 70, 10, 70, 71, 11, 71, 72, 12, 72, 73,
+    13, 73, 74, 14, 74, 75, 15, 75, 76, 16, 76, 77,
+    17, 77, 78, 18, 78, 79, 19, 79, 80, 20, 80, 81,
+    21, 81, 82, 22, 82, 83, 23, 83, 84, 24, 84, 85,
+    25, 85, 86, 26, 86, 87, 27, 87, 88, 28, 88, 89,
+    29, 89, 90, 30, 90, 91, 31, 91, 92, 32, 92, 93,
+    33, 93, 94, 34, 94, 95, 35, 95, 96, 36, 96, 97,
+    37, 97, 98, 38, 98, 99, 39, 99, 100, 40, 100, 101,
+    41, 101, 102, 42, 102, 103, 43, 103, 104, 44, 104, 105,
+    45, 105, 106, 46, 106, 107, 47, 107, 108, 48, 108, 109,
+    49, 109, 110, 50, 110, 111, 51, 111, 112, 52, 112, 113,
+    53, 113, 114, 54, 114, 115, 55, 115, 116, 56, 116, 117,
+    57, 117, 118, 58, 118, 119, 59, 119, 120, 60, 120, 121,
+    61, 122, 62, 62, 123, 63, 63, 124, 64, 64, 125, 65,
+    65, 126, 66, 66, 127, 67, 67, 128, 68, 68, 129, 69,
+    69, 130, 70, 70, 131, 71, 71, 132, 72, 72, 133, 73,
+    73, 134, 74, 74, 135, 75, 75, 136, 76, 76, 137, 77,
+    77, 138, 78, 78, 139, 79, 79, 140, 80, 80, 141, 81,
+    81, 142, 82, 82, 143, 83, 83, 144, 84, 84, 145, 85,
+    85, 146, 86, 86, 147, 87, 87, 148, 88, 88, 149, 89,
+    89, 150, 90, 90, 151, 91, 91, 152, 92, 92, 153, 93,
+    93, 154, 94, 94, 155, 95, 95, 156, 96, 96, 157, 97,
+    97, 158, 98, 98, 159, 99, 99, 160, 100, 100, 161, 101,
+    101, 162, 102, 102, 163, 103, 103, 164, 104, 104, 165, 105,
+    105, 166, 106, 106, 167, 107, 107, 168, 108, 108, 169, 109,
+    109, 170, 110, 110, 171, 111, 111, 172, 112, 112, 173, 113,
+    113, 174, 114, 114, 175, 115, 115, 176, 116, 116, 177, 117,
+    117, 178, 118, 118, 179, 119, 119, 180, 120, 120, 181, 121,
+};
+
+#endif /* INCLUDE_GEOMETRY_BAKED_RING_MESH */
@@ -0,0 +1,2480 @@
+#ifndef INCLUDE_GEOMETRY_BAKED_SPHERE_MESH
+#define INCLUDE_GEOMETRY_BAKED_SPHERE_MESH
+
+// generated by tools/bake_meshes.c, do not edit
+
+#include "geometry/geometry.h"
+
+static const ShapeParameters BAKED_SPHERE_PARAMETERS = {
+    .detail = {40, 40},
+    .radius = 0.400000006,
+};
+
+static const Vertex BAKED_SPHERE_VERTICES[] = {
+    {{-1.7484556e-08, -0.0, 0.400000006}, {1.0, 1.0, 1.0}, {-4.37113883e-08, -0.0, 1.0}, {0.0, 0.0}},
+    {{-1.72692918e-08, -2.73518719e-09, 0.400000006}, {1.0, 1.0, 1.0}, {-4.31732303e-08, -6.83796797e-09, 1.0}, {0.0250000004, 0.0}},
+    {{-1.66288014e-08, -5.40302514e-09, 0.400000006}, {1.0, 1.0, 1.0}, {-4.15720045e-08, -1.35075631e-08, 1.0}, {0.0500000007, 0.0}},
+    {{-1.55788538e-08, -7.93782284e-09, 0.400000006}, {1.0, 1.0, 1.0}, {-3.89471353e-08, -1.98445562e-08, 1.0}, {0.075000003, 0.0}},
+    {{-1.41453027e-08, -1.0277164e-08, 0.400000006}, {1.0, 1.0, 1.0}, {-3.53632572e-08, -2.56929091e-08, 1.0}, {0.100000001, 0.0}},
+    {{-1.2363448e-08, -1.2363448e-08, 0.400000006}, {1.0, 1.0, 1.0}, {-3.09086197e-08, -3.09086197e-08, 1.0}, {0.125, 0.0}},
+    {{-1.0277164e-08, -1.41453036e-08, 0.400000006}, {1.0, 1.0, 1.0}, {-2.56929091e-08, -3.53632572e-08, 1.0}, {0.150000006, 0.0}},
+    {{-7.93782284e-09, -1.55788538e-08, 0.400000006}, {1.0, 1.0, 1.0}, {-1.98445562e-08, -3.89471353e-08, 1.0}, {0.174999997, 0.0}},
+    {{-5.40302425e-09, -1.66288014e-08, 0.400000006}, {1.0, 1.0, 1.0}, {-1.35075604e-08, -4.15720045e-08, 1.0}, {0.200000003, 0.0}},
+    {{-2.73518541e-09, -1.72692918e-08, 0.400000006}, {1.0, 1.0, 1.0}, {-6.83796353e-09, -4.31732303e-08, 1.0}, {0.224999994, 0.0}},
+    {{7.64274228e-16, -1.7484556e-08, 0.400000006}, {1.0, 1.0, 1.0}, {1.91068568e-15, -4.37113883e-08, 1.0}, {0.25, 0.0}},
+    {{2.73518697e-09, -1.72692918e-08, 0.400000006}, {1.0, 1.0, 1.0}, {6.83796753e-09, -4.31732303e-08, 1.0}, {0.275000006, 0.0}},
+    {{5.40302603e-09, -1.66288014e-08, 0.400000006}, {1.0, 1.0, 1.0}, {1.35075648e-08, -4.15720045e-08, 1.0}, {0.300000012, 0.0}},
+    {{7.93782373e-09, -1.5578852e-08, 0.400000006}, {1.0, 1.0, 1.0}, {1.98445598e-08, -3.89471282e-08, 1.0}, {0.324999988, 0.0}},
+    {{1.02771631e-08, -1.41453036e-08, 0.400000006}, {1.0, 1.0, 1.0}, {2.56929074e-08, -3.53632572e-08, 1.0}, {0.349999994, 0.0}},
+    {{1.2363448e-08, -1.2363448e-08, 0.400000006}, {1.0, 1.0, 1.0}, {3.09086197e-08, -3.09086197e-08, 1.0}, {0.375, 0.0}},
+    {{1.41453036e-08, -1.02771631e-08, 0.400000006}, {1.0, 1.0, 1.0}, {3.53632572e-08, -2.56929074e-08, 1.0}, {0.400000006, 0.0}},
+    {{1.55788538e-08, -7.93782018e-09, 0.400000006}, {1.0, 1.0, 1.0}, {3.89471353e-08, -1.98445509e-08, 1.0}, {0.425000012, 0.0}},
+    {{1.66288014e-08, -5.40302159e-09, 0.400000006}, {1.0, 1.0, 1.0}, {4.15720045e-08, -1.35075542e-08, 1.0}, {0.449999988, 0.0}},
+    {{1.72692918e-08, -2.73518674e-09, 0.400000006}, {1.0, 1.0, 1.0}, {4.31732303e-08, -6.83796664e-09, 1.0}, {0.474999994, 0.0}},
+    {{1.7484556e-08, 1.52854846e-15, 0.400000006}, {1.0, 1.0, 1.0}, {4.37113883e-08, 3.82137135e-15, 1.0}, {0.5, 0.0}},
+    {{1.72692918e-08, 2.73518985e-09, 0.400000006}, {1.0, 1.0, 1.0}, {4.31732303e-08, 6.83797463e-09, 1.0}, {0.524999976, 0.0}},
+    {{1.66288014e-08, 5.40302469e-09, 0.400000006}, {1.0, 1.0, 1.0}, {4.15720045e-08, 1.35075613e-08, 1.0}, {0.550000012, 0.0}},
+    {{1.55788538e-08, 7.93782284e-09, 0.400000006}, {1.0, 1.0, 1.0}, {3.89471353e-08, 1.98445562e-08, 1.0}, {0.574999988, 0.0}},
+    {{1.41453018e-08, 1.02771658e-08, 0.400000006}, {1.0, 1.0, 1.0}, {3.53632537e-08, 2.56929145e-08, 1.0}, {0.600000024, 0.0}},
+    {{1.23634463e-08, 1.23634498e-08, 0.400000006}, {1.0, 1.0, 1.0}, {3.09086161e-08, 3.09086232e-08, 1.0}, {0.625, 0.0}},
+    {{1.02771605e-08, 1.41453054e-08, 0.400000006}, {1.0, 1.0, 1.0}, {2.5692902e-08, 3.53632643e-08, 1.0}, {0.649999976, 0.0}},
+    {{7.93781751e-09, 1.55788555e-08, 0.400000006}, {1.0, 1.0, 1.0}, {1.98445438e-08, 3.89471388e-08, 1.0}, {0.675000012, 0.0}},
+    {{5.40302691e-09, 1.66287997e-08, 0.400000006}, {1.0, 1.0, 1.0}, {1.35075675e-08, 4.1572001e-08, 1.0}, {0.699999988, 0.0}},
+    {{2.73518808e-09, 1.72692918e-08, 0.400000006}, {1.0, 1.0, 1.0}, {6.83797019e-09, 4.31732303e-08, 1.0}, {0.725000024, 0.0}},
+    {{-2.08501236e-16, 1.7484556e-08, 0.400000006}, {1.0, 1.0, 1.0}, {-5.21253064e-16, 4.37113883e-08, 1.0}, {0.75, 0.0}},
+    {{-2.73518852e-09, 1.72692918e-08, 0.400000006}, {1.0, 1.0, 1.0}, {-6.83797108e-09, 4.31732303e-08, 1.0}, {0.774999976, 0.0}},
+    {{-5.40302736e-09, 1.66287997e-08, 0.400000006}, {1.0, 1.0, 1.0}, {-1.35075684e-08, 4.1572001e-08, 1.0}, {0.800000012, 0.0}},
+    {{-7.93782551e-09, 1.5578852e-08, 0.400000006}, {1.0, 1.0, 1.0}, {-1.98445633e-08, 3.89471282e-08, 1.0}, {0.824999988, 0.0}},
+    {{-1.02771676e-08, 1.41453e-08, 0.400000006}, {1.0, 1.0, 1.0}, {-2.56929198e-08, 3.53632501e-08, 1.0}, {0.850000024, 0.0}},
+    {{-1.23634525e-08, 1.23634436e-08, 0.400000006}, {1.0, 1.0, 1.0}, {-3.09086303e-08, 3.0908609e-08, 1.0}, {0.875, 0.0}},
+    {{-1.41453071e-08, 1.02771587e-08, 0.400000006}, {1.0, 1.0, 1.0}, {-3.53632679e-08, 2.56928967e-08, 1.0}, {0.899999976, 0.0}},
+    {{-1.55788538e-08, 7.93782284e-09, 0.400000006}, {1.0, 1.0, 1.0}, {-3.89471353e-08, 1.98445562e-08, 1.0}, {0.925000012, 0.0}},
+    {{-1.66288014e-08, 5.40302425e-09, 0.400000006}, {1.0, 1.0, 1.0}, {-4.15720045e-08, 1.35075604e-08, 1.0}, {0.949999988, 0.0}},
+    {{-1.72692918e-08, 2.73518519e-09, 0.400000006}, {1.0, 1.0, 1.0}, {-4.31732303e-08, 6.83796308e-09, 1.0}, {0.975000024, 0.0}},
+    {{-1.7484556e-08, -3.05709691e-15, 0.400000006}, {1.0, 1.0, 1.0}, {-4.37113883e-08, -7.64274271e-15, 1.0}, {1.0, 0.0}},
+    {{0.0313836336, 0.0, 0.398766935}, {1.0, 1.0, 1.0}, {0.078459084, 0.0, 0.996917367}, {0.0, 0.0250000004}},
+    {{0.0309972484, 0.00490948185, 0.398766935}, {1.0, 1.0, 1.0}, {0.0774931237, 0.0122737046, 0.996917367}, {0.0250000004, 0.0250000004}},
+    {{0.0298476089, 0.00969807617, 0.398766935}, {1.0, 1.0, 1.0}, {0.074619025, 0.0242451914, 0.996917367}, {0.0500000007, 0.0250000004}},
+    {{0.0279630218, 0.0142478719, 0.398766935}, {1.0, 1.0, 1.0}, {0.0699075535, 0.0356196798, 0.996917367}, {0.075000003, 0.0250000004}},
+    {{0.025389893, 0.0184468366, 0.398766935}, {1.0, 1.0, 1.0}, {0.0634747297, 0.0461170897, 0.996917367}, {0.100000001, 0.0250000004}},
+    {{0.0221915804, 0.0221915804, 0.398766935}, {1.0, 1.0, 1.0}, {0.0554789528, 0.0554789528, 0.996917367}, {0.125, 0.0250000004}},
+    {{0.0184468366, 0.025389893, 0.398766935}, {1.0, 1.0, 1.0}, {0.0461170897, 0.0634747297, 0.996917367}, {0.150000006, 0.0250000004}},
+    {{0.0142478719, 0.0279630218, 0.398766935}, {1.0, 1.0, 1.0}, {0.0356196798, 0.0699075535, 0.996917367}, {0.174999997, 0.0250000004}},
+    {{0.00969807524, 0.0298476089, 0.398766935}, {1.0, 1.0, 1.0}, {0.0242451876, 0.074619025, 0.996917367}, {0.200000003, 0.0250000004}},
+    {{0.00490947906, 0.0309972502, 0.398766935}, {1.0, 1.0, 1.0}, {0.0122736972, 0.0774931237, 0.996917367}, {0.224999994, 0.0250000004}},
+    {{-1.37182221e-09, 0.0313836336, 0.398766935}, {1.0, 1.0, 1.0}, {-3.42955553e-09, 0.078459084, 0.996917367}, {0.25, 0.0250000004}},
+    {{-0.00490948139, 0.0309972484, 0.398766935}, {1.0, 1.0, 1.0}, {-0.0122737037, 0.0774931237, 0.996917367}, {0.275000006, 0.0250000004}},
+    {{-0.00969807804, 0.0298476089, 0.398766935}, {1.0, 1.0, 1.0}, {-0.0242451951, 0.074619025, 0.996917367}, {0.300000012, 0.0250000004}},
+    {{-0.0142478747, 0.0279630199, 0.398766935}, {1.0, 1.0, 1.0}, {-0.0356196873, 0.069907546, 0.996917367}, {0.324999988, 0.0250000004}},
+    {{-0.0184468348, 0.0253898948, 0.398766935}, {1.0, 1.0, 1.0}, {-0.046117086, 0.0634747371, 0.996917367}, {0.349999994, 0.0250000004}},
+    {{-0.0221915804, 0.0221915804, 0.398766935}, {1.0, 1.0, 1.0}, {-0.0554789528, 0.0554789528, 0.996917367}, {0.375, 0.0250000004}},
+    {{-0.0253898948, 0.0184468348, 0.398766935}, {1.0, 1.0, 1.0}, {-0.0634747371, 0.046117086, 0.996917367}, {0.400000006, 0.0250000004}},
+    {{-0.0279630236, 0.0142478682, 0.398766935}, {1.0, 1.0, 1.0}, {-0.0699075609, 0.0356196687, 0.996917367}, {0.425000012, 0.0250000004}},
+    {{-0.0298476107, 0.00969807059, 0.398766935}, {1.0, 1.0, 1.0}, {-0.074619025, 0.0242451765, 0.996917367}, {0.449999988, 0.0250000004}},
+    {{-0.0309972484, 0.00490948139, 0.398766935}, {1.0, 1.0, 1.0}, {-0.0774931237, 0.0122737037, 0.996917367}, {0.474999994, 0.0250000004}},
+    {{-0.0313836336, -2.74364442e-09, 0.398766935}, {1.0, 1.0, 1.0}, {-0.078459084, -6.85911106e-09, 0.996917367}, {0.5, 0.0250000004}},
+    {{-0.0309972484, -0.00490948651, 0.398766935}, {1.0, 1.0, 1.0}, {-0.0774931237, -0.0122737158, 0.996917367}, {0.524999976, 0.0250000004}},
+    {{-0.0298476089, -0.00969807524, 0.398766935}, {1.0, 1.0, 1.0}, {-0.074619025, -0.0242451876, 0.996917367}, {0.550000012, 0.0250000004}},
+    {{-0.0279630218, -0.0142478729, 0.398766935}, {1.0, 1.0, 1.0}, {-0.0699075535, -0.0356196836, 0.996917367}, {0.574999988, 0.0250000004}},
+    {{-0.0253898911, -0.0184468403, 0.398766935}, {1.0, 1.0, 1.0}, {-0.0634747297, -0.0461171009, 0.996917367}, {0.600000024, 0.0250000004}},
+    {{-0.0221915767, -0.0221915841, 0.398766935}, {1.0, 1.0, 1.0}, {-0.0554789416, -0.0554789603, 0.996917367}, {0.625, 0.0250000004}},
+    {{-0.018446831, -0.0253898967, 0.398766935}, {1.0, 1.0, 1.0}, {-0.0461170785, -0.0634747446, 0.996917367}, {0.649999976, 0.0250000004}},
+    {{-0.0142478636, -0.0279630274, 0.398766935}, {1.0, 1.0, 1.0}, {-0.0356196575, -0.0699075684, 0.996917367}, {0.675000012, 0.0250000004}},
+    {{-0.0096980799, -0.0298476089, 0.398766935}, {1.0, 1.0, 1.0}, {-0.0242451988, -0.074619025, 0.996917367}, {0.699999988, 0.0250000004}},
+    {{-0.00490948372, -0.0309972484, 0.398766935}, {1.0, 1.0, 1.0}, {-0.0122737093, -0.0774931237, 0.996917367}, {0.725000024, 0.0250000004}},
+    {{3.74246079e-10, -0.0313836336, 0.398766935}, {1.0, 1.0, 1.0}, {9.35615141e-10, -0.078459084, 0.996917367}, {0.75, 0.0250000004}},
+    {{0.00490948418, -0.0309972484, 0.398766935}, {1.0, 1.0, 1.0}, {0.0122737102, -0.0774931237, 0.996917367}, {0.774999976, 0.0250000004}},
+    {{0.0096980799, -0.029847607, 0.398766935}, {1.0, 1.0, 1.0}, {0.0242451988, -0.0746190175, 0.996917367}, {0.800000012, 0.0250000004}},
+    {{0.0142478775, -0.0279630199, 0.398766935}, {1.0, 1.0, 1.0}, {0.0356196947, -0.069907546, 0.996917367}, {0.824999988, 0.0250000004}},
+    {{0.0184468441, -0.0253898874, 0.398766935}, {1.0, 1.0, 1.0}, {0.046117112, -0.0634747148, 0.996917367}, {0.850000024, 0.0250000004}},
+    {{0.0221915878, -0.0221915729, 0.398766935}, {1.0, 1.0, 1.0}, {0.0554789677, -0.0554789305, 0.996917367}, {0.875, 0.0250000004}},
+    {{0.0253899004, -0.0184468273, 0.398766935}, {1.0, 1.0, 1.0}, {0.063474752, -0.0461170673, 0.996917367}, {0.899999976, 0.0250000004}},
+    {{0.0279630218, -0.0142478719, 0.398766935}, {1.0, 1.0, 1.0}, {0.0699075535, -0.0356196798, 0.996917367}, {0.925000012, 0.0250000004}},
+    {{0.0298476089, -0.00969807431, 0.398766935}, {1.0, 1.0, 1.0}, {0.074619025, -0.0242451858, 0.996917367}, {0.949999988, 0.0250000004}},
+    {{0.0309972502, -0.00490947859, 0.398766935}, {1.0, 1.0, 1.0}, {0.0774931237, -0.0122736963, 0.996917367}, {0.975000024, 0.0250000004}},
+    {{0.0313836336, 5.48728885e-09, 0.398766935}, {1.0, 1.0, 1.0}, {0.078459084, 1.37182221e-08, 0.996917367}, {1.0, 0.0250000004}},
+    {{0.0625737458, 0.0, 0.395075351}, {1.0, 1.0, 1.0}, {0.156434357, 0.0, 0.987688363}, {0.0, 0.0500000007}},
+    {{0.0618033595, 0.00978869107, 0.395075351}, {1.0, 1.0, 1.0}, {0.154508397, 0.0244717281, 0.987688363}, {0.0250000004, 0.0500000007}},
+    {{0.0595111698, 0.0193363521, 0.395075351}, {1.0, 1.0, 1.0}, {0.148777932, 0.0483408794, 0.987688363}, {0.0500000007, 0.0500000007}},
+    {{0.0557536148, 0.0284078866, 0.395075351}, {1.0, 1.0, 1.0}, {0.139384031, 0.0710197166, 0.987688363}, {0.075000003, 0.0500000007}},
+    {{0.0506232232, 0.0367799252, 0.395075351}, {1.0, 1.0, 1.0}, {0.126558065, 0.0919498131, 0.987688363}, {0.100000001, 0.0500000007}},
+    {{0.0442463197, 0.0442463197, 0.395075351}, {1.0, 1.0, 1.0}, {0.110615797, 0.110615797, 0.987688363}, {0.125, 0.0500000007}},
+    {{0.0367799252, 0.0506232232, 0.395075351}, {1.0, 1.0, 1.0}, {0.0919498131, 0.126558065, 0.987688363}, {0.150000006, 0.0500000007}},
+    {{0.0284078885, 0.0557536148, 0.395075351}, {1.0, 1.0, 1.0}, {0.071019724, 0.139384031, 0.987688363}, {0.174999997, 0.0500000007}},
+    {{0.0193363484, 0.0595111698, 0.395075351}, {1.0, 1.0, 1.0}, {0.0483408719, 0.148777932, 0.987688363}, {0.200000003, 0.0500000007}},
+    {{0.00978868455, 0.0618033595, 0.395075351}, {1.0, 1.0, 1.0}, {0.0244717114, 0.154508397, 0.987688363}, {0.224999994, 0.0500000007}},
+    {{-2.73518541e-09, 0.0625737458, 0.395075351}, {1.0, 1.0, 1.0}, {-6.83796353e-09, 0.156434357, 0.987688363}, {0.25, 0.0500000007}},
+    {{-0.00978869013, 0.0618033595, 0.395075351}, {1.0, 1.0, 1.0}, {-0.0244717263, 0.154508397, 0.987688363}, {0.275000006, 0.0500000007}},
+    {{-0.019336354, 0.0595111661, 0.395075351}, {1.0, 1.0, 1.0}, {-0.0483408868, 0.148777917, 0.987688363}, {0.300000012, 0.0500000007}},
+    {{-0.0284078922, 0.055753611, 0.395075351}, {1.0, 1.0, 1.0}, {-0.0710197315, 0.139384031, 0.987688363}, {0.324999988, 0.0500000007}},
+    {{-0.0367799215, 0.0506232269, 0.395075351}, {1.0, 1.0, 1.0}, {-0.0919498056, 0.126558065, 0.987688363}, {0.349999994, 0.0500000007}},
+    {{-0.0442463197, 0.0442463197, 0.395075351}, {1.0, 1.0, 1.0}, {-0.110615797, 0.110615797, 0.987688363}, {0.375, 0.0500000007}},
+    {{-0.0506232269, 0.0367799215, 0.395075351}, {1.0, 1.0, 1.0}, {-0.126558065, 0.0919498056, 0.987688363}, {0.400000006, 0.0500000007}},
+    {{-0.0557536185, 0.0284078792, 0.395075351}, {1.0, 1.0, 1.0}, {-0.139384046, 0.0710196942, 0.987688363}, {0.425000012, 0.0500000007}},
+    {{-0.0595111735, 0.0193363391, 0.395075351}, {1.0, 1.0, 1.0}, {-0.148777932, 0.0483408496, 0.987688363}, {0.449999988, 0.0500000007}},
+    {{-0.0618033595, 0.0097886892, 0.395075351}, {1.0, 1.0, 1.0}, {-0.154508397, 0.0244717225, 0.987688363}, {0.474999994, 0.0500000007}},
+    {{-0.0625737458, -5.47037082e-09, 0.395075351}, {1.0, 1.0, 1.0}, {-0.156434357, -1.36759271e-08, 0.987688363}, {0.5, 0.0500000007}},
+    {{-0.0618033595, -0.00978869945, 0.395075351}, {1.0, 1.0, 1.0}, {-0.154508397, -0.0244717486, 0.987688363}, {0.524999976, 0.0500000007}},
+    {{-0.0595111698, -0.0193363503, 0.395075351}, {1.0, 1.0, 1.0}, {-0.148777932, -0.0483408757, 0.987688363}, {0.550000012, 0.0500000007}},
+    {{-0.0557536148, -0.0284078885, 0.395075351}, {1.0, 1.0, 1.0}, {-0.139384031, -0.071019724, 0.987688363}, {0.574999988, 0.0500000007}},
+    {{-0.0506232195, -0.036779929, 0.395075351}, {1.0, 1.0, 1.0}, {-0.126558051, -0.0919498205, 0.987688363}, {0.600000024, 0.0500000007}},
+    {{-0.0442463122, -0.0442463271, 0.395075351}, {1.0, 1.0, 1.0}, {-0.110615782, -0.11061582, 0.987688363}, {0.625, 0.0500000007}},
+    {{-0.0367799141, -0.0506232306, 0.395075351}, {1.0, 1.0, 1.0}, {-0.0919497833, -0.12655808, 0.987688363}, {0.649999976, 0.0500000007}},
+    {{-0.0284078699, -0.0557536259, 0.395075351}, {1.0, 1.0, 1.0}, {-0.0710196719, -0.139384061, 0.987688363}, {0.675000012, 0.0500000007}},
+    {{-0.0193363577, -0.0595111661, 0.395075351}, {1.0, 1.0, 1.0}, {-0.0483408943, -0.148777917, 0.987688363}, {0.699999988, 0.0500000007}},
+    {{-0.00978869386, -0.0618033595, 0.395075351}, {1.0, 1.0, 1.0}, {-0.0244717337, -0.154508397, 0.987688363}, {0.725000024, 0.0500000007}},
+    {{7.46184448e-10, -0.0625737458, 0.395075351}, {1.0, 1.0, 1.0}, {1.86546112e-09, -0.156434357, 0.987688363}, {0.75, 0.0500000007}},
+    {{0.00978869479, -0.0618033595, 0.395075351}, {1.0, 1.0, 1.0}, {0.0244717374, -0.154508397, 0.987688363}, {0.774999976, 0.0500000007}},
+    {{0.0193363596, -0.0595111661, 0.395075351}, {1.0, 1.0, 1.0}, {0.048340898, -0.148777917, 0.987688363}, {0.800000012, 0.0500000007}},
+    {{0.0284078978, -0.055753611, 0.395075351}, {1.0, 1.0, 1.0}, {0.0710197464, -0.139384031, 0.987688363}, {0.824999988, 0.0500000007}},
+    {{0.0367799401, -0.0506232157, 0.395075351}, {1.0, 1.0, 1.0}, {0.0919498503, -0.126558036, 0.987688363}, {0.850000024, 0.0500000007}},
+    {{0.0442463346, -0.0442463048, 0.395075351}, {1.0, 1.0, 1.0}, {0.110615835, -0.11061576, 0.987688363}, {0.875, 0.0500000007}},
+    {{0.0506232381, -0.0367799066, 0.395075351}, {1.0, 1.0, 1.0}, {0.126558095, -0.0919497684, 0.987688363}, {0.899999976, 0.0500000007}},
+    {{0.0557536148, -0.0284078866, 0.395075351}, {1.0, 1.0, 1.0}, {0.139384031, -0.0710197166, 0.987688363}, {0.925000012, 0.0500000007}},
+    {{0.0595111698, -0.0193363484, 0.395075351}, {1.0, 1.0, 1.0}, {0.148777932, -0.0483408719, 0.987688363}, {0.949999988, 0.0500000007}},
+    {{0.0618033595, -0.00978868362, 0.395075351}, {1.0, 1.0, 1.0}, {0.154508397, -0.0244717095, 0.987688363}, {0.975000024, 0.0500000007}},
+    {{0.0625737458, 1.09407416e-08, 0.395075351}, {1.0, 1.0, 1.0}, {0.156434357, 2.73518541e-08, 0.987688363}, {1.0, 0.0500000007}},
+    {{0.0933781192, 0.0, 0.388947994}, {1.0, 1.0, 1.0}, {0.233445302, 0.0, 0.972369969}, {0.0, 0.075000003}},
+    {{0.0922284797, 0.0146075562, 0.388947994}, {1.0, 1.0, 1.0}, {0.230571195, 0.0365188904, 0.972369969}, {0.0250000004, 0.075000003}},
+    {{0.088807866, 0.0288554262, 0.388947994}, {1.0, 1.0, 1.0}, {0.222019672, 0.0721385628, 0.972369969}, {0.0500000007, 0.075000003}},
+    {{0.0832005143, 0.0423927791, 0.388947994}, {1.0, 1.0, 1.0}, {0.208001286, 0.105981946, 0.972369969}, {0.075000003, 0.075000003}},
+    {{0.075544484, 0.0548862815, 0.388947994}, {1.0, 1.0, 1.0}, {0.188861206, 0.137215704, 0.972369969}, {0.100000001, 0.075000003}},
+    {{0.0660282969, 0.0660283044, 0.388947994}, {1.0, 1.0, 1.0}, {0.165070742, 0.165070757, 0.972369969}, {0.125, 0.075000003}},
+    {{0.0548862778, 0.075544484, 0.388947994}, {1.0, 1.0, 1.0}, {0.137215689, 0.188861206, 0.972369969}, {0.150000006, 0.075000003}},
+    {{0.0423927829, 0.0832005143, 0.388947994}, {1.0, 1.0, 1.0}, {0.105981961, 0.208001286, 0.972369969}, {0.174999997, 0.075000003}},
+    {{0.0288554225, 0.0888078734, 0.388947994}, {1.0, 1.0, 1.0}, {0.0721385553, 0.222019687, 0.972369969}, {0.200000003, 0.075000003}},
+    {{0.0146075469, 0.0922284797, 0.388947994}, {1.0, 1.0, 1.0}, {0.0365188681, 0.230571195, 0.972369969}, {0.224999994, 0.075000003}},
+    {{-4.08168743e-09, 0.0933781192, 0.388947994}, {1.0, 1.0, 1.0}, {-1.02042188e-08, 0.233445302, 0.972369969}, {0.25, 0.075000003}},
+    {{-0.0146075552, 0.0922284797, 0.388947994}, {1.0, 1.0, 1.0}, {-0.0365188867, 0.230571195, 0.972369969}, {0.275000006, 0.075000003}},
+    {{-0.02885543, 0.088807866, 0.388947994}, {1.0, 1.0, 1.0}, {-0.0721385777, 0.222019672, 0.972369969}, {0.300000012, 0.075000003}},
+    {{-0.0423927903, 0.0832005069, 0.388947994}, {1.0, 1.0, 1.0}, {-0.105981976, 0.208001271, 0.972369969}, {0.324999988, 0.075000003}},
+    {{-0.0548862778, 0.0755444914, 0.388947994}, {1.0, 1.0, 1.0}, {-0.137215689, 0.188861221, 0.972369969}, {0.349999994, 0.075000003}},
+    {{-0.0660283044, 0.0660283044, 0.388947994}, {1.0, 1.0, 1.0}, {-0.165070757, 0.165070757, 0.972369969}, {0.375, 0.075000003}},
+    {{-0.0755444914, 0.0548862778, 0.388947994}, {1.0, 1.0, 1.0}, {-0.188861221, 0.137215689, 0.972369969}, {0.400000006, 0.075000003}},
+    {{-0.0832005218, 0.042392768, 0.388947994}, {1.0, 1.0, 1.0}, {-0.208001301, 0.105981916, 0.972369969}, {0.425000012, 0.075000003}},
+    {{-0.0888078734, 0.0288554076, 0.388947994}, {1.0, 1.0, 1.0}, {-0.222019687, 0.0721385181, 0.972369969}, {0.449999988, 0.075000003}},
+    {{-0.0922284797, 0.0146075543, 0.388947994}, {1.0, 1.0, 1.0}, {-0.230571195, 0.0365188867, 0.972369969}, {0.474999994, 0.075000003}},
+    {{-0.0933781192, -8.16337486e-09, 0.388947994}, {1.0, 1.0, 1.0}, {-0.233445302, -2.04084376e-08, 0.972369969}, {0.5, 0.075000003}},
+    {{-0.0922284797, -0.0146075701, 0.388947994}, {1.0, 1.0, 1.0}, {-0.230571195, -0.0365189239, 0.972369969}, {0.524999976, 0.075000003}},
+    {{-0.088807866, -0.0288554244, 0.388947994}, {1.0, 1.0, 1.0}, {-0.222019672, -0.0721385628, 0.972369969}, {0.550000012, 0.075000003}},
+    {{-0.0832005143, -0.0423927829, 0.388947994}, {1.0, 1.0, 1.0}, {-0.208001286, -0.105981961, 0.972369969}, {0.574999988, 0.075000003}},
+    {{-0.0755444765, -0.0548862889, 0.388947994}, {1.0, 1.0, 1.0}, {-0.188861191, -0.137215719, 0.972369969}, {0.600000024, 0.075000003}},
+    {{-0.0660282895, -0.0660283118, 0.388947994}, {1.0, 1.0, 1.0}, {-0.165070727, -0.165070772, 0.972369969}, {0.625, 0.075000003}},
+    {{-0.0548862629, -0.0755444989, 0.388947994}, {1.0, 1.0, 1.0}, {-0.137215659, -0.188861251, 0.972369969}, {0.649999976, 0.075000003}},
+    {{-0.0423927531, -0.0832005292, 0.388947994}, {1.0, 1.0, 1.0}, {-0.105981886, -0.208001316, 0.972369969}, {0.675000012, 0.075000003}},
+    {{-0.0288554356, -0.088807866, 0.388947994}, {1.0, 1.0, 1.0}, {-0.0721385926, -0.222019672, 0.972369969}, {0.699999988, 0.075000003}},
+    {{-0.0146075608, -0.0922284797, 0.388947994}, {1.0, 1.0, 1.0}, {-0.0365189016, -0.230571195, 0.972369969}, {0.725000024, 0.075000003}},
+    {{1.11352294e-09, -0.0933781192, 0.388947994}, {1.0, 1.0, 1.0}, {2.78380741e-09, -0.233445302, 0.972369969}, {0.75, 0.075000003}},
+    {{0.0146075627, -0.0922284797, 0.388947994}, {1.0, 1.0, 1.0}, {0.0365189053, -0.230571195, 0.972369969}, {0.774999976, 0.075000003}},
+    {{0.0288554374, -0.088807866, 0.388947994}, {1.0, 1.0, 1.0}, {0.0721385926, -0.222019672, 0.972369969}, {0.800000012, 0.075000003}},
+    {{0.0423927978, -0.0832005069, 0.388947994}, {1.0, 1.0, 1.0}, {0.105981991, -0.208001271, 0.972369969}, {0.824999988, 0.075000003}},
+    {{0.0548863001, -0.0755444691, 0.388947994}, {1.0, 1.0, 1.0}, {0.137215748, -0.188861176, 0.972369969}, {0.850000024, 0.075000003}},
+    {{0.0660283267, -0.066028282, 0.388947994}, {1.0, 1.0, 1.0}, {0.165070817, -0.165070713, 0.972369969}, {0.875, 0.075000003}},
+    {{0.0755445063, -0.0548862517, 0.388947994}, {1.0, 1.0, 1.0}, {0.188861266, -0.137215629, 0.972369969}, {0.899999976, 0.075000003}},
+    {{0.0832005143, -0.0423927791, 0.388947994}, {1.0, 1.0, 1.0}, {0.208001286, -0.105981946, 0.972369969}, {0.925000012, 0.075000003}},
+    {{0.0888078734, -0.0288554206, 0.388947994}, {1.0, 1.0, 1.0}, {0.222019687, -0.0721385479, 0.972369969}, {0.949999988, 0.075000003}},
+    {{0.0922284797, -0.0146075459, 0.388947994}, {1.0, 1.0, 1.0}, {0.230571195, -0.0365188643, 0.972369969}, {0.975000024, 0.075000003}},
+    {{0.0933781192, 1.63267497e-08, 0.388947994}, {1.0, 1.0, 1.0}, {0.233445302, 4.08168752e-08, 0.972369969}, {1.0, 0.075000003}},
+    {{0.123606786, 0.0, 0.380422622}, {1.0, 1.0, 1.0}, {0.309016973, 0.0, 0.95105654}, {0.0, 0.100000001}},
+    {{0.122084983, 0.0193363614, 0.380422622}, {1.0, 1.0, 1.0}, {0.305212468, 0.0483409017, 0.95105654}, {0.0250000004, 0.100000001}},
+    {{0.117557041, 0.0381965972, 0.380422622}, {1.0, 1.0, 1.0}, {0.293892592, 0.0954914913, 0.95105654}, {0.0500000007, 0.100000001}},
+    {{0.110134453, 0.056116309, 0.380422622}, {1.0, 1.0, 1.0}, {0.275336146, 0.140290767, 0.95105654}, {0.075000003, 0.100000001}},
+    {{0.0999999866, 0.0726542473, 0.380422622}, {1.0, 1.0, 1.0}, {0.24999997, 0.181635618, 0.95105654}, {0.100000001, 0.100000001}},
+    {{0.0874031931, 0.0874032006, 0.380422622}, {1.0, 1.0, 1.0}, {0.218507975, 0.218508005, 0.95105654}, {0.125, 0.100000001}},
+    {{0.0726542398, 0.099999994, 0.380422622}, {1.0, 1.0, 1.0}, {0.181635603, 0.249999985, 0.95105654}, {0.150000006, 0.100000001}},
+    {{0.056116309, 0.110134453, 0.380422622}, {1.0, 1.0, 1.0}, {0.140290767, 0.275336146, 0.95105654}, {0.174999997, 0.100000001}},
+    {{0.0381965935, 0.117557041, 0.380422622}, {1.0, 1.0, 1.0}, {0.0954914838, 0.293892592, 0.95105654}, {0.200000003, 0.100000001}},
+    {{0.0193363503, 0.122084983, 0.380422622}, {1.0, 1.0, 1.0}, {0.0483408757, 0.305212468, 0.95105654}, {0.224999994, 0.100000001}},
+    {{-5.40302425e-09, 0.123606786, 0.380422622}, {1.0, 1.0, 1.0}, {-1.35075604e-08, 0.309016973, 0.95105654}, {0.25, 0.100000001}},
+    {{-0.0193363596, 0.122084983, 0.380422622}, {1.0, 1.0, 1.0}, {-0.048340898, 0.305212468, 0.95105654}, {0.275000006, 0.100000001}},
+    {{-0.0381966047, 0.117557034, 0.380422622}, {1.0, 1.0, 1.0}, {-0.0954915136, 0.293892592, 0.95105654}, {0.300000012, 0.100000001}},
+    {{-0.0561163202, 0.110134445, 0.380422622}, {1.0, 1.0, 1.0}, {-0.140290797, 0.275336117, 0.95105654}, {0.324999988, 0.100000001}},
+    {{-0.0726542398, 0.099999994, 0.380422622}, {1.0, 1.0, 1.0}, {-0.181635603, 0.249999985, 0.95105654}, {0.349999994, 0.100000001}},
+    {{-0.0874032006, 0.0874031931, 0.380422622}, {1.0, 1.0, 1.0}, {-0.218508005, 0.218507975, 0.95105654}, {0.375, 0.100000001}},
+    {{-0.099999994, 0.0726542398, 0.380422622}, {1.0, 1.0, 1.0}, {-0.249999985, 0.181635603, 0.95105654}, {0.400000006, 0.100000001}},
+    {{-0.11013446, 0.0561162904, 0.380422622}, {1.0, 1.0, 1.0}, {-0.275336146, 0.140290722, 0.95105654}, {0.425000012, 0.100000001}},
+    {{-0.117557049, 0.0381965749, 0.380422622}, {1.0, 1.0, 1.0}, {-0.293892622, 0.0954914391, 0.95105654}, {0.449999988, 0.100000001}},
+    {{-0.122084983, 0.0193363577, 0.380422622}, {1.0, 1.0, 1.0}, {-0.305212468, 0.0483408943, 0.95105654}, {0.474999994, 0.100000001}},
+    {{-0.123606786, -1.08060485e-08, 0.380422622}, {1.0, 1.0, 1.0}, {-0.309016973, -2.70151208e-08, 0.95105654}, {0.5, 0.100000001}},
+    {{-0.122084975, -0.0193363801, 0.380422622}, {1.0, 1.0, 1.0}, {-0.305212438, -0.0483409502, 0.95105654}, {0.524999976, 0.100000001}},
+    {{-0.117557041, -0.0381965935, 0.380422622}, {1.0, 1.0, 1.0}, {-0.293892592, -0.0954914838, 0.95105654}, {0.550000012, 0.100000001}},
+    {{-0.110134453, -0.0561163127, 0.380422622}, {1.0, 1.0, 1.0}, {-0.275336146, -0.140290782, 0.95105654}, {0.574999988, 0.100000001}},
+    {{-0.0999999866, -0.0726542547, 0.380422622}, {1.0, 1.0, 1.0}, {-0.24999997, -0.181635633, 0.95105654}, {0.600000024, 0.100000001}},
+    {{-0.0874031782, -0.087403208, 0.380422622}, {1.0, 1.0, 1.0}, {-0.218507946, -0.21850802, 0.95105654}, {0.625, 0.100000001}},
+    {{-0.0726542249, -0.100000009, 0.380422622}, {1.0, 1.0, 1.0}, {-0.181635559, -0.25000003, 0.95105654}, {0.649999976, 0.100000001}},
+    {{-0.0561162755, -0.110134467, 0.380422622}, {1.0, 1.0, 1.0}, {-0.140290692, -0.275336176, 0.95105654}, {0.675000012, 0.100000001}},
+    {{-0.0381966121, -0.117557034, 0.380422622}, {1.0, 1.0, 1.0}, {-0.0954915285, -0.293892592, 0.95105654}, {0.699999988, 0.100000001}},
+    {{-0.019336367, -0.122084983, 0.380422622}, {1.0, 1.0, 1.0}, {-0.0483409166, -0.305212468, 0.95105654}, {0.725000024, 0.100000001}},
+    {{1.47399615e-09, -0.123606786, 0.380422622}, {1.0, 1.0, 1.0}, {3.68499031e-09, -0.309016973, 0.95105654}, {0.75, 0.100000001}},
+    {{0.0193363708, -0.122084983, 0.380422622}, {1.0, 1.0, 1.0}, {0.0483409278, -0.305212468, 0.95105654}, {0.774999976, 0.100000001}},
+    {{0.0381966121, -0.117557034, 0.380422622}, {1.0, 1.0, 1.0}, {0.0954915285, -0.293892592, 0.95105654}, {0.800000012, 0.100000001}},
+    {{0.0561163276, -0.110134445, 0.380422622}, {1.0, 1.0, 1.0}, {0.140290827, -0.275336117, 0.95105654}, {0.824999988, 0.100000001}},
+    {{0.0726542696, -0.0999999717, 0.380422622}, {1.0, 1.0, 1.0}, {0.181635678, -0.249999925, 0.95105654}, {0.850000024, 0.100000001}},
+    {{0.0874032229, -0.0874031708, 0.380422622}, {1.0, 1.0, 1.0}, {0.218508065, -0.218507931, 0.95105654}, {0.875, 0.100000001}},
+    {{0.100000016, -0.07265421, 0.380422622}, {1.0, 1.0, 1.0}, {0.25000003, -0.181635529, 0.95105654}, {0.899999976, 0.100000001}},
+    {{0.110134453, -0.056116309, 0.380422622}, {1.0, 1.0, 1.0}, {0.275336146, -0.140290767, 0.95105654}, {0.925000012, 0.100000001}},
+    {{0.117557041, -0.0381965935, 0.380422622}, {1.0, 1.0, 1.0}, {0.293892592, -0.0954914838, 0.95105654}, {0.949999988, 0.100000001}},
+    {{0.122084983, -0.0193363484, 0.380422622}, {1.0, 1.0, 1.0}, {0.305212468, -0.0483408719, 0.95105654}, {0.975000024, 0.100000001}},
+    {{0.123606786, 2.1612097e-08, 0.380422622}, {1.0, 1.0, 1.0}, {0.309016973, 5.40302416e-08, 0.95105654}, {1.0, 0.100000001}},
+    {{0.15307337, 0.0, 0.369551808}, {1.0, 1.0, 1.0}, {0.382683426, 0.0, 0.923879504}, {0.0, 0.125}},
+    {{0.151188776, 0.0239459518, 0.369551808}, {1.0, 1.0, 1.0}, {0.377971947, 0.0598648787, 0.923879504}, {0.0250000004, 0.125}},
+    {{0.145581424, 0.0473022759, 0.369551808}, {1.0, 1.0, 1.0}, {0.363953561, 0.11825569, 0.923879504}, {0.0500000007, 0.125}},
+    {{0.136389375, 0.06949386, 0.369551808}, {1.0, 1.0, 1.0}, {0.340973437, 0.17373465, 0.923879504}, {0.075000003, 0.125}},
+    {{0.123838954, 0.0899742693, 0.369551808}, {1.0, 1.0, 1.0}, {0.309597373, 0.224935681, 0.923879504}, {0.100000001, 0.125}},
+    {{0.108239219, 0.108239219, 0.369551808}, {1.0, 1.0, 1.0}, {0.270598054, 0.270598054, 0.923879504}, {0.125, 0.125}},
+    {{0.0899742693, 0.123838961, 0.369551808}, {1.0, 1.0, 1.0}, {0.224935681, 0.309597403, 0.923879504}, {0.150000006, 0.125}},
+    {{0.06949386, 0.136389375, 0.369551808}, {1.0, 1.0, 1.0}, {0.17373465, 0.340973437, 0.923879504}, {0.174999997, 0.125}},
+    {{0.0473022684, 0.145581424, 0.369551808}, {1.0, 1.0, 1.0}, {0.118255675, 0.363953561, 0.923879504}, {0.200000003, 0.125}},
+    {{0.0239459351, 0.151188791, 0.369551808}, {1.0, 1.0, 1.0}, {0.0598648377, 0.377971977, 0.923879504}, {0.224999994, 0.125}},
+    {{-6.69104994e-09, 0.15307337, 0.369551808}, {1.0, 1.0, 1.0}, {-1.67276255e-08, 0.382683426, 0.923879504}, {0.25, 0.125}},
+    {{-0.02394595, 0.151188791, 0.369551808}, {1.0, 1.0, 1.0}, {-0.0598648749, 0.377971977, 0.923879504}, {0.275000006, 0.125}},
+    {{-0.0473022796, 0.145581424, 0.369551808}, {1.0, 1.0, 1.0}, {-0.118255697, 0.363953561, 0.923879504}, {0.300000012, 0.125}},
+    {{-0.0694938749, 0.13638936, 0.369551808}, {1.0, 1.0, 1.0}, {-0.173734695, 0.340973407, 0.923879504}, {0.324999988, 0.125}},
+    {{-0.0899742618, 0.123838961, 0.369551808}, {1.0, 1.0, 1.0}, {-0.224935651, 0.309597403, 0.923879504}, {0.349999994, 0.125}},
+    {{-0.108239219, 0.108239219, 0.369551808}, {1.0, 1.0, 1.0}, {-0.270598054, 0.270598054, 0.923879504}, {0.375, 0.125}},
+    {{-0.123838961, 0.0899742618, 0.369551808}, {1.0, 1.0, 1.0}, {-0.309597403, 0.224935651, 0.923879504}, {0.400000006, 0.125}},
+    {{-0.136389375, 0.0694938377, 0.369551808}, {1.0, 1.0, 1.0}, {-0.340973437, 0.17373459, 0.923879504}, {0.425000012, 0.125}},
+    {{-0.145581439, 0.0473022424, 0.369551808}, {1.0, 1.0, 1.0}, {-0.36395359, 0.118255608, 0.923879504}, {0.449999988, 0.125}},
+    {{-0.151188791, 0.0239459481, 0.369551808}, {1.0, 1.0, 1.0}, {-0.377971977, 0.0598648712, 0.923879504}, {0.474999994, 0.125}},
+    {{-0.15307337, -1.33820999e-08, 0.369551808}, {1.0, 1.0, 1.0}, {-0.382683426, -3.3455251e-08, 0.923879504}, {0.5, 0.125}},
+    {{-0.151188776, -0.0239459742, 0.369551808}, {1.0, 1.0, 1.0}, {-0.377971947, -0.0598649345, 0.923879504}, {0.524999976, 0.125}},
+    {{-0.145581424, -0.0473022684, 0.369551808}, {1.0, 1.0, 1.0}, {-0.363953561, -0.118255675, 0.923879504}, {0.550000012, 0.125}},
+    {{-0.136389375, -0.06949386, 0.369551808}, {1.0, 1.0, 1.0}, {-0.340973437, -0.17373465, 0.923879504}, {0.574999988, 0.125}},
+    {{-0.123838946, -0.0899742842, 0.369551808}, {1.0, 1.0, 1.0}, {-0.309597373, -0.22493571, 0.923879504}, {0.600000024, 0.125}},
+    {{-0.108239204, -0.108239233, 0.369551808}, {1.0, 1.0, 1.0}, {-0.270597994, -0.270598084, 0.923879504}, {0.625, 0.125}},
+    {{-0.0899742395, -0.123838976, 0.369551808}, {1.0, 1.0, 1.0}, {-0.224935591, -0.309597433, 0.923879504}, {0.649999976, 0.125}},
+    {{-0.0694938153, -0.13638939, 0.369551808}, {1.0, 1.0, 1.0}, {-0.173734546, -0.340973467, 0.923879504}, {0.675000012, 0.125}},
+    {{-0.0473022908, -0.145581424, 0.369551808}, {1.0, 1.0, 1.0}, {-0.118255727, -0.363953561, 0.923879504}, {0.699999988, 0.125}},
+    {{-0.0239459593, -0.151188776, 0.369551808}, {1.0, 1.0, 1.0}, {-0.0598648973, -0.377971947, 0.923879504}, {0.725000024, 0.125}},
+    {{1.82538162e-09, -0.15307337, 0.369551808}, {1.0, 1.0, 1.0}, {4.56345406e-09, -0.382683426, 0.923879504}, {0.75, 0.125}},
+    {{0.023945963, -0.151188776, 0.369551808}, {1.0, 1.0, 1.0}, {0.0598649085, -0.377971947, 0.923879504}, {0.774999976, 0.125}},
+    {{0.0473022945, -0.145581424, 0.369551808}, {1.0, 1.0, 1.0}, {0.118255734, -0.363953561, 0.923879504}, {0.800000012, 0.125}},
+    {{0.0694938824, -0.13638936, 0.369551808}, {1.0, 1.0, 1.0}, {0.17373471, -0.340973407, 0.923879504}, {0.824999988, 0.125}},
+    {{0.0899743065, -0.123838931, 0.369551808}, {1.0, 1.0, 1.0}, {0.22493577, -0.309597313, 0.923879504}, {0.850000024, 0.125}},
+    {{0.108239256, -0.108239181, 0.369551808}, {1.0, 1.0, 1.0}, {0.270598143, -0.270597965, 0.923879504}, {0.875, 0.125}},
+    {{0.123838991, -0.0899742171, 0.369551808}, {1.0, 1.0, 1.0}, {0.309597492, -0.224935547, 0.923879504}, {0.899999976, 0.125}},
+    {{0.136389375, -0.06949386, 0.369551808}, {1.0, 1.0, 1.0}, {0.340973437, -0.17373465, 0.923879504}, {0.925000012, 0.125}},
+    {{0.145581424, -0.0473022647, 0.369551808}, {1.0, 1.0, 1.0}, {0.363953561, -0.11825566, 0.923879504}, {0.949999988, 0.125}},
+    {{0.151188791, -0.0239459332, 0.369551808}, {1.0, 1.0, 1.0}, {0.377971977, -0.059864834, 0.923879504}, {0.975000024, 0.125}},
+    {{0.15307337, 2.67641997e-08, 0.369551808}, {1.0, 1.0, 1.0}, {0.382683426, 6.6910502e-08, 0.923879504}, {1.0, 0.125}},
+    {{0.18159622, 0.0, 0.356402606}, {1.0, 1.0, 1.0}, {0.453990549, 0.0, 0.891006529}, {0.0, 0.150000006}},
+    {{0.179360464, 0.028407909, 0.356402606}, {1.0, 1.0, 1.0}, {0.448401153, 0.0710197687, 0.891006529}, {0.0250000004, 0.150000006}},
+    {{0.172708273, 0.0561163202, 0.356402606}, {1.0, 1.0, 1.0}, {0.431770682, 0.140290797, 0.891006529}, {0.0500000007, 0.150000006}},
+    {{0.161803409, 0.0824429616, 0.356402606}, {1.0, 1.0, 1.0}, {0.404508531, 0.206107408, 0.891006529}, {0.075000003, 0.150000006}},
+    {{0.146914423, 0.106739581, 0.356402606}, {1.0, 1.0, 1.0}, {0.367286056, 0.266848952, 0.891006529}, {0.100000001, 0.150000006}},
+    {{0.12840791, 0.128407925, 0.356402606}, {1.0, 1.0, 1.0}, {0.321019769, 0.321019828, 0.891006529}, {0.125, 0.150000006}},
+    {{0.106739573, 0.146914437, 0.356402606}, {1.0, 1.0, 1.0}, {0.266848922, 0.367286086, 0.891006529}, {0.150000006, 0.150000006}},
+    {{0.0824429616, 0.161803409, 0.356402606}, {1.0, 1.0, 1.0}, {0.206107408, 0.404508531, 0.891006529}, {0.174999997, 0.150000006}},
+    {{0.0561163127, 0.172708273, 0.356402606}, {1.0, 1.0, 1.0}, {0.140290782, 0.431770682, 0.891006529}, {0.200000003, 0.150000006}},
+    {{0.0284078903, 0.179360464, 0.356402606}, {1.0, 1.0, 1.0}, {0.071019724, 0.448401153, 0.891006529}, {0.224999994, 0.150000006}},
+    {{-7.93782284e-09, 0.18159622, 0.356402606}, {1.0, 1.0, 1.0}, {-1.98445562e-08, 0.453990549, 0.891006529}, {0.25, 0.150000006}},
+    {{-0.0284079053, 0.179360464, 0.356402606}, {1.0, 1.0, 1.0}, {-0.0710197613, 0.448401153, 0.891006529}, {0.275000006, 0.150000006}},
+    {{-0.0561163276, 0.172708258, 0.356402606}, {1.0, 1.0, 1.0}, {-0.140290827, 0.431770653, 0.891006529}, {0.300000012, 0.150000006}},
+    {{-0.0824429765, 0.161803409, 0.356402606}, {1.0, 1.0, 1.0}, {-0.206107438, 0.404508531, 0.891006529}, {0.324999988, 0.150000006}},
+    {{-0.106739573, 0.146914437, 0.356402606}, {1.0, 1.0, 1.0}, {-0.266848922, 0.367286086, 0.891006529}, {0.349999994, 0.150000006}},
+    {{-0.128407925, 0.12840791, 0.356402606}, {1.0, 1.0, 1.0}, {-0.321019828, 0.321019769, 0.891006529}, {0.375, 0.150000006}},
+    {{-0.146914437, 0.106739566, 0.356402606}, {1.0, 1.0, 1.0}, {-0.367286086, 0.266848922, 0.891006529}, {0.400000006, 0.150000006}},
+    {{-0.161803424, 0.0824429393, 0.356402606}, {1.0, 1.0, 1.0}, {-0.404508561, 0.206107348, 0.891006529}, {0.425000012, 0.150000006}},
+    {{-0.172708273, 0.0561162829, 0.356402606}, {1.0, 1.0, 1.0}, {-0.431770682, 0.140290707, 0.891006529}, {0.449999988, 0.150000006}},
+    {{-0.179360464, 0.0284079034, 0.356402606}, {1.0, 1.0, 1.0}, {-0.448401153, 0.0710197613, 0.891006529}, {0.474999994, 0.150000006}},
+    {{-0.18159622, -1.58756457e-08, 0.356402606}, {1.0, 1.0, 1.0}, {-0.453990549, -3.96891124e-08, 0.891006529}, {0.5, 0.150000006}},
+    {{-0.179360464, -0.0284079351, 0.356402606}, {1.0, 1.0, 1.0}, {-0.448401153, -0.0710198358, 0.891006529}, {0.524999976, 0.150000006}},
+    {{-0.172708273, -0.0561163127, 0.356402606}, {1.0, 1.0, 1.0}, {-0.431770682, -0.140290782, 0.891006529}, {0.550000012, 0.150000006}},
+    {{-0.161803409, -0.0824429616, 0.356402606}, {1.0, 1.0, 1.0}, {-0.404508531, -0.206107408, 0.891006529}, {0.574999988, 0.150000006}},
+    {{-0.146914423, -0.106739596, 0.356402606}, {1.0, 1.0, 1.0}, {-0.367286056, -0.266848981, 0.891006529}, {0.600000024, 0.150000006}},
+    {{-0.128407896, -0.12840794, 0.356402606}, {1.0, 1.0, 1.0}, {-0.321019739, -0.321019858, 0.891006529}, {0.625, 0.150000006}},
+    {{-0.106739543, -0.146914452, 0.356402606}, {1.0, 1.0, 1.0}, {-0.266848862, -0.367286146, 0.891006529}, {0.649999976, 0.150000006}},
+    {{-0.0824429095, -0.161803439, 0.356402606}, {1.0, 1.0, 1.0}, {-0.206107274, -0.404508591, 0.891006529}, {0.675000012, 0.150000006}},
+    {{-0.0561163388, -0.172708258, 0.356402606}, {1.0, 1.0, 1.0}, {-0.140290841, -0.431770653, 0.891006529}, {0.699999988, 0.150000006}},
+    {{-0.0284079164, -0.179360464, 0.356402606}, {1.0, 1.0, 1.0}, {-0.0710197911, -0.448401153, 0.891006529}, {0.725000024, 0.150000006}},
+    {{2.1655131e-09, -0.18159622, 0.356402606}, {1.0, 1.0, 1.0}, {5.41378276e-09, -0.453990549, 0.891006529}, {0.75, 0.150000006}},
+    {{0.0284079202, -0.179360464, 0.356402606}, {1.0, 1.0, 1.0}, {0.0710197985, -0.448401153, 0.891006529}, {0.774999976, 0.150000006}},
+    {{0.0561163425, -0.172708258, 0.356402606}, {1.0, 1.0, 1.0}, {0.140290856, -0.431770653, 0.891006529}, {0.800000012, 0.150000006}},
+    {{0.0824429914, -0.161803395, 0.356402606}, {1.0, 1.0, 1.0}, {0.206107482, -0.404508471, 0.891006529}, {0.824999988, 0.150000006}},
+    {{0.106739618, -0.146914393, 0.356402606}, {1.0, 1.0, 1.0}, {0.266849041, -0.367285967, 0.891006529}, {0.850000024, 0.150000006}},
+    {{0.128407955, -0.128407881, 0.356402606}, {1.0, 1.0, 1.0}, {0.321019888, -0.321019709, 0.891006529}, {0.875, 0.150000006}},
+    {{0.146914467, -0.106739521, 0.356402606}, {1.0, 1.0, 1.0}, {0.367286175, -0.266848803, 0.891006529}, {0.899999976, 0.150000006}},
+    {{0.161803409, -0.0824429616, 0.356402606}, {1.0, 1.0, 1.0}, {0.404508531, -0.206107408, 0.891006529}, {0.925000012, 0.150000006}},
+    {{0.172708273, -0.056116309, 0.356402606}, {1.0, 1.0, 1.0}, {0.431770682, -0.140290767, 0.891006529}, {0.949999988, 0.150000006}},
+    {{0.179360479, -0.0284078885, 0.356402606}, {1.0, 1.0, 1.0}, {0.448401213, -0.071019724, 0.891006529}, {0.975000024, 0.150000006}},
+    {{0.18159622, 3.17512914e-08, 0.356402606}, {1.0, 1.0, 1.0}, {0.453990549, 7.93782249e-08, 0.891006529}, {1.0, 0.150000006}},
+    {{0.20899941, 0.0, 0.341056079}, {1.0, 1.0, 1.0}, {0.522498548, 0.0, 0.852640212}, {0.0, 0.174999997}},
+    {{0.206426278, 0.0326947123, 0.341056079}, {1.0, 1.0, 1.0}, {0.516065717, 0.0817367807, 0.852640212}, {0.0250000004, 0.174999997}},
+    {{0.198770255, 0.0645843744, 0.341056079}, {1.0, 1.0, 1.0}, {0.496925652, 0.161460936, 0.852640212}, {0.0500000007, 0.174999997}},
+    {{0.186219841, 0.0948837474, 0.341056079}, {1.0, 1.0, 1.0}, {0.465549588, 0.237209365, 0.852640212}, {0.075000003, 0.174999997}},
+    {{0.169084072, 0.122846775, 0.341056079}, {1.0, 1.0, 1.0}, {0.42271018, 0.307116926, 0.852640212}, {0.100000001, 0.174999997}},
+    {{0.147784904, 0.147784904, 0.341056079}, {1.0, 1.0, 1.0}, {0.369462252, 0.369462252, 0.852640212}, {0.125, 0.174999997}},
+    {{0.122846767, 0.169084072, 0.341056079}, {1.0, 1.0, 1.0}, {0.307116926, 0.42271018, 0.852640212}, {0.150000006, 0.174999997}},
+    {{0.0948837548, 0.186219841, 0.341056079}, {1.0, 1.0, 1.0}, {0.23720938, 0.465549588, 0.852640212}, {0.174999997, 0.174999997}},
+    {{0.0645843595, 0.198770255, 0.341056079}, {1.0, 1.0, 1.0}, {0.161460906, 0.496925652, 0.852640212}, {0.200000003, 0.174999997}},
+    {{0.0326946899, 0.206426278, 0.341056079}, {1.0, 1.0, 1.0}, {0.0817367285, 0.516065717, 0.852640212}, {0.224999994, 0.174999997}},
+    {{-9.1356549e-09, 0.20899941, 0.341056079}, {1.0, 1.0, 1.0}, {-2.28391368e-08, 0.522498548, 0.852640212}, {0.25, 0.174999997}},
+    {{-0.0326947086, 0.206426278, 0.341056079}, {1.0, 1.0, 1.0}, {-0.0817367733, 0.516065717, 0.852640212}, {0.275000006, 0.174999997}},
+    {{-0.0645843819, 0.198770255, 0.341056079}, {1.0, 1.0, 1.0}, {-0.161460951, 0.496925652, 0.852640212}, {0.300000012, 0.174999997}},
+    {{-0.0948837698, 0.186219826, 0.341056079}, {1.0, 1.0, 1.0}, {-0.237209424, 0.465549558, 0.852640212}, {0.324999988, 0.174999997}},
+    {{-0.12284676, 0.169084087, 0.341056079}, {1.0, 1.0, 1.0}, {-0.307116896, 0.42271021, 0.852640212}, {0.349999994, 0.174999997}},
+    {{-0.147784904, 0.147784904, 0.341056079}, {1.0, 1.0, 1.0}, {-0.369462252, 0.369462252, 0.852640212}, {0.375, 0.174999997}},
+    {{-0.169084087, 0.12284676, 0.341056079}, {1.0, 1.0, 1.0}, {-0.42271021, 0.307116896, 0.852640212}, {0.400000006, 0.174999997}},
+    {{-0.186219856, 0.094883725, 0.341056079}, {1.0, 1.0, 1.0}, {-0.465549648, 0.23720932, 0.852640212}, {0.425000012, 0.174999997}},
+    {{-0.19877027, 0.0645843297, 0.341056079}, {1.0, 1.0, 1.0}, {-0.496925682, 0.161460817, 0.852640212}, {0.449999988, 0.174999997}},
+    {{-0.206426278, 0.0326947048, 0.341056079}, {1.0, 1.0, 1.0}, {-0.516065717, 0.0817367584, 0.852640212}, {0.474999994, 0.174999997}},
+    {{-0.20899941, -1.82713098e-08, 0.341056079}, {1.0, 1.0, 1.0}, {-0.522498548, -4.56782736e-08, 0.852640212}, {0.5, 0.174999997}},
+    {{-0.206426278, -0.0326947421, 0.341056079}, {1.0, 1.0, 1.0}, {-0.516065717, -0.0817368552, 0.852640212}, {0.524999976, 0.174999997}},
+    {{-0.198770255, -0.064584367, 0.341056079}, {1.0, 1.0, 1.0}, {-0.496925652, -0.161460921, 0.852640212}, {0.550000012, 0.174999997}},
+    {{-0.186219841, -0.0948837548, 0.341056079}, {1.0, 1.0, 1.0}, {-0.465549588, -0.23720938, 0.852640212}, {0.574999988, 0.174999997}},
+    {{-0.169084057, -0.12284679, 0.341056079}, {1.0, 1.0, 1.0}, {-0.42271015, -0.307116985, 0.852640212}, {0.600000024, 0.174999997}},
+    {{-0.147784874, -0.147784919, 0.341056079}, {1.0, 1.0, 1.0}, {-0.369462192, -0.369462311, 0.852640212}, {0.625, 0.174999997}},
+    {{-0.12284673, -0.169084102, 0.341056079}, {1.0, 1.0, 1.0}, {-0.307116836, -0.42271024, 0.852640212}, {0.649999976, 0.174999997}},
+    {{-0.0948836878, -0.186219871, 0.341056079}, {1.0, 1.0, 1.0}, {-0.237209216, -0.465549678, 0.852640212}, {0.675000012, 0.174999997}},
+    {{-0.0645843893, -0.19877024, 0.341056079}, {1.0, 1.0, 1.0}, {-0.161460966, -0.496925592, 0.852640212}, {0.699999988, 0.174999997}},
+    {{-0.0326947235, -0.206426278, 0.341056079}, {1.0, 1.0, 1.0}, {-0.0817368105, -0.516065717, 0.852640212}, {0.725000024, 0.174999997}},
+    {{2.49229304e-09, -0.20899941, 0.341056079}, {1.0, 1.0, 1.0}, {6.23073237e-09, -0.522498548, 0.852640212}, {0.75, 0.174999997}},
+    {{0.0326947272, -0.206426278, 0.341056079}, {1.0, 1.0, 1.0}, {0.081736818, -0.516065717, 0.852640212}, {0.774999976, 0.174999997}},
+    {{0.0645843968, -0.19877024, 0.341056079}, {1.0, 1.0, 1.0}, {0.161460996, -0.496925592, 0.852640212}, {0.800000012, 0.174999997}},
+    {{0.0948837847, -0.186219811, 0.341056079}, {1.0, 1.0, 1.0}, {0.237209469, -0.465549529, 0.852640212}, {0.824999988, 0.174999997}},
+    {{0.122846819, -0.169084042, 0.341056079}, {1.0, 1.0, 1.0}, {0.307117045, -0.422710121, 0.852640212}, {0.850000024, 0.174999997}},
+    {{0.147784948, -0.147784844, 0.341056079}, {1.0, 1.0, 1.0}, {0.369462371, -0.369462103, 0.852640212}, {0.875, 0.174999997}},
+    {{0.169084117, -0.122846708, 0.341056079}, {1.0, 1.0, 1.0}, {0.422710299, -0.307116777, 0.852640212}, {0.899999976, 0.174999997}},
+    {{0.186219841, -0.0948837474, 0.341056079}, {1.0, 1.0, 1.0}, {0.465549588, -0.237209365, 0.852640212}, {0.925000012, 0.174999997}},
+    {{0.198770255, -0.0645843595, 0.341056079}, {1.0, 1.0, 1.0}, {0.496925652, -0.161460906, 0.852640212}, {0.949999988, 0.174999997}},
+    {{0.206426278, -0.0326946862, 0.341056079}, {1.0, 1.0, 1.0}, {0.516065717, -0.0817367136, 0.852640212}, {0.975000024, 0.174999997}},
+    {{0.20899941, 3.65426196e-08, 0.341056079}, {1.0, 1.0, 1.0}, {0.522498548, 9.13565472e-08, 0.852640212}, {1.0, 0.174999997}},
+    {{0.235114098, 0.0, 0.323606819}, {1.0, 1.0, 1.0}, {0.587785244, 0.0, 0.809017062}, {0.0, 0.200000003}},
+    {{0.232219458, 0.0367799476, 0.323606819}, {1.0, 1.0, 1.0}, {0.580548644, 0.0919498652, 0.809017062}, {0.0250000004, 0.200000003}},
+    {{0.223606795, 0.0726542547, 0.323606819}, {1.0, 1.0, 1.0}, {0.559017003, 0.181635633, 0.809017062}, {0.0500000007, 0.200000003}},
+    {{0.209488198, 0.106739566, 0.323606819}, {1.0, 1.0, 1.0}, {0.523720503, 0.266848922, 0.809017062}, {0.075000003, 0.200000003}},
+    {{0.190211296, 0.138196602, 0.323606819}, {1.0, 1.0, 1.0}, {0.47552824, 0.345491499, 0.809017062}, {0.100000001, 0.200000003}},
+    {{0.166250765, 0.16625078, 0.323606819}, {1.0, 1.0, 1.0}, {0.415626913, 0.415626943, 0.809017062}, {0.125, 0.200000003}},
+    {{0.138196588, 0.190211311, 0.323606819}, {1.0, 1.0, 1.0}, {0.345491469, 0.47552827, 0.809017062}, {0.150000006, 0.200000003}},
+    {{0.106739573, 0.209488198, 0.323606819}, {1.0, 1.0, 1.0}, {0.266848922, 0.523720503, 0.809017062}, {0.174999997, 0.200000003}},
+    {{0.0726542473, 0.223606795, 0.323606819}, {1.0, 1.0, 1.0}, {0.181635618, 0.559017003, 0.809017062}, {0.200000003, 0.200000003}},
+    {{0.0367799252, 0.232219458, 0.323606819}, {1.0, 1.0, 1.0}, {0.0919498131, 0.580548644, 0.809017062}, {0.224999994, 0.200000003}},
+    {{-1.0277164e-08, 0.235114098, 0.323606819}, {1.0, 1.0, 1.0}, {-2.56929091e-08, 0.587785244, 0.809017062}, {0.25, 0.200000003}},
+    {{-0.0367799439, 0.232219458, 0.323606819}, {1.0, 1.0, 1.0}, {-0.0919498578, 0.580548644, 0.809017062}, {0.275000006, 0.200000003}},
+    {{-0.0726542622, 0.223606795, 0.323606819}, {1.0, 1.0, 1.0}, {-0.181635648, 0.559017003, 0.809017062}, {0.300000012, 0.200000003}},
+    {{-0.106739588, 0.209488183, 0.323606819}, {1.0, 1.0, 1.0}, {-0.266848981, 0.523720443, 0.809017062}, {0.324999988, 0.200000003}},
+    {{-0.138196588, 0.190211311, 0.323606819}, {1.0, 1.0, 1.0}, {-0.345491469, 0.47552827, 0.809017062}, {0.349999994, 0.200000003}},
+    {{-0.16625078, 0.166250765, 0.323606819}, {1.0, 1.0, 1.0}, {-0.415626943, 0.415626913, 0.809017062}, {0.375, 0.200000003}},
+    {{-0.190211311, 0.138196588, 0.323606819}, {1.0, 1.0, 1.0}, {-0.47552827, 0.345491469, 0.809017062}, {0.400000006, 0.200000003}},
+    {{-0.209488213, 0.106739536, 0.323606819}, {1.0, 1.0, 1.0}, {-0.523720503, 0.266848832, 0.809017062}, {0.425000012, 0.200000003}},
+    {{-0.22360681, 0.07265421, 0.323606819}, {1.0, 1.0, 1.0}, {-0.559017003, 0.181635529, 0.809017062}, {0.449999988, 0.200000003}},
+    {{-0.232219458, 0.0367799439, 0.323606819}, {1.0, 1.0, 1.0}, {-0.580548644, 0.0919498578, 0.809017062}, {0.474999994, 0.200000003}},
+    {{-0.235114098, -2.0554328e-08, 0.323606819}, {1.0, 1.0, 1.0}, {-0.587785244, -5.13858183e-08, 0.809017062}, {0.5, 0.200000003}},
+    {{-0.232219443, -0.0367799848, 0.323606819}, {1.0, 1.0, 1.0}, {-0.580548584, -0.0919499621, 0.809017062}, {0.524999976, 0.200000003}},
+    {{-0.223606795, -0.0726542473, 0.323606819}, {1.0, 1.0, 1.0}, {-0.559017003, -0.181635618, 0.809017062}, {0.550000012, 0.200000003}},
+    {{-0.209488183, -0.106739573, 0.323606819}, {1.0, 1.0, 1.0}, {-0.523720443, -0.266848922, 0.809017062}, {0.574999988, 0.200000003}},
+    {{-0.190211281, -0.138196617, 0.323606819}, {1.0, 1.0, 1.0}, {-0.47552821, -0.345491529, 0.809017062}, {0.600000024, 0.200000003}},
+    {{-0.16625075, -0.166250795, 0.323606819}, {1.0, 1.0, 1.0}, {-0.415626884, -0.415627003, 0.809017062}, {0.625, 0.200000003}},
+    {{-0.138196558, -0.190211326, 0.323606819}, {1.0, 1.0, 1.0}, {-0.345491409, -0.4755283, 0.809017062}, {0.649999976, 0.200000003}},
+    {{-0.106739506, -0.209488228, 0.323606819}, {1.0, 1.0, 1.0}, {-0.266848773, -0.523720562, 0.809017062}, {0.675000012, 0.200000003}},
+    {{-0.0726542771, -0.22360678, 0.323606819}, {1.0, 1.0, 1.0}, {-0.181635693, -0.559016943, 0.809017062}, {0.699999988, 0.200000003}},
+    {{-0.0367799588, -0.232219458, 0.323606819}, {1.0, 1.0, 1.0}, {-0.091949895, -0.580548644, 0.809017062}, {0.725000024, 0.200000003}},
+    {{2.80370749e-09, -0.235114098, 0.323606819}, {1.0, 1.0, 1.0}, {7.00926872e-09, -0.587785244, 0.809017062}, {0.75, 0.200000003}},
+    {{0.0367799662, -0.232219443, 0.323606819}, {1.0, 1.0, 1.0}, {0.0919499174, -0.580548584, 0.809017062}, {0.774999976, 0.200000003}},
+    {{0.0726542845, -0.22360678, 0.323606819}, {1.0, 1.0, 1.0}, {0.181635708, -0.559016943, 0.809017062}, {0.800000012, 0.200000003}},
+    {{0.10673961, -0.209488168, 0.323606819}, {1.0, 1.0, 1.0}, {0.266849041, -0.523720443, 0.809017062}, {0.824999988, 0.200000003}},
+    {{0.138196647, -0.190211266, 0.323606819}, {1.0, 1.0, 1.0}, {0.345491618, -0.475528181, 0.809017062}, {0.850000024, 0.200000003}},
+    {{0.166250825, -0.166250721, 0.323606819}, {1.0, 1.0, 1.0}, {0.415627062, -0.415626794, 0.809017062}, {0.875, 0.200000003}},
+    {{0.190211356, -0.138196528, 0.323606819}, {1.0, 1.0, 1.0}, {0.475528389, -0.34549132, 0.809017062}, {0.899999976, 0.200000003}},
+    {{0.209488198, -0.106739573, 0.323606819}, {1.0, 1.0, 1.0}, {0.523720503, -0.266848922, 0.809017062}, {0.925000012, 0.200000003}},
+    {{0.223606795, -0.0726542398, 0.323606819}, {1.0, 1.0, 1.0}, {0.559017003, -0.181635603, 0.809017062}, {0.949999988, 0.200000003}},
+    {{0.232219458, -0.0367799215, 0.323606819}, {1.0, 1.0, 1.0}, {0.580548644, -0.0919498056, 0.809017062}, {0.975000024, 0.200000003}},
+    {{0.235114098, 4.1108656e-08, 0.323606819}, {1.0, 1.0, 1.0}, {0.587785244, 1.02771637e-07, 0.809017062}, {1.0, 0.200000003}},
+    {{0.259779215, 0.0, 0.304162383}, {1.0, 1.0, 1.0}, {0.649448037, 0.0, 0.760405958}, {0.0, 0.224999994}},
+    {{0.256580889, 0.0406384245, 0.304162383}, {1.0, 1.0, 1.0}, {0.641452193, 0.101596057, 0.760405958}, {0.0250000004, 0.224999994}},
+    {{0.24706471, 0.0802761912, 0.304162383}, {1.0, 1.0, 1.0}, {0.617661774, 0.200690478, 0.760405958}, {0.0500000007, 0.224999994}},
+    {{0.231464967, 0.117937297, 0.304162383}, {1.0, 1.0, 1.0}, {0.578662395, 0.294843256, 0.760405958}, {0.075000003, 0.224999994}},
+    {{0.210165799, 0.152694389, 0.304162383}, {1.0, 1.0, 1.0}, {0.525414467, 0.381735981, 0.760405958}, {0.100000001, 0.224999994}},
+    {{0.183691636, 0.183691651, 0.304162383}, {1.0, 1.0, 1.0}, {0.459229082, 0.459229112, 0.760405958}, {0.125, 0.224999994}},
+    {{0.152694389, 0.210165799, 0.304162383}, {1.0, 1.0, 1.0}, {0.381735981, 0.525414467, 0.760405958}, {0.150000006, 0.224999994}},
+    {{0.117937304, 0.231464967, 0.304162383}, {1.0, 1.0, 1.0}, {0.294843256, 0.578662395, 0.760405958}, {0.174999997, 0.224999994}},
+    {{0.0802761838, 0.247064725, 0.304162383}, {1.0, 1.0, 1.0}, {0.200690463, 0.617661834, 0.760405958}, {0.200000003, 0.224999994}},
+    {{0.0406383984, 0.256580919, 0.304162383}, {1.0, 1.0, 1.0}, {0.101595998, 0.641452312, 0.760405958}, {0.224999994, 0.224999994}},
+    {{-1.13553105e-08, 0.259779215, 0.304162383}, {1.0, 1.0, 1.0}, {-2.83882766e-08, 0.649448037, 0.760405958}, {0.25, 0.224999994}},
+    {{-0.0406384207, 0.256580889, 0.304162383}, {1.0, 1.0, 1.0}, {-0.10159605, 0.641452193, 0.760405958}, {0.275000006, 0.224999994}},
+    {{-0.0802762061, 0.24706471, 0.304162383}, {1.0, 1.0, 1.0}, {-0.200690508, 0.617661774, 0.760405958}, {0.300000012, 0.224999994}},
+    {{-0.117937319, 0.231464967, 0.304162383}, {1.0, 1.0, 1.0}, {-0.294843286, 0.578662395, 0.760405958}, {0.324999988, 0.224999994}},
+    {{-0.152694374, 0.210165814, 0.304162383}, {1.0, 1.0, 1.0}, {-0.381735921, 0.525414526, 0.760405958}, {0.349999994, 0.224999994}},
+    {{-0.183691651, 0.183691651, 0.304162383}, {1.0, 1.0, 1.0}, {-0.459229112, 0.459229112, 0.760405958}, {0.375, 0.224999994}},
+    {{-0.210165814, 0.152694374, 0.304162383}, {1.0, 1.0, 1.0}, {-0.525414526, 0.381735921, 0.760405958}, {0.400000006, 0.224999994}},
+    {{-0.231464997, 0.117937267, 0.304162383}, {1.0, 1.0, 1.0}, {-0.578662515, 0.294843167, 0.760405958}, {0.425000012, 0.224999994}},
+    {{-0.247064725, 0.0802761465, 0.304162383}, {1.0, 1.0, 1.0}, {-0.617661834, 0.200690359, 0.760405958}, {0.449999988, 0.224999994}},
+    {{-0.256580889, 0.040638417, 0.304162383}, {1.0, 1.0, 1.0}, {-0.641452193, 0.101596043, 0.760405958}, {0.474999994, 0.224999994}},
+    {{-0.259779215, -2.27106209e-08, 0.304162383}, {1.0, 1.0, 1.0}, {-0.649448037, -5.67765532e-08, 0.760405958}, {0.5, 0.224999994}},
+    {{-0.256580889, -0.0406384617, 0.304162383}, {1.0, 1.0, 1.0}, {-0.641452193, -0.101596154, 0.760405958}, {0.524999976, 0.224999994}},
+    {{-0.24706471, -0.0802761838, 0.304162383}, {1.0, 1.0, 1.0}, {-0.617661774, -0.200690463, 0.760405958}, {0.550000012, 0.224999994}},
+    {{-0.231464967, -0.117937304, 0.304162383}, {1.0, 1.0, 1.0}, {-0.578662395, -0.294843256, 0.760405958}, {0.574999988, 0.224999994}},
+    {{-0.210165784, -0.152694419, 0.304162383}, {1.0, 1.0, 1.0}, {-0.525414467, -0.38173604, 0.760405958}, {0.600000024, 0.224999994}},
+    {{-0.183691621, -0.18369168, 0.304162383}, {1.0, 1.0, 1.0}, {-0.459229052, -0.459229201, 0.760405958}, {0.625, 0.224999994}},
+    {{-0.152694345, -0.210165828, 0.304162383}, {1.0, 1.0, 1.0}, {-0.381735861, -0.525414586, 0.760405958}, {0.649999976, 0.224999994}},
+    {{-0.11793723, -0.231465012, 0.304162383}, {1.0, 1.0, 1.0}, {-0.294843078, -0.578662515, 0.760405958}, {0.675000012, 0.224999994}},
+    {{-0.080276221, -0.24706471, 0.304162383}, {1.0, 1.0, 1.0}, {-0.200690553, -0.617661774, 0.760405958}, {0.699999988, 0.224999994}},
+    {{-0.0406384356, -0.256580889, 0.304162383}, {1.0, 1.0, 1.0}, {-0.101596087, -0.641452193, 0.760405958}, {0.725000024, 0.224999994}},
+    {{3.09783599e-09, -0.259779215, 0.304162383}, {1.0, 1.0, 1.0}, {7.74458986e-09, -0.649448037, 0.760405958}, {0.75, 0.224999994}},
+    {{0.0406384431, -0.256580889, 0.304162383}, {1.0, 1.0, 1.0}, {0.10159611, -0.641452193, 0.760405958}, {0.774999976, 0.224999994}},
+    {{0.0802762285, -0.24706471, 0.304162383}, {1.0, 1.0, 1.0}, {0.200690567, -0.617661774, 0.760405958}, {0.800000012, 0.224999994}},
+    {{0.117937341, -0.231464952, 0.304162383}, {1.0, 1.0, 1.0}, {0.294843346, -0.578662395, 0.760405958}, {0.824999988, 0.224999994}},
+    {{0.152694449, -0.210165754, 0.304162383}, {1.0, 1.0, 1.0}, {0.38173613, -0.525414407, 0.760405958}, {0.850000024, 0.224999994}},
+    {{0.18369171, -0.183691576, 0.304162383}, {1.0, 1.0, 1.0}, {0.45922929, -0.459228933, 0.760405958}, {0.875, 0.224999994}},
+    {{0.210165858, -0.152694315, 0.304162383}, {1.0, 1.0, 1.0}, {0.525414646, -0.381735802, 0.760405958}, {0.899999976, 0.224999994}},
+    {{0.231464967, -0.117937297, 0.304162383}, {1.0, 1.0, 1.0}, {0.578662395, -0.294843256, 0.760405958}, {0.925000012, 0.224999994}},
+    {{0.247064725, -0.0802761838, 0.304162383}, {1.0, 1.0, 1.0}, {0.617661834, -0.200690463, 0.760405958}, {0.949999988, 0.224999994}},
+    {{0.256580919, -0.0406383947, 0.304162383}, {1.0, 1.0, 1.0}, {0.641452312, -0.101595983, 0.760405958}, {0.975000024, 0.224999994}},
+    {{0.259779215, 4.54212419e-08, 0.304162383}, {1.0, 1.0, 1.0}, {0.649448037, 1.13553106e-07, 0.760405958}, {1.0, 0.224999994}},
+    {{0.282842696, 0.0, 0.282842726}, {1.0, 1.0, 1.0}, {0.707106709, 0.0, 0.707106829}, {0.0, 0.25}},
+    {{0.279360443, 0.0442463458, 0.282842726}, {1.0, 1.0, 1.0}, {0.698401093, 0.110615864, 0.707106829}, {0.0250000004, 0.25}},
+    {{0.268999398, 0.0874032006, 0.282842726}, {1.0, 1.0, 1.0}, {0.672498465, 0.218508005, 0.707106829}, {0.0500000007, 0.25}},
+    {{0.252014697, 0.128407896, 0.282842726}, {1.0, 1.0, 1.0}, {0.630036712, 0.321019739, 0.707106829}, {0.075000003, 0.25}},
+    {{0.228824541, 0.166250765, 0.282842726}, {1.0, 1.0, 1.0}, {0.57206136, 0.415626913, 0.707106829}, {0.100000001, 0.25}},
+    {{0.199999988, 0.199999988, 0.282842726}, {1.0, 1.0, 1.0}, {0.49999997, 0.49999997, 0.707106829}, {0.125, 0.25}},
+    {{0.166250765, 0.228824556, 0.282842726}, {1.0, 1.0, 1.0}, {0.415626913, 0.572061419, 0.707106829}, {0.150000006, 0.25}},
+    {{0.12840791, 0.252014697, 0.282842726}, {1.0, 1.0, 1.0}, {0.321019769, 0.630036712, 0.707106829}, {0.174999997, 0.25}},
+    {{0.0874031931, 0.268999398, 0.282842726}, {1.0, 1.0, 1.0}, {0.218507975, 0.672498465, 0.707106829}, {0.200000003, 0.25}},
+    {{0.0442463197, 0.279360443, 0.282842726}, {1.0, 1.0, 1.0}, {0.110615797, 0.698401093, 0.707106829}, {0.224999994, 0.25}},
+    {{-1.23634472e-08, 0.282842696, 0.282842726}, {1.0, 1.0, 1.0}, {-3.09086161e-08, 0.707106709, 0.707106829}, {0.25, 0.25}},
+    {{-0.044246342, 0.279360443, 0.282842726}, {1.0, 1.0, 1.0}, {-0.110615857, 0.698401093, 0.707106829}, {0.275000006, 0.25}},
+    {{-0.0874032155, 0.268999398, 0.282842726}, {1.0, 1.0, 1.0}, {-0.218508035, 0.672498465, 0.707106829}, {0.300000012, 0.25}},
+    {{-0.128407925, 0.252014667, 0.282842726}, {1.0, 1.0, 1.0}, {-0.321019828, 0.630036652, 0.707106829}, {0.324999988, 0.25}},
+    {{-0.16625075, 0.228824556, 0.282842726}, {1.0, 1.0, 1.0}, {-0.415626884, 0.572061419, 0.707106829}, {0.349999994, 0.25}},
+    {{-0.199999988, 0.199999988, 0.282842726}, {1.0, 1.0, 1.0}, {-0.49999997, 0.49999997, 0.707106829}, {0.375, 0.25}},
+    {{-0.228824556, 0.16625075, 0.282842726}, {1.0, 1.0, 1.0}, {-0.572061419, 0.415626884, 0.707106829}, {0.400000006, 0.25}},
+    {{-0.252014697, 0.128407866, 0.282842726}, {1.0, 1.0, 1.0}, {-0.630036712, 0.32101965, 0.707106829}, {0.425000012, 0.25}},
+    {{-0.268999398, 0.0874031484, 0.282842726}, {1.0, 1.0, 1.0}, {-0.672498465, 0.218507871, 0.707106829}, {0.449999988, 0.25}},
+    {{-0.279360443, 0.0442463383, 0.282842726}, {1.0, 1.0, 1.0}, {-0.698401093, 0.110615849, 0.707106829}, {0.474999994, 0.25}},
+    {{-0.282842696, -2.47268943e-08, 0.282842726}, {1.0, 1.0, 1.0}, {-0.707106709, -6.18172322e-08, 0.707106829}, {0.5, 0.25}},
+    {{-0.279360414, -0.0442463867, 0.282842726}, {1.0, 1.0, 1.0}, {-0.698401034, -0.110615969, 0.707106829}, {0.524999976, 0.25}},
+    {{-0.268999398, -0.0874031931, 0.282842726}, {1.0, 1.0, 1.0}, {-0.672498465, -0.218507975, 0.707106829}, {0.550000012, 0.25}},
+    {{-0.252014697, -0.12840791, 0.282842726}, {1.0, 1.0, 1.0}, {-0.630036712, -0.321019769, 0.707106829}, {0.574999988, 0.25}},
+    {{-0.228824526, -0.166250795, 0.282842726}, {1.0, 1.0, 1.0}, {-0.5720613, -0.415627003, 0.707106829}, {0.600000024, 0.25}},
+    {{-0.199999958, -0.200000018, 0.282842726}, {1.0, 1.0, 1.0}, {-0.499999881, -0.50000006, 0.707106829}, {0.625, 0.25}},
+    {{-0.166250706, -0.228824586, 0.282842726}, {1.0, 1.0, 1.0}, {-0.415626764, -0.572061479, 0.707106829}, {0.649999976, 0.25}},
+    {{-0.128407821, -0.252014726, 0.282842726}, {1.0, 1.0, 1.0}, {-0.32101956, -0.630036831, 0.707106829}, {0.675000012, 0.25}},
+    {{-0.0874032304, -0.268999368, 0.282842726}, {1.0, 1.0, 1.0}, {-0.21850808, -0.672498405, 0.707106829}, {0.699999988, 0.25}},
+    {{-0.0442463607, -0.279360443, 0.282842726}, {1.0, 1.0, 1.0}, {-0.110615902, -0.698401093, 0.707106829}, {0.725000024, 0.25}},
+    {{3.37286532e-09, -0.282842696, 0.282842726}, {1.0, 1.0, 1.0}, {8.43216341e-09, -0.707106709, 0.707106829}, {0.75, 0.25}},
+    {{0.0442463681, -0.279360443, 0.282842726}, {1.0, 1.0, 1.0}, {0.110615924, -0.698401093, 0.707106829}, {0.774999976, 0.25}},
+    {{0.0874032378, -0.268999368, 0.282842726}, {1.0, 1.0, 1.0}, {0.218508095, -0.672498405, 0.707106829}, {0.800000012, 0.25}},
+    {{0.128407955, -0.252014667, 0.282842726}, {1.0, 1.0, 1.0}, {0.321019888, -0.630036652, 0.707106829}, {0.824999988, 0.25}},
+    {{0.166250825, -0.228824496, 0.282842726}, {1.0, 1.0, 1.0}, {0.415627062, -0.572061241, 0.707106829}, {0.850000024, 0.25}},
+    {{0.200000048, -0.199999928, 0.282842726}, {1.0, 1.0, 1.0}, {0.500000119, -0.499999821, 0.707106829}, {0.875, 0.25}},
+    {{0.228824615, -0.166250676, 0.282842726}, {1.0, 1.0, 1.0}, {0.572061539, -0.415626705, 0.707106829}, {0.899999976, 0.25}},
+    {{0.252014697, -0.128407896, 0.282842726}, {1.0, 1.0, 1.0}, {0.630036712, -0.321019739, 0.707106829}, {0.925000012, 0.25}},
+    {{0.268999398, -0.0874031857, 0.282842726}, {1.0, 1.0, 1.0}, {0.672498465, -0.21850796, 0.707106829}, {0.949999988, 0.25}},
+    {{0.279360443, -0.044246316, 0.282842726}, {1.0, 1.0, 1.0}, {0.698401093, -0.11061579, 0.707106829}, {0.975000024, 0.25}},
+    {{0.282842696, 4.94537886e-08, 0.282842726}, {1.0, 1.0, 1.0}, {0.707106709, 1.23634464e-07, 0.707106829}, {1.0, 0.25}},
+    {{0.304162383, 0.0, 0.259779245}, {1.0, 1.0, 1.0}, {0.760405958, 0.0, 0.649448097}, {0.0, 0.275000006}},
+    {{0.300417632, 0.0475814827, 0.259779245}, {1.0, 1.0, 1.0}, {0.751044095, 0.118953705, 0.649448097}, {0.0250000004, 0.275000006}},
+    {{0.289275616, 0.0939913467, 0.259779245}, {1.0, 1.0, 1.0}, {0.723189056, 0.234978363, 0.649448097}, {0.0500000007, 0.275000006}},
+    {{0.271010667, 0.138086841, 0.259779245}, {1.0, 1.0, 1.0}, {0.677526653, 0.345217109, 0.649448097}, {0.075000003, 0.275000006}},
+    {{0.246072531, 0.178782165, 0.259779245}, {1.0, 1.0, 1.0}, {0.615181327, 0.446955413, 0.649448097}, {0.100000001, 0.275000006}},
+    {{0.215075284, 0.215075284, 0.259779245}, {1.0, 1.0, 1.0}, {0.537688196, 0.537688196, 0.649448097}, {0.125, 0.275000006}},
+    {{0.17878215, 0.246072546, 0.259779245}, {1.0, 1.0, 1.0}, {0.446955383, 0.615181386, 0.649448097}, {0.150000006, 0.275000006}},
+    {{0.138086841, 0.271010667, 0.259779245}, {1.0, 1.0, 1.0}, {0.345217109, 0.677526653, 0.649448097}, {0.174999997, 0.275000006}},
+    {{0.0939913318, 0.289275616, 0.259779245}, {1.0, 1.0, 1.0}, {0.234978333, 0.723189056, 0.649448097}, {0.200000003, 0.275000006}},
+    {{0.0475814492, 0.300417632, 0.259779245}, {1.0, 1.0, 1.0}, {0.118953623, 0.751044095, 0.649448097}, {0.224999994, 0.275000006}},
+    {{-1.32953604e-08, 0.304162383, 0.259779245}, {1.0, 1.0, 1.0}, {-3.32384005e-08, 0.760405958, 0.649448097}, {0.25, 0.275000006}},
+    {{-0.0475814752, 0.300417632, 0.259779245}, {1.0, 1.0, 1.0}, {-0.11895369, 0.751044095, 0.649448097}, {0.275000006, 0.275000006}},
+    {{-0.0939913616, 0.289275616, 0.259779245}, {1.0, 1.0, 1.0}, {-0.234978408, 0.723189056, 0.649448097}, {0.300000012, 0.275000006}},
+    {{-0.13808687, 0.271010637, 0.259779245}, {1.0, 1.0, 1.0}, {-0.345217168, 0.677526593, 0.649448097}, {0.324999988, 0.275000006}},
+    {{-0.17878215, 0.246072546, 0.259779245}, {1.0, 1.0, 1.0}, {-0.446955383, 0.615181386, 0.649448097}, {0.349999994, 0.275000006}},
+    {{-0.215075284, 0.215075284, 0.259779245}, {1.0, 1.0, 1.0}, {-0.537688196, 0.537688196, 0.649448097}, {0.375, 0.275000006}},
+    {{-0.246072546, 0.17878215, 0.259779245}, {1.0, 1.0, 1.0}, {-0.615181386, 0.446955383, 0.649448097}, {0.400000006, 0.275000006}},
+    {{-0.271010697, 0.138086796, 0.259779245}, {1.0, 1.0, 1.0}, {-0.677526712, 0.34521699, 0.649448097}, {0.425000012, 0.275000006}},
+    {{-0.289275646, 0.0939912871, 0.259779245}, {1.0, 1.0, 1.0}, {-0.723189116, 0.234978214, 0.649448097}, {0.449999988, 0.275000006}},
+    {{-0.300417632, 0.0475814715, 0.259779245}, {1.0, 1.0, 1.0}, {-0.751044095, 0.118953675, 0.649448097}, {0.474999994, 0.275000006}},
+    {{-0.304162383, -2.65907207e-08, 0.259779245}, {1.0, 1.0, 1.0}, {-0.760405958, -6.6476801e-08, 0.649448097}, {0.5, 0.275000006}},
+    {{-0.300417632, -0.0475815237, 0.259779245}, {1.0, 1.0, 1.0}, {-0.751044095, -0.118953809, 0.649448097}, {0.524999976, 0.275000006}},
+    {{-0.289275616, -0.0939913392, 0.259779245}, {1.0, 1.0, 1.0}, {-0.723189056, -0.234978348, 0.649448097}, {0.550000012, 0.275000006}},
+    {{-0.271010667, -0.138086841, 0.259779245}, {1.0, 1.0, 1.0}, {-0.677526653, -0.345217109, 0.649448097}, {0.574999988, 0.275000006}},
+    {{-0.246072516, -0.178782195, 0.259779245}, {1.0, 1.0, 1.0}, {-0.615181267, -0.446955502, 0.649448097}, {0.600000024, 0.275000006}},
+    {{-0.215075254, -0.215075314, 0.259779245}, {1.0, 1.0, 1.0}, {-0.537688136, -0.537688255, 0.649448097}, {0.625, 0.275000006}},
+    {{-0.178782105, -0.246072575, 0.259779245}, {1.0, 1.0, 1.0}, {-0.446955264, -0.615181446, 0.649448097}, {0.649999976, 0.275000006}},
+    {{-0.138086751, -0.271010697, 0.259779245}, {1.0, 1.0, 1.0}, {-0.34521687, -0.677526712, 0.649448097}, {0.675000012, 0.275000006}},
+    {{-0.0939913765, -0.289275616, 0.259779245}, {1.0, 1.0, 1.0}, {-0.234978437, -0.723189056, 0.649448097}, {0.699999988, 0.275000006}},
+    {{-0.0475814939, -0.300417632, 0.259779245}, {1.0, 1.0, 1.0}, {-0.118953735, -0.751044095, 0.649448097}, {0.725000024, 0.275000006}},
+    {{3.62709995e-09, -0.304162383, 0.259779245}, {1.0, 1.0, 1.0}, {9.06775011e-09, -0.760405958, 0.649448097}, {0.75, 0.275000006}},
+    {{0.0475815013, -0.300417632, 0.259779245}, {1.0, 1.0, 1.0}, {0.11895375, -0.751044095, 0.649448097}, {0.774999976, 0.275000006}},
+    {{0.0939913839, -0.289275616, 0.259779245}, {1.0, 1.0, 1.0}, {0.234978467, -0.723189056, 0.649448097}, {0.800000012, 0.275000006}},
+    {{0.138086885, -0.271010637, 0.259779245}, {1.0, 1.0, 1.0}, {0.345217228, -0.677526593, 0.649448097}, {0.824999988, 0.275000006}},
+    {{0.178782225, -0.246072486, 0.259779245}, {1.0, 1.0, 1.0}, {0.446955562, -0.615181208, 0.649448097}, {0.850000024, 0.275000006}},
+    {{0.215075359, -0.21507521, 0.259779245}, {1.0, 1.0, 1.0}, {0.537688375, -0.537688017, 0.649448097}, {0.875, 0.275000006}},
+    {{0.246072605, -0.178782061, 0.259779245}, {1.0, 1.0, 1.0}, {0.615181506, -0.446955144, 0.649448097}, {0.899999976, 0.275000006}},
+    {{0.271010667, -0.138086841, 0.259779245}, {1.0, 1.0, 1.0}, {0.677526653, -0.345217109, 0.649448097}, {0.925000012, 0.275000006}},
+    {{0.289275616, -0.0939913318, 0.259779245}, {1.0, 1.0, 1.0}, {0.723189056, -0.234978333, 0.649448097}, {0.949999988, 0.275000006}},
+    {{0.300417632, -0.0475814454, 0.259779245}, {1.0, 1.0, 1.0}, {0.751044095, -0.118953615, 0.649448097}, {0.975000024, 0.275000006}},
+    {{0.304162383, 5.31814415e-08, 0.259779245}, {1.0, 1.0, 1.0}, {0.760405958, 1.32953602e-07, 0.649448097}, {1.0, 0.275000006}},
+    {{0.323606789, 0.0, 0.235114112}, {1.0, 1.0, 1.0}, {0.809016943, 0.0, 0.587785304}, {0.0, 0.300000012}},
+    {{0.319622666, 0.0506232567, 0.235114112}, {1.0, 1.0, 1.0}, {0.799056649, 0.12655814, 0.587785304}, {0.0250000004, 0.300000012}},
+    {{0.307768345, 0.100000001, 0.235114112}, {1.0, 1.0, 1.0}, {0.769420862, 0.25, 0.587785304}, {0.0500000007, 0.300000012}},
+    {{0.28833577, 0.146914408, 0.235114112}, {1.0, 1.0, 1.0}, {0.720839441, 0.367286026, 0.587785304}, {0.075000003, 0.300000012}},
+    {{0.261803389, 0.190211296, 0.235114112}, {1.0, 1.0, 1.0}, {0.654508471, 0.47552824, 0.587785304}, {0.100000001, 0.300000012}},
+    {{0.228824556, 0.228824556, 0.235114112}, {1.0, 1.0, 1.0}, {0.572061419, 0.572061419, 0.587785304}, {0.125, 0.300000012}},
+    {{0.190211296, 0.261803389, 0.235114112}, {1.0, 1.0, 1.0}, {0.47552824, 0.654508471, 0.587785304}, {0.150000006, 0.300000012}},
+    {{0.146914423, 0.28833577, 0.235114112}, {1.0, 1.0, 1.0}, {0.367286056, 0.720839441, 0.587785304}, {0.174999997, 0.300000012}},
+    {{0.0999999866, 0.307768345, 0.235114112}, {1.0, 1.0, 1.0}, {0.24999997, 0.769420862, 0.587785304}, {0.200000003, 0.300000012}},
+    {{0.0506232232, 0.319622666, 0.235114112}, {1.0, 1.0, 1.0}, {0.126558065, 0.799056649, 0.587785304}, {0.224999994, 0.300000012}},
+    {{-1.41453027e-08, 0.323606789, 0.235114112}, {1.0, 1.0, 1.0}, {-3.53632572e-08, 0.809016943, 0.587785304}, {0.25, 0.300000012}},
+    {{-0.050623253, 0.319622666, 0.235114112}, {1.0, 1.0, 1.0}, {-0.126558125, 0.799056649, 0.587785304}, {0.275000006, 0.300000012}},
+    {{-0.100000016, 0.307768345, 0.235114112}, {1.0, 1.0, 1.0}, {-0.25000003, 0.769420862, 0.587785304}, {0.300000012, 0.300000012}},
+    {{-0.146914437, 0.288335741, 0.235114112}, {1.0, 1.0, 1.0}, {-0.367286086, 0.720839381, 0.587785304}, {0.324999988, 0.300000012}},
+    {{-0.190211281, 0.261803389, 0.235114112}, {1.0, 1.0, 1.0}, {-0.47552821, 0.654508471, 0.587785304}, {0.349999994, 0.300000012}},
+    {{-0.228824556, 0.228824556, 0.235114112}, {1.0, 1.0, 1.0}, {-0.572061419, 0.572061419, 0.587785304}, {0.375, 0.300000012}},
+    {{-0.261803418, 0.190211281, 0.235114112}, {1.0, 1.0, 1.0}, {-0.654508531, 0.47552821, 0.587785304}, {0.400000006, 0.300000012}},
+    {{-0.28833577, 0.146914363, 0.235114112}, {1.0, 1.0, 1.0}, {-0.720839441, 0.367285907, 0.587785304}, {0.425000012, 0.300000012}},
+    {{-0.307768375, 0.0999999344, 0.235114112}, {1.0, 1.0, 1.0}, {-0.769420922, 0.249999836, 0.587785304}, {0.449999988, 0.300000012}},
+    {{-0.319622666, 0.0506232493, 0.235114112}, {1.0, 1.0, 1.0}, {-0.799056649, 0.126558125, 0.587785304}, {0.474999994, 0.300000012}},
+    {{-0.323606789, -2.82906054e-08, 0.235114112}, {1.0, 1.0, 1.0}, {-0.809016943, -7.07265144e-08, 0.587785304}, {0.5, 0.300000012}},
+    {{-0.319622636, -0.0506233051, 0.235114112}, {1.0, 1.0, 1.0}, {-0.79905659, -0.126558259, 0.587785304}, {0.524999976, 0.300000012}},
+    {{-0.307768345, -0.0999999866, 0.235114112}, {1.0, 1.0, 1.0}, {-0.769420862, -0.24999997, 0.587785304}, {0.550000012, 0.300000012}},
+    {{-0.288335741, -0.146914423, 0.235114112}, {1.0, 1.0, 1.0}, {-0.720839381, -0.367286056, 0.587785304}, {0.574999988, 0.300000012}},
+    {{-0.261803359, -0.190211326, 0.235114112}, {1.0, 1.0, 1.0}, {-0.654508412, -0.4755283, 0.587785304}, {0.600000024, 0.300000012}},
+    {{-0.228824511, -0.228824601, 0.235114112}, {1.0, 1.0, 1.0}, {-0.5720613, -0.572061479, 0.587785304}, {0.625, 0.300000012}},
+    {{-0.190211236, -0.261803448, 0.235114112}, {1.0, 1.0, 1.0}, {-0.475528091, -0.654508591, 0.587785304}, {0.649999976, 0.300000012}},
+    {{-0.146914318, -0.2883358, 0.235114112}, {1.0, 1.0, 1.0}, {-0.367285788, -0.7208395, 0.587785304}, {0.675000012, 0.300000012}},
+    {{-0.100000031, -0.307768345, 0.235114112}, {1.0, 1.0, 1.0}, {-0.250000089, -0.769420862, 0.587785304}, {0.699999988, 0.300000012}},
+    {{-0.0506232716, -0.319622636, 0.235114112}, {1.0, 1.0, 1.0}, {-0.126558185, -0.79905659, 0.587785304}, {0.725000024, 0.300000012}},
+    {{3.85897225e-09, -0.323606789, 0.235114112}, {1.0, 1.0, 1.0}, {9.64743041e-09, -0.809016943, 0.587785304}, {0.75, 0.300000012}},
+    {{0.0506232791, -0.319622636, 0.235114112}, {1.0, 1.0, 1.0}, {0.1265582, -0.79905659, 0.587785304}, {0.774999976, 0.300000012}},
+    {{0.100000039, -0.307768345, 0.235114112}, {1.0, 1.0, 1.0}, {0.250000089, -0.769420862, 0.587785304}, {0.800000012, 0.300000012}},
+    {{0.146914467, -0.288335741, 0.235114112}, {1.0, 1.0, 1.0}, {0.367286175, -0.720839381, 0.587785304}, {0.824999988, 0.300000012}},
+    {{0.190211371, -0.261803329, 0.235114112}, {1.0, 1.0, 1.0}, {0.475528419, -0.654508352, 0.587785304}, {0.850000024, 0.300000012}},
+    {{0.22882463, -0.228824481, 0.235114112}, {1.0, 1.0, 1.0}, {0.572061598, -0.572061181, 0.587785304}, {0.875, 0.300000012}},
+    {{0.261803478, -0.190211192, 0.235114112}, {1.0, 1.0, 1.0}, {0.65450871, -0.475527972, 0.587785304}, {0.899999976, 0.300000012}},
+    {{0.28833577, -0.146914408, 0.235114112}, {1.0, 1.0, 1.0}, {0.720839441, -0.367286026, 0.587785304}, {0.925000012, 0.300000012}},
+    {{0.307768345, -0.0999999866, 0.235114112}, {1.0, 1.0, 1.0}, {0.769420862, -0.24999997, 0.587785304}, {0.949999988, 0.300000012}},
+    {{0.319622666, -0.0506232195, 0.235114112}, {1.0, 1.0, 1.0}, {0.799056649, -0.126558051, 0.587785304}, {0.975000024, 0.300000012}},
+    {{0.323606789, 5.65812108e-08, 0.235114112}, {1.0, 1.0, 1.0}, {0.809016943, 1.41453029e-07, 0.587785304}, {1.0, 0.300000012}},
+    {{0.341056079, 0.0, 0.208999425}, {1.0, 1.0, 1.0}, {0.852640212, 0.0, 0.522498548}, {0.0, 0.324999988}},
+    {{0.33685711, 0.0533529259, 0.208999425}, {1.0, 1.0, 1.0}, {0.842142761, 0.13338232, 0.522498548}, {0.0250000004, 0.324999988}},
+    {{0.324363619, 0.105392128, 0.208999425}, {1.0, 1.0, 1.0}, {0.810909033, 0.263480306, 0.522498548}, {0.0500000007, 0.324999988}},
+    {{0.303883195, 0.154836223, 0.208999425}, {1.0, 1.0, 1.0}, {0.759707987, 0.387090564, 0.522498548}, {0.075000003, 0.324999988}},
+    {{0.275920153, 0.200467736, 0.208999425}, {1.0, 1.0, 1.0}, {0.689800382, 0.501169324, 0.522498548}, {0.100000001, 0.324999988}},
+    {{0.24116306, 0.241163075, 0.208999425}, {1.0, 1.0, 1.0}, {0.602907658, 0.602907658, 0.522498548}, {0.125, 0.324999988}},
+    {{0.200467721, 0.275920182, 0.208999425}, {1.0, 1.0, 1.0}, {0.501169324, 0.689800441, 0.522498548}, {0.150000006, 0.324999988}},
+    {{0.154836223, 0.303883195, 0.208999425}, {1.0, 1.0, 1.0}, {0.387090564, 0.759707987, 0.522498548}, {0.174999997, 0.324999988}},
+    {{0.105392113, 0.324363619, 0.208999425}, {1.0, 1.0, 1.0}, {0.263480276, 0.810909033, 0.522498548}, {0.200000003, 0.324999988}},
+    {{0.0533528924, 0.33685711, 0.208999425}, {1.0, 1.0, 1.0}, {0.133382231, 0.842142761, 0.522498548}, {0.224999994, 0.324999988}},
+    {{-1.49080357e-08, 0.341056079, 0.208999425}, {1.0, 1.0, 1.0}, {-3.7270091e-08, 0.852640212, 0.522498548}, {0.25, 0.324999988}},
+    {{-0.0533529222, 0.33685711, 0.208999425}, {1.0, 1.0, 1.0}, {-0.133382306, 0.842142761, 0.522498548}, {0.275000006, 0.324999988}},
+    {{-0.105392143, 0.324363589, 0.208999425}, {1.0, 1.0, 1.0}, {-0.263480365, 0.810908973, 0.522498548}, {0.300000012, 0.324999988}},
+    {{-0.154836252, 0.303883165, 0.208999425}, {1.0, 1.0, 1.0}, {-0.387090623, 0.759707928, 0.522498548}, {0.324999988, 0.324999988}},
+    {{-0.200467721, 0.275920182, 0.208999425}, {1.0, 1.0, 1.0}, {-0.501169324, 0.689800441, 0.522498548}, {0.349999994, 0.324999988}},
+    {{-0.24116306, 0.24116306, 0.208999425}, {1.0, 1.0, 1.0}, {-0.602907658, 0.602907658, 0.522498548}, {0.375, 0.324999988}},
+    {{-0.275920182, 0.200467721, 0.208999425}, {1.0, 1.0, 1.0}, {-0.689800441, 0.501169324, 0.522498548}, {0.400000006, 0.324999988}},
+    {{-0.303883225, 0.154836178, 0.208999425}, {1.0, 1.0, 1.0}, {-0.759708047, 0.387090445, 0.522498548}, {0.425000012, 0.324999988}},
+    {{-0.324363619, 0.105392061, 0.208999425}, {1.0, 1.0, 1.0}, {-0.810909033, 0.263480157, 0.522498548}, {0.449999988, 0.324999988}},
+    {{-0.33685711, 0.0533529185, 0.208999425}, {1.0, 1.0, 1.0}, {-0.842142761, 0.133382291, 0.522498548}, {0.474999994, 0.324999988}},
+    {{-0.341056079, -2.98160714e-08, 0.208999425}, {1.0, 1.0, 1.0}, {-0.852640212, -7.4540182e-08, 0.522498548}, {0.5, 0.324999988}},
+    {{-0.33685711, -0.0533529744, 0.208999425}, {1.0, 1.0, 1.0}, {-0.842142761, -0.13338244, 0.522498548}, {0.524999976, 0.324999988}},
+    {{-0.324363619, -0.105392113, 0.208999425}, {1.0, 1.0, 1.0}, {-0.810909033, -0.263480276, 0.522498548}, {0.550000012, 0.324999988}},
+    {{-0.303883195, -0.154836237, 0.208999425}, {1.0, 1.0, 1.0}, {-0.759707987, -0.387090594, 0.522498548}, {0.574999988, 0.324999988}},
+    {{-0.275920153, -0.200467765, 0.208999425}, {1.0, 1.0, 1.0}, {-0.689800382, -0.501169443, 0.522498548}, {0.600000024, 0.324999988}},
+    {{-0.24116303, -0.241163105, 0.208999425}, {1.0, 1.0, 1.0}, {-0.602907598, -0.602907777, 0.522498548}, {0.625, 0.324999988}},
+    {{-0.200467676, -0.275920212, 0.208999425}, {1.0, 1.0, 1.0}, {-0.501169205, -0.689800501, 0.522498548}, {0.649999976, 0.324999988}},
+    {{-0.154836133, -0.303883225, 0.208999425}, {1.0, 1.0, 1.0}, {-0.387090325, -0.759708047, 0.522498548}, {0.675000012, 0.324999988}},
+    {{-0.105392165, -0.324363589, 0.208999425}, {1.0, 1.0, 1.0}, {-0.263480425, -0.810908973, 0.522498548}, {0.699999988, 0.324999988}},
+    {{-0.0533529446, -0.33685711, 0.208999425}, {1.0, 1.0, 1.0}, {-0.133382365, -0.842142761, 0.522498548}, {0.725000024, 0.324999988}},
+    {{4.06705292e-09, -0.341056079, 0.208999425}, {1.0, 1.0, 1.0}, {1.01676321e-08, -0.852640212, 0.522498548}, {0.75, 0.324999988}},
+    {{0.053352952, -0.33685711, 0.208999425}, {1.0, 1.0, 1.0}, {0.13338238, -0.842142761, 0.522498548}, {0.774999976, 0.324999988}},
+    {{0.105392173, -0.324363589, 0.208999425}, {1.0, 1.0, 1.0}, {0.263480425, -0.810908973, 0.522498548}, {0.800000012, 0.324999988}},
+    {{0.154836282, -0.303883165, 0.208999425}, {1.0, 1.0, 1.0}, {0.387090713, -0.759707928, 0.522498548}, {0.824999988, 0.324999988}},
+    {{0.20046781, -0.275920123, 0.208999425}, {1.0, 1.0, 1.0}, {0.501169503, -0.689800322, 0.522498548}, {0.850000024, 0.324999988}},
+    {{0.241163149, -0.241162986, 0.208999425}, {1.0, 1.0, 1.0}, {0.602907896, -0.602907479, 0.522498548}, {0.875, 0.324999988}},
+    {{0.275920242, -0.200467631, 0.208999425}, {1.0, 1.0, 1.0}, {0.68980062, -0.501169086, 0.522498548}, {0.899999976, 0.324999988}},
+    {{0.303883195, -0.154836223, 0.208999425}, {1.0, 1.0, 1.0}, {0.759707987, -0.387090564, 0.522498548}, {0.925000012, 0.324999988}},
+    {{0.324363619, -0.105392106, 0.208999425}, {1.0, 1.0, 1.0}, {0.810909033, -0.263480276, 0.522498548}, {0.949999988, 0.324999988}},
+    {{0.33685711, -0.0533528887, 0.208999425}, {1.0, 1.0, 1.0}, {0.842142761, -0.133382216, 0.522498548}, {0.975000024, 0.324999988}},
+    {{0.341056079, 5.96321428e-08, 0.208999425}, {1.0, 1.0, 1.0}, {0.852640212, 1.49080364e-07, 0.522498548}, {1.0, 0.324999988}},
+    {{0.356402606, 0.0, 0.181596234}, {1.0, 1.0, 1.0}, {0.891006529, 0.0, 0.453990579}, {0.0, 0.349999994}},
+    {{0.352014691, 0.055753652, 0.181596234}, {1.0, 1.0, 1.0}, {0.880036712, 0.139384136, 0.453990579}, {0.0250000004, 0.349999994}},
+    {{0.338959008, 0.110134467, 0.181596234}, {1.0, 1.0, 1.0}, {0.847397506, 0.275336176, 0.453990579}, {0.0500000007, 0.349999994}},
+    {{0.317557037, 0.161803395, 0.181596234}, {1.0, 1.0, 1.0}, {0.793892622, 0.404508471, 0.453990579}, {0.075000003, 0.349999994}},
+    {{0.28833577, 0.209488198, 0.181596234}, {1.0, 1.0, 1.0}, {0.720839441, 0.523720503, 0.453990579}, {0.100000001, 0.349999994}},
+    {{0.252014697, 0.252014697, 0.181596234}, {1.0, 1.0, 1.0}, {0.630036712, 0.630036712, 0.453990579}, {0.125, 0.349999994}},
+    {{0.209488183, 0.28833577, 0.181596234}, {1.0, 1.0, 1.0}, {0.523720443, 0.720839441, 0.453990579}, {0.150000006, 0.349999994}},
+    {{0.161803409, 0.317557037, 0.181596234}, {1.0, 1.0, 1.0}, {0.404508531, 0.793892622, 0.453990579}, {0.174999997, 0.349999994}},
+    {{0.110134453, 0.338959038, 0.181596234}, {1.0, 1.0, 1.0}, {0.275336146, 0.847397566, 0.453990579}, {0.200000003, 0.349999994}},
+    {{0.0557536148, 0.352014691, 0.181596234}, {1.0, 1.0, 1.0}, {0.139384031, 0.880036712, 0.453990579}, {0.224999994, 0.349999994}},
+    {{-1.55788538e-08, 0.356402606, 0.181596234}, {1.0, 1.0, 1.0}, {-3.89471353e-08, 0.891006529, 0.453990579}, {0.25, 0.349999994}},
+    {{-0.0557536483, 0.352014691, 0.181596234}, {1.0, 1.0, 1.0}, {-0.139384121, 0.880036712, 0.453990579}, {0.275000006, 0.349999994}},
+    {{-0.110134482, 0.338959008, 0.181596234}, {1.0, 1.0, 1.0}, {-0.275336206, 0.847397506, 0.453990579}, {0.300000012, 0.349999994}},
+    {{-0.161803439, 0.317557037, 0.181596234}, {1.0, 1.0, 1.0}, {-0.404508591, 0.793892622, 0.453990579}, {0.324999988, 0.349999994}},
+    {{-0.209488183, 0.28833577, 0.181596234}, {1.0, 1.0, 1.0}, {-0.523720443, 0.720839441, 0.453990579}, {0.349999994, 0.349999994}},
+    {{-0.252014697, 0.252014697, 0.181596234}, {1.0, 1.0, 1.0}, {-0.630036712, 0.630036712, 0.453990579}, {0.375, 0.349999994}},
+    {{-0.28833577, 0.209488168, 0.181596234}, {1.0, 1.0, 1.0}, {-0.720839441, 0.523720443, 0.453990579}, {0.400000006, 0.349999994}},
+    {{-0.317557067, 0.16180335, 0.181596234}, {1.0, 1.0, 1.0}, {-0.793892682, 0.404508382, 0.453990579}, {0.425000012, 0.349999994}},
+    {{-0.338959038, 0.110134393, 0.181596234}, {1.0, 1.0, 1.0}, {-0.847397566, 0.275335968, 0.453990579}, {0.449999988, 0.349999994}},
+    {{-0.352014691, 0.0557536446, 0.181596234}, {1.0, 1.0, 1.0}, {-0.880036712, 0.139384106, 0.453990579}, {0.474999994, 0.349999994}},
+    {{-0.356402606, -3.11577075e-08, 0.181596234}, {1.0, 1.0, 1.0}, {-0.891006529, -7.78942706e-08, 0.453990579}, {0.5, 0.349999994}},
+    {{-0.352014691, -0.0557537042, 0.181596234}, {1.0, 1.0, 1.0}, {-0.880036712, -0.139384255, 0.453990579}, {0.524999976, 0.349999994}},
+    {{-0.338959008, -0.110134453, 0.181596234}, {1.0, 1.0, 1.0}, {-0.847397506, -0.275336146, 0.453990579}, {0.550000012, 0.349999994}},
+    {{-0.317557037, -0.161803409, 0.181596234}, {1.0, 1.0, 1.0}, {-0.793892622, -0.404508531, 0.453990579}, {0.574999988, 0.349999994}},
+    {{-0.288335741, -0.209488228, 0.181596234}, {1.0, 1.0, 1.0}, {-0.720839381, -0.523720562, 0.453990579}, {0.600000024, 0.349999994}},
+    {{-0.252014667, -0.252014756, 0.181596234}, {1.0, 1.0, 1.0}, {-0.630036652, -0.630036891, 0.453990579}, {0.625, 0.349999994}},
+    {{-0.209488124, -0.2883358, 0.181596234}, {1.0, 1.0, 1.0}, {-0.523720324, -0.7208395, 0.453990579}, {0.649999976, 0.349999994}},
+    {{-0.161803305, -0.317557096, 0.181596234}, {1.0, 1.0, 1.0}, {-0.404508263, -0.793892741, 0.453990579}, {0.675000012, 0.349999994}},
+    {{-0.110134505, -0.338959008, 0.181596234}, {1.0, 1.0, 1.0}, {-0.275336266, -0.847397506, 0.453990579}, {0.699999988, 0.349999994}},
+    {{-0.0557536706, -0.352014691, 0.181596234}, {1.0, 1.0, 1.0}, {-0.13938418, -0.880036712, 0.453990579}, {0.725000024, 0.349999994}},
+    {{4.25005853e-09, -0.356402606, 0.181596234}, {1.0, 1.0, 1.0}, {1.06251461e-08, -0.891006529, 0.453990579}, {0.75, 0.349999994}},
+    {{0.0557536781, -0.352014691, 0.181596234}, {1.0, 1.0, 1.0}, {0.139384195, -0.880036712, 0.453990579}, {0.774999976, 0.349999994}},
+    {{0.110134512, -0.338959008, 0.181596234}, {1.0, 1.0, 1.0}, {0.275336266, -0.847397506, 0.453990579}, {0.800000012, 0.349999994}},
+    {{0.161803469, -0.317557007, 0.181596234}, {1.0, 1.0, 1.0}, {0.40450868, -0.793892503, 0.453990579}, {0.824999988, 0.349999994}},
+    {{0.209488273, -0.288335711, 0.181596234}, {1.0, 1.0, 1.0}, {0.523720682, -0.720839262, 0.453990579}, {0.850000024, 0.349999994}},
+    {{0.252014786, -0.252014607, 0.181596234}, {1.0, 1.0, 1.0}, {0.63003695, -0.630036533, 0.453990579}, {0.875, 0.349999994}},
+    {{0.28833586, -0.209488079, 0.181596234}, {1.0, 1.0, 1.0}, {0.72083962, -0.523720205, 0.453990579}, {0.899999976, 0.349999994}},
+    {{0.317557037, -0.161803409, 0.181596234}, {1.0, 1.0, 1.0}, {0.793892622, -0.404508531, 0.453990579}, {0.925000012, 0.349999994}},
+    {{0.338959038, -0.110134445, 0.181596234}, {1.0, 1.0, 1.0}, {0.847397566, -0.275336117, 0.453990579}, {0.949999988, 0.349999994}},
+    {{0.352014691, -0.055753611, 0.181596234}, {1.0, 1.0, 1.0}, {0.880036712, -0.139384031, 0.453990579}, {0.975000024, 0.349999994}},
+    {{0.356402606, 6.23154151e-08, 0.181596234}, {1.0, 1.0, 1.0}, {0.891006529, 1.55788541e-07, 0.453990579}, {1.0, 0.349999994}},
+    {{0.369551808, 0.0, 0.153073385}, {1.0, 1.0, 1.0}, {0.923879504, 0.0, 0.382683456}, {0.0, 0.375}},
+    {{0.365002006, 0.0578106418, 0.153073385}, {1.0, 1.0, 1.0}, {0.912505031, 0.144526601, 0.382683456}, {0.0250000004, 0.375}},
+    {{0.351464659, 0.114197791, 0.153073385}, {1.0, 1.0, 1.0}, {0.878661633, 0.285494477, 0.382683456}, {0.0500000007, 0.375}},
+    {{0.329273075, 0.167773008, 0.153073385}, {1.0, 1.0, 1.0}, {0.823182702, 0.419432521, 0.382683456}, {0.075000003, 0.375}},
+    {{0.29897368, 0.217217103, 0.153073385}, {1.0, 1.0, 1.0}, {0.747434199, 0.543042779, 0.382683456}, {0.100000001, 0.375}},
+    {{0.261312574, 0.261312604, 0.153073385}, {1.0, 1.0, 1.0}, {0.65328145, 0.65328151, 0.382683456}, {0.125, 0.375}},
+    {{0.217217088, 0.298973709, 0.153073385}, {1.0, 1.0, 1.0}, {0.543042719, 0.747434258, 0.382683456}, {0.150000006, 0.375}},
+    {{0.167773023, 0.329273075, 0.153073385}, {1.0, 1.0, 1.0}, {0.419432551, 0.823182702, 0.382683456}, {0.174999997, 0.375}},
+    {{0.114197776, 0.351464659, 0.153073385}, {1.0, 1.0, 1.0}, {0.285494447, 0.878661633, 0.382683456}, {0.200000003, 0.375}},
+    {{0.0578106046, 0.365002006, 0.153073385}, {1.0, 1.0, 1.0}, {0.144526511, 0.912505031, 0.382683456}, {0.224999994, 0.375}},
+    {{-1.61536224e-08, 0.369551808, 0.153073385}, {1.0, 1.0, 1.0}, {-4.03840552e-08, 0.923879504, 0.382683456}, {0.25, 0.375}},
+    {{-0.0578106344, 0.365002006, 0.153073385}, {1.0, 1.0, 1.0}, {-0.144526586, 0.912505031, 0.382683456}, {0.275000006, 0.375}},
+    {{-0.114197806, 0.351464659, 0.153073385}, {1.0, 1.0, 1.0}, {-0.285494506, 0.878661633, 0.382683456}, {0.300000012, 0.375}},
+    {{-0.167773053, 0.329273045, 0.153073385}, {1.0, 1.0, 1.0}, {-0.41943264, 0.823182583, 0.382683456}, {0.324999988, 0.375}},
+    {{-0.217217088, 0.298973709, 0.153073385}, {1.0, 1.0, 1.0}, {-0.543042719, 0.747434258, 0.382683456}, {0.349999994, 0.375}},
+    {{-0.261312604, 0.261312574, 0.153073385}, {1.0, 1.0, 1.0}, {-0.65328151, 0.65328145, 0.382683456}, {0.375, 0.375}},
+    {{-0.298973709, 0.217217088, 0.153073385}, {1.0, 1.0, 1.0}, {-0.747434258, 0.543042719, 0.382683456}, {0.400000006, 0.375}},
+    {{-0.329273105, 0.167772964, 0.153073385}, {1.0, 1.0, 1.0}, {-0.823182762, 0.419432402, 0.382683456}, {0.425000012, 0.375}},
+    {{-0.351464689, 0.114197716, 0.153073385}, {1.0, 1.0, 1.0}, {-0.878661752, 0.285494298, 0.382683456}, {0.449999988, 0.375}},
+    {{-0.365002006, 0.0578106306, 0.153073385}, {1.0, 1.0, 1.0}, {-0.912505031, 0.144526571, 0.382683456}, {0.474999994, 0.375}},
+    {{-0.369551808, -3.23072449e-08, 0.153073385}, {1.0, 1.0, 1.0}, {-0.923879504, -8.07681104e-08, 0.382683456}, {0.5, 0.375}},
+    {{-0.365002006, -0.057810694, 0.153073385}, {1.0, 1.0, 1.0}, {-0.912505031, -0.144526735, 0.382683456}, {0.524999976, 0.375}},
+    {{-0.351464659, -0.114197783, 0.153073385}, {1.0, 1.0, 1.0}, {-0.878661633, -0.285494447, 0.382683456}, {0.550000012, 0.375}},
+    {{-0.329273075, -0.167773023, 0.153073385}, {1.0, 1.0, 1.0}, {-0.823182702, -0.419432551, 0.382683456}, {0.574999988, 0.375}},
+    {{-0.29897368, -0.217217132, 0.153073385}, {1.0, 1.0, 1.0}, {-0.747434199, -0.543042839, 0.382683456}, {0.600000024, 0.375}},
+    {{-0.261312544, -0.261312634, 0.153073385}, {1.0, 1.0, 1.0}, {-0.653281331, -0.653281569, 0.382683456}, {0.625, 0.375}},
+    {{-0.217217028, -0.298973739, 0.153073385}, {1.0, 1.0, 1.0}, {-0.543042541, -0.747434378, 0.382683456}, {0.649999976, 0.375}},
+    {{-0.167772919, -0.329273134, 0.153073385}, {1.0, 1.0, 1.0}, {-0.419432282, -0.823182821, 0.382683456}, {0.675000012, 0.375}},
+    {{-0.114197828, -0.351464629, 0.153073385}, {1.0, 1.0, 1.0}, {-0.285494566, -0.878661573, 0.382683456}, {0.699999988, 0.375}},
+    {{-0.0578106567, -0.365002006, 0.153073385}, {1.0, 1.0, 1.0}, {-0.144526646, -0.912505031, 0.382683456}, {0.725000024, 0.375}},
+    {{4.4068611e-09, -0.369551808, 0.153073385}, {1.0, 1.0, 1.0}, {1.10171525e-08, -0.923879504, 0.382683456}, {0.75, 0.375}},
+    {{0.0578106679, -0.365002006, 0.153073385}, {1.0, 1.0, 1.0}, {0.144526675, -0.912505031, 0.382683456}, {0.774999976, 0.375}},
+    {{0.114197835, -0.351464629, 0.153073385}, {1.0, 1.0, 1.0}, {0.285494596, -0.878661573, 0.382683456}, {0.800000012, 0.375}},
+    {{0.167773083, -0.329273045, 0.153073385}, {1.0, 1.0, 1.0}, {0.4194327, -0.823182583, 0.382683456}, {0.824999988, 0.375}},
+    {{0.217217177, -0.29897362, 0.153073385}, {1.0, 1.0, 1.0}, {0.543042958, -0.74743402, 0.382683456}, {0.850000024, 0.375}},
+    {{0.261312664, -0.261312515, 0.153073385}, {1.0, 1.0, 1.0}, {0.653281689, -0.653281271, 0.382683456}, {0.875, 0.375}},
+    {{0.298973769, -0.217216983, 0.153073385}, {1.0, 1.0, 1.0}, {0.747434437, -0.543042481, 0.382683456}, {0.899999976, 0.375}},
+    {{0.329273075, -0.167773008, 0.153073385}, {1.0, 1.0, 1.0}, {0.823182702, -0.419432521, 0.382683456}, {0.925000012, 0.375}},
+    {{0.351464659, -0.114197776, 0.153073385}, {1.0, 1.0, 1.0}, {0.878661633, -0.285494447, 0.382683456}, {0.949999988, 0.375}},
+    {{0.365002006, -0.0578105971, 0.153073385}, {1.0, 1.0, 1.0}, {0.912505031, -0.144526497, 0.382683456}, {0.975000024, 0.375}},
+    {{0.369551808, 6.46144898e-08, 0.153073385}, {1.0, 1.0, 1.0}, {0.923879504, 1.61536221e-07, 0.382683456}, {1.0, 0.375}},
+    {{0.380422622, 0.0, 0.123606801}, {1.0, 1.0, 1.0}, {0.95105654, 0.0, 0.309017003}, {0.0, 0.400000006}},
+    {{0.375738978, 0.0595112108, 0.123606801}, {1.0, 1.0, 1.0}, {0.939347446, 0.148778021, 0.309017003}, {0.0250000004, 0.400000006}},
+    {{0.361803412, 0.117557056, 0.123606801}, {1.0, 1.0, 1.0}, {0.904508531, 0.293892652, 0.309017003}, {0.0500000007, 0.400000006}},
+    {{0.338959038, 0.172708258, 0.123606801}, {1.0, 1.0, 1.0}, {0.847397566, 0.431770653, 0.309017003}, {0.075000003, 0.400000006}},
+    {{0.307768375, 0.22360681, 0.123606801}, {1.0, 1.0, 1.0}, {0.769420922, 0.559017003, 0.309017003}, {0.100000001, 0.400000006}},
+    {{0.268999398, 0.268999428, 0.123606801}, {1.0, 1.0, 1.0}, {0.672498465, 0.672498584, 0.309017003}, {0.125, 0.400000006}},
+    {{0.223606795, 0.307768375, 0.123606801}, {1.0, 1.0, 1.0}, {0.559017003, 0.769420922, 0.309017003}, {0.150000006, 0.400000006}},
+    {{0.172708273, 0.338959038, 0.123606801}, {1.0, 1.0, 1.0}, {0.431770682, 0.847397566, 0.309017003}, {0.174999997, 0.400000006}},
+    {{0.117557041, 0.361803412, 0.123606801}, {1.0, 1.0, 1.0}, {0.293892592, 0.904508531, 0.309017003}, {0.200000003, 0.400000006}},
+    {{0.0595111735, 0.375739008, 0.123606801}, {1.0, 1.0, 1.0}, {0.148777932, 0.939347506, 0.309017003}, {0.224999994, 0.400000006}},
+    {{-1.66288014e-08, 0.380422622, 0.123606801}, {1.0, 1.0, 1.0}, {-4.15720045e-08, 0.95105654, 0.309017003}, {0.25, 0.400000006}},
+    {{-0.0595112033, 0.375738978, 0.123606801}, {1.0, 1.0, 1.0}, {-0.148778006, 0.939347446, 0.309017003}, {0.275000006, 0.400000006}},
+    {{-0.117557071, 0.361803412, 0.123606801}, {1.0, 1.0, 1.0}, {-0.293892682, 0.904508531, 0.309017003}, {0.300000012, 0.400000006}},
+    {{-0.172708303, 0.338959008, 0.123606801}, {1.0, 1.0, 1.0}, {-0.431770742, 0.847397506, 0.309017003}, {0.324999988, 0.400000006}},
+    {{-0.223606795, 0.307768375, 0.123606801}, {1.0, 1.0, 1.0}, {-0.559017003, 0.769420922, 0.309017003}, {0.349999994, 0.400000006}},
+    {{-0.268999428, 0.268999428, 0.123606801}, {1.0, 1.0, 1.0}, {-0.672498584, 0.672498584, 0.309017003}, {0.375, 0.400000006}},
+    {{-0.307768375, 0.22360678, 0.123606801}, {1.0, 1.0, 1.0}, {-0.769420922, 0.559016943, 0.309017003}, {0.400000006, 0.400000006}},
+    {{-0.338959068, 0.172708213, 0.123606801}, {1.0, 1.0, 1.0}, {-0.847397685, 0.431770533, 0.309017003}, {0.425000012, 0.400000006}},
+    {{-0.361803442, 0.117556982, 0.123606801}, {1.0, 1.0, 1.0}, {-0.904508591, 0.293892443, 0.309017003}, {0.449999988, 0.400000006}},
+    {{-0.375738978, 0.0595111996, 0.123606801}, {1.0, 1.0, 1.0}, {-0.939347446, 0.148777992, 0.309017003}, {0.474999994, 0.400000006}},
+    {{-0.380422622, -3.32576029e-08, 0.123606801}, {1.0, 1.0, 1.0}, {-0.95105654, -8.3144009e-08, 0.309017003}, {0.5, 0.400000006}},
+    {{-0.375738978, -0.0595112666, 0.123606801}, {1.0, 1.0, 1.0}, {-0.939347446, -0.14877817, 0.309017003}, {0.524999976, 0.400000006}},
+    {{-0.361803412, -0.117557049, 0.123606801}, {1.0, 1.0, 1.0}, {-0.904508531, -0.293892622, 0.309017003}, {0.550000012, 0.400000006}},
+    {{-0.338959038, -0.172708273, 0.123606801}, {1.0, 1.0, 1.0}, {-0.847397566, -0.431770682, 0.309017003}, {0.574999988, 0.400000006}},
+    {{-0.307768345, -0.22360684, 0.123606801}, {1.0, 1.0, 1.0}, {-0.769420862, -0.559017122, 0.309017003}, {0.600000024, 0.400000006}},
+    {{-0.268999368, -0.268999457, 0.123606801}, {1.0, 1.0, 1.0}, {-0.672498405, -0.672498643, 0.309017003}, {0.625, 0.400000006}},
+    {{-0.223606735, -0.307768404, 0.123606801}, {1.0, 1.0, 1.0}, {-0.559016824, -0.769420981, 0.309017003}, {0.649999976, 0.400000006}},
+    {{-0.172708154, -0.338959098, 0.123606801}, {1.0, 1.0, 1.0}, {-0.431770384, -0.847397745, 0.309017003}, {0.675000012, 0.400000006}},
+    {{-0.117557094, -0.361803412, 0.123606801}, {1.0, 1.0, 1.0}, {-0.293892741, -0.904508531, 0.309017003}, {0.699999988, 0.400000006}},
+    {{-0.0595112294, -0.375738978, 0.123606801}, {1.0, 1.0, 1.0}, {-0.148778081, -0.939347446, 0.309017003}, {0.725000024, 0.400000006}},
+    {{4.53649429e-09, -0.380422622, 0.123606801}, {1.0, 1.0, 1.0}, {1.13412355e-08, -0.95105654, 0.309017003}, {0.75, 0.400000006}},
+    {{0.0595112368, -0.375738978, 0.123606801}, {1.0, 1.0, 1.0}, {0.148778096, -0.939347446, 0.309017003}, {0.774999976, 0.400000006}},
+    {{0.117557108, -0.361803383, 0.123606801}, {1.0, 1.0, 1.0}, {0.293892771, -0.904508471, 0.309017003}, {0.800000012, 0.400000006}},
+    {{0.172708333, -0.338959008, 0.123606801}, {1.0, 1.0, 1.0}, {0.431770831, -0.847397506, 0.309017003}, {0.824999988, 0.400000006}},
+    {{0.223606884, -0.307768315, 0.123606801}, {1.0, 1.0, 1.0}, {0.559017181, -0.769420803, 0.309017003}, {0.850000024, 0.400000006}},
+    {{0.268999517, -0.268999338, 0.123606801}, {1.0, 1.0, 1.0}, {0.672498822, -0.672498345, 0.309017003}, {0.875, 0.400000006}},
+    {{0.307768464, -0.223606691, 0.123606801}, {1.0, 1.0, 1.0}, {0.76942116, -0.559016705, 0.309017003}, {0.899999976, 0.400000006}},
+    {{0.338959038, -0.172708258, 0.123606801}, {1.0, 1.0, 1.0}, {0.847397566, -0.431770653, 0.309017003}, {0.925000012, 0.400000006}},
+    {{0.361803412, -0.117557041, 0.123606801}, {1.0, 1.0, 1.0}, {0.904508531, -0.293892592, 0.309017003}, {0.949999988, 0.400000006}},
+    {{0.375739008, -0.0595111661, 0.123606801}, {1.0, 1.0, 1.0}, {0.939347506, -0.148777917, 0.309017003}, {0.975000024, 0.400000006}},
+    {{0.380422622, 6.65152058e-08, 0.123606801}, {1.0, 1.0, 1.0}, {0.95105654, 1.66288018e-07, 0.309017003}, {1.0, 0.400000006}},
+    {{0.388947964, 0.0, 0.0933781415}, {1.0, 1.0, 1.0}, {0.972369909, 0.0, 0.233445346}, {0.0, 0.425000012}},
+    {{0.384159356, 0.0608448684, 0.0933781415}, {1.0, 1.0, 1.0}, {0.960398376, 0.152112171, 0.233445346}, {0.0250000004, 0.425000012}},
+    {{0.369911492, 0.120191537, 0.0933781415}, {1.0, 1.0, 1.0}, {0.9247787, 0.300478846, 0.233445346}, {0.0500000007, 0.425000012}},
+    {{0.346555173, 0.176578686, 0.0933781415}, {1.0, 1.0, 1.0}, {0.866387963, 0.441446722, 0.233445346}, {0.075000003, 0.425000012}},
+    {{0.314665496, 0.228617877, 0.0933781415}, {1.0, 1.0, 1.0}, {0.786663771, 0.571544707, 0.233445346}, {0.100000001, 0.425000012}},
+    {{0.275027722, 0.275027752, 0.0933781415}, {1.0, 1.0, 1.0}, {0.68756932, 0.68756938, 0.233445346}, {0.125, 0.425000012}},
+    {{0.228617862, 0.314665526, 0.0933781415}, {1.0, 1.0, 1.0}, {0.571544647, 0.78666383, 0.233445346}, {0.150000006, 0.425000012}},
+    {{0.176578686, 0.346555173, 0.0933781415}, {1.0, 1.0, 1.0}, {0.441446722, 0.866387963, 0.233445346}, {0.174999997, 0.425000012}},
+    {{0.120191514, 0.369911492, 0.0933781415}, {1.0, 1.0, 1.0}, {0.300478786, 0.9247787, 0.233445346}, {0.200000003, 0.425000012}},
+    {{0.0608448274, 0.384159386, 0.0933781415}, {1.0, 1.0, 1.0}, {0.152112067, 0.960398436, 0.233445346}, {0.224999994, 0.425000012}},
+    {{-1.70014562e-08, 0.388947964, 0.0933781415}, {1.0, 1.0, 1.0}, {-4.25036397e-08, 0.972369909, 0.233445346}, {0.25, 0.425000012}},
+    {{-0.060844861, 0.384159356, 0.0933781415}, {1.0, 1.0, 1.0}, {-0.152112156, 0.960398376, 0.233445346}, {0.275000006, 0.425000012}},
+    {{-0.120191552, 0.369911492, 0.0933781415}, {1.0, 1.0, 1.0}, {-0.300478876, 0.9247787, 0.233445346}, {0.300000012, 0.425000012}},
+    {{-0.176578715, 0.346555144, 0.0933781415}, {1.0, 1.0, 1.0}, {-0.441446781, 0.866387844, 0.233445346}, {0.324999988, 0.425000012}},
+    {{-0.228617862, 0.314665526, 0.0933781415}, {1.0, 1.0, 1.0}, {-0.571544647, 0.78666383, 0.233445346}, {0.349999994, 0.425000012}},
+    {{-0.275027752, 0.275027752, 0.0933781415}, {1.0, 1.0, 1.0}, {-0.68756938, 0.68756938, 0.233445346}, {0.375, 0.425000012}},
+    {{-0.314665526, 0.228617862, 0.0933781415}, {1.0, 1.0, 1.0}, {-0.78666383, 0.571544647, 0.233445346}, {0.400000006, 0.425000012}},
+    {{-0.346555203, 0.176578641, 0.0933781415}, {1.0, 1.0, 1.0}, {-0.866388023, 0.441446602, 0.233445346}, {0.425000012, 0.425000012}},
+    {{-0.369911522, 0.120191455, 0.0933781415}, {1.0, 1.0, 1.0}, {-0.924778819, 0.300478637, 0.233445346}, {0.449999988, 0.425000012}},
+    {{-0.384159356, 0.0608448572, 0.0933781415}, {1.0, 1.0, 1.0}, {-0.960398376, 0.152112141, 0.233445346}, {0.474999994, 0.425000012}},
+    {{-0.388947964, -3.40029125e-08, 0.0933781415}, {1.0, 1.0, 1.0}, {-0.972369909, -8.50072794e-08, 0.233445346}, {0.5, 0.425000012}},
+    {{-0.384159356, -0.0608449243, 0.0933781415}, {1.0, 1.0, 1.0}, {-0.960398376, -0.152112305, 0.233445346}, {0.524999976, 0.425000012}},
+    {{-0.369911492, -0.120191522, 0.0933781415}, {1.0, 1.0, 1.0}, {-0.9247787, -0.300478816, 0.233445346}, {0.550000012, 0.425000012}},
+    {{-0.346555173, -0.176578701, 0.0933781415}, {1.0, 1.0, 1.0}, {-0.866387963, -0.441446751, 0.233445346}, {0.574999988, 0.425000012}},
+    {{-0.314665496, -0.228617907, 0.0933781415}, {1.0, 1.0, 1.0}, {-0.786663771, -0.571544766, 0.233445346}, {0.600000024, 0.425000012}},
+    {{-0.275027692, -0.275027782, 0.0933781415}, {1.0, 1.0, 1.0}, {-0.687569261, -0.687569439, 0.233445346}, {0.625, 0.425000012}},
+    {{-0.228617802, -0.314665556, 0.0933781415}, {1.0, 1.0, 1.0}, {-0.571544528, -0.78666389, 0.233445346}, {0.649999976, 0.425000012}},
+    {{-0.176578581, -0.346555233, 0.0933781415}, {1.0, 1.0, 1.0}, {-0.441446453, -0.866388083, 0.233445346}, {0.675000012, 0.425000012}},
+    {{-0.120191574, -0.369911492, 0.0933781415}, {1.0, 1.0, 1.0}, {-0.300478935, -0.9247787, 0.233445346}, {0.699999988, 0.425000012}},
+    {{-0.060844887, -0.384159356, 0.0933781415}, {1.0, 1.0, 1.0}, {-0.152112216, -0.960398376, 0.233445346}, {0.725000024, 0.425000012}},
+    {{4.63815786e-09, -0.388947964, 0.0933781415}, {1.0, 1.0, 1.0}, {1.15953949e-08, -0.972369909, 0.233445346}, {0.75, 0.425000012}},
+    {{0.0608448945, -0.384159356, 0.0933781415}, {1.0, 1.0, 1.0}, {0.152112231, -0.960398376, 0.233445346}, {0.774999976, 0.425000012}},
+    {{0.120191582, -0.369911492, 0.0933781415}, {1.0, 1.0, 1.0}, {0.300478965, -0.9247787, 0.233445346}, {0.800000012, 0.425000012}},
+    {{0.176578745, -0.346555144, 0.0933781415}, {1.0, 1.0, 1.0}, {0.441446871, -0.866387844, 0.233445346}, {0.824999988, 0.425000012}},
+    {{0.228617966, -0.314665437, 0.0933781415}, {1.0, 1.0, 1.0}, {0.571544886, -0.786663592, 0.233445346}, {0.850000024, 0.425000012}},
+    {{0.275027841, -0.275027663, 0.0933781415}, {1.0, 1.0, 1.0}, {0.687569618, -0.687569141, 0.233445346}, {0.875, 0.425000012}},
+    {{0.314665616, -0.228617758, 0.0933781415}, {1.0, 1.0, 1.0}, {0.786664009, -0.571544409, 0.233445346}, {0.899999976, 0.425000012}},
+    {{0.346555173, -0.176578686, 0.0933781415}, {1.0, 1.0, 1.0}, {0.866387963, -0.441446722, 0.233445346}, {0.925000012, 0.425000012}},
+    {{0.369911492, -0.120191514, 0.0933781415}, {1.0, 1.0, 1.0}, {0.9247787, -0.300478786, 0.233445346}, {0.949999988, 0.425000012}},
+    {{0.384159386, -0.0608448237, 0.0933781415}, {1.0, 1.0, 1.0}, {0.960398436, -0.152112067, 0.233445346}, {0.975000024, 0.425000012}},
+    {{0.388947964, 6.8005825e-08, 0.0933781415}, {1.0, 1.0, 1.0}, {0.972369909, 1.70014559e-07, 0.233445346}, {1.0, 0.425000012}},
+    {{0.395075351, 0.0, 0.0625737682}, {1.0, 1.0, 1.0}, {0.987688363, 0.0, 0.156434417}, {0.0, 0.449999988}},
+    {{0.390211314, 0.0618034042, 0.0625737682}, {1.0, 1.0, 1.0}, {0.9755283, 0.154508516, 0.156434417}, {0.0250000004, 0.449999988}},
+    {{0.375738978, 0.122084998, 0.0625737682}, {1.0, 1.0, 1.0}, {0.939347446, 0.305212498, 0.156434417}, {0.0500000007, 0.449999988}},
+    {{0.35201472, 0.179360464, 0.0625737682}, {1.0, 1.0, 1.0}, {0.880036831, 0.448401153, 0.156434417}, {0.075000003, 0.449999988}},
+    {{0.319622666, 0.232219473, 0.0625737682}, {1.0, 1.0, 1.0}, {0.799056649, 0.580548704, 0.156434417}, {0.100000001, 0.449999988}},
+    {{0.279360443, 0.279360473, 0.0625737682}, {1.0, 1.0, 1.0}, {0.698401093, 0.698401213, 0.156434417}, {0.125, 0.449999988}},
+    {{0.232219458, 0.319622666, 0.0625737682}, {1.0, 1.0, 1.0}, {0.580548644, 0.799056649, 0.156434417}, {0.150000006, 0.449999988}},
+    {{0.179360464, 0.35201472, 0.0625737682}, {1.0, 1.0, 1.0}, {0.448401153, 0.880036831, 0.156434417}, {0.174999997, 0.449999988}},
+    {{0.122084983, 0.375738978, 0.0625737682}, {1.0, 1.0, 1.0}, {0.305212468, 0.939347446, 0.156434417}, {0.200000003, 0.449999988}},
+    {{0.0618033633, 0.390211314, 0.0625737682}, {1.0, 1.0, 1.0}, {0.154508412, 0.9755283, 0.156434417}, {0.224999994, 0.449999988}},
+    {{-1.72692936e-08, 0.395075351, 0.0625737682}, {1.0, 1.0, 1.0}, {-4.31732339e-08, 0.987688363, 0.156434417}, {0.25, 0.449999988}},
+    {{-0.0618033968, 0.390211314, 0.0625737682}, {1.0, 1.0, 1.0}, {-0.154508486, 0.9755283, 0.156434417}, {0.275000006, 0.449999988}},
+    {{-0.12208502, 0.375738978, 0.0625737682}, {1.0, 1.0, 1.0}, {-0.305212557, 0.939347446, 0.156434417}, {0.300000012, 0.449999988}},
+    {{-0.179360494, 0.352014691, 0.0625737682}, {1.0, 1.0, 1.0}, {-0.448401242, 0.880036712, 0.156434417}, {0.324999988, 0.449999988}},
+    {{-0.232219443, 0.319622695, 0.0625737682}, {1.0, 1.0, 1.0}, {-0.580548584, 0.799056768, 0.156434417}, {0.349999994, 0.449999988}},
+    {{-0.279360473, 0.279360443, 0.0625737682}, {1.0, 1.0, 1.0}, {-0.698401213, 0.698401093, 0.156434417}, {0.375, 0.449999988}},
+    {{-0.319622695, 0.232219443, 0.0625737682}, {1.0, 1.0, 1.0}, {-0.799056768, 0.580548584, 0.156434417}, {0.400000006, 0.449999988}},
+    {{-0.35201475, 0.179360405, 0.0625737682}, {1.0, 1.0, 1.0}, {-0.880036891, 0.448401004, 0.156434417}, {0.425000012, 0.449999988}},
+    {{-0.375739008, 0.122084923, 0.0625737682}, {1.0, 1.0, 1.0}, {-0.939347506, 0.305212319, 0.156434417}, {0.449999988, 0.449999988}},
+    {{-0.390211314, 0.0618033931, 0.0625737682}, {1.0, 1.0, 1.0}, {-0.9755283, 0.154508486, 0.156434417}, {0.474999994, 0.449999988}},
+    {{-0.395075351, -3.45385871e-08, 0.0625737682}, {1.0, 1.0, 1.0}, {-0.987688363, -8.63464678e-08, 0.156434417}, {0.5, 0.449999988}},
+    {{-0.390211314, -0.0618034601, 0.0625737682}, {1.0, 1.0, 1.0}, {-0.9755283, -0.15450865, 0.156434417}, {0.524999976, 0.449999988}},
+    {{-0.375738978, -0.12208499, 0.0625737682}, {1.0, 1.0, 1.0}, {-0.939347446, -0.305212468, 0.156434417}, {0.550000012, 0.449999988}},
+    {{-0.35201472, -0.179360464, 0.0625737682}, {1.0, 1.0, 1.0}, {-0.880036831, -0.448401153, 0.156434417}, {0.574999988, 0.449999988}},
+    {{-0.319622636, -0.232219502, 0.0625737682}, {1.0, 1.0, 1.0}, {-0.79905659, -0.580548763, 0.156434417}, {0.600000024, 0.449999988}},
+    {{-0.279360414, -0.279360503, 0.0625737682}, {1.0, 1.0, 1.0}, {-0.698401034, -0.698401272, 0.156434417}, {0.625, 0.449999988}},
+    {{-0.232219383, -0.319622725, 0.0625737682}, {1.0, 1.0, 1.0}, {-0.580548465, -0.799056828, 0.156434417}, {0.649999976, 0.449999988}},
+    {{-0.179360345, -0.35201478, 0.0625737682}, {1.0, 1.0, 1.0}, {-0.448400855, -0.88003695, 0.156434417}, {0.675000012, 0.449999988}},
+    {{-0.122085042, -0.375738978, 0.0625737682}, {1.0, 1.0, 1.0}, {-0.305212617, -0.939347446, 0.156434417}, {0.699999988, 0.449999988}},
+    {{-0.0618034229, -0.390211314, 0.0625737682}, {1.0, 1.0, 1.0}, {-0.154508561, -0.9755283, 0.156434417}, {0.725000024, 0.449999988}},
+    {{4.71122652e-09, -0.395075351, 0.0625737682}, {1.0, 1.0, 1.0}, {1.17780665e-08, -0.987688363, 0.156434417}, {0.75, 0.449999988}},
+    {{0.0618034303, -0.390211314, 0.0625737682}, {1.0, 1.0, 1.0}, {0.154508576, -0.9755283, 0.156434417}, {0.774999976, 0.449999988}},
+    {{0.12208505, -0.375738978, 0.0625737682}, {1.0, 1.0, 1.0}, {0.305212617, -0.939347446, 0.156434417}, {0.800000012, 0.449999988}},
+    {{0.179360524, -0.352014691, 0.0625737682}, {1.0, 1.0, 1.0}, {0.448401302, -0.880036712, 0.156434417}, {0.824999988, 0.449999988}},
+    {{0.232219547, -0.319622606, 0.0625737682}, {1.0, 1.0, 1.0}, {0.580548882, -0.79905653, 0.156434417}, {0.850000024, 0.449999988}},
+    {{0.279360563, -0.279360354, 0.0625737682}, {1.0, 1.0, 1.0}, {0.698401392, -0.698400855, 0.156434417}, {0.875, 0.449999988}},
+    {{0.319622755, -0.232219338, 0.0625737682}, {1.0, 1.0, 1.0}, {0.799056888, -0.580548346, 0.156434417}, {0.899999976, 0.449999988}},
+    {{0.35201472, -0.179360464, 0.0625737682}, {1.0, 1.0, 1.0}, {0.880036831, -0.448401153, 0.156434417}, {0.925000012, 0.449999988}},
+    {{0.375738978, -0.122084983, 0.0625737682}, {1.0, 1.0, 1.0}, {0.939347446, -0.305212468, 0.156434417}, {0.949999988, 0.449999988}},
+    {{0.390211314, -0.0618033595, 0.0625737682}, {1.0, 1.0, 1.0}, {0.9755283, -0.154508397, 0.156434417}, {0.975000024, 0.449999988}},
+    {{0.395075351, 6.90771742e-08, 0.0625737682}, {1.0, 1.0, 1.0}, {0.987688363, 1.72692936e-07, 0.156434417}, {1.0, 0.449999988}},
+    {{0.398766935, 0.0, 0.0313836522}, {1.0, 1.0, 1.0}, {0.996917367, 0.0, 0.0784591287}, {0.0, 0.474999994}},
+    {{0.393857449, 0.062380895, 0.0313836522}, {1.0, 1.0, 1.0}, {0.984643638, 0.155952245, 0.0784591287}, {0.0250000004, 0.474999994}},
+    {{0.379249901, 0.123225763, 0.0313836522}, {1.0, 1.0, 1.0}, {0.948124766, 0.308064401, 0.0784591287}, {0.0500000007, 0.474999994}},
+    {{0.355303943, 0.181036398, 0.0313836522}, {1.0, 1.0, 1.0}, {0.888259888, 0.452591002, 0.0784591287}, {0.075000003, 0.474999994}},
+    {{0.322609216, 0.234389335, 0.0313836522}, {1.0, 1.0, 1.0}, {0.806523025, 0.585973322, 0.0784591287}, {0.100000001, 0.474999994}},
+    {{0.281970799, 0.281970799, 0.0313836522}, {1.0, 1.0, 1.0}, {0.704926968, 0.704926968, 0.0784591287}, {0.125, 0.474999994}},
+    {{0.23438932, 0.322609246, 0.0313836522}, {1.0, 1.0, 1.0}, {0.585973322, 0.806523085, 0.0784591287}, {0.150000006, 0.474999994}},
+    {{0.181036413, 0.355303943, 0.0313836522}, {1.0, 1.0, 1.0}, {0.452591032, 0.888259888, 0.0784591287}, {0.174999997, 0.474999994}},
+    {{0.123225749, 0.379249901, 0.0313836522}, {1.0, 1.0, 1.0}, {0.308064371, 0.948124766, 0.0784591287}, {0.200000003, 0.474999994}},
+    {{0.062380854, 0.393857449, 0.0313836522}, {1.0, 1.0, 1.0}, {0.155952141, 0.984643638, 0.0784591287}, {0.224999994, 0.474999994}},
+    {{-1.74306578e-08, 0.398766935, 0.0313836522}, {1.0, 1.0, 1.0}, {-4.35766445e-08, 0.996917367, 0.0784591287}, {0.25, 0.474999994}},
+    {{-0.0623808876, 0.393857449, 0.0313836522}, {1.0, 1.0, 1.0}, {-0.155952215, 0.984643638, 0.0784591287}, {0.275000006, 0.474999994}},
+    {{-0.123225778, 0.379249871, 0.0313836522}, {1.0, 1.0, 1.0}, {-0.308064461, 0.948124647, 0.0784591287}, {0.300000012, 0.474999994}},
+    {{-0.181036443, 0.355303913, 0.0313836522}, {1.0, 1.0, 1.0}, {-0.452591121, 0.888259768, 0.0784591287}, {0.324999988, 0.474999994}},
+    {{-0.234389305, 0.322609246, 0.0313836522}, {1.0, 1.0, 1.0}, {-0.585973263, 0.806523085, 0.0784591287}, {0.349999994, 0.474999994}},
+    {{-0.281970799, 0.281970799, 0.0313836522}, {1.0, 1.0, 1.0}, {-0.704926968, 0.704926968, 0.0784591287}, {0.375, 0.474999994}},
+    {{-0.322609246, 0.234389305, 0.0313836522}, {1.0, 1.0, 1.0}, {-0.806523085, 0.585973263, 0.0784591287}, {0.400000006, 0.474999994}},
+    {{-0.355303973, 0.181036353, 0.0313836522}, {1.0, 1.0, 1.0}, {-0.888259947, 0.452590883, 0.0784591287}, {0.425000012, 0.474999994}},
+    {{-0.37924993, 0.123225681, 0.0313836522}, {1.0, 1.0, 1.0}, {-0.948124826, 0.308064193, 0.0784591287}, {0.449999988, 0.474999994}},
+    {{-0.393857449, 0.0623808838, 0.0313836522}, {1.0, 1.0, 1.0}, {-0.984643638, 0.155952215, 0.0784591287}, {0.474999994, 0.474999994}},
+    {{-0.398766935, -3.48613156e-08, 0.0313836522}, {1.0, 1.0, 1.0}, {-0.996917367, -8.7153289e-08, 0.0784591287}, {0.5, 0.474999994}},
+    {{-0.393857449, -0.0623809509, 0.0313836522}, {1.0, 1.0, 1.0}, {-0.984643638, -0.155952379, 0.0784591287}, {0.524999976, 0.474999994}},
+    {{-0.379249901, -0.123225749, 0.0313836522}, {1.0, 1.0, 1.0}, {-0.948124766, -0.308064371, 0.0784591287}, {0.550000012, 0.474999994}},
+    {{-0.355303943, -0.181036413, 0.0313836522}, {1.0, 1.0, 1.0}, {-0.888259888, -0.452591032, 0.0784591287}, {0.574999988, 0.474999994}},
+    {{-0.322609216, -0.23438935, 0.0313836522}, {1.0, 1.0, 1.0}, {-0.806523025, -0.585973382, 0.0784591287}, {0.600000024, 0.474999994}},
+    {{-0.281970769, -0.281970859, 0.0313836522}, {1.0, 1.0, 1.0}, {-0.704926908, -0.704927146, 0.0784591287}, {0.625, 0.474999994}},
+    {{-0.234389246, -0.322609276, 0.0313836522}, {1.0, 1.0, 1.0}, {-0.585973144, -0.806523204, 0.0784591287}, {0.649999976, 0.474999994}},
+    {{-0.181036294, -0.355304003, 0.0313836522}, {1.0, 1.0, 1.0}, {-0.452590734, -0.888260007, 0.0784591287}, {0.675000012, 0.474999994}},
+    {{-0.123225801, -0.379249871, 0.0313836522}, {1.0, 1.0, 1.0}, {-0.308064491, -0.948124647, 0.0784591287}, {0.699999988, 0.474999994}},
+    {{-0.0623809136, -0.393857449, 0.0313836522}, {1.0, 1.0, 1.0}, {-0.15595229, -0.984643638, 0.0784591287}, {0.725000024, 0.474999994}},
+    {{4.7552482e-09, -0.398766935, 0.0313836522}, {1.0, 1.0, 1.0}, {1.18881207e-08, -0.996917367, 0.0784591287}, {0.75, 0.474999994}},
+    {{0.0623809211, -0.393857449, 0.0313836522}, {1.0, 1.0, 1.0}, {0.155952305, -0.984643638, 0.0784591287}, {0.774999976, 0.474999994}},
+    {{0.123225816, -0.379249871, 0.0313836522}, {1.0, 1.0, 1.0}, {0.30806455, -0.948124647, 0.0784591287}, {0.800000012, 0.474999994}},
+    {{0.181036472, -0.355303913, 0.0313836522}, {1.0, 1.0, 1.0}, {0.452591181, -0.888259768, 0.0784591287}, {0.824999988, 0.474999994}},
+    {{0.234389409, -0.322609156, 0.0313836522}, {1.0, 1.0, 1.0}, {0.585973501, -0.806522906, 0.0784591287}, {0.850000024, 0.474999994}},
+    {{0.281970888, -0.28197071, 0.0313836522}, {1.0, 1.0, 1.0}, {0.704927206, -0.704926789, 0.0784591287}, {0.875, 0.474999994}},
+    {{0.322609305, -0.234389201, 0.0313836522}, {1.0, 1.0, 1.0}, {0.806523263, -0.585973024, 0.0784591287}, {0.899999976, 0.474999994}},
+    {{0.355303943, -0.181036413, 0.0313836522}, {1.0, 1.0, 1.0}, {0.888259888, -0.452591032, 0.0784591287}, {0.925000012, 0.474999994}},
+    {{0.379249901, -0.123225741, 0.0313836522}, {1.0, 1.0, 1.0}, {0.948124766, -0.308064342, 0.0784591287}, {0.949999988, 0.474999994}},
+    {{0.393857449, -0.0623808503, 0.0313836522}, {1.0, 1.0, 1.0}, {0.984643638, -0.155952126, 0.0784591287}, {0.975000024, 0.474999994}},
+    {{0.398766935, 6.97226312e-08, 0.0313836522}, {1.0, 1.0, 1.0}, {0.996917367, 1.74306578e-07, 0.0784591287}, {1.0, 0.474999994}},
+    {{0.400000006, 0.0, 0.0}, {1.0, 1.0, 1.0}, {1.0, 0.0, 0.0}, {0.0, 0.5}},
+    {{0.395075351, 0.0625737906, 0.0}, {1.0, 1.0, 1.0}, {0.987688363, 0.156434476, 0.0}, {0.0250000004, 0.5}},
+    {{0.380422622, 0.123606801, 0.0}, {1.0, 1.0, 1.0}, {0.95105654, 0.309017003, 0.0}, {0.0500000007, 0.5}},
+    {{0.356402606, 0.181596205, 0.0}, {1.0, 1.0, 1.0}, {0.891006529, 0.453990519, 0.0}, {0.075000003, 0.5}},
+    {{0.323606789, 0.235114112, 0.0}, {1.0, 1.0, 1.0}, {0.809016943, 0.587785304, 0.0}, {0.100000001, 0.5}},
+    {{0.282842696, 0.282842726, 0.0}, {1.0, 1.0, 1.0}, {0.707106709, 0.707106829, 0.0}, {0.125, 0.5}},
+    {{0.235114098, 0.323606819, 0.0}, {1.0, 1.0, 1.0}, {0.587785244, 0.809017062, 0.0}, {0.150000006, 0.5}},
+    {{0.18159622, 0.356402606, 0.0}, {1.0, 1.0, 1.0}, {0.453990549, 0.891006529, 0.0}, {0.174999997, 0.5}},
+    {{0.123606786, 0.380422622, 0.0}, {1.0, 1.0, 1.0}, {0.309016973, 0.95105654, 0.0}, {0.200000003, 0.5}},
+    {{0.0625737458, 0.395075351, 0.0}, {1.0, 1.0, 1.0}, {0.156434357, 0.987688363, 0.0}, {0.224999994, 0.5}},
+    {{-1.7484556e-08, 0.400000006, 0.0}, {1.0, 1.0, 1.0}, {-4.37113883e-08, 1.0, 0.0}, {0.25, 0.5}},
+    {{-0.0625737831, 0.395075351, 0.0}, {1.0, 1.0, 1.0}, {-0.156434461, 0.987688363, 0.0}, {0.275000006, 0.5}},
+    {{-0.123606816, 0.380422592, 0.0}, {1.0, 1.0, 1.0}, {-0.309017032, 0.95105648, 0.0}, {0.300000012, 0.5}},
+    {{-0.181596249, 0.356402606, 0.0}, {1.0, 1.0, 1.0}, {-0.453990638, 0.891006529, 0.0}, {0.324999988, 0.5}},
+    {{-0.235114083, 0.323606819, 0.0}, {1.0, 1.0, 1.0}, {-0.587785184, 0.809017062, 0.0}, {0.349999994, 0.5}},
+    {{-0.282842726, 0.282842726, 0.0}, {1.0, 1.0, 1.0}, {-0.707106829, 0.707106829, 0.0}, {0.375, 0.5}},
+    {{-0.323606819, 0.235114083, 0.0}, {1.0, 1.0, 1.0}, {-0.809017062, 0.587785184, 0.0}, {0.400000006, 0.5}},
+    {{-0.356402636, 0.18159616, 0.0}, {1.0, 1.0, 1.0}, {-0.891006589, 0.4539904, 0.0}, {0.425000012, 0.5}},
+    {{-0.380422622, 0.123606727, 0.0}, {1.0, 1.0, 1.0}, {-0.95105654, 0.309016824, 0.0}, {0.449999988, 0.5}},
+    {{-0.395075351, 0.0625737756, 0.0}, {1.0, 1.0, 1.0}, {-0.987688363, 0.156434447, 0.0}, {0.474999994, 0.5}},
+    {{-0.400000006, -3.49691121e-08, 0.0}, {1.0, 1.0, 1.0}, {-1.0, -8.74227766e-08, 0.0}, {0.5, 0.5}},
+    {{-0.395075321, -0.0625738502, 0.0}, {1.0, 1.0, 1.0}, {-0.987688303, -0.156434625, 0.0}, {0.524999976, 0.5}},
+    {{-0.380422622, -0.123606794, 0.0}, {1.0, 1.0, 1.0}, {-0.95105654, -0.309016973, 0.0}, {0.550000012, 0.5}},
+    {{-0.356402606, -0.18159622, 0.0}, {1.0, 1.0, 1.0}, {-0.891006529, -0.453990549, 0.0}, {0.574999988, 0.5}},
+    {{-0.323606789, -0.235114142, 0.0}, {1.0, 1.0, 1.0}, {-0.809016943, -0.587785363, 0.0}, {0.600000024, 0.5}},
+    {{-0.282842666, -0.282842755, 0.0}, {1.0, 1.0, 1.0}, {-0.70710665, -0.707106888, 0.0}, {0.625, 0.5}},
+    {{-0.235114023, -0.323606849, 0.0}, {1.0, 1.0, 1.0}, {-0.587785065, -0.809017122, 0.0}, {0.649999976, 0.5}},
+    {{-0.1815961, -0.356402665, 0.0}, {1.0, 1.0, 1.0}, {-0.453990251, -0.891006649, 0.0}, {0.675000012, 0.5}},
+    {{-0.123606846, -0.380422592, 0.0}, {1.0, 1.0, 1.0}, {-0.309017122, -0.95105648, 0.0}, {0.699999988, 0.5}},
+    {{-0.0625738055, -0.395075351, 0.0}, {1.0, 1.0, 1.0}, {-0.156434506, -0.987688363, 0.0}, {0.725000024, 0.5}},
+    {{4.76995243e-09, -0.400000006, 0.0}, {1.0, 1.0, 1.0}, {1.19248806e-08, -1.0, 0.0}, {0.75, 0.5}},
+    {{0.0625738204, -0.395075351, 0.0}, {1.0, 1.0, 1.0}, {0.156434551, -0.987688363, 0.0}, {0.774999976, 0.5}},
+    {{0.123606853, -0.380422592, 0.0}, {1.0, 1.0, 1.0}, {0.309017122, -0.95105648, 0.0}, {0.800000012, 0.5}},
+    {{0.181596279, -0.356402576, 0.0}, {1.0, 1.0, 1.0}, {0.453990698, -0.89100647, 0.0}, {0.824999988, 0.5}},
+    {{0.235114187, -0.32360673, 0.0}, {1.0, 1.0, 1.0}, {0.587785482, -0.809016824, 0.0}, {0.850000024, 0.5}},
+    {{0.282842815, -0.282842636, 0.0}, {1.0, 1.0, 1.0}, {0.707107067, -0.70710659, 0.0}, {0.875, 0.5}},
+    {{0.323606908, -0.235113978, 0.0}, {1.0, 1.0, 1.0}, {0.809017301, -0.587784946, 0.0}, {0.899999976, 0.5}},
+    {{0.356402606, -0.181596205, 0.0}, {1.0, 1.0, 1.0}, {0.891006529, -0.453990519, 0.0}, {0.925000012, 0.5}},
+    {{0.380422622, -0.123606779, 0.0}, {1.0, 1.0, 1.0}, {0.95105654, -0.309016943, 0.0}, {0.949999988, 0.5}},
+    {{0.395075351, -0.0625737458, 0.0}, {1.0, 1.0, 1.0}, {0.987688363, -0.156434357, 0.0}, {0.975000024, 0.5}},
+    {{0.400000006, 6.99382241e-08, 0.0}, {1.0, 1.0, 1.0}, {1.0, 1.74845553e-07, 0.0}, {1.0, 0.5}},
+    {{0.398766935, 0.0, -0.0313836522}, {1.0, 1.0, 1.0}, {0.996917367, 0.0, -0.0784591287}, {0.0, 0.524999976}},
+    {{0.393857449, 0.062380895, -0.0313836522}, {1.0, 1.0, 1.0}, {0.984643638, 0.155952245, -0.0784591287}, {0.0250000004, 0.524999976}},
+    {{0.379249901, 0.123225763, -0.0313836522}, {1.0, 1.0, 1.0}, {0.948124766, 0.308064401, -0.0784591287}, {0.0500000007, 0.524999976}},
+    {{0.355303943, 0.181036398, -0.0313836522}, {1.0, 1.0, 1.0}, {0.888259888, 0.452591002, -0.0784591287}, {0.075000003, 0.524999976}},
+    {{0.322609216, 0.234389335, -0.0313836522}, {1.0, 1.0, 1.0}, {0.806523025, 0.585973322, -0.0784591287}, {0.100000001, 0.524999976}},
+    {{0.281970799, 0.281970799, -0.0313836522}, {1.0, 1.0, 1.0}, {0.704926968, 0.704926968, -0.0784591287}, {0.125, 0.524999976}},
+    {{0.23438932, 0.322609246, -0.0313836522}, {1.0, 1.0, 1.0}, {0.585973322, 0.806523085, -0.0784591287}, {0.150000006, 0.524999976}},
+    {{0.181036413, 0.355303943, -0.0313836522}, {1.0, 1.0, 1.0}, {0.452591032, 0.888259888, -0.0784591287}, {0.174999997, 0.524999976}},
+    {{0.123225749, 0.379249901, -0.0313836522}, {1.0, 1.0, 1.0}, {0.308064371, 0.948124766, -0.0784591287}, {0.200000003, 0.524999976}},
+    {{0.062380854, 0.393857449, -0.0313836522}, {1.0, 1.0, 1.0}, {0.155952141, 0.984643638, -0.0784591287}, {0.224999994, 0.524999976}},
+    {{-1.74306578e-08, 0.398766935, -0.0313836522}, {1.0, 1.0, 1.0}, {-4.35766445e-08, 0.996917367, -0.0784591287}, {0.25, 0.524999976}},
+    {{-0.0623808876, 0.393857449, -0.0313836522}, {1.0, 1.0, 1.0}, {-0.155952215, 0.984643638, -0.0784591287}, {0.275000006, 0.524999976}},
+    {{-0.123225778, 0.379249871, -0.0313836522}, {1.0, 1.0, 1.0}, {-0.308064461, 0.948124647, -0.0784591287}, {0.300000012, 0.524999976}},
+    {{-0.181036443, 0.355303913, -0.0313836522}, {1.0, 1.0, 1.0}, {-0.452591121, 0.888259768, -0.0784591287}, {0.324999988, 0.524999976}},
+    {{-0.234389305, 0.322609246, -0.0313836522}, {1.0, 1.0, 1.0}, {-0.585973263, 0.806523085, -0.0784591287}, {0.349999994, 0.524999976}},
+    {{-0.281970799, 0.281970799, -0.0313836522}, {1.0, 1.0, 1.0}, {-0.704926968, 0.704926968, -0.0784591287}, {0.375, 0.524999976}},
+    {{-0.322609246, 0.234389305, -0.0313836522}, {1.0, 1.0, 1.0}, {-0.806523085, 0.585973263, -0.0784591287}, {0.400000006, 0.524999976}},
+    {{-0.355303973, 0.181036353, -0.0313836522}, {1.0, 1.0, 1.0}, {-0.888259947, 0.452590883, -0.0784591287}, {0.425000012, 0.524999976}},
+    {{-0.37924993, 0.123225681, -0.0313836522}, {1.0, 1.0, 1.0}, {-0.948124826, 0.308064193, -0.0784591287}, {0.449999988, 0.524999976}},
+    {{-0.393857449, 0.0623808838, -0.0313836522}, {1.0, 1.0, 1.0}, {-0.984643638, 0.155952215, -0.0784591287}, {0.474999994, 0.524999976}},
+    {{-0.398766935, -3.48613156e-08, -0.0313836522}, {1.0, 1.0, 1.0}, {-0.996917367, -8.7153289e-08, -0.0784591287}, {0.5, 0.524999976}},
+    {{-0.393857449, -0.0623809509, -0.0313836522}, {1.0, 1.0, 1.0}, {-0.984643638, -0.155952379, -0.0784591287}, {0.524999976, 0.524999976}},
+    {{-0.379249901, -0.123225749, -0.0313836522}, {1.0, 1.0, 1.0}, {-0.948124766, -0.308064371, -0.0784591287}, {0.550000012, 0.524999976}},
+    {{-0.355303943, -0.181036413, -0.0313836522}, {1.0, 1.0, 1.0}, {-0.888259888, -0.452591032, -0.0784591287}, {0.574999988, 0.524999976}},
+    {{-0.322609216, -0.23438935, -0.0313836522}, {1.0, 1.0, 1.0}, {-0.806523025, -0.585973382, -0.0784591287}, {0.600000024, 0.524999976}},
+    {{-0.281970769, -0.281970859, -0.0313836522}, {1.0, 1.0, 1.0}, {-0.704926908, -0.704927146, -0.0784591287}, {0.625, 0.524999976}},
+    {{-0.234389246, -0.322609276, -0.0313836522}, {1.0, 1.0, 1.0}, {-0.585973144, -0.806523204, -0.0784591287}, {0.649999976, 0.524999976}},
+    {{-0.181036294, -0.355304003, -0.0313836522}, {1.0, 1.0, 1.0}, {-0.452590734, -0.888260007, -0.0784591287}, {0.675000012, 0.524999976}},
+    {{-0.123225801, -0.379249871, -0.0313836522}, {1.0, 1.0, 1.0}, {-0.308064491, -0.948124647, -0.0784591287}, {0.699999988, 0.524999976}},
+    {{-0.0623809136, -0.393857449, -0.0313836522}, {1.0, 1.0, 1.0}, {-0.15595229, -0.984643638, -0.0784591287}, {0.725000024, 0.524999976}},
+    {{4.7552482e-09, -0.398766935, -0.0313836522}, {1.0, 1.0, 1.0}, {1.18881207e-08, -0.996917367, -0.0784591287}, {0.75, 0.524999976}},
+    {{0.0623809211, -0.393857449, -0.0313836522}, {1.0, 1.0, 1.0}, {0.155952305, -0.984643638, -0.0784591287}, {0.774999976, 0.524999976}},
+    {{0.123225816, -0.379249871, -0.0313836522}, {1.0, 1.0, 1.0}, {0.30806455, -0.948124647, -0.0784591287}, {0.800000012, 0.524999976}},
+    {{0.181036472, -0.355303913, -0.0313836522}, {1.0, 1.0, 1.0}, {0.452591181, -0.888259768, -0.0784591287}, {0.824999988, 0.524999976}},
+    {{0.234389409, -0.322609156, -0.0313836522}, {1.0, 1.0, 1.0}, {0.585973501, -0.806522906, -0.0784591287}, {0.850000024, 0.524999976}},
+    {{0.281970888, -0.28197071, -0.0313836522}, {1.0, 1.0, 1.0}, {0.704927206, -0.704926789, -0.0784591287}, {0.875, 0.524999976}},
+    {{0.322609305, -0.234389201, -0.0313836522}, {1.0, 1.0, 1.0}, {0.806523263, -0.585973024, -0.0784591287}, {0.899999976, 0.524999976}},
+    {{0.355303943, -0.181036413, -0.0313836522}, {1.0, 1.0, 1.0}, {0.888259888, -0.452591032, -0.0784591287}, {0.925000012, 0.524999976}},
+    {{0.379249901, -0.123225741, -0.0313836522}, {1.0, 1.0, 1.0}, {0.948124766, -0.308064342, -0.0784591287}, {0.949999988, 0.524999976}},
+    {{0.393857449, -0.0623808503, -0.0313836522}, {1.0, 1.0, 1.0}, {0.984643638, -0.155952126, -0.0784591287}, {0.975000024, 0.524999976}},
+    {{0.398766935, 6.97226312e-08, -0.0313836522}, {1.0, 1.0, 1.0}, {0.996917367, 1.74306578e-07, -0.0784591287}, {1.0, 0.524999976}},
+    {{0.395075351, 0.0, -0.0625737682}, {1.0, 1.0, 1.0}, {0.987688363, 0.0, -0.156434417}, {0.0, 0.550000012}},
+    {{0.390211314, 0.0618034042, -0.0625737682}, {1.0, 1.0, 1.0}, {0.9755283, 0.154508516, -0.156434417}, {0.0250000004, 0.550000012}},
+    {{0.375738978, 0.122084998, -0.0625737682}, {1.0, 1.0, 1.0}, {0.939347446, 0.305212498, -0.156434417}, {0.0500000007, 0.550000012}},
+    {{0.35201472, 0.179360464, -0.0625737682}, {1.0, 1.0, 1.0}, {0.880036831, 0.448401153, -0.156434417}, {0.075000003, 0.550000012}},
+    {{0.319622666, 0.232219473, -0.0625737682}, {1.0, 1.0, 1.0}, {0.799056649, 0.580548704, -0.156434417}, {0.100000001, 0.550000012}},
+    {{0.279360443, 0.279360473, -0.0625737682}, {1.0, 1.0, 1.0}, {0.698401093, 0.698401213, -0.156434417}, {0.125, 0.550000012}},
+    {{0.232219458, 0.319622666, -0.0625737682}, {1.0, 1.0, 1.0}, {0.580548644, 0.799056649, -0.156434417}, {0.150000006, 0.550000012}},
+    {{0.179360464, 0.35201472, -0.0625737682}, {1.0, 1.0, 1.0}, {0.448401153, 0.880036831, -0.156434417}, {0.174999997, 0.550000012}},
+    {{0.122084983, 0.375738978, -0.0625737682}, {1.0, 1.0, 1.0}, {0.305212468, 0.939347446, -0.156434417}, {0.200000003, 0.550000012}},
+    {{0.0618033633, 0.390211314, -0.0625737682}, {1.0, 1.0, 1.0}, {0.154508412, 0.9755283, -0.156434417}, {0.224999994, 0.550000012}},
+    {{-1.72692936e-08, 0.395075351, -0.0625737682}, {1.0, 1.0, 1.0}, {-4.31732339e-08, 0.987688363, -0.156434417}, {0.25, 0.550000012}},
+    {{-0.0618033968, 0.390211314, -0.0625737682}, {1.0, 1.0, 1.0}, {-0.154508486, 0.9755283, -0.156434417}, {0.275000006, 0.550000012}},
+    {{-0.12208502, 0.375738978, -0.0625737682}, {1.0, 1.0, 1.0}, {-0.305212557, 0.939347446, -0.156434417}, {0.300000012, 0.550000012}},
+    {{-0.179360494, 0.352014691, -0.0625737682}, {1.0, 1.0, 1.0}, {-0.448401242, 0.880036712, -0.156434417}, {0.324999988, 0.550000012}},
+    {{-0.232219443, 0.319622695, -0.0625737682}, {1.0, 1.0, 1.0}, {-0.580548584, 0.799056768, -0.156434417}, {0.349999994, 0.550000012}},
+    {{-0.279360473, 0.279360443, -0.0625737682}, {1.0, 1.0, 1.0}, {-0.698401213, 0.698401093, -0.156434417}, {0.375, 0.550000012}},
+    {{-0.319622695, 0.232219443, -0.0625737682}, {1.0, 1.0, 1.0}, {-0.799056768, 0.580548584, -0.156434417}, {0.400000006, 0.550000012}},
+    {{-0.35201475, 0.179360405, -0.0625737682}, {1.0, 1.0, 1.0}, {-0.880036891, 0.448401004, -0.156434417}, {0.425000012, 0.550000012}},
+    {{-0.375739008, 0.122084923, -0.0625737682}, {1.0, 1.0, 1.0}, {-0.939347506, 0.305212319, -0.156434417}, {0.449999988, 0.550000012}},
+    {{-0.390211314, 0.0618033931, -0.0625737682}, {1.0, 1.0, 1.0}, {-0.9755283, 0.154508486, -0.156434417}, {0.474999994, 0.550000012}},
+    {{-0.395075351, -3.45385871e-08, -0.0625737682}, {1.0, 1.0, 1.0}, {-0.987688363, -8.63464678e-08, -0.156434417}, {0.5, 0.550000012}},
+    {{-0.390211314, -0.0618034601, -0.0625737682}, {1.0, 1.0, 1.0}, {-0.9755283, -0.15450865, -0.156434417}, {0.524999976, 0.550000012}},
+    {{-0.375738978, -0.12208499, -0.0625737682}, {1.0, 1.0, 1.0}, {-0.939347446, -0.305212468, -0.156434417}, {0.550000012, 0.550000012}},
+    {{-0.35201472, -0.179360464, -0.0625737682}, {1.0, 1.0, 1.0}, {-0.880036831, -0.448401153, -0.156434417}, {0.574999988, 0.550000012}},
+    {{-0.319622636, -0.232219502, -0.0625737682}, {1.0, 1.0, 1.0}, {-0.79905659, -0.580548763, -0.156434417}, {0.600000024, 0.550000012}},
+    {{-0.279360414, -0.279360503, -0.0625737682}, {1.0, 1.0, 1.0}, {-0.698401034, -0.698401272, -0.156434417}, {0.625, 0.550000012}},
+    {{-0.232219383, -0.319622725, -0.0625737682}, {1.0, 1.0, 1.0}, {-0.580548465, -0.799056828, -0.156434417}, {0.649999976, 0.550000012}},
+    {{-0.179360345, -0.35201478, -0.0625737682}, {1.0, 1.0, 1.0}, {-0.448400855, -0.88003695, -0.156434417}, {0.675000012, 0.550000012}},
+    {{-0.122085042, -0.375738978, -0.0625737682}, {1.0, 1.0, 1.0}, {-0.305212617, -0.939347446, -0.156434417}, {0.699999988, 0.550000012}},
+    {{-0.0618034229, -0.390211314, -0.0625737682}, {1.0, 1.0, 1.0}, {-0.154508561, -0.9755283, -0.156434417}, {0.725000024, 0.550000012}},
+    {{4.71122652e-09, -0.395075351, -0.0625737682}, {1.0, 1.0, 1.0}, {1.17780665e-08, -0.987688363, -0.156434417}, {0.75, 0.550000012}},
+    {{0.0618034303, -0.390211314, -0.0625737682}, {1.0, 1.0, 1.0}, {0.154508576, -0.9755283, -0.156434417}, {0.774999976, 0.550000012}},
+    {{0.12208505, -0.375738978, -0.0625737682}, {1.0, 1.0, 1.0}, {0.305212617, -0.939347446, -0.156434417}, {0.800000012, 0.550000012}},
+    {{0.179360524, -0.352014691, -0.0625737682}, {1.0, 1.0, 1.0}, {0.448401302, -0.880036712, -0.156434417}, {0.824999988, 0.550000012}},
+    {{0.232219547, -0.319622606, -0.0625737682}, {1.0, 1.0, 1.0}, {0.580548882, -0.79905653, -0.156434417}, {0.850000024, 0.550000012}},
+    {{0.279360563, -0.279360354, -0.0625737682}, {1.0, 1.0, 1.0}, {0.698401392, -0.698400855, -0.156434417}, {0.875, 0.550000012}},
+    {{0.319622755, -0.232219338, -0.0625737682}, {1.0, 1.0, 1.0}, {0.799056888, -0.580548346, -0.156434417}, {0.899999976, 0.550000012}},
+    {{0.35201472, -0.179360464, -0.0625737682}, {1.0, 1.0, 1.0}, {0.880036831, -0.448401153, -0.156434417}, {0.925000012, 0.550000012}},
+    {{0.375738978, -0.122084983, -0.0625737682}, {1.0, 1.0, 1.0}, {0.939347446, -0.305212468, -0.156434417}, {0.949999988, 0.550000012}},
+    {{0.390211314, -0.0618033595, -0.0625737682}, {1.0, 1.0, 1.0}, {0.9755283, -0.154508397, -0.156434417}, {0.975000024, 0.550000012}},
+    {{0.395075351, 6.90771742e-08, -0.0625737682}, {1.0, 1.0, 1.0}, {0.987688363, 1.72692936e-07, -0.156434417}, {1.0, 0.550000012}},
+    {{0.388947964, 0.0, -0.0933781415}, {1.0, 1.0, 1.0}, {0.972369909, 0.0, -0.233445346}, {0.0, 0.574999988}},
+    {{0.384159356, 0.0608448684, -0.0933781415}, {1.0, 1.0, 1.0}, {0.960398376, 0.152112171, -0.233445346}, {0.0250000004, 0.574999988}},
+    {{0.369911492, 0.120191537, -0.0933781415}, {1.0, 1.0, 1.0}, {0.9247787, 0.300478846, -0.233445346}, {0.0500000007, 0.574999988}},
+    {{0.346555173, 0.176578686, -0.0933781415}, {1.0, 1.0, 1.0}, {0.866387963, 0.441446722, -0.233445346}, {0.075000003, 0.574999988}},
+    {{0.314665496, 0.228617877, -0.0933781415}, {1.0, 1.0, 1.0}, {0.786663771, 0.571544707, -0.233445346}, {0.100000001, 0.574999988}},
+    {{0.275027722, 0.275027752, -0.0933781415}, {1.0, 1.0, 1.0}, {0.68756932, 0.68756938, -0.233445346}, {0.125, 0.574999988}},
+    {{0.228617862, 0.314665526, -0.0933781415}, {1.0, 1.0, 1.0}, {0.571544647, 0.78666383, -0.233445346}, {0.150000006, 0.574999988}},
+    {{0.176578686, 0.346555173, -0.0933781415}, {1.0, 1.0, 1.0}, {0.441446722, 0.866387963, -0.233445346}, {0.174999997, 0.574999988}},
+    {{0.120191514, 0.369911492, -0.0933781415}, {1.0, 1.0, 1.0}, {0.300478786, 0.9247787, -0.233445346}, {0.200000003, 0.574999988}},
+    {{0.0608448274, 0.384159386, -0.0933781415}, {1.0, 1.0, 1.0}, {0.152112067, 0.960398436, -0.233445346}, {0.224999994, 0.574999988}},
+    {{-1.70014562e-08, 0.388947964, -0.0933781415}, {1.0, 1.0, 1.0}, {-4.25036397e-08, 0.972369909, -0.233445346}, {0.25, 0.574999988}},
+    {{-0.060844861, 0.384159356, -0.0933781415}, {1.0, 1.0, 1.0}, {-0.152112156, 0.960398376, -0.233445346}, {0.275000006, 0.574999988}},
+    {{-0.120191552, 0.369911492, -0.0933781415}, {1.0, 1.0, 1.0}, {-0.300478876, 0.9247787, -0.233445346}, {0.300000012, 0.574999988}},
+    {{-0.176578715, 0.346555144, -0.0933781415}, {1.0, 1.0, 1.0}, {-0.441446781, 0.866387844, -0.233445346}, {0.324999988, 0.574999988}},
+    {{-0.228617862, 0.314665526, -0.0933781415}, {1.0, 1.0, 1.0}, {-0.571544647, 0.78666383, -0.233445346}, {0.349999994, 0.574999988}},
+    {{-0.275027752, 0.275027752, -0.0933781415}, {1.0, 1.0, 1.0}, {-0.68756938, 0.68756938, -0.233445346}, {0.375, 0.574999988}},
+    {{-0.314665526, 0.228617862, -0.0933781415}, {1.0, 1.0, 1.0}, {-0.78666383, 0.571544647, -0.233445346}, {0.400000006, 0.574999988}},
+    {{-0.346555203, 0.176578641, -0.0933781415}, {1.0, 1.0, 1.0}, {-0.866388023, 0.441446602, -0.233445346}, {0.425000012, 0.574999988}},
+    {{-0.369911522, 0.120191455, -0.0933781415}, {1.0, 1.0, 1.0}, {-0.924778819, 0.300478637, -0.233445346}, {0.449999988, 0.574999988}},
+    {{-0.384159356, 0.0608448572, -0.0933781415}, {1.0, 1.0, 1.0}, {-0.960398376, 0.152112141, -0.233445346}, {0.474999994, 0.574999988}},
+    {{-0.388947964, -3.40029125e-08, -0.0933781415}, {1.0, 1.0, 1.0}, {-0.972369909, -8.50072794e-08, -0.233445346}, {0.5, 0.574999988}},
+    {{-0.384159356, -0.0608449243, -0.0933781415}, {1.0, 1.0, 1.0}, {-0.960398376, -0.152112305, -0.233445346}, {0.524999976, 0.574999988}},
+    {{-0.369911492, -0.120191522, -0.0933781415}, {1.0, 1.0, 1.0}, {-0.9247787, -0.300478816, -0.233445346}, {0.550000012, 0.574999988}},
+    {{-0.346555173, -0.176578701, -0.0933781415}, {1.0, 1.0, 1.0}, {-0.866387963, -0.441446751, -0.233445346}, {0.574999988, 0.574999988}},
+    {{-0.314665496, -0.228617907, -0.0933781415}, {1.0, 1.0, 1.0}, {-0.786663771, -0.571544766, -0.233445346}, {0.600000024, 0.574999988}},
+    {{-0.275027692, -0.275027782, -0.0933781415}, {1.0, 1.0, 1.0}, {-0.687569261, -0.687569439, -0.233445346}, {0.625, 0.574999988}},
+    {{-0.228617802, -0.314665556, -0.0933781415}, {1.0, 1.0, 1.0}, {-0.571544528, -0.78666389, -0.233445346}, {0.649999976, 0.574999988}},
+    {{-0.176578581, -0.346555233, -0.0933781415}, {1.0, 1.0, 1.0}, {-0.441446453, -0.866388083, -0.233445346}, {0.675000012, 0.574999988}},
+    {{-0.120191574, -0.369911492, -0.0933781415}, {1.0, 1.0, 1.0}, {-0.300478935, -0.9247787, -0.233445346}, {0.699999988, 0.574999988}},
+    {{-0.060844887, -0.384159356, -0.0933781415}, {1.0, 1.0, 1.0}, {-0.152112216, -0.960398376, -0.233445346}, {0.725000024, 0.574999988}},
+    {{4.63815786e-09, -0.388947964, -0.0933781415}, {1.0, 1.0, 1.0}, {1.15953949e-08, -0.972369909, -0.233445346}, {0.75, 0.574999988}},
+    {{0.0608448945, -0.384159356, -0.0933781415}, {1.0, 1.0, 1.0}, {0.152112231, -0.960398376, -0.233445346}, {0.774999976, 0.574999988}},
+    {{0.120191582, -0.369911492, -0.0933781415}, {1.0, 1.0, 1.0}, {0.300478965, -0.9247787, -0.233445346}, {0.800000012, 0.574999988}},
+    {{0.176578745, -0.346555144, -0.0933781415}, {1.0, 1.0, 1.0}, {0.441446871, -0.866387844, -0.233445346}, {0.824999988, 0.574999988}},
+    {{0.228617966, -0.314665437, -0.0933781415}, {1.0, 1.0, 1.0}, {0.571544886, -0.786663592, -0.233445346}, {0.850000024, 0.574999988}},
+    {{0.275027841, -0.275027663, -0.0933781415}, {1.0, 1.0, 1.0}, {0.687569618, -0.687569141, -0.233445346}, {0.875, 0.574999988}},
+    {{0.314665616, -0.228617758, -0.0933781415}, {1.0, 1.0, 1.0}, {0.786664009, -0.571544409, -0.233445346}, {0.899999976, 0.574999988}},
+    {{0.346555173, -0.176578686, -0.0933781415}, {1.0, 1.0, 1.0}, {0.866387963, -0.441446722, -0.233445346}, {0.925000012, 0.574999988}},
+    {{0.369911492, -0.120191514, -0.0933781415}, {1.0, 1.0, 1.0}, {0.9247787, -0.300478786, -0.233445346}, {0.949999988, 0.574999988}},
+    {{0.384159386, -0.0608448237, -0.0933781415}, {1.0, 1.0, 1.0}, {0.960398436, -0.152112067, -0.233445346}, {0.975000024, 0.574999988}},
+    {{0.388947964, 6.8005825e-08, -0.0933781415}, {1.0, 1.0, 1.0}, {0.972369909, 1.70014559e-07, -0.233445346}, {1.0, 0.574999988}},
+    {{0.380422622, 0.0, -0.123606801}, {1.0, 1.0, 1.0}, {0.95105654, 0.0, -0.309017003}, {0.0, 0.600000024}},
+    {{0.375738978, 0.0595112108, -0.123606801}, {1.0, 1.0, 1.0}, {0.939347446, 0.148778021, -0.309017003}, {0.0250000004, 0.600000024}},
+    {{0.361803412, 0.117557056, -0.123606801}, {1.0, 1.0, 1.0}, {0.904508531, 0.293892652, -0.309017003}, {0.0500000007, 0.600000024}},
+    {{0.338959038, 0.172708258, -0.123606801}, {1.0, 1.0, 1.0}, {0.847397566, 0.431770653, -0.309017003}, {0.075000003, 0.600000024}},
+    {{0.307768375, 0.22360681, -0.123606801}, {1.0, 1.0, 1.0}, {0.769420922, 0.559017003, -0.309017003}, {0.100000001, 0.600000024}},
+    {{0.268999398, 0.268999428, -0.123606801}, {1.0, 1.0, 1.0}, {0.672498465, 0.672498584, -0.309017003}, {0.125, 0.600000024}},
+    {{0.223606795, 0.307768375, -0.123606801}, {1.0, 1.0, 1.0}, {0.559017003, 0.769420922, -0.309017003}, {0.150000006, 0.600000024}},
+    {{0.172708273, 0.338959038, -0.123606801}, {1.0, 1.0, 1.0}, {0.431770682, 0.847397566, -0.309017003}, {0.174999997, 0.600000024}},
+    {{0.117557041, 0.361803412, -0.123606801}, {1.0, 1.0, 1.0}, {0.293892592, 0.904508531, -0.309017003}, {0.200000003, 0.600000024}},
+    {{0.0595111735, 0.375739008, -0.123606801}, {1.0, 1.0, 1.0}, {0.148777932, 0.939347506, -0.309017003}, {0.224999994, 0.600000024}},
+    {{-1.66288014e-08, 0.380422622, -0.123606801}, {1.0, 1.0, 1.0}, {-4.15720045e-08, 0.95105654, -0.309017003}, {0.25, 0.600000024}},
+    {{-0.0595112033, 0.375738978, -0.123606801}, {1.0, 1.0, 1.0}, {-0.148778006, 0.939347446, -0.309017003}, {0.275000006, 0.600000024}},
+    {{-0.117557071, 0.361803412, -0.123606801}, {1.0, 1.0, 1.0}, {-0.293892682, 0.904508531, -0.309017003}, {0.300000012, 0.600000024}},
+    {{-0.172708303, 0.338959008, -0.123606801}, {1.0, 1.0, 1.0}, {-0.431770742, 0.847397506, -0.309017003}, {0.324999988, 0.600000024}},
+    {{-0.223606795, 0.307768375, -0.123606801}, {1.0, 1.0, 1.0}, {-0.559017003, 0.769420922, -0.309017003}, {0.349999994, 0.600000024}},
+    {{-0.268999428, 0.268999428, -0.123606801}, {1.0, 1.0, 1.0}, {-0.672498584, 0.672498584, -0.309017003}, {0.375, 0.600000024}},
+    {{-0.307768375, 0.22360678, -0.123606801}, {1.0, 1.0, 1.0}, {-0.769420922, 0.559016943, -0.309017003}, {0.400000006, 0.600000024}},
+    {{-0.338959068, 0.172708213, -0.123606801}, {1.0, 1.0, 1.0}, {-0.847397685, 0.431770533, -0.309017003}, {0.425000012, 0.600000024}},
+    {{-0.361803442, 0.117556982, -0.123606801}, {1.0, 1.0, 1.0}, {-0.904508591, 0.293892443, -0.309017003}, {0.449999988, 0.600000024}},
+    {{-0.375738978, 0.0595111996, -0.123606801}, {1.0, 1.0, 1.0}, {-0.939347446, 0.148777992, -0.309017003}, {0.474999994, 0.600000024}},
+    {{-0.380422622, -3.32576029e-08, -0.123606801}, {1.0, 1.0, 1.0}, {-0.95105654, -8.3144009e-08, -0.309017003}, {0.5, 0.600000024}},
+    {{-0.375738978, -0.0595112666, -0.123606801}, {1.0, 1.0, 1.0}, {-0.939347446, -0.14877817, -0.309017003}, {0.524999976, 0.600000024}},
+    {{-0.361803412, -0.117557049, -0.123606801}, {1.0, 1.0, 1.0}, {-0.904508531, -0.293892622, -0.309017003}, {0.550000012, 0.600000024}},
+    {{-0.338959038, -0.172708273, -0.123606801}, {1.0, 1.0, 1.0}, {-0.847397566, -0.431770682, -0.309017003}, {0.574999988, 0.600000024}},
+    {{-0.307768345, -0.22360684, -0.123606801}, {1.0, 1.0, 1.0}, {-0.769420862, -0.559017122, -0.309017003}, {0.600000024, 0.600000024}},
+    {{-0.268999368, -0.268999457, -0.123606801}, {1.0, 1.0, 1.0}, {-0.672498405, -0.672498643, -0.309017003}, {0.625, 0.600000024}},
+    {{-0.223606735, -0.307768404, -0.123606801}, {1.0, 1.0, 1.0}, {-0.559016824, -0.769420981, -0.309017003}, {0.649999976, 0.600000024}},
+    {{-0.172708154, -0.338959098, -0.123606801}, {1.0, 1.0, 1.0}, {-0.431770384, -0.847397745, -0.309017003}, {0.675000012, 0.600000024}},
+    {{-0.117557094, -0.361803412, -0.123606801}, {1.0, 1.0, 1.0}, {-0.293892741, -0.904508531, -0.309017003}, {0.699999988, 0.600000024}},
+    {{-0.0595112294, -0.375738978, -0.123606801}, {1.0, 1.0, 1.0}, {-0.148778081, -0.939347446, -0.309017003}, {0.725000024, 0.600000024}},
+    {{4.53649429e-09, -0.380422622, -0.123606801}, {1.0, 1.0, 1.0}, {1.13412355e-08, -0.95105654, -0.309017003}, {0.75, 0.600000024}},
+    {{0.0595112368, -0.375738978, -0.123606801}, {1.0, 1.0, 1.0}, {0.148778096, -0.939347446, -0.309017003}, {0.774999976, 0.600000024}},
+    {{0.117557108, -0.361803383, -0.123606801}, {1.0, 1.0, 1.0}, {0.293892771, -0.904508471, -0.309017003}, {0.800000012, 0.600000024}},
+    {{0.172708333, -0.338959008, -0.123606801}, {1.0, 1.0, 1.0}, {0.431770831, -0.847397506, -0.309017003}, {0.824999988, 0.600000024}},
+    {{0.223606884, -0.307768315, -0.123606801}, {1.0, 1.0, 1.0}, {0.559017181, -0.769420803, -0.309017003}, {0.850000024, 0.600000024}},
+    {{0.268999517, -0.268999338, -0.123606801}, {1.0, 1.0, 1.0}, {0.672498822, -0.672498345, -0.309017003}, {0.875, 0.600000024}},
+    {{0.307768464, -0.223606691, -0.123606801}, {1.0, 1.0, 1.0}, {0.76942116, -0.559016705, -0.309017003}, {0.899999976, 0.600000024}},
+    {{0.338959038, -0.172708258, -0.123606801}, {1.0, 1.0, 1.0}, {0.847397566, -0.431770653, -0.309017003}, {0.925000012, 0.600000024}},
+    {{0.361803412, -0.117557041, -0.123606801}, {1.0, 1.0, 1.0}, {0.904508531, -0.293892592, -0.309017003}, {0.949999988, 0.600000024}},
+    {{0.375739008, -0.0595111661, -0.123606801}, {1.0, 1.0, 1.0}, {0.939347506, -0.148777917, -0.309017003}, {0.975000024, 0.600000024}},
+    {{0.380422622, 6.65152058e-08, -0.123606801}, {1.0, 1.0, 1.0}, {0.95105654, 1.66288018e-07, -0.309017003}, {1.0, 0.600000024}},
+    {{0.369551808, 0.0, -0.153073385}, {1.0, 1.0, 1.0}, {0.923879504, 0.0, -0.382683456}, {0.0, 0.625}},
+    {{0.365002006, 0.0578106418, -0.153073385}, {1.0, 1.0, 1.0}, {0.912505031, 0.144526601, -0.382683456}, {0.0250000004, 0.625}},
+    {{0.351464659, 0.114197791, -0.153073385}, {1.0, 1.0, 1.0}, {0.878661633, 0.285494477, -0.382683456}, {0.0500000007, 0.625}},
+    {{0.329273075, 0.167773008, -0.153073385}, {1.0, 1.0, 1.0}, {0.823182702, 0.419432521, -0.382683456}, {0.075000003, 0.625}},
+    {{0.29897368, 0.217217103, -0.153073385}, {1.0, 1.0, 1.0}, {0.747434199, 0.543042779, -0.382683456}, {0.100000001, 0.625}},
+    {{0.261312574, 0.261312604, -0.153073385}, {1.0, 1.0, 1.0}, {0.65328145, 0.65328151, -0.382683456}, {0.125, 0.625}},
+    {{0.217217088, 0.298973709, -0.153073385}, {1.0, 1.0, 1.0}, {0.543042719, 0.747434258, -0.382683456}, {0.150000006, 0.625}},
+    {{0.167773023, 0.329273075, -0.153073385}, {1.0, 1.0, 1.0}, {0.419432551, 0.823182702, -0.382683456}, {0.174999997, 0.625}},
+    {{0.114197776, 0.351464659, -0.153073385}, {1.0, 1.0, 1.0}, {0.285494447, 0.878661633, -0.382683456}, {0.200000003, 0.625}},
+    {{0.0578106046, 0.365002006, -0.153073385}, {1.0, 1.0, 1.0}, {0.144526511, 0.912505031, -0.382683456}, {0.224999994, 0.625}},
+    {{-1.61536224e-08, 0.369551808, -0.153073385}, {1.0, 1.0, 1.0}, {-4.03840552e-08, 0.923879504, -0.382683456}, {0.25, 0.625}},
+    {{-0.0578106344, 0.365002006, -0.153073385}, {1.0, 1.0, 1.0}, {-0.144526586, 0.912505031, -0.382683456}, {0.275000006, 0.625}},
+    {{-0.114197806, 0.351464659, -0.153073385}, {1.0, 1.0, 1.0}, {-0.285494506, 0.878661633, -0.382683456}, {0.300000012, 0.625}},
+    {{-0.167773053, 0.329273045, -0.153073385}, {1.0, 1.0, 1.0}, {-0.41943264, 0.823182583, -0.382683456}, {0.324999988, 0.625}},
+    {{-0.217217088, 0.298973709, -0.153073385}, {1.0, 1.0, 1.0}, {-0.543042719, 0.747434258, -0.382683456}, {0.349999994, 0.625}},
+    {{-0.261312604, 0.261312574, -0.153073385}, {1.0, 1.0, 1.0}, {-0.65328151, 0.65328145, -0.382683456}, {0.375, 0.625}},
+    {{-0.298973709, 0.217217088, -0.153073385}, {1.0, 1.0, 1.0}, {-0.747434258, 0.543042719, -0.382683456}, {0.400000006, 0.625}},
+    {{-0.329273105, 0.167772964, -0.153073385}, {1.0, 1.0, 1.0}, {-0.823182762, 0.419432402, -0.382683456}, {0.425000012, 0.625}},
+    {{-0.351464689, 0.114197716, -0.153073385}, {1.0, 1.0, 1.0}, {-0.878661752, 0.285494298, -0.382683456}, {0.449999988, 0.625}},
+    {{-0.365002006, 0.0578106306, -0.153073385}, {1.0, 1.0, 1.0}, {-0.912505031, 0.144526571, -0.382683456}, {0.474999994, 0.625}},
+    {{-0.369551808, -3.23072449e-08, -0.153073385}, {1.0, 1.0, 1.0}, {-0.923879504, -8.07681104e-08, -0.382683456}, {0.5, 0.625}},
+    {{-0.365002006, -0.057810694, -0.153073385}, {1.0, 1.0, 1.0}, {-0.912505031, -0.144526735, -0.382683456}, {0.524999976, 0.625}},
+    {{-0.351464659, -0.114197783, -0.153073385}, {1.0, 1.0, 1.0}, {-0.878661633, -0.285494447, -0.382683456}, {0.550000012, 0.625}},
+    {{-0.329273075, -0.167773023, -0.153073385}, {1.0, 1.0, 1.0}, {-0.823182702, -0.419432551, -0.382683456}, {0.574999988, 0.625}},
+    {{-0.29897368, -0.217217132, -0.153073385}, {1.0, 1.0, 1.0}, {-0.747434199, -0.543042839, -0.382683456}, {0.600000024, 0.625}},
+    {{-0.261312544, -0.261312634, -0.153073385}, {1.0, 1.0, 1.0}, {-0.653281331, -0.653281569, -0.382683456}, {0.625, 0.625}},
+    {{-0.217217028, -0.298973739, -0.153073385}, {1.0, 1.0, 1.0}, {-0.543042541, -0.747434378, -0.382683456}, {0.649999976, 0.625}},
+    {{-0.167772919, -0.329273134, -0.153073385}, {1.0, 1.0, 1.0}, {-0.419432282, -0.823182821, -0.382683456}, {0.675000012, 0.625}},
+    {{-0.114197828, -0.351464629, -0.153073385}, {1.0, 1.0, 1.0}, {-0.285494566, -0.878661573, -0.382683456}, {0.699999988, 0.625}},
+    {{-0.0578106567, -0.365002006, -0.153073385}, {1.0, 1.0, 1.0}, {-0.144526646, -0.912505031, -0.382683456}, {0.725000024, 0.625}},
+    {{4.4068611e-09, -0.369551808, -0.153073385}, {1.0, 1.0, 1.0}, {1.10171525e-08, -0.923879504, -0.382683456}, {0.75, 0.625}},
+    {{0.0578106679, -0.365002006, -0.153073385}, {1.0, 1.0, 1.0}, {0.144526675, -0.912505031, -0.382683456}, {0.774999976, 0.625}},
+    {{0.114197835, -0.351464629, -0.153073385}, {1.0, 1.0, 1.0}, {0.285494596, -0.878661573, -0.382683456}, {0.800000012, 0.625}},
+    {{0.167773083, -0.329273045, -0.153073385}, {1.0, 1.0, 1.0}, {0.4194327, -0.823182583, -0.382683456}, {0.824999988, 0.625}},
+    {{0.217217177, -0.29897362, -0.153073385}, {1.0, 1.0, 1.0}, {0.543042958, -0.74743402, -0.382683456}, {0.850000024, 0.625}},
+    {{0.261312664, -0.261312515, -0.153073385}, {1.0, 1.0, 1.0}, {0.653281689, -0.653281271, -0.382683456}, {0.875, 0.625}},
+    {{0.298973769, -0.217216983, -0.153073385}, {1.0, 1.0, 1.0}, {0.747434437, -0.543042481, -0.382683456}, {0.899999976, 0.625}},
+    {{0.329273075, -0.167773008, -0.153073385}, {1.0, 1.0, 1.0}, {0.823182702, -0.419432521, -0.382683456}, {0.925000012, 0.625}},
+    {{0.351464659, -0.114197776, -0.153073385}, {1.0, 1.0, 1.0}, {0.878661633, -0.285494447, -0.382683456}, {0.949999988, 0.625}},
+    {{0.365002006, -0.0578105971, -0.153073385}, {1.0, 1.0, 1.0}, {0.912505031, -0.144526497, -0.382683456}, {0.975000024, 0.625}},
+    {{0.369551808, 6.46144898e-08, -0.153073385}, {1.0, 1.0, 1.0}, {0.923879504, 1.61536221e-07, -0.382683456}, {1.0, 0.625}},
+    {{0.356402606, 0.0, -0.181596234}, {1.0, 1.0, 1.0}, {0.891006529, 0.0, -0.453990579}, {0.0, 0.649999976}},
+    {{0.352014691, 0.055753652, -0.181596234}, {1.0, 1.0, 1.0}, {0.880036712, 0.139384136, -0.453990579}, {0.0250000004, 0.649999976}},
+    {{0.338959008, 0.110134467, -0.181596234}, {1.0, 1.0, 1.0}, {0.847397506, 0.275336176, -0.453990579}, {0.0500000007, 0.649999976}},
+    {{0.317557037, 0.161803395, -0.181596234}, {1.0, 1.0, 1.0}, {0.793892622, 0.404508471, -0.453990579}, {0.075000003, 0.649999976}},
+    {{0.28833577, 0.209488198, -0.181596234}, {1.0, 1.0, 1.0}, {0.720839441, 0.523720503, -0.453990579}, {0.100000001, 0.649999976}},
+    {{0.252014697, 0.252014697, -0.181596234}, {1.0, 1.0, 1.0}, {0.630036712, 0.630036712, -0.453990579}, {0.125, 0.649999976}},
+    {{0.209488183, 0.28833577, -0.181596234}, {1.0, 1.0, 1.0}, {0.523720443, 0.720839441, -0.453990579}, {0.150000006, 0.649999976}},
+    {{0.161803409, 0.317557037, -0.181596234}, {1.0, 1.0, 1.0}, {0.404508531, 0.793892622, -0.453990579}, {0.174999997, 0.649999976}},
+    {{0.110134453, 0.338959038, -0.181596234}, {1.0, 1.0, 1.0}, {0.275336146, 0.847397566, -0.453990579}, {0.200000003, 0.649999976}},
+    {{0.0557536148, 0.352014691, -0.181596234}, {1.0, 1.0, 1.0}, {0.139384031, 0.880036712, -0.453990579}, {0.224999994, 0.649999976}},
+    {{-1.55788538e-08, 0.356402606, -0.181596234}, {1.0, 1.0, 1.0}, {-3.89471353e-08, 0.891006529, -0.453990579}, {0.25, 0.649999976}},
+    {{-0.0557536483, 0.352014691, -0.181596234}, {1.0, 1.0, 1.0}, {-0.139384121, 0.880036712, -0.453990579}, {0.275000006, 0.649999976}},
+    {{-0.110134482, 0.338959008, -0.181596234}, {1.0, 1.0, 1.0}, {-0.275336206, 0.847397506, -0.453990579}, {0.300000012, 0.649999976}},
+    {{-0.161803439, 0.317557037, -0.181596234}, {1.0, 1.0, 1.0}, {-0.404508591, 0.793892622, -0.453990579}, {0.324999988, 0.649999976}},
+    {{-0.209488183, 0.28833577, -0.181596234}, {1.0, 1.0, 1.0}, {-0.523720443, 0.720839441, -0.453990579}, {0.349999994, 0.649999976}},
+    {{-0.252014697, 0.252014697, -0.181596234}, {1.0, 1.0, 1.0}, {-0.630036712, 0.630036712, -0.453990579}, {0.375, 0.649999976}},
+    {{-0.28833577, 0.209488168, -0.181596234}, {1.0, 1.0, 1.0}, {-0.720839441, 0.523720443, -0.453990579}, {0.400000006, 0.649999976}},
+    {{-0.317557067, 0.16180335, -0.181596234}, {1.0, 1.0, 1.0}, {-0.793892682, 0.404508382, -0.453990579}, {0.425000012, 0.649999976}},
+    {{-0.338959038, 0.110134393, -0.181596234}, {1.0, 1.0, 1.0}, {-0.847397566, 0.275335968, -0.453990579}, {0.449999988, 0.649999976}},
+    {{-0.352014691, 0.0557536446, -0.181596234}, {1.0, 1.0, 1.0}, {-0.880036712, 0.139384106, -0.453990579}, {0.474999994, 0.649999976}},
+    {{-0.356402606, -3.11577075e-08, -0.181596234}, {1.0, 1.0, 1.0}, {-0.891006529, -7.78942706e-08, -0.453990579}, {0.5, 0.649999976}},
+    {{-0.352014691, -0.0557537042, -0.181596234}, {1.0, 1.0, 1.0}, {-0.880036712, -0.139384255, -0.453990579}, {0.524999976, 0.649999976}},
+    {{-0.338959008, -0.110134453, -0.181596234}, {1.0, 1.0, 1.0}, {-0.847397506, -0.275336146, -0.453990579}, {0.550000012, 0.649999976}},
+    {{-0.317557037, -0.161803409, -0.181596234}, {1.0, 1.0, 1.0}, {-0.793892622, -0.404508531, -0.453990579}, {0.574999988, 0.649999976}},
+    {{-0.288335741, -0.209488228, -0.181596234}, {1.0, 1.0, 1.0}, {-0.720839381, -0.523720562, -0.453990579}, {0.600000024, 0.649999976}},
+    {{-0.252014667, -0.252014756, -0.181596234}, {1.0, 1.0, 1.0}, {-0.630036652, -0.630036891, -0.453990579}, {0.625, 0.649999976}},
+    {{-0.209488124, -0.2883358, -0.181596234}, {1.0, 1.0, 1.0}, {-0.523720324, -0.7208395, -0.453990579}, {0.649999976, 0.649999976}},
+    {{-0.161803305, -0.317557096, -0.181596234}, {1.0, 1.0, 1.0}, {-0.404508263, -0.793892741, -0.453990579}, {0.675000012, 0.649999976}},
+    {{-0.110134505, -0.338959008, -0.181596234}, {1.0, 1.0, 1.0}, {-0.275336266, -0.847397506, -0.453990579}, {0.699999988, 0.649999976}},
+    {{-0.0557536706, -0.352014691, -0.181596234}, {1.0, 1.0, 1.0}, {-0.13938418, -0.880036712, -0.453990579}, {0.725000024, 0.649999976}},
+    {{4.25005853e-09, -0.356402606, -0.181596234}, {1.0, 1.0, 1.0}, {1.06251461e-08, -0.891006529, -0.453990579}, {0.75, 0.649999976}},
+    {{0.0557536781, -0.352014691, -0.181596234}, {1.0, 1.0, 1.0}, {0.139384195, -0.880036712, -0.453990579}, {0.774999976, 0.649999976}},
+    {{0.110134512, -0.338959008, -0.181596234}, {1.0, 1.0, 1.0}, {0.275336266, -0.847397506, -0.453990579}, {0.800000012, 0.649999976}},
+    {{0.161803469, -0.317557007, -0.181596234}, {1.0, 1.0, 1.0}, {0.40450868, -0.793892503, -0.453990579}, {0.824999988, 0.649999976}},
+    {{0.209488273, -0.288335711, -0.181596234}, {1.0, 1.0, 1.0}, {0.523720682, -0.720839262, -0.453990579}, {0.850000024, 0.649999976}},
+    {{0.252014786, -0.252014607, -0.181596234}, {1.0, 1.0, 1.0}, {0.63003695, -0.630036533, -0.453990579}, {0.875, 0.649999976}},
+    {{0.28833586, -0.209488079, -0.181596234}, {1.0, 1.0, 1.0}, {0.72083962, -0.523720205, -0.453990579}, {0.899999976, 0.649999976}},
+    {{0.317557037, -0.161803409, -0.181596234}, {1.0, 1.0, 1.0}, {0.793892622, -0.404508531, -0.453990579}, {0.925000012, 0.649999976}},
+    {{0.338959038, -0.110134445, -0.181596234}, {1.0, 1.0, 1.0}, {0.847397566, -0.275336117, -0.453990579}, {0.949999988, 0.649999976}},
+    {{0.352014691, -0.055753611, -0.181596234}, {1.0, 1.0, 1.0}, {0.880036712, -0.139384031, -0.453990579}, {0.975000024, 0.649999976}},
+    {{0.356402606, 6.23154151e-08, -0.181596234}, {1.0, 1.0, 1.0}, {0.891006529, 1.55788541e-07, -0.453990579}, {1.0, 0.649999976}},
+    {{0.341056049, 0.0, -0.20899947}, {1.0, 1.0, 1.0}, {0.852640152, 0.0, -0.522498667}, {0.0, 0.675000012}},
+    {{0.33685708, 0.0533529222, -0.20899947}, {1.0, 1.0, 1.0}, {0.842142701, 0.133382306, -0.522498667}, {0.0250000004, 0.675000012}},
+    {{0.324363589, 0.105392121, -0.20899947}, {1.0, 1.0, 1.0}, {0.810908973, 0.263480306, -0.522498667}, {0.0500000007, 0.675000012}},
+    {{0.303883165, 0.154836208, -0.20899947}, {1.0, 1.0, 1.0}, {0.759707928, 0.387090504, -0.522498667}, {0.075000003, 0.675000012}},
+    {{0.275920123, 0.200467721, -0.20899947}, {1.0, 1.0, 1.0}, {0.689800322, 0.501169324, -0.522498667}, {0.100000001, 0.675000012}},
+    {{0.241163045, 0.241163045, -0.20899947}, {1.0, 1.0, 1.0}, {0.602907598, 0.602907598, -0.522498667}, {0.125, 0.675000012}},
+    {{0.200467706, 0.275920153, -0.20899947}, {1.0, 1.0, 1.0}, {0.501169264, 0.689800382, -0.522498667}, {0.150000006, 0.675000012}},
+    {{0.154836208, 0.303883165, -0.20899947}, {1.0, 1.0, 1.0}, {0.387090504, 0.759707928, -0.522498667}, {0.174999997, 0.675000012}},
+    {{0.105392106, 0.324363589, -0.20899947}, {1.0, 1.0, 1.0}, {0.263480276, 0.810908973, -0.522498667}, {0.200000003, 0.675000012}},
+    {{0.0533528887, 0.33685708, -0.20899947}, {1.0, 1.0, 1.0}, {0.133382216, 0.842142701, -0.522498667}, {0.224999994, 0.675000012}},
+    {{-1.49080339e-08, 0.341056049, -0.20899947}, {1.0, 1.0, 1.0}, {-3.72700839e-08, 0.852640152, -0.522498667}, {0.25, 0.675000012}},
+    {{-0.0533529185, 0.33685708, -0.20899947}, {1.0, 1.0, 1.0}, {-0.133382291, 0.842142701, -0.522498667}, {0.275000006, 0.675000012}},
+    {{-0.105392136, 0.324363559, -0.20899947}, {1.0, 1.0, 1.0}, {-0.263480335, 0.810908914, -0.522498667}, {0.300000012, 0.675000012}},
+    {{-0.154836237, 0.303883135, -0.20899947}, {1.0, 1.0, 1.0}, {-0.387090594, 0.759707808, -0.522498667}, {0.324999988, 0.675000012}},
+    {{-0.200467706, 0.275920153, -0.20899947}, {1.0, 1.0, 1.0}, {-0.501169264, 0.689800382, -0.522498667}, {0.349999994, 0.675000012}},
+    {{-0.241163045, 0.241163045, -0.20899947}, {1.0, 1.0, 1.0}, {-0.602907598, 0.602907598, -0.522498667}, {0.375, 0.675000012}},
+    {{-0.275920153, 0.200467691, -0.20899947}, {1.0, 1.0, 1.0}, {-0.689800382, 0.501169205, -0.522498667}, {0.400000006, 0.675000012}},
+    {{-0.303883195, 0.154836163, -0.20899947}, {1.0, 1.0, 1.0}, {-0.759707987, 0.387090415, -0.522498667}, {0.425000012, 0.675000012}},
+    {{-0.324363589, 0.105392054, -0.20899947}, {1.0, 1.0, 1.0}, {-0.810908973, 0.263480127, -0.522498667}, {0.449999988, 0.675000012}},
+    {{-0.33685708, 0.053352911, -0.20899947}, {1.0, 1.0, 1.0}, {-0.842142701, 0.133382276, -0.522498667}, {0.474999994, 0.675000012}},
+    {{-0.341056049, -2.98160678e-08, -0.20899947}, {1.0, 1.0, 1.0}, {-0.852640152, -7.45401678e-08, -0.522498667}, {0.5, 0.675000012}},
+    {{-0.33685708, -0.0533529706, -0.20899947}, {1.0, 1.0, 1.0}, {-0.842142701, -0.133382425, -0.522498667}, {0.524999976, 0.675000012}},
+    {{-0.324363589, -0.105392106, -0.20899947}, {1.0, 1.0, 1.0}, {-0.810908973, -0.263480276, -0.522498667}, {0.550000012, 0.675000012}},
+    {{-0.303883165, -0.154836223, -0.20899947}, {1.0, 1.0, 1.0}, {-0.759707928, -0.387090564, -0.522498667}, {0.574999988, 0.675000012}},
+    {{-0.275920123, -0.20046775, -0.20899947}, {1.0, 1.0, 1.0}, {-0.689800322, -0.501169384, -0.522498667}, {0.600000024, 0.675000012}},
+    {{-0.241163, -0.24116309, -0.20899947}, {1.0, 1.0, 1.0}, {-0.602907479, -0.602907717, -0.522498667}, {0.625, 0.675000012}},
+    {{-0.200467646, -0.275920182, -0.20899947}, {1.0, 1.0, 1.0}, {-0.501169086, -0.689800441, -0.522498667}, {0.649999976, 0.675000012}},
+    {{-0.154836118, -0.303883225, -0.20899947}, {1.0, 1.0, 1.0}, {-0.387090296, -0.759708047, -0.522498667}, {0.675000012, 0.675000012}},
+    {{-0.105392151, -0.324363559, -0.20899947}, {1.0, 1.0, 1.0}, {-0.263480365, -0.810908914, -0.522498667}, {0.699999988, 0.675000012}},
+    {{-0.0533529371, -0.33685708, -0.20899947}, {1.0, 1.0, 1.0}, {-0.13338235, -0.842142701, -0.522498667}, {0.725000024, 0.675000012}},
+    {{4.06705247e-09, -0.341056049, -0.20899947}, {1.0, 1.0, 1.0}, {1.01676312e-08, -0.852640152, -0.522498667}, {0.75, 0.675000012}},
+    {{0.0533529446, -0.33685708, -0.20899947}, {1.0, 1.0, 1.0}, {0.133382365, -0.842142701, -0.522498667}, {0.774999976, 0.675000012}},
+    {{0.105392158, -0.324363559, -0.20899947}, {1.0, 1.0, 1.0}, {0.263480395, -0.810908914, -0.522498667}, {0.800000012, 0.675000012}},
+    {{0.154836267, -0.303883135, -0.20899947}, {1.0, 1.0, 1.0}, {0.387090683, -0.759707808, -0.522498667}, {0.824999988, 0.675000012}},
+    {{0.200467795, -0.275920093, -0.20899947}, {1.0, 1.0, 1.0}, {0.501169503, -0.689800262, -0.522498667}, {0.850000024, 0.675000012}},
+    {{0.24116312, -0.241162971, -0.20899947}, {1.0, 1.0, 1.0}, {0.602907777, -0.602907419, -0.522498667}, {0.875, 0.675000012}},
+    {{0.275920212, -0.200467601, -0.20899947}, {1.0, 1.0, 1.0}, {0.689800501, -0.501169026, -0.522498667}, {0.899999976, 0.675000012}},
+    {{0.303883165, -0.154836208, -0.20899947}, {1.0, 1.0, 1.0}, {0.759707928, -0.387090504, -0.522498667}, {0.925000012, 0.675000012}},
+    {{0.324363589, -0.105392098, -0.20899947}, {1.0, 1.0, 1.0}, {0.810908973, -0.263480246, -0.522498667}, {0.949999988, 0.675000012}},
+    {{0.33685708, -0.0533528849, -0.20899947}, {1.0, 1.0, 1.0}, {0.842142701, -0.133382216, -0.522498667}, {0.975000024, 0.675000012}},
+    {{0.341056049, 5.96321357e-08, -0.20899947}, {1.0, 1.0, 1.0}, {0.852640152, 1.49080336e-07, -0.522498667}, {1.0, 0.675000012}},
+    {{0.323606819, 0.0, -0.235114068}, {1.0, 1.0, 1.0}, {0.809017062, 0.0, -0.587785184}, {0.0, 0.699999988}},
+    {{0.319622695, 0.0506232604, -0.235114068}, {1.0, 1.0, 1.0}, {0.799056768, 0.126558155, -0.587785184}, {0.0250000004, 0.699999988}},
+    {{0.307768375, 0.100000009, -0.235114068}, {1.0, 1.0, 1.0}, {0.769420922, 0.25000003, -0.587785184}, {0.0500000007, 0.699999988}},
+    {{0.28833577, 0.146914423, -0.235114068}, {1.0, 1.0, 1.0}, {0.720839441, 0.367286056, -0.587785184}, {0.075000003, 0.699999988}},
+    {{0.261803418, 0.190211326, -0.235114068}, {1.0, 1.0, 1.0}, {0.654508531, 0.4755283, -0.587785184}, {0.100000001, 0.699999988}},
+    {{0.228824571, 0.228824586, -0.235114068}, {1.0, 1.0, 1.0}, {0.572061419, 0.572061479, -0.587785184}, {0.125, 0.699999988}},
+    {{0.190211311, 0.261803418, -0.235114068}, {1.0, 1.0, 1.0}, {0.47552827, 0.654508531, -0.587785184}, {0.150000006, 0.699999988}},
+    {{0.146914423, 0.28833577, -0.235114068}, {1.0, 1.0, 1.0}, {0.367286056, 0.720839441, -0.587785184}, {0.174999997, 0.699999988}},
+    {{0.099999994, 0.307768375, -0.235114068}, {1.0, 1.0, 1.0}, {0.249999985, 0.769420922, -0.587785184}, {0.200000003, 0.699999988}},
+    {{0.0506232269, 0.319622695, -0.235114068}, {1.0, 1.0, 1.0}, {0.126558065, 0.799056768, -0.587785184}, {0.224999994, 0.699999988}},
+    {{-1.41453036e-08, 0.323606819, -0.235114068}, {1.0, 1.0, 1.0}, {-3.53632572e-08, 0.809017062, -0.587785184}, {0.25, 0.699999988}},
+    {{-0.0506232567, 0.319622695, -0.235114068}, {1.0, 1.0, 1.0}, {-0.12655814, 0.799056768, -0.587785184}, {0.275000006, 0.699999988}},
+    {{-0.100000024, 0.307768375, -0.235114068}, {1.0, 1.0, 1.0}, {-0.25000006, 0.769420922, -0.587785184}, {0.300000012, 0.699999988}},
+    {{-0.146914452, 0.28833577, -0.235114068}, {1.0, 1.0, 1.0}, {-0.367286146, 0.720839441, -0.587785184}, {0.324999988, 0.699999988}},
+    {{-0.190211296, 0.261803418, -0.235114068}, {1.0, 1.0, 1.0}, {-0.47552824, 0.654508531, -0.587785184}, {0.349999994, 0.699999988}},
+    {{-0.228824571, 0.228824571, -0.235114068}, {1.0, 1.0, 1.0}, {-0.572061419, 0.572061419, -0.587785184}, {0.375, 0.699999988}},
+    {{-0.261803418, 0.190211296, -0.235114068}, {1.0, 1.0, 1.0}, {-0.654508531, 0.47552824, -0.587785184}, {0.400000006, 0.699999988}},
+    {{-0.2883358, 0.146914378, -0.235114068}, {1.0, 1.0, 1.0}, {-0.7208395, 0.367285937, -0.587785184}, {0.425000012, 0.699999988}},
+    {{-0.307768404, 0.0999999493, -0.235114068}, {1.0, 1.0, 1.0}, {-0.769420981, 0.249999881, -0.587785184}, {0.449999988, 0.699999988}},
+    {{-0.319622695, 0.050623253, -0.235114068}, {1.0, 1.0, 1.0}, {-0.799056768, 0.126558125, -0.587785184}, {0.474999994, 0.699999988}},
+    {{-0.323606819, -2.82906072e-08, -0.235114068}, {1.0, 1.0, 1.0}, {-0.809017062, -7.07265144e-08, -0.587785184}, {0.5, 0.699999988}},
+    {{-0.319622666, -0.0506233089, -0.235114068}, {1.0, 1.0, 1.0}, {-0.799056649, -0.126558274, -0.587785184}, {0.524999976, 0.699999988}},
+    {{-0.307768375, -0.100000001, -0.235114068}, {1.0, 1.0, 1.0}, {-0.769420922, -0.25, -0.587785184}, {0.550000012, 0.699999988}},
+    {{-0.28833577, -0.146914437, -0.235114068}, {1.0, 1.0, 1.0}, {-0.720839441, -0.367286086, -0.587785184}, {0.574999988, 0.699999988}},
+    {{-0.261803389, -0.190211341, -0.235114068}, {1.0, 1.0, 1.0}, {-0.654508471, -0.475528359, -0.587785184}, {0.600000024, 0.699999988}},
+    {{-0.228824541, -0.228824615, -0.235114068}, {1.0, 1.0, 1.0}, {-0.57206136, -0.572061539, -0.587785184}, {0.625, 0.699999988}},
+    {{-0.190211251, -0.261803448, -0.235114068}, {1.0, 1.0, 1.0}, {-0.475528121, -0.654508591, -0.587785184}, {0.649999976, 0.699999988}},
+    {{-0.146914333, -0.28833583, -0.235114068}, {1.0, 1.0, 1.0}, {-0.367285848, -0.72083956, -0.587785184}, {0.675000012, 0.699999988}},
+    {{-0.100000039, -0.307768375, -0.235114068}, {1.0, 1.0, 1.0}, {-0.250000089, -0.769420922, -0.587785184}, {0.699999988, 0.699999988}},
+    {{-0.0506232753, -0.319622666, -0.235114068}, {1.0, 1.0, 1.0}, {-0.126558185, -0.799056649, -0.587785184}, {0.725000024, 0.699999988}},
+    {{3.8589727e-09, -0.323606819, -0.235114068}, {1.0, 1.0, 1.0}, {9.6474313e-09, -0.809017062, -0.587785184}, {0.75, 0.699999988}},
+    {{0.0506232828, -0.319622666, -0.235114068}, {1.0, 1.0, 1.0}, {0.126558214, -0.799056649, -0.587785184}, {0.774999976, 0.699999988}},
+    {{0.100000046, -0.307768375, -0.235114068}, {1.0, 1.0, 1.0}, {0.250000119, -0.769420922, -0.587785184}, {0.800000012, 0.699999988}},
+    {{0.146914482, -0.28833577, -0.235114068}, {1.0, 1.0, 1.0}, {0.367286205, -0.720839441, -0.587785184}, {0.824999988, 0.699999988}},
+    {{0.190211385, -0.261803359, -0.235114068}, {1.0, 1.0, 1.0}, {0.475528479, -0.654508412, -0.587785184}, {0.850000024, 0.699999988}},
+    {{0.228824645, -0.228824496, -0.235114068}, {1.0, 1.0, 1.0}, {0.572061598, -0.572061241, -0.587785184}, {0.875, 0.699999988}},
+    {{0.261803478, -0.190211207, -0.235114068}, {1.0, 1.0, 1.0}, {0.65450871, -0.475528002, -0.587785184}, {0.899999976, 0.699999988}},
+    {{0.28833577, -0.146914423, -0.235114068}, {1.0, 1.0, 1.0}, {0.720839441, -0.367286056, -0.587785184}, {0.925000012, 0.699999988}},
+    {{0.307768375, -0.099999994, -0.235114068}, {1.0, 1.0, 1.0}, {0.769420922, -0.249999985, -0.587785184}, {0.949999988, 0.699999988}},
+    {{0.319622695, -0.0506232232, -0.235114068}, {1.0, 1.0, 1.0}, {0.799056768, -0.126558065, -0.587785184}, {0.975000024, 0.699999988}},
+    {{0.323606819, 5.65812144e-08, -0.235114068}, {1.0, 1.0, 1.0}, {0.809017062, 1.41453029e-07, -0.587785184}, {1.0, 0.699999988}},
+    {{0.304162413, 0.0, -0.259779215}, {1.0, 1.0, 1.0}, {0.760406017, 0.0, -0.649448037}, {0.0, 0.725000024}},
+    {{0.300417662, 0.0475814864, -0.259779215}, {1.0, 1.0, 1.0}, {0.751044154, 0.11895372, -0.649448037}, {0.0250000004, 0.725000024}},
+    {{0.289275646, 0.0939913541, -0.259779215}, {1.0, 1.0, 1.0}, {0.723189116, 0.234978378, -0.649448037}, {0.0500000007, 0.725000024}},
+    {{0.271010697, 0.138086855, -0.259779215}, {1.0, 1.0, 1.0}, {0.677526712, 0.345217139, -0.649448037}, {0.075000003, 0.725000024}},
+    {{0.246072561, 0.17878218, -0.259779215}, {1.0, 1.0, 1.0}, {0.615181386, 0.446955442, -0.649448037}, {0.100000001, 0.725000024}},
+    {{0.215075299, 0.215075314, -0.259779215}, {1.0, 1.0, 1.0}, {0.537688255, 0.537688255, -0.649448037}, {0.125, 0.725000024}},
+    {{0.17878218, 0.246072561, -0.259779215}, {1.0, 1.0, 1.0}, {0.446955442, 0.615181386, -0.649448037}, {0.150000006, 0.725000024}},
+    {{0.138086855, 0.271010697, -0.259779215}, {1.0, 1.0, 1.0}, {0.345217139, 0.677526712, -0.649448037}, {0.174999997, 0.725000024}},
+    {{0.0939913467, 0.289275646, -0.259779215}, {1.0, 1.0, 1.0}, {0.234978363, 0.723189116, -0.649448037}, {0.200000003, 0.725000024}},
+    {{0.0475814529, 0.300417662, -0.259779215}, {1.0, 1.0, 1.0}, {0.11895363, 0.751044154, -0.649448037}, {0.224999994, 0.725000024}},
+    {{-1.32953621e-08, 0.304162413, -0.259779215}, {1.0, 1.0, 1.0}, {-3.3238404e-08, 0.760406017, -0.649448037}, {0.25, 0.725000024}},
+    {{-0.0475814827, 0.300417662, -0.259779215}, {1.0, 1.0, 1.0}, {-0.118953705, 0.751044154, -0.649448037}, {0.275000006, 0.725000024}},
+    {{-0.093991369, 0.289275646, -0.259779215}, {1.0, 1.0, 1.0}, {-0.234978423, 0.723189116, -0.649448037}, {0.300000012, 0.725000024}},
+    {{-0.13808687, 0.271010667, -0.259779215}, {1.0, 1.0, 1.0}, {-0.345217168, 0.677526653, -0.649448037}, {0.324999988, 0.725000024}},
+    {{-0.178782165, 0.246072575, -0.259779215}, {1.0, 1.0, 1.0}, {-0.446955413, 0.615181446, -0.649448037}, {0.349999994, 0.725000024}},
+    {{-0.215075299, 0.215075299, -0.259779215}, {1.0, 1.0, 1.0}, {-0.537688255, 0.537688255, -0.649448037}, {0.375, 0.725000024}},
+    {{-0.246072575, 0.178782165, -0.259779215}, {1.0, 1.0, 1.0}, {-0.615181446, 0.446955413, -0.649448037}, {0.400000006, 0.725000024}},
+    {{-0.271010727, 0.138086811, -0.259779215}, {1.0, 1.0, 1.0}, {-0.677526832, 0.345217019, -0.649448037}, {0.425000012, 0.725000024}},
+    {{-0.289275676, 0.0939912945, -0.259779215}, {1.0, 1.0, 1.0}, {-0.723189175, 0.234978229, -0.649448037}, {0.449999988, 0.725000024}},
+    {{-0.300417662, 0.047581479, -0.259779215}, {1.0, 1.0, 1.0}, {-0.751044154, 0.118953697, -0.649448037}, {0.474999994, 0.725000024}},
+    {{-0.304162413, -2.65907243e-08, -0.259779215}, {1.0, 1.0, 1.0}, {-0.760406017, -6.64768081e-08, -0.649448037}, {0.5, 0.725000024}},
+    {{-0.300417662, -0.0475815311, -0.259779215}, {1.0, 1.0, 1.0}, {-0.751044154, -0.118953824, -0.649448037}, {0.524999976, 0.725000024}},
+    {{-0.289275646, -0.0939913467, -0.259779215}, {1.0, 1.0, 1.0}, {-0.723189116, -0.234978363, -0.649448037}, {0.550000012, 0.725000024}},
+    {{-0.271010697, -0.138086855, -0.259779215}, {1.0, 1.0, 1.0}, {-0.677526712, -0.345217139, -0.649448037}, {0.574999988, 0.725000024}},
+    {{-0.246072546, -0.17878221, -0.259779215}, {1.0, 1.0, 1.0}, {-0.615181386, -0.446955532, -0.649448037}, {0.600000024, 0.725000024}},
+    {{-0.215075269, -0.215075344, -0.259779215}, {1.0, 1.0, 1.0}, {-0.537688196, -0.537688375, -0.649448037}, {0.625, 0.725000024}},
+    {{-0.17878212, -0.246072605, -0.259779215}, {1.0, 1.0, 1.0}, {-0.446955293, -0.615181506, -0.649448037}, {0.649999976, 0.725000024}},
+    {{-0.138086766, -0.271010727, -0.259779215}, {1.0, 1.0, 1.0}, {-0.34521693, -0.677526832, -0.649448037}, {0.675000012, 0.725000024}},
+    {{-0.0939913914, -0.289275646, -0.259779215}, {1.0, 1.0, 1.0}, {-0.234978482, -0.723189116, -0.649448037}, {0.699999988, 0.725000024}},
+    {{-0.0475815013, -0.300417662, -0.259779215}, {1.0, 1.0, 1.0}, {-0.11895375, -0.751044154, -0.649448037}, {0.725000024, 0.725000024}},
+    {{3.6271004e-09, -0.304162413, -0.259779215}, {1.0, 1.0, 1.0}, {9.06775099e-09, -0.760406017, -0.649448037}, {0.75, 0.725000024}},
+    {{0.0475815088, -0.300417662, -0.259779215}, {1.0, 1.0, 1.0}, {0.118953772, -0.751044154, -0.649448037}, {0.774999976, 0.725000024}},
+    {{0.0939913988, -0.289275646, -0.259779215}, {1.0, 1.0, 1.0}, {0.234978497, -0.723189116, -0.649448037}, {0.800000012, 0.725000024}},
+    {{0.1380869, -0.271010667, -0.259779215}, {1.0, 1.0, 1.0}, {0.345217258, -0.677526653, -0.649448037}, {0.824999988, 0.725000024}},
+    {{0.17878224, -0.246072516, -0.259779215}, {1.0, 1.0, 1.0}, {0.446955591, -0.615181267, -0.649448037}, {0.850000024, 0.725000024}},
+    {{0.215075374, -0.21507524, -0.259779215}, {1.0, 1.0, 1.0}, {0.537688434, -0.537688076, -0.649448037}, {0.875, 0.725000024}},
+    {{0.246072635, -0.178782091, -0.259779215}, {1.0, 1.0, 1.0}, {0.615181565, -0.446955234, -0.649448037}, {0.899999976, 0.725000024}},
+    {{0.271010697, -0.138086855, -0.259779215}, {1.0, 1.0, 1.0}, {0.677526712, -0.345217139, -0.649448037}, {0.925000012, 0.725000024}},
+    {{0.289275646, -0.0939913392, -0.259779215}, {1.0, 1.0, 1.0}, {0.723189116, -0.234978348, -0.649448037}, {0.949999988, 0.725000024}},
+    {{0.300417662, -0.0475814529, -0.259779215}, {1.0, 1.0, 1.0}, {0.751044154, -0.11895363, -0.649448037}, {0.975000024, 0.725000024}},
+    {{0.304162413, 5.31814486e-08, -0.259779215}, {1.0, 1.0, 1.0}, {0.760406017, 1.32953616e-07, -0.649448037}, {1.0, 0.725000024}},
+    {{0.282842726, 0.0, -0.282842696}, {1.0, 1.0, 1.0}, {0.707106829, 0.0, -0.707106709}, {0.0, 0.75}},
+    {{0.279360473, 0.0442463532, -0.282842696}, {1.0, 1.0, 1.0}, {0.698401213, 0.110615879, -0.707106709}, {0.0250000004, 0.75}},
+    {{0.268999428, 0.087403208, -0.282842696}, {1.0, 1.0, 1.0}, {0.672498584, 0.21850802, -0.707106709}, {0.0500000007, 0.75}},
+    {{0.252014726, 0.12840791, -0.282842696}, {1.0, 1.0, 1.0}, {0.630036831, 0.321019769, -0.707106709}, {0.075000003, 0.75}},
+    {{0.228824571, 0.16625078, -0.282842696}, {1.0, 1.0, 1.0}, {0.572061419, 0.415626943, -0.707106709}, {0.100000001, 0.75}},
+    {{0.200000003, 0.200000018, -0.282842696}, {1.0, 1.0, 1.0}, {0.5, 0.50000006, -0.707106709}, {0.125, 0.75}},
+    {{0.16625078, 0.228824571, -0.282842696}, {1.0, 1.0, 1.0}, {0.415626943, 0.572061419, -0.707106709}, {0.150000006, 0.75}},
+    {{0.12840791, 0.252014697, -0.282842696}, {1.0, 1.0, 1.0}, {0.321019769, 0.630036712, -0.707106709}, {0.174999997, 0.75}},
+    {{0.0874032006, 0.268999428, -0.282842696}, {1.0, 1.0, 1.0}, {0.218508005, 0.672498584, -0.707106709}, {0.200000003, 0.75}},
+    {{0.0442463234, 0.279360473, -0.282842696}, {1.0, 1.0, 1.0}, {0.110615805, 0.698401213, -0.707106709}, {0.224999994, 0.75}},
+    {{-1.23634489e-08, 0.282842726, -0.282842696}, {1.0, 1.0, 1.0}, {-3.09086232e-08, 0.707106829, -0.707106709}, {0.25, 0.75}},
+    {{-0.0442463458, 0.279360473, -0.282842696}, {1.0, 1.0, 1.0}, {-0.110615864, 0.698401213, -0.707106709}, {0.275000006, 0.75}},
+    {{-0.0874032229, 0.268999398, -0.282842696}, {1.0, 1.0, 1.0}, {-0.218508065, 0.672498465, -0.707106709}, {0.300000012, 0.75}},
+    {{-0.12840794, 0.252014697, -0.282842696}, {1.0, 1.0, 1.0}, {-0.321019858, 0.630036712, -0.707106709}, {0.324999988, 0.75}},
+    {{-0.166250765, 0.228824586, -0.282842696}, {1.0, 1.0, 1.0}, {-0.415626913, 0.572061479, -0.707106709}, {0.349999994, 0.75}},
+    {{-0.200000003, 0.200000003, -0.282842696}, {1.0, 1.0, 1.0}, {-0.5, 0.5, -0.707106709}, {0.375, 0.75}},
+    {{-0.228824586, 0.166250765, -0.282842696}, {1.0, 1.0, 1.0}, {-0.572061479, 0.415626913, -0.707106709}, {0.400000006, 0.75}},
+    {{-0.252014726, 0.128407881, -0.282842696}, {1.0, 1.0, 1.0}, {-0.630036831, 0.321019709, -0.707106709}, {0.425000012, 0.75}},
+    {{-0.268999428, 0.0874031559, -0.282842696}, {1.0, 1.0, 1.0}, {-0.672498584, 0.218507886, -0.707106709}, {0.449999988, 0.75}},
+    {{-0.279360473, 0.0442463458, -0.282842696}, {1.0, 1.0, 1.0}, {-0.698401213, 0.110615864, -0.707106709}, {0.474999994, 0.75}},
+    {{-0.282842726, -2.47268979e-08, -0.282842696}, {1.0, 1.0, 1.0}, {-0.707106829, -6.18172464e-08, -0.707106709}, {0.5, 0.75}},
+    {{-0.279360443, -0.0442463942, -0.282842696}, {1.0, 1.0, 1.0}, {-0.698401093, -0.110615984, -0.707106709}, {0.524999976, 0.75}},
+    {{-0.268999428, -0.0874032006, -0.282842696}, {1.0, 1.0, 1.0}, {-0.672498584, -0.218508005, -0.707106709}, {0.550000012, 0.75}},
+    {{-0.252014697, -0.128407925, -0.282842696}, {1.0, 1.0, 1.0}, {-0.630036712, -0.321019828, -0.707106709}, {0.574999988, 0.75}},
+    {{-0.228824556, -0.16625081, -0.282842696}, {1.0, 1.0, 1.0}, {-0.572061419, -0.415627033, -0.707106709}, {0.600000024, 0.75}},
+    {{-0.199999973, -0.200000048, -0.282842696}, {1.0, 1.0, 1.0}, {-0.49999994, -0.500000119, -0.707106709}, {0.625, 0.75}},
+    {{-0.166250736, -0.228824615, -0.282842696}, {1.0, 1.0, 1.0}, {-0.415626824, -0.572061539, -0.707106709}, {0.649999976, 0.75}},
+    {{-0.128407836, -0.252014756, -0.282842696}, {1.0, 1.0, 1.0}, {-0.32101959, -0.630036891, -0.707106709}, {0.675000012, 0.75}},
+    {{-0.0874032378, -0.268999398, -0.282842696}, {1.0, 1.0, 1.0}, {-0.218508095, -0.672498465, -0.707106709}, {0.699999988, 0.75}},
+    {{-0.0442463644, -0.279360473, -0.282842696}, {1.0, 1.0, 1.0}, {-0.110615909, -0.698401213, -0.707106709}, {0.725000024, 0.75}},
+    {{3.37286576e-09, -0.282842726, -0.282842696}, {1.0, 1.0, 1.0}, {8.4321643e-09, -0.707106829, -0.707106709}, {0.75, 0.75}},
+    {{0.0442463718, -0.279360473, -0.282842696}, {1.0, 1.0, 1.0}, {0.110615931, -0.698401213, -0.707106709}, {0.774999976, 0.75}},
+    {{0.0874032453, -0.268999398, -0.282842696}, {1.0, 1.0, 1.0}, {0.218508109, -0.672498465, -0.707106709}, {0.800000012, 0.75}},
+    {{0.128407955, -0.252014697, -0.282842696}, {1.0, 1.0, 1.0}, {0.321019888, -0.630036712, -0.707106709}, {0.824999988, 0.75}},
+    {{0.16625084, -0.228824526, -0.282842696}, {1.0, 1.0, 1.0}, {0.415627092, -0.5720613, -0.707106709}, {0.850000024, 0.75}},
+    {{0.200000077, -0.199999943, -0.282842696}, {1.0, 1.0, 1.0}, {0.500000179, -0.499999851, -0.707106709}, {0.875, 0.75}},
+    {{0.22882463, -0.166250691, -0.282842696}, {1.0, 1.0, 1.0}, {0.572061598, -0.415626734, -0.707106709}, {0.899999976, 0.75}},
+    {{0.252014726, -0.12840791, -0.282842696}, {1.0, 1.0, 1.0}, {0.630036831, -0.321019769, -0.707106709}, {0.925000012, 0.75}},
+    {{0.268999428, -0.0874031931, -0.282842696}, {1.0, 1.0, 1.0}, {0.672498584, -0.218507975, -0.707106709}, {0.949999988, 0.75}},
+    {{0.279360473, -0.0442463197, -0.282842696}, {1.0, 1.0, 1.0}, {0.698401213, -0.110615797, -0.707106709}, {0.975000024, 0.75}},
+    {{0.282842726, 4.94537957e-08, -0.282842696}, {1.0, 1.0, 1.0}, {0.707106829, 1.23634493e-07, -0.707106709}, {1.0, 0.75}},
+    {{0.259779215, 0.0, -0.304162383}, {1.0, 1.0, 1.0}, {0.649448037, 0.0, -0.760405958}, {0.0, 0.774999976}},
+    {{0.256580889, 0.0406384245, -0.304162383}, {1.0, 1.0, 1.0}, {0.641452193, 0.101596057, -0.760405958}, {0.0250000004, 0.774999976}},
+    {{0.24706471, 0.0802761912, -0.304162383}, {1.0, 1.0, 1.0}, {0.617661774, 0.200690478, -0.760405958}, {0.0500000007, 0.774999976}},
+    {{0.231464967, 0.117937297, -0.304162383}, {1.0, 1.0, 1.0}, {0.578662395, 0.294843256, -0.760405958}, {0.075000003, 0.774999976}},
+    {{0.210165799, 0.152694389, -0.304162383}, {1.0, 1.0, 1.0}, {0.525414467, 0.381735981, -0.760405958}, {0.100000001, 0.774999976}},
+    {{0.183691636, 0.183691651, -0.304162383}, {1.0, 1.0, 1.0}, {0.459229082, 0.459229112, -0.760405958}, {0.125, 0.774999976}},
+    {{0.152694389, 0.210165799, -0.304162383}, {1.0, 1.0, 1.0}, {0.381735981, 0.525414467, -0.760405958}, {0.150000006, 0.774999976}},
+    {{0.117937304, 0.231464967, -0.304162383}, {1.0, 1.0, 1.0}, {0.294843256, 0.578662395, -0.760405958}, {0.174999997, 0.774999976}},
+    {{0.0802761838, 0.247064725, -0.304162383}, {1.0, 1.0, 1.0}, {0.200690463, 0.617661834, -0.760405958}, {0.200000003, 0.774999976}},
+    {{0.0406383984, 0.256580919, -0.304162383}, {1.0, 1.0, 1.0}, {0.101595998, 0.641452312, -0.760405958}, {0.224999994, 0.774999976}},
+    {{-1.13553105e-08, 0.259779215, -0.304162383}, {1.0, 1.0, 1.0}, {-2.83882766e-08, 0.649448037, -0.760405958}, {0.25, 0.774999976}},
+    {{-0.0406384207, 0.256580889, -0.304162383}, {1.0, 1.0, 1.0}, {-0.10159605, 0.641452193, -0.760405958}, {0.275000006, 0.774999976}},
+    {{-0.0802762061, 0.24706471, -0.304162383}, {1.0, 1.0, 1.0}, {-0.200690508, 0.617661774, -0.760405958}, {0.300000012, 0.774999976}},
+    {{-0.117937319, 0.231464967, -0.304162383}, {1.0, 1.0, 1.0}, {-0.294843286, 0.578662395, -0.760405958}, {0.324999988, 0.774999976}},
+    {{-0.152694374, 0.210165814, -0.304162383}, {1.0, 1.0, 1.0}, {-0.381735921, 0.525414526, -0.760405958}, {0.349999994, 0.774999976}},
+    {{-0.183691651, 0.183691651, -0.304162383}, {1.0, 1.0, 1.0}, {-0.459229112, 0.459229112, -0.760405958}, {0.375, 0.774999976}},
+    {{-0.210165814, 0.152694374, -0.304162383}, {1.0, 1.0, 1.0}, {-0.525414526, 0.381735921, -0.760405958}, {0.400000006, 0.774999976}},
+    {{-0.231464997, 0.117937267, -0.304162383}, {1.0, 1.0, 1.0}, {-0.578662515, 0.294843167, -0.760405958}, {0.425000012, 0.774999976}},
+    {{-0.247064725, 0.0802761465, -0.304162383}, {1.0, 1.0, 1.0}, {-0.617661834, 0.200690359, -0.760405958}, {0.449999988, 0.774999976}},
+    {{-0.256580889, 0.040638417, -0.304162383}, {1.0, 1.0, 1.0}, {-0.641452193, 0.101596043, -0.760405958}, {0.474999994, 0.774999976}},
+    {{-0.259779215, -2.27106209e-08, -0.304162383}, {1.0, 1.0, 1.0}, {-0.649448037, -5.67765532e-08, -0.760405958}, {0.5, 0.774999976}},
+    {{-0.256580889, -0.0406384617, -0.304162383}, {1.0, 1.0, 1.0}, {-0.641452193, -0.101596154, -0.760405958}, {0.524999976, 0.774999976}},
+    {{-0.24706471, -0.0802761838, -0.304162383}, {1.0, 1.0, 1.0}, {-0.617661774, -0.200690463, -0.760405958}, {0.550000012, 0.774999976}},
+    {{-0.231464967, -0.117937304, -0.304162383}, {1.0, 1.0, 1.0}, {-0.578662395, -0.294843256, -0.760405958}, {0.574999988, 0.774999976}},
+    {{-0.210165784, -0.152694419, -0.304162383}, {1.0, 1.0, 1.0}, {-0.525414467, -0.38173604, -0.760405958}, {0.600000024, 0.774999976}},
+    {{-0.183691621, -0.18369168, -0.304162383}, {1.0, 1.0, 1.0}, {-0.459229052, -0.459229201, -0.760405958}, {0.625, 0.774999976}},
+    {{-0.152694345, -0.210165828, -0.304162383}, {1.0, 1.0, 1.0}, {-0.381735861, -0.525414586, -0.760405958}, {0.649999976, 0.774999976}},
+    {{-0.11793723, -0.231465012, -0.304162383}, {1.0, 1.0, 1.0}, {-0.294843078, -0.578662515, -0.760405958}, {0.675000012, 0.774999976}},
+    {{-0.080276221, -0.24706471, -0.304162383}, {1.0, 1.0, 1.0}, {-0.200690553, -0.617661774, -0.760405958}, {0.699999988, 0.774999976}},
+    {{-0.0406384356, -0.256580889, -0.304162383}, {1.0, 1.0, 1.0}, {-0.101596087, -0.641452193, -0.760405958}, {0.725000024, 0.774999976}},
+    {{3.09783599e-09, -0.259779215, -0.304162383}, {1.0, 1.0, 1.0}, {7.74458986e-09, -0.649448037, -0.760405958}, {0.75, 0.774999976}},
+    {{0.0406384431, -0.256580889, -0.304162383}, {1.0, 1.0, 1.0}, {0.10159611, -0.641452193, -0.760405958}, {0.774999976, 0.774999976}},
+    {{0.0802762285, -0.24706471, -0.304162383}, {1.0, 1.0, 1.0}, {0.200690567, -0.617661774, -0.760405958}, {0.800000012, 0.774999976}},
+    {{0.117937341, -0.231464952, -0.304162383}, {1.0, 1.0, 1.0}, {0.294843346, -0.578662395, -0.760405958}, {0.824999988, 0.774999976}},
+    {{0.152694449, -0.210165754, -0.304162383}, {1.0, 1.0, 1.0}, {0.38173613, -0.525414407, -0.760405958}, {0.850000024, 0.774999976}},
+    {{0.18369171, -0.183691576, -0.304162383}, {1.0, 1.0, 1.0}, {0.45922929, -0.459228933, -0.760405958}, {0.875, 0.774999976}},
+    {{0.210165858, -0.152694315, -0.304162383}, {1.0, 1.0, 1.0}, {0.525414646, -0.381735802, -0.760405958}, {0.899999976, 0.774999976}},
+    {{0.231464967, -0.117937297, -0.304162383}, {1.0, 1.0, 1.0}, {0.578662395, -0.294843256, -0.760405958}, {0.925000012, 0.774999976}},
+    {{0.247064725, -0.0802761838, -0.304162383}, {1.0, 1.0, 1.0}, {0.617661834, -0.200690463, -0.760405958}, {0.949999988, 0.774999976}},
+    {{0.256580919, -0.0406383947, -0.304162383}, {1.0, 1.0, 1.0}, {0.641452312, -0.101595983, -0.760405958}, {0.975000024, 0.774999976}},
+    {{0.259779215, 4.54212419e-08, -0.304162383}, {1.0, 1.0, 1.0}, {0.649448037, 1.13553106e-07, -0.760405958}, {1.0, 0.774999976}},
+    {{0.235114098, 0.0, -0.323606819}, {1.0, 1.0, 1.0}, {0.587785244, 0.0, -0.809017062}, {0.0, 0.800000012}},
+    {{0.232219458, 0.0367799476, -0.323606819}, {1.0, 1.0, 1.0}, {0.580548644, 0.0919498652, -0.809017062}, {0.0250000004, 0.800000012}},
+    {{0.223606795, 0.0726542547, -0.323606819}, {1.0, 1.0, 1.0}, {0.559017003, 0.181635633, -0.809017062}, {0.0500000007, 0.800000012}},
+    {{0.209488198, 0.106739566, -0.323606819}, {1.0, 1.0, 1.0}, {0.523720503, 0.266848922, -0.809017062}, {0.075000003, 0.800000012}},
+    {{0.190211296, 0.138196602, -0.323606819}, {1.0, 1.0, 1.0}, {0.47552824, 0.345491499, -0.809017062}, {0.100000001, 0.800000012}},
+    {{0.166250765, 0.16625078, -0.323606819}, {1.0, 1.0, 1.0}, {0.415626913, 0.415626943, -0.809017062}, {0.125, 0.800000012}},
+    {{0.138196588, 0.190211311, -0.323606819}, {1.0, 1.0, 1.0}, {0.345491469, 0.47552827, -0.809017062}, {0.150000006, 0.800000012}},
+    {{0.106739573, 0.209488198, -0.323606819}, {1.0, 1.0, 1.0}, {0.266848922, 0.523720503, -0.809017062}, {0.174999997, 0.800000012}},
+    {{0.0726542473, 0.223606795, -0.323606819}, {1.0, 1.0, 1.0}, {0.181635618, 0.559017003, -0.809017062}, {0.200000003, 0.800000012}},
+    {{0.0367799252, 0.232219458, -0.323606819}, {1.0, 1.0, 1.0}, {0.0919498131, 0.580548644, -0.809017062}, {0.224999994, 0.800000012}},
+    {{-1.0277164e-08, 0.235114098, -0.323606819}, {1.0, 1.0, 1.0}, {-2.56929091e-08, 0.587785244, -0.809017062}, {0.25, 0.800000012}},
+    {{-0.0367799439, 0.232219458, -0.323606819}, {1.0, 1.0, 1.0}, {-0.0919498578, 0.580548644, -0.809017062}, {0.275000006, 0.800000012}},
+    {{-0.0726542622, 0.223606795, -0.323606819}, {1.0, 1.0, 1.0}, {-0.181635648, 0.559017003, -0.809017062}, {0.300000012, 0.800000012}},
+    {{-0.106739588, 0.209488183, -0.323606819}, {1.0, 1.0, 1.0}, {-0.266848981, 0.523720443, -0.809017062}, {0.324999988, 0.800000012}},
+    {{-0.138196588, 0.190211311, -0.323606819}, {1.0, 1.0, 1.0}, {-0.345491469, 0.47552827, -0.809017062}, {0.349999994, 0.800000012}},
+    {{-0.16625078, 0.166250765, -0.323606819}, {1.0, 1.0, 1.0}, {-0.415626943, 0.415626913, -0.809017062}, {0.375, 0.800000012}},
+    {{-0.190211311, 0.138196588, -0.323606819}, {1.0, 1.0, 1.0}, {-0.47552827, 0.345491469, -0.809017062}, {0.400000006, 0.800000012}},
+    {{-0.209488213, 0.106739536, -0.323606819}, {1.0, 1.0, 1.0}, {-0.523720503, 0.266848832, -0.809017062}, {0.425000012, 0.800000012}},
+    {{-0.22360681, 0.07265421, -0.323606819}, {1.0, 1.0, 1.0}, {-0.559017003, 0.181635529, -0.809017062}, {0.449999988, 0.800000012}},
+    {{-0.232219458, 0.0367799439, -0.323606819}, {1.0, 1.0, 1.0}, {-0.580548644, 0.0919498578, -0.809017062}, {0.474999994, 0.800000012}},
+    {{-0.235114098, -2.0554328e-08, -0.323606819}, {1.0, 1.0, 1.0}, {-0.587785244, -5.13858183e-08, -0.809017062}, {0.5, 0.800000012}},
+    {{-0.232219443, -0.0367799848, -0.323606819}, {1.0, 1.0, 1.0}, {-0.580548584, -0.0919499621, -0.809017062}, {0.524999976, 0.800000012}},
+    {{-0.223606795, -0.0726542473, -0.323606819}, {1.0, 1.0, 1.0}, {-0.559017003, -0.181635618, -0.809017062}, {0.550000012, 0.800000012}},
+    {{-0.209488183, -0.106739573, -0.323606819}, {1.0, 1.0, 1.0}, {-0.523720443, -0.266848922, -0.809017062}, {0.574999988, 0.800000012}},
+    {{-0.190211281, -0.138196617, -0.323606819}, {1.0, 1.0, 1.0}, {-0.47552821, -0.345491529, -0.809017062}, {0.600000024, 0.800000012}},
+    {{-0.16625075, -0.166250795, -0.323606819}, {1.0, 1.0, 1.0}, {-0.415626884, -0.415627003, -0.809017062}, {0.625, 0.800000012}},
+    {{-0.138196558, -0.190211326, -0.323606819}, {1.0, 1.0, 1.0}, {-0.345491409, -0.4755283, -0.809017062}, {0.649999976, 0.800000012}},
+    {{-0.106739506, -0.209488228, -0.323606819}, {1.0, 1.0, 1.0}, {-0.266848773, -0.523720562, -0.809017062}, {0.675000012, 0.800000012}},
+    {{-0.0726542771, -0.22360678, -0.323606819}, {1.0, 1.0, 1.0}, {-0.181635693, -0.559016943, -0.809017062}, {0.699999988, 0.800000012}},
+    {{-0.0367799588, -0.232219458, -0.323606819}, {1.0, 1.0, 1.0}, {-0.091949895, -0.580548644, -0.809017062}, {0.725000024, 0.800000012}},
+    {{2.80370749e-09, -0.235114098, -0.323606819}, {1.0, 1.0, 1.0}, {7.00926872e-09, -0.587785244, -0.809017062}, {0.75, 0.800000012}},
+    {{0.0367799662, -0.232219443, -0.323606819}, {1.0, 1.0, 1.0}, {0.0919499174, -0.580548584, -0.809017062}, {0.774999976, 0.800000012}},
+    {{0.0726542845, -0.22360678, -0.323606819}, {1.0, 1.0, 1.0}, {0.181635708, -0.559016943, -0.809017062}, {0.800000012, 0.800000012}},
+    {{0.10673961, -0.209488168, -0.323606819}, {1.0, 1.0, 1.0}, {0.266849041, -0.523720443, -0.809017062}, {0.824999988, 0.800000012}},
+    {{0.138196647, -0.190211266, -0.323606819}, {1.0, 1.0, 1.0}, {0.345491618, -0.475528181, -0.809017062}, {0.850000024, 0.800000012}},
+    {{0.166250825, -0.166250721, -0.323606819}, {1.0, 1.0, 1.0}, {0.415627062, -0.415626794, -0.809017062}, {0.875, 0.800000012}},
+    {{0.190211356, -0.138196528, -0.323606819}, {1.0, 1.0, 1.0}, {0.475528389, -0.34549132, -0.809017062}, {0.899999976, 0.800000012}},
+    {{0.209488198, -0.106739573, -0.323606819}, {1.0, 1.0, 1.0}, {0.523720503, -0.266848922, -0.809017062}, {0.925000012, 0.800000012}},
+    {{0.223606795, -0.0726542398, -0.323606819}, {1.0, 1.0, 1.0}, {0.559017003, -0.181635603, -0.809017062}, {0.949999988, 0.800000012}},
+    {{0.232219458, -0.0367799215, -0.323606819}, {1.0, 1.0, 1.0}, {0.580548644, -0.0919498056, -0.809017062}, {0.975000024, 0.800000012}},
+    {{0.235114098, 4.1108656e-08, -0.323606819}, {1.0, 1.0, 1.0}, {0.587785244, 1.02771637e-07, -0.809017062}, {1.0, 0.800000012}},
+    {{0.20899941, 0.0, -0.341056079}, {1.0, 1.0, 1.0}, {0.522498548, 0.0, -0.852640212}, {0.0, 0.824999988}},
+    {{0.206426278, 0.0326947123, -0.341056079}, {1.0, 1.0, 1.0}, {0.516065717, 0.0817367807, -0.852640212}, {0.0250000004, 0.824999988}},
+    {{0.198770255, 0.0645843744, -0.341056079}, {1.0, 1.0, 1.0}, {0.496925652, 0.161460936, -0.852640212}, {0.0500000007, 0.824999988}},
+    {{0.186219841, 0.0948837474, -0.341056079}, {1.0, 1.0, 1.0}, {0.465549588, 0.237209365, -0.852640212}, {0.075000003, 0.824999988}},
+    {{0.169084072, 0.122846775, -0.341056079}, {1.0, 1.0, 1.0}, {0.42271018, 0.307116926, -0.852640212}, {0.100000001, 0.824999988}},
+    {{0.147784904, 0.147784904, -0.341056079}, {1.0, 1.0, 1.0}, {0.369462252, 0.369462252, -0.852640212}, {0.125, 0.824999988}},
+    {{0.122846767, 0.169084072, -0.341056079}, {1.0, 1.0, 1.0}, {0.307116926, 0.42271018, -0.852640212}, {0.150000006, 0.824999988}},
+    {{0.0948837548, 0.186219841, -0.341056079}, {1.0, 1.0, 1.0}, {0.23720938, 0.465549588, -0.852640212}, {0.174999997, 0.824999988}},
+    {{0.0645843595, 0.198770255, -0.341056079}, {1.0, 1.0, 1.0}, {0.161460906, 0.496925652, -0.852640212}, {0.200000003, 0.824999988}},
+    {{0.0326946899, 0.206426278, -0.341056079}, {1.0, 1.0, 1.0}, {0.0817367285, 0.516065717, -0.852640212}, {0.224999994, 0.824999988}},
+    {{-9.1356549e-09, 0.20899941, -0.341056079}, {1.0, 1.0, 1.0}, {-2.28391368e-08, 0.522498548, -0.852640212}, {0.25, 0.824999988}},
+    {{-0.0326947086, 0.206426278, -0.341056079}, {1.0, 1.0, 1.0}, {-0.0817367733, 0.516065717, -0.852640212}, {0.275000006, 0.824999988}},
+    {{-0.0645843819, 0.198770255, -0.341056079}, {1.0, 1.0, 1.0}, {-0.161460951, 0.496925652, -0.852640212}, {0.300000012, 0.824999988}},
+    {{-0.0948837698, 0.186219826, -0.341056079}, {1.0, 1.0, 1.0}, {-0.237209424, 0.465549558, -0.852640212}, {0.324999988, 0.824999988}},
+    {{-0.12284676, 0.169084087, -0.341056079}, {1.0, 1.0, 1.0}, {-0.307116896, 0.42271021, -0.852640212}, {0.349999994, 0.824999988}},
+    {{-0.147784904, 0.147784904, -0.341056079}, {1.0, 1.0, 1.0}, {-0.369462252, 0.369462252, -0.852640212}, {0.375, 0.824999988}},
+    {{-0.169084087, 0.12284676, -0.341056079}, {1.0, 1.0, 1.0}, {-0.42271021, 0.307116896, -0.852640212}, {0.400000006, 0.824999988}},
+    {{-0.186219856, 0.094883725, -0.341056079}, {1.0, 1.0, 1.0}, {-0.465549648, 0.23720932, -0.852640212}, {0.425000012, 0.824999988}},
+    {{-0.19877027, 0.0645843297, -0.341056079}, {1.0, 1.0, 1.0}, {-0.496925682, 0.161460817, -0.852640212}, {0.449999988, 0.824999988}},
+    {{-0.206426278, 0.0326947048, -0.341056079}, {1.0, 1.0, 1.0}, {-0.516065717, 0.0817367584, -0.852640212}, {0.474999994, 0.824999988}},
+    {{-0.20899941, -1.82713098e-08, -0.341056079}, {1.0, 1.0, 1.0}, {-0.522498548, -4.56782736e-08, -0.852640212}, {0.5, 0.824999988}},
+    {{-0.206426278, -0.0326947421, -0.341056079}, {1.0, 1.0, 1.0}, {-0.516065717, -0.0817368552, -0.852640212}, {0.524999976, 0.824999988}},
+    {{-0.198770255, -0.064584367, -0.341056079}, {1.0, 1.0, 1.0}, {-0.496925652, -0.161460921, -0.852640212}, {0.550000012, 0.824999988}},
+    {{-0.186219841, -0.0948837548, -0.341056079}, {1.0, 1.0, 1.0}, {-0.465549588, -0.23720938, -0.852640212}, {0.574999988, 0.824999988}},
+    {{-0.169084057, -0.12284679, -0.341056079}, {1.0, 1.0, 1.0}, {-0.42271015, -0.307116985, -0.852640212}, {0.600000024, 0.824999988}},
+    {{-0.147784874, -0.147784919, -0.341056079}, {1.0, 1.0, 1.0}, {-0.369462192, -0.369462311, -0.852640212}, {0.625, 0.824999988}},
+    {{-0.12284673, -0.169084102, -0.341056079}, {1.0, 1.0, 1.0}, {-0.307116836, -0.42271024, -0.852640212}, {0.649999976, 0.824999988}},
+    {{-0.0948836878, -0.186219871, -0.341056079}, {1.0, 1.0, 1.0}, {-0.237209216, -0.465549678, -0.852640212}, {0.675000012, 0.824999988}},
+    {{-0.0645843893, -0.19877024, -0.341056079}, {1.0, 1.0, 1.0}, {-0.161460966, -0.496925592, -0.852640212}, {0.699999988, 0.824999988}},
+    {{-0.0326947235, -0.206426278, -0.341056079}, {1.0, 1.0, 1.0}, {-0.0817368105, -0.516065717, -0.852640212}, {0.725000024, 0.824999988}},
+    {{2.49229304e-09, -0.20899941, -0.341056079}, {1.0, 1.0, 1.0}, {6.23073237e-09, -0.522498548, -0.852640212}, {0.75, 0.824999988}},
+    {{0.0326947272, -0.206426278, -0.341056079}, {1.0, 1.0, 1.0}, {0.081736818, -0.516065717, -0.852640212}, {0.774999976, 0.824999988}},
+    {{0.0645843968, -0.19877024, -0.341056079}, {1.0, 1.0, 1.0}, {0.161460996, -0.496925592, -0.852640212}, {0.800000012, 0.824999988}},
+    {{0.0948837847, -0.186219811, -0.341056079}, {1.0, 1.0, 1.0}, {0.237209469, -0.465549529, -0.852640212}, {0.824999988, 0.824999988}},
+    {{0.122846819, -0.169084042, -0.341056079}, {1.0, 1.0, 1.0}, {0.307117045, -0.422710121, -0.852640212}, {0.850000024, 0.824999988}},
+    {{0.147784948, -0.147784844, -0.341056079}, {1.0, 1.0, 1.0}, {0.369462371, -0.369462103, -0.852640212}, {0.875, 0.824999988}},
+    {{0.169084117, -0.122846708, -0.341056079}, {1.0, 1.0, 1.0}, {0.422710299, -0.307116777, -0.852640212}, {0.899999976, 0.824999988}},
+    {{0.186219841, -0.0948837474, -0.341056079}, {1.0, 1.0, 1.0}, {0.465549588, -0.237209365, -0.852640212}, {0.925000012, 0.824999988}},
+    {{0.198770255, -0.0645843595, -0.341056079}, {1.0, 1.0, 1.0}, {0.496925652, -0.161460906, -0.852640212}, {0.949999988, 0.824999988}},
+    {{0.206426278, -0.0326946862, -0.341056079}, {1.0, 1.0, 1.0}, {0.516065717, -0.0817367136, -0.852640212}, {0.975000024, 0.824999988}},
+    {{0.20899941, 3.65426196e-08, -0.341056079}, {1.0, 1.0, 1.0}, {0.522498548, 9.13565472e-08, -0.852640212}, {1.0, 0.824999988}},
+    {{0.181596175, 0.0, -0.356402636}, {1.0, 1.0, 1.0}, {0.45399043, 0.0, -0.891006589}, {0.0, 0.850000024}},
+    {{0.17936042, 0.0284079015, -0.356402636}, {1.0, 1.0, 1.0}, {0.448401034, 0.0710197538, -0.891006589}, {0.0250000004, 0.850000024}},
+    {{0.172708228, 0.0561163053, -0.356402636}, {1.0, 1.0, 1.0}, {0.431770563, 0.140290767, -0.891006589}, {0.0500000007, 0.850000024}},
+    {{0.16180338, 0.0824429393, -0.356402636}, {1.0, 1.0, 1.0}, {0.404508442, 0.206107348, -0.891006589}, {0.075000003, 0.850000024}},
+    {{0.146914393, 0.106739558, -0.356402636}, {1.0, 1.0, 1.0}, {0.367285967, 0.266848892, -0.891006589}, {0.100000001, 0.850000024}},
+    {{0.128407881, 0.128407896, -0.356402636}, {1.0, 1.0, 1.0}, {0.321019709, 0.321019739, -0.891006589}, {0.125, 0.850000024}},
+    {{0.106739551, 0.146914393, -0.356402636}, {1.0, 1.0, 1.0}, {0.266848862, 0.367285967, -0.891006589}, {0.150000006, 0.850000024}},
+    {{0.0824429393, 0.16180338, -0.356402636}, {1.0, 1.0, 1.0}, {0.206107348, 0.404508442, -0.891006589}, {0.174999997, 0.850000024}},
+    {{0.0561162978, 0.172708228, -0.356402636}, {1.0, 1.0, 1.0}, {0.140290737, 0.431770563, -0.891006589}, {0.200000003, 0.850000024}},
+    {{0.0284078829, 0.179360434, -0.356402636}, {1.0, 1.0, 1.0}, {0.0710197091, 0.448401093, -0.891006589}, {0.224999994, 0.850000024}},
+    {{-7.93782107e-09, 0.181596175, -0.356402636}, {1.0, 1.0, 1.0}, {-1.98445527e-08, 0.45399043, -0.891006589}, {0.25, 0.850000024}},
+    {{-0.0284078978, 0.17936042, -0.356402636}, {1.0, 1.0, 1.0}, {-0.0710197464, 0.448401034, -0.891006589}, {0.275000006, 0.850000024}},
+    {{-0.0561163127, 0.172708228, -0.356402636}, {1.0, 1.0, 1.0}, {-0.140290782, 0.431770563, -0.891006589}, {0.300000012, 0.850000024}},
+    {{-0.0824429542, 0.161803365, -0.356402636}, {1.0, 1.0, 1.0}, {-0.206107378, 0.404508412, -0.891006589}, {0.324999988, 0.850000024}},
+    {{-0.106739543, 0.146914393, -0.356402636}, {1.0, 1.0, 1.0}, {-0.266848862, 0.367285967, -0.891006589}, {0.349999994, 0.850000024}},
+    {{-0.128407881, 0.128407881, -0.356402636}, {1.0, 1.0, 1.0}, {-0.321019709, 0.321019709, -0.891006589}, {0.375, 0.850000024}},
+    {{-0.146914393, 0.106739543, -0.356402636}, {1.0, 1.0, 1.0}, {-0.367285967, 0.266848862, -0.891006589}, {0.400000006, 0.850000024}},
+    {{-0.161803395, 0.0824429169, -0.356402636}, {1.0, 1.0, 1.0}, {-0.404508471, 0.206107289, -0.891006589}, {0.425000012, 0.850000024}},
+    {{-0.172708243, 0.0561162718, -0.356402636}, {1.0, 1.0, 1.0}, {-0.431770623, 0.140290678, -0.891006589}, {0.449999988, 0.850000024}},
+    {{-0.17936042, 0.0284078959, -0.356402636}, {1.0, 1.0, 1.0}, {-0.448401034, 0.0710197389, -0.891006589}, {0.474999994, 0.850000024}},
+    {{-0.181596175, -1.58756421e-08, -0.356402636}, {1.0, 1.0, 1.0}, {-0.45399043, -3.96891053e-08, -0.891006589}, {0.5, 0.850000024}},
+    {{-0.17936042, -0.0284079276, -0.356402636}, {1.0, 1.0, 1.0}, {-0.448401034, -0.0710198209, -0.891006589}, {0.524999976, 0.850000024}},
+    {{-0.172708228, -0.0561163016, -0.356402636}, {1.0, 1.0, 1.0}, {-0.431770563, -0.140290752, -0.891006589}, {0.550000012, 0.850000024}},
+    {{-0.16180338, -0.0824429467, -0.356402636}, {1.0, 1.0, 1.0}, {-0.404508442, -0.206107363, -0.891006589}, {0.574999988, 0.850000024}},
+    {{-0.146914378, -0.106739566, -0.356402636}, {1.0, 1.0, 1.0}, {-0.367285937, -0.266848922, -0.891006589}, {0.600000024, 0.850000024}},
+    {{-0.128407866, -0.12840791, -0.356402636}, {1.0, 1.0, 1.0}, {-0.32101965, -0.321019769, -0.891006589}, {0.625, 0.850000024}},
+    {{-0.106739521, -0.146914423, -0.356402636}, {1.0, 1.0, 1.0}, {-0.266848803, -0.367286056, -0.891006589}, {0.649999976, 0.850000024}},
+    {{-0.0824428871, -0.161803395, -0.356402636}, {1.0, 1.0, 1.0}, {-0.206107214, -0.404508471, -0.891006589}, {0.675000012, 0.850000024}},
+    {{-0.0561163239, -0.172708213, -0.356402636}, {1.0, 1.0, 1.0}, {-0.140290812, -0.431770533, -0.891006589}, {0.699999988, 0.850000024}},
+    {{-0.028407909, -0.17936042, -0.356402636}, {1.0, 1.0, 1.0}, {-0.0710197687, -0.448401034, -0.891006589}, {0.725000024, 0.850000024}},
+    {{2.16551266e-09, -0.181596175, -0.356402636}, {1.0, 1.0, 1.0}, {5.41378142e-09, -0.45399043, -0.891006589}, {0.75, 0.850000024}},
+    {{0.0284079146, -0.17936042, -0.356402636}, {1.0, 1.0, 1.0}, {0.0710197836, -0.448401034, -0.891006589}, {0.774999976, 0.850000024}},
+    {{0.0561163276, -0.172708213, -0.356402636}, {1.0, 1.0, 1.0}, {0.140290827, -0.431770533, -0.891006589}, {0.800000012, 0.850000024}},
+    {{0.0824429691, -0.161803365, -0.356402636}, {1.0, 1.0, 1.0}, {0.206107423, -0.404508412, -0.891006589}, {0.824999988, 0.850000024}},
+    {{0.106739596, -0.146914363, -0.356402636}, {1.0, 1.0, 1.0}, {0.266848981, -0.367285907, -0.891006589}, {0.850000024, 0.850000024}},
+    {{0.128407925, -0.128407851, -0.356402636}, {1.0, 1.0, 1.0}, {0.321019828, -0.32101962, -0.891006589}, {0.875, 0.850000024}},
+    {{0.146914437, -0.106739499, -0.356402636}, {1.0, 1.0, 1.0}, {0.367286086, -0.266848743, -0.891006589}, {0.899999976, 0.850000024}},
+    {{0.16180338, -0.0824429393, -0.356402636}, {1.0, 1.0, 1.0}, {0.404508442, -0.206107348, -0.891006589}, {0.925000012, 0.850000024}},
+    {{0.172708228, -0.0561162978, -0.356402636}, {1.0, 1.0, 1.0}, {0.431770563, -0.140290737, -0.891006589}, {0.949999988, 0.850000024}},
+    {{0.179360434, -0.028407881, -0.356402636}, {1.0, 1.0, 1.0}, {0.448401093, -0.0710197017, -0.891006589}, {0.975000024, 0.850000024}},
+    {{0.181596175, 3.17512843e-08, -0.356402636}, {1.0, 1.0, 1.0}, {0.45399043, 7.93782107e-08, -0.891006589}, {1.0, 0.850000024}},
+    {{0.153073326, 0.0, -0.369551837}, {1.0, 1.0, 1.0}, {0.382683307, 0.0, -0.923879623}, {0.0, 0.875}},
+    {{0.151188746, 0.0239459444, -0.369551837}, {1.0, 1.0, 1.0}, {0.377971858, 0.05986486, -0.923879623}, {0.0250000004, 0.875}},
+    {{0.14558138, 0.047302261, -0.369551837}, {1.0, 1.0, 1.0}, {0.363953441, 0.118255652, -0.923879623}, {0.0500000007, 0.875}},
+    {{0.13638933, 0.0694938377, -0.369551837}, {1.0, 1.0, 1.0}, {0.340973318, 0.17373459, -0.923879623}, {0.075000003, 0.875}},
+    {{0.123838924, 0.0899742469, -0.369551837}, {1.0, 1.0, 1.0}, {0.309597313, 0.224935621, -0.923879623}, {0.100000001, 0.875}},
+    {{0.108239181, 0.108239189, -0.369551837}, {1.0, 1.0, 1.0}, {0.270597965, 0.270597965, -0.923879623}, {0.125, 0.875}},
+    {{0.0899742395, 0.123838924, -0.369551837}, {1.0, 1.0, 1.0}, {0.224935591, 0.309597313, -0.923879623}, {0.150000006, 0.875}},
+    {{0.0694938377, 0.13638933, -0.369551837}, {1.0, 1.0, 1.0}, {0.17373459, 0.340973318, -0.923879623}, {0.174999997, 0.875}},
+    {{0.0473022535, 0.14558138, -0.369551837}, {1.0, 1.0, 1.0}, {0.11825563, 0.363953441, -0.923879623}, {0.200000003, 0.875}},
+    {{0.0239459295, 0.151188746, -0.369551837}, {1.0, 1.0, 1.0}, {0.0598648228, 0.377971858, -0.923879623}, {0.224999994, 0.875}},
+    {{-6.69104772e-09, 0.153073326, -0.369551837}, {1.0, 1.0, 1.0}, {-1.67276184e-08, 0.382683307, -0.923879623}, {0.25, 0.875}},
+    {{-0.0239459425, 0.151188746, -0.369551837}, {1.0, 1.0, 1.0}, {-0.0598648563, 0.377971858, -0.923879623}, {0.275000006, 0.875}},
+    {{-0.0473022684, 0.14558138, -0.369551837}, {1.0, 1.0, 1.0}, {-0.118255675, 0.363953441, -0.923879623}, {0.300000012, 0.875}},
+    {{-0.0694938526, 0.13638933, -0.369551837}, {1.0, 1.0, 1.0}, {-0.173734635, 0.340973318, -0.923879623}, {0.324999988, 0.875}},
+    {{-0.0899742395, 0.123838924, -0.369551837}, {1.0, 1.0, 1.0}, {-0.224935591, 0.309597313, -0.923879623}, {0.349999994, 0.875}},
+    {{-0.108239189, 0.108239189, -0.369551837}, {1.0, 1.0, 1.0}, {-0.270597965, 0.270597965, -0.923879623}, {0.375, 0.875}},
+    {{-0.123838931, 0.089974232, -0.369551837}, {1.0, 1.0, 1.0}, {-0.309597313, 0.224935576, -0.923879623}, {0.400000006, 0.875}},
+    {{-0.136389345, 0.0694938153, -0.369551837}, {1.0, 1.0, 1.0}, {-0.340973377, 0.173734546, -0.923879623}, {0.425000012, 0.875}},
+    {{-0.145581394, 0.0473022312, -0.369551837}, {1.0, 1.0, 1.0}, {-0.363953471, 0.118255578, -0.923879623}, {0.449999988, 0.875}},
+    {{-0.151188746, 0.0239459407, -0.369551837}, {1.0, 1.0, 1.0}, {-0.377971858, 0.0598648526, -0.923879623}, {0.474999994, 0.875}},
+    {{-0.153073326, -1.33820954e-08, -0.369551837}, {1.0, 1.0, 1.0}, {-0.382683307, -3.34552368e-08, -0.923879623}, {0.5, 0.875}},
+    {{-0.151188731, -0.0239459667, -0.369551837}, {1.0, 1.0, 1.0}, {-0.377971828, -0.0598649159, -0.923879623}, {0.524999976, 0.875}},
+    {{-0.14558138, -0.0473022573, -0.369551837}, {1.0, 1.0, 1.0}, {-0.363953441, -0.118255645, -0.923879623}, {0.550000012, 0.875}},
+    {{-0.13638933, -0.0694938377, -0.369551837}, {1.0, 1.0, 1.0}, {-0.340973318, -0.17373459, -0.923879623}, {0.574999988, 0.875}},
+    {{-0.123838909, -0.0899742544, -0.369551837}, {1.0, 1.0, 1.0}, {-0.309597284, -0.224935636, -0.923879623}, {0.600000024, 0.875}},
+    {{-0.108239166, -0.108239204, -0.369551837}, {1.0, 1.0, 1.0}, {-0.270597905, -0.270597994, -0.923879623}, {0.625, 0.875}},
+    {{-0.0899742171, -0.123838946, -0.369551837}, {1.0, 1.0, 1.0}, {-0.224935547, -0.309597373, -0.923879623}, {0.649999976, 0.875}},
+    {{-0.069493793, -0.13638936, -0.369551837}, {1.0, 1.0, 1.0}, {-0.173734486, -0.340973407, -0.923879623}, {0.675000012, 0.875}},
+    {{-0.0473022759, -0.14558138, -0.369551837}, {1.0, 1.0, 1.0}, {-0.11825569, -0.363953441, -0.923879623}, {0.699999988, 0.875}},
+    {{-0.0239459518, -0.151188731, -0.369551837}, {1.0, 1.0, 1.0}, {-0.0598648787, -0.377971828, -0.923879623}, {0.725000024, 0.875}},
+    {{1.82538107e-09, -0.153073326, -0.369551837}, {1.0, 1.0, 1.0}, {4.56345273e-09, -0.382683307, -0.923879623}, {0.75, 0.875}},
+    {{0.0239459556, -0.151188731, -0.369551837}, {1.0, 1.0, 1.0}, {0.0598648898, -0.377971828, -0.923879623}, {0.774999976, 0.875}},
+    {{0.0473022796, -0.14558138, -0.369551837}, {1.0, 1.0, 1.0}, {0.118255697, -0.363953441, -0.923879623}, {0.800000012, 0.875}},
+    {{0.06949386, -0.136389315, -0.369551837}, {1.0, 1.0, 1.0}, {0.17373465, -0.340973288, -0.923879623}, {0.824999988, 0.875}},
+    {{0.0899742767, -0.123838902, -0.369551837}, {1.0, 1.0, 1.0}, {0.224935696, -0.309597254, -0.923879623}, {0.850000024, 0.875}},
+    {{0.108239226, -0.108239152, -0.369551837}, {1.0, 1.0, 1.0}, {0.270598054, -0.270597875, -0.923879623}, {0.875, 0.875}},
+    {{0.123838961, -0.0899741948, -0.369551837}, {1.0, 1.0, 1.0}, {0.309597403, -0.224935487, -0.923879623}, {0.899999976, 0.875}},
+    {{0.13638933, -0.0694938377, -0.369551837}, {1.0, 1.0, 1.0}, {0.340973318, -0.17373459, -0.923879623}, {0.925000012, 0.875}},
+    {{0.14558138, -0.0473022535, -0.369551837}, {1.0, 1.0, 1.0}, {0.363953441, -0.11825563, -0.923879623}, {0.949999988, 0.875}},
+    {{0.151188746, -0.0239459276, -0.369551837}, {1.0, 1.0, 1.0}, {0.377971858, -0.059864819, -0.923879623}, {0.975000024, 0.875}},
+    {{0.153073326, 2.67641909e-08, -0.369551837}, {1.0, 1.0, 1.0}, {0.382683307, 6.69104736e-08, -0.923879623}, {1.0, 0.875}},
+    {{0.123606741, 0.0, -0.380422622}, {1.0, 1.0, 1.0}, {0.309016854, 0.0, -0.95105654}, {0.0, 0.899999976}},
+    {{0.122084938, 0.0193363559, -0.380422622}, {1.0, 1.0, 1.0}, {0.305212349, 0.0483408906, -0.95105654}, {0.0250000004, 0.899999976}},
+    {{0.117556997, 0.0381965861, -0.380422622}, {1.0, 1.0, 1.0}, {0.293892503, 0.0954914689, -0.95105654}, {0.0500000007, 0.899999976}},
+    {{0.110134415, 0.0561162867, -0.380422622}, {1.0, 1.0, 1.0}, {0.275336027, 0.140290722, -0.95105654}, {0.075000003, 0.899999976}},
+    {{0.0999999568, 0.0726542249, -0.380422622}, {1.0, 1.0, 1.0}, {0.249999896, 0.181635559, -0.95105654}, {0.100000001, 0.899999976}},
+    {{0.0874031633, 0.0874031633, -0.380422622}, {1.0, 1.0, 1.0}, {0.218507916, 0.218507916, -0.95105654}, {0.125, 0.899999976}},
+    {{0.0726542175, 0.0999999568, -0.380422622}, {1.0, 1.0, 1.0}, {0.181635544, 0.249999896, -0.95105654}, {0.150000006, 0.899999976}},
+    {{0.0561162904, 0.110134408, -0.380422622}, {1.0, 1.0, 1.0}, {0.140290722, 0.275336027, -0.95105654}, {0.174999997, 0.899999976}},
+    {{0.0381965786, 0.117556997, -0.380422622}, {1.0, 1.0, 1.0}, {0.0954914466, 0.293892503, -0.95105654}, {0.200000003, 0.899999976}},
+    {{0.0193363428, 0.122084938, -0.380422622}, {1.0, 1.0, 1.0}, {0.048340857, 0.305212349, -0.95105654}, {0.224999994, 0.899999976}},
+    {{-5.40302247e-09, 0.123606741, -0.380422622}, {1.0, 1.0, 1.0}, {-1.3507556e-08, 0.309016854, -0.95105654}, {0.25, 0.899999976}},
+    {{-0.019336354, 0.122084938, -0.380422622}, {1.0, 1.0, 1.0}, {-0.0483408868, 0.305212349, -0.95105654}, {0.275000006, 0.899999976}},
+    {{-0.0381965898, 0.117556997, -0.380422622}, {1.0, 1.0, 1.0}, {-0.0954914764, 0.293892503, -0.95105654}, {0.300000012, 0.899999976}},
+    {{-0.0561162978, 0.110134408, -0.380422622}, {1.0, 1.0, 1.0}, {-0.140290737, 0.275336027, -0.95105654}, {0.324999988, 0.899999976}},
+    {{-0.0726542175, 0.0999999568, -0.380422622}, {1.0, 1.0, 1.0}, {-0.181635544, 0.249999896, -0.95105654}, {0.349999994, 0.899999976}},
+    {{-0.0874031633, 0.0874031633, -0.380422622}, {1.0, 1.0, 1.0}, {-0.218507916, 0.218507916, -0.95105654}, {0.375, 0.899999976}},
+    {{-0.0999999568, 0.07265421, -0.380422622}, {1.0, 1.0, 1.0}, {-0.249999896, 0.181635529, -0.95105654}, {0.400000006, 0.899999976}},
+    {{-0.110134423, 0.0561162718, -0.380422622}, {1.0, 1.0, 1.0}, {-0.275336057, 0.140290678, -0.95105654}, {0.425000012, 0.899999976}},
+    {{-0.117557004, 0.03819656, -0.380422622}, {1.0, 1.0, 1.0}, {-0.293892503, 0.0954914019, -0.95105654}, {0.449999988, 0.899999976}},
+    {{-0.122084938, 0.0193363521, -0.380422622}, {1.0, 1.0, 1.0}, {-0.305212349, 0.0483408794, -0.95105654}, {0.474999994, 0.899999976}},
+    {{-0.123606741, -1.08060449e-08, -0.380422622}, {1.0, 1.0, 1.0}, {-0.309016854, -2.70151119e-08, -0.95105654}, {0.5, 0.899999976}},
+    {{-0.122084938, -0.0193363726, -0.380422622}, {1.0, 1.0, 1.0}, {-0.305212349, -0.0483409315, -0.95105654}, {0.524999976, 0.899999976}},
+    {{-0.117556997, -0.0381965823, -0.380422622}, {1.0, 1.0, 1.0}, {-0.293892503, -0.095491454, -0.95105654}, {0.550000012, 0.899999976}},
+    {{-0.110134408, -0.0561162904, -0.380422622}, {1.0, 1.0, 1.0}, {-0.275336027, -0.140290722, -0.95105654}, {0.574999988, 0.899999976}},
+    {{-0.0999999493, -0.0726542324, -0.380422622}, {1.0, 1.0, 1.0}, {-0.249999881, -0.181635588, -0.95105654}, {0.600000024, 0.899999976}},
+    {{-0.0874031484, -0.0874031782, -0.380422622}, {1.0, 1.0, 1.0}, {-0.218507871, -0.218507946, -0.95105654}, {0.625, 0.899999976}},
+    {{-0.0726541951, -0.0999999717, -0.380422622}, {1.0, 1.0, 1.0}, {-0.181635484, -0.249999925, -0.95105654}, {0.649999976, 0.899999976}},
+    {{-0.0561162531, -0.11013443, -0.380422622}, {1.0, 1.0, 1.0}, {-0.140290633, -0.275336087, -0.95105654}, {0.675000012, 0.899999976}},
+    {{-0.0381965972, -0.117556989, -0.380422622}, {1.0, 1.0, 1.0}, {-0.0954914913, -0.293892473, -0.95105654}, {0.699999988, 0.899999976}},
+    {{-0.0193363614, -0.122084938, -0.380422622}, {1.0, 1.0, 1.0}, {-0.0483409017, -0.305212349, -0.95105654}, {0.725000024, 0.899999976}},
+    {{1.47399559e-09, -0.123606741, -0.380422622}, {1.0, 1.0, 1.0}, {3.68498898e-09, -0.309016854, -0.95105654}, {0.75, 0.899999976}},
+    {{0.0193363633, -0.122084938, -0.380422622}, {1.0, 1.0, 1.0}, {0.0483409092, -0.305212349, -0.95105654}, {0.774999976, 0.899999976}},
+    {{0.038196601, -0.117556989, -0.380422622}, {1.0, 1.0, 1.0}, {0.0954914987, -0.293892473, -0.95105654}, {0.800000012, 0.899999976}},
+    {{0.056116309, -0.1101344, -0.380422622}, {1.0, 1.0, 1.0}, {0.140290767, -0.275335997, -0.95105654}, {0.824999988, 0.899999976}},
+    {{0.0726542473, -0.0999999344, -0.380422622}, {1.0, 1.0, 1.0}, {0.181635618, -0.249999836, -0.95105654}, {0.850000024, 0.899999976}},
+    {{0.0874031931, -0.0874031335, -0.380422622}, {1.0, 1.0, 1.0}, {0.218507975, -0.218507826, -0.95105654}, {0.875, 0.899999976}},
+    {{0.0999999866, -0.0726541802, -0.380422622}, {1.0, 1.0, 1.0}, {0.24999997, -0.181635454, -0.95105654}, {0.899999976, 0.899999976}},
+    {{0.110134415, -0.0561162867, -0.380422622}, {1.0, 1.0, 1.0}, {0.275336027, -0.140290722, -0.95105654}, {0.925000012, 0.899999976}},
+    {{0.117556997, -0.0381965786, -0.380422622}, {1.0, 1.0, 1.0}, {0.293892503, -0.0954914466, -0.95105654}, {0.949999988, 0.899999976}},
+    {{0.122084938, -0.0193363409, -0.380422622}, {1.0, 1.0, 1.0}, {0.305212349, -0.0483408533, -0.95105654}, {0.975000024, 0.899999976}},
+    {{0.123606741, 2.16120899e-08, -0.380422622}, {1.0, 1.0, 1.0}, {0.309016854, 5.40302239e-08, -0.95105654}, {1.0, 0.899999976}},
+    {{0.0933781639, 0.0, -0.388947964}, {1.0, 1.0, 1.0}, {0.233445406, 0.0, -0.972369909}, {0.0, 0.925000012}},
+    {{0.0922285244, 0.0146075636, -0.388947964}, {1.0, 1.0, 1.0}, {0.230571315, 0.036518909, -0.972369909}, {0.0250000004, 0.925000012}},
+    {{0.0888079107, 0.0288554411, -0.388947964}, {1.0, 1.0, 1.0}, {0.222019777, 0.0721386001, -0.972369909}, {0.0500000007, 0.925000012}},
+    {{0.0832005516, 0.0423928015, -0.388947964}, {1.0, 1.0, 1.0}, {0.208001375, 0.105982006, -0.972369909}, {0.075000003, 0.925000012}},
+    {{0.0755445212, 0.0548863076, -0.388947964}, {1.0, 1.0, 1.0}, {0.18886131, 0.137215763, -0.972369909}, {0.100000001, 0.925000012}},
+    {{0.0660283342, 0.0660283342, -0.388947964}, {1.0, 1.0, 1.0}, {0.165070832, 0.165070832, -0.972369909}, {0.125, 0.925000012}},
+    {{0.0548863038, 0.0755445212, -0.388947964}, {1.0, 1.0, 1.0}, {0.137215763, 0.18886131, -0.972369909}, {0.150000006, 0.925000012}},
+    {{0.0423928015, 0.0832005516, -0.388947964}, {1.0, 1.0, 1.0}, {0.105982006, 0.208001375, -0.972369909}, {0.174999997, 0.925000012}},
+    {{0.0288554356, 0.0888079107, -0.388947964}, {1.0, 1.0, 1.0}, {0.0721385926, 0.222019777, -0.972369909}, {0.200000003, 0.925000012}},
+    {{0.0146075543, 0.0922285244, -0.388947964}, {1.0, 1.0, 1.0}, {0.0365188867, 0.230571315, -0.972369909}, {0.224999994, 0.925000012}},
+    {{-4.08168921e-09, 0.0933781639, -0.388947964}, {1.0, 1.0, 1.0}, {-1.02042232e-08, 0.233445406, -0.972369909}, {0.25, 0.925000012}},
+    {{-0.0146075618, 0.0922285244, -0.388947964}, {1.0, 1.0, 1.0}, {-0.0365189053, 0.230571315, -0.972369909}, {0.275000006, 0.925000012}},
+    {{-0.0288554449, 0.0888079107, -0.388947964}, {1.0, 1.0, 1.0}, {-0.072138615, 0.222019777, -0.972369909}, {0.300000012, 0.925000012}},
+    {{-0.0423928089, 0.0832005516, -0.388947964}, {1.0, 1.0, 1.0}, {-0.10598202, 0.208001375, -0.972369909}, {0.324999988, 0.925000012}},
+    {{-0.0548863038, 0.0755445212, -0.388947964}, {1.0, 1.0, 1.0}, {-0.137215763, 0.18886131, -0.972369909}, {0.349999994, 0.925000012}},
+    {{-0.0660283342, 0.0660283342, -0.388947964}, {1.0, 1.0, 1.0}, {-0.165070832, 0.165070832, -0.972369909}, {0.375, 0.925000012}},
+    {{-0.0755445287, 0.0548863038, -0.388947964}, {1.0, 1.0, 1.0}, {-0.188861325, 0.137215763, -0.972369909}, {0.400000006, 0.925000012}},
+    {{-0.083200559, 0.0423927866, -0.388947964}, {1.0, 1.0, 1.0}, {-0.208001405, 0.105981968, -0.972369909}, {0.425000012, 0.925000012}},
+    {{-0.0888079181, 0.0288554225, -0.388947964}, {1.0, 1.0, 1.0}, {-0.222019792, 0.0721385553, -0.972369909}, {0.449999988, 0.925000012}},
+    {{-0.0922285244, 0.0146075608, -0.388947964}, {1.0, 1.0, 1.0}, {-0.230571315, 0.0365189016, -0.972369909}, {0.474999994, 0.925000012}},
+    {{-0.0933781639, -8.16337842e-09, -0.388947964}, {1.0, 1.0, 1.0}, {-0.233445406, -2.04084465e-08, -0.972369909}, {0.5, 0.925000012}},
+    {{-0.0922285244, -0.0146075767, -0.388947964}, {1.0, 1.0, 1.0}, {-0.230571315, -0.0365189426, -0.972369909}, {0.524999976, 0.925000012}},
+    {{-0.0888079107, -0.0288554374, -0.388947964}, {1.0, 1.0, 1.0}, {-0.222019777, -0.0721385926, -0.972369909}, {0.550000012, 0.925000012}},
+    {{-0.0832005516, -0.0423928015, -0.388947964}, {1.0, 1.0, 1.0}, {-0.208001375, -0.105982006, -0.972369909}, {0.574999988, 0.925000012}},
+    {{-0.0755445138, -0.054886315, -0.388947964}, {1.0, 1.0, 1.0}, {-0.188861281, -0.137215793, -0.972369909}, {0.600000024, 0.925000012}},
+    {{-0.0660283193, -0.0660283417, -0.388947964}, {1.0, 1.0, 1.0}, {-0.165070802, -0.165070862, -0.972369909}, {0.625, 0.925000012}},
+    {{-0.0548862889, -0.0755445361, -0.388947964}, {1.0, 1.0, 1.0}, {-0.137215719, -0.18886134, -0.972369909}, {0.649999976, 0.925000012}},
+    {{-0.0423927754, -0.0832005665, -0.388947964}, {1.0, 1.0, 1.0}, {-0.105981939, -0.20800142, -0.972369909}, {0.675000012, 0.925000012}},
+    {{-0.0288554505, -0.0888079107, -0.388947964}, {1.0, 1.0, 1.0}, {-0.0721386224, -0.222019777, -0.972369909}, {0.699999988, 0.925000012}},
+    {{-0.0146075683, -0.0922285244, -0.388947964}, {1.0, 1.0, 1.0}, {-0.0365189202, -0.230571315, -0.972369909}, {0.725000024, 0.925000012}},
+    {{1.1135235e-09, -0.0933781639, -0.388947964}, {1.0, 1.0, 1.0}, {2.78380874e-09, -0.233445406, -0.972369909}, {0.75, 0.925000012}},
+    {{0.0146075701, -0.0922285244, -0.388947964}, {1.0, 1.0, 1.0}, {0.0365189239, -0.230571315, -0.972369909}, {0.774999976, 0.925000012}},
+    {{0.0288554523, -0.0888079107, -0.388947964}, {1.0, 1.0, 1.0}, {0.0721386299, -0.222019777, -0.972369909}, {0.800000012, 0.925000012}},
+    {{0.0423928164, -0.0832005441, -0.388947964}, {1.0, 1.0, 1.0}, {0.105982043, -0.20800136, -0.972369909}, {0.824999988, 0.925000012}},
+    {{0.0548863262, -0.0755445063, -0.388947964}, {1.0, 1.0, 1.0}, {0.137215823, -0.188861266, -0.972369909}, {0.850000024, 0.925000012}},
+    {{0.0660283566, -0.0660283118, -0.388947964}, {1.0, 1.0, 1.0}, {0.165070891, -0.165070772, -0.972369909}, {0.875, 0.925000012}},
+    {{0.0755445436, -0.0548862778, -0.388947964}, {1.0, 1.0, 1.0}, {0.188861355, -0.137215689, -0.972369909}, {0.899999976, 0.925000012}},
+    {{0.0832005516, -0.0423928015, -0.388947964}, {1.0, 1.0, 1.0}, {0.208001375, -0.105982006, -0.972369909}, {0.925000012, 0.925000012}},
+    {{0.0888079107, -0.0288554356, -0.388947964}, {1.0, 1.0, 1.0}, {0.222019777, -0.0721385926, -0.972369909}, {0.949999988, 0.925000012}},
+    {{0.0922285244, -0.0146075524, -0.388947964}, {1.0, 1.0, 1.0}, {0.230571315, -0.0365188792, -0.972369909}, {0.975000024, 0.925000012}},
+    {{0.0933781639, 1.63267568e-08, -0.388947964}, {1.0, 1.0, 1.0}, {0.233445406, 4.0816893e-08, -0.972369909}, {1.0, 0.925000012}},
+    {{0.062573798, 0.0, -0.395075351}, {1.0, 1.0, 1.0}, {0.156434491, 0.0, -0.987688363}, {0.0, 0.949999988}},
+    {{0.0618034117, 0.00978869852, -0.395075351}, {1.0, 1.0, 1.0}, {0.154508531, 0.0244717468, -0.987688363}, {0.0250000004, 0.949999988}},
+    {{0.0595112182, 0.019336367, -0.395075351}, {1.0, 1.0, 1.0}, {0.148778051, 0.0483409166, -0.987688363}, {0.0500000007, 0.949999988}},
+    {{0.0557536632, 0.0284079108, -0.395075351}, {1.0, 1.0, 1.0}, {0.139384151, 0.0710197762, -0.987688363}, {0.075000003, 0.949999988}},
+    {{0.0506232642, 0.036779955, -0.395075351}, {1.0, 1.0, 1.0}, {0.126558155, 0.0919498876, -0.987688363}, {0.100000001, 0.949999988}},
+    {{0.0442463569, 0.0442463569, -0.395075351}, {1.0, 1.0, 1.0}, {0.110615894, 0.110615894, -0.987688363}, {0.125, 0.949999988}},
+    {{0.036779955, 0.0506232679, -0.395075351}, {1.0, 1.0, 1.0}, {0.0919498876, 0.12655817, -0.987688363}, {0.150000006, 0.949999988}},
+    {{0.0284079108, 0.0557536632, -0.395075351}, {1.0, 1.0, 1.0}, {0.0710197762, 0.139384151, -0.987688363}, {0.174999997, 0.949999988}},
+    {{0.0193363652, 0.0595112182, -0.395075351}, {1.0, 1.0, 1.0}, {0.0483409129, 0.148778051, -0.987688363}, {0.200000003, 0.949999988}},
+    {{0.00978869293, 0.0618034117, -0.395075351}, {1.0, 1.0, 1.0}, {0.0244717319, 0.154508531, -0.987688363}, {0.224999994, 0.949999988}},
+    {{-2.73518763e-09, 0.062573798, -0.395075351}, {1.0, 1.0, 1.0}, {-6.8379693e-09, 0.156434491, -0.987688363}, {0.25, 0.949999988}},
+    {{-0.00978869759, 0.0618034117, -0.395075351}, {1.0, 1.0, 1.0}, {-0.0244717449, 0.154508531, -0.987688363}, {0.275000006, 0.949999988}},
+    {{-0.0193363708, 0.0595112182, -0.395075351}, {1.0, 1.0, 1.0}, {-0.0483409278, 0.148778051, -0.987688363}, {0.300000012, 0.949999988}},
+    {{-0.0284079164, 0.0557536595, -0.395075351}, {1.0, 1.0, 1.0}, {-0.0710197911, 0.139384151, -0.987688363}, {0.324999988, 0.949999988}},
+    {{-0.0367799513, 0.0506232679, -0.395075351}, {1.0, 1.0, 1.0}, {-0.0919498801, 0.12655817, -0.987688363}, {0.349999994, 0.949999988}},
+    {{-0.0442463569, 0.0442463569, -0.395075351}, {1.0, 1.0, 1.0}, {-0.110615894, 0.110615894, -0.987688363}, {0.375, 0.949999988}},
+    {{-0.0506232679, 0.0367799513, -0.395075351}, {1.0, 1.0, 1.0}, {-0.12655817, 0.0919498801, -0.987688363}, {0.400000006, 0.949999988}},
+    {{-0.0557536669, 0.0284079015, -0.395075351}, {1.0, 1.0, 1.0}, {-0.139384165, 0.0710197538, -0.987688363}, {0.425000012, 0.949999988}},
+    {{-0.0595112219, 0.0193363559, -0.395075351}, {1.0, 1.0, 1.0}, {-0.148778051, 0.0483408906, -0.987688363}, {0.449999988, 0.949999988}},
+    {{-0.0618034117, 0.00978869759, -0.395075351}, {1.0, 1.0, 1.0}, {-0.154508531, 0.0244717449, -0.987688363}, {0.474999994, 0.949999988}},
+    {{-0.062573798, -5.47037526e-09, -0.395075351}, {1.0, 1.0, 1.0}, {-0.156434491, -1.36759386e-08, -0.987688363}, {0.5, 0.949999988}},
+    {{-0.061803408, -0.00978870783, -0.395075351}, {1.0, 1.0, 1.0}, {-0.154508516, -0.0244717691, -0.987688363}, {0.524999976, 0.949999988}},
+    {{-0.0595112182, -0.0193363652, -0.395075351}, {1.0, 1.0, 1.0}, {-0.148778051, -0.0483409129, -0.987688363}, {0.550000012, 0.949999988}},
+    {{-0.0557536595, -0.0284079127, -0.395075351}, {1.0, 1.0, 1.0}, {-0.139384151, -0.0710197836, -0.987688363}, {0.574999988, 0.949999988}},
+    {{-0.0506232604, -0.0367799625, -0.395075351}, {1.0, 1.0, 1.0}, {-0.126558155, -0.0919499099, -0.987688363}, {0.600000024, 0.949999988}},
+    {{-0.0442463495, -0.0442463644, -0.395075351}, {1.0, 1.0, 1.0}, {-0.110615872, -0.110615909, -0.987688363}, {0.625, 0.949999988}},
+    {{-0.0367799439, -0.0506232753, -0.395075351}, {1.0, 1.0, 1.0}, {-0.0919498578, -0.126558185, -0.987688363}, {0.649999976, 0.949999988}},
+    {{-0.0284078941, -0.0557536706, -0.395075351}, {1.0, 1.0, 1.0}, {-0.0710197389, -0.13938418, -0.987688363}, {0.675000012, 0.949999988}},
+    {{-0.0193363745, -0.0595112145, -0.395075351}, {1.0, 1.0, 1.0}, {-0.0483409353, -0.148778036, -0.987688363}, {0.699999988, 0.949999988}},
+    {{-0.00978870224, -0.0618034117, -0.395075351}, {1.0, 1.0, 1.0}, {-0.0244717561, -0.154508531, -0.987688363}, {0.725000024, 0.949999988}},
+    {{7.46185058e-10, -0.062573798, -0.395075351}, {1.0, 1.0, 1.0}, {1.86546267e-09, -0.156434491, -0.987688363}, {0.75, 0.949999988}},
+    {{0.00978870317, -0.0618034117, -0.395075351}, {1.0, 1.0, 1.0}, {0.0244717579, -0.154508531, -0.987688363}, {0.774999976, 0.949999988}},
+    {{0.0193363745, -0.0595112145, -0.395075351}, {1.0, 1.0, 1.0}, {0.0483409353, -0.148778036, -0.987688363}, {0.800000012, 0.949999988}},
+    {{0.028407922, -0.0557536557, -0.395075351}, {1.0, 1.0, 1.0}, {0.071019806, -0.139384136, -0.987688363}, {0.824999988, 0.949999988}},
+    {{0.0367799699, -0.0506232567, -0.395075351}, {1.0, 1.0, 1.0}, {0.0919499248, -0.12655814, -0.987688363}, {0.850000024, 0.949999988}},
+    {{0.0442463718, -0.044246342, -0.395075351}, {1.0, 1.0, 1.0}, {0.110615931, -0.110615857, -0.987688363}, {0.875, 0.949999988}},
+    {{0.0506232791, -0.0367799364, -0.395075351}, {1.0, 1.0, 1.0}, {0.1265582, -0.0919498429, -0.987688363}, {0.899999976, 0.949999988}},
+    {{0.0557536632, -0.0284079108, -0.395075351}, {1.0, 1.0, 1.0}, {0.139384151, -0.0710197762, -0.987688363}, {0.925000012, 0.949999988}},
+    {{0.0595112182, -0.0193363633, -0.395075351}, {1.0, 1.0, 1.0}, {0.148778051, -0.0483409092, -0.987688363}, {0.949999988, 0.949999988}},
+    {{0.0618034117, -0.009788692, -0.395075351}, {1.0, 1.0, 1.0}, {0.154508531, -0.02447173, -0.987688363}, {0.975000024, 0.949999988}},
+    {{0.062573798, 1.09407505e-08, -0.395075351}, {1.0, 1.0, 1.0}, {0.156434491, 2.73518772e-08, -0.987688363}, {1.0, 0.949999988}},
+    {{0.0313836336, 0.0, -0.398766935}, {1.0, 1.0, 1.0}, {0.078459084, 0.0, -0.996917367}, {0.0, 0.975000024}},
+    {{0.0309972484, 0.00490948185, -0.398766935}, {1.0, 1.0, 1.0}, {0.0774931237, 0.0122737046, -0.996917367}, {0.0250000004, 0.975000024}},
+    {{0.0298476089, 0.00969807617, -0.398766935}, {1.0, 1.0, 1.0}, {0.074619025, 0.0242451914, -0.996917367}, {0.0500000007, 0.975000024}},
+    {{0.0279630218, 0.0142478719, -0.398766935}, {1.0, 1.0, 1.0}, {0.0699075535, 0.0356196798, -0.996917367}, {0.075000003, 0.975000024}},
+    {{0.025389893, 0.0184468366, -0.398766935}, {1.0, 1.0, 1.0}, {0.0634747297, 0.0461170897, -0.996917367}, {0.100000001, 0.975000024}},
+    {{0.0221915804, 0.0221915804, -0.398766935}, {1.0, 1.0, 1.0}, {0.0554789528, 0.0554789528, -0.996917367}, {0.125, 0.975000024}},
+    {{0.0184468366, 0.025389893, -0.398766935}, {1.0, 1.0, 1.0}, {0.0461170897, 0.0634747297, -0.996917367}, {0.150000006, 0.975000024}},
+    {{0.0142478719, 0.0279630218, -0.398766935}, {1.0, 1.0, 1.0}, {0.0356196798, 0.0699075535, -0.996917367}, {0.174999997, 0.975000024}},
+    {{0.00969807524, 0.0298476089, -0.398766935}, {1.0, 1.0, 1.0}, {0.0242451876, 0.074619025, -0.996917367}, {0.200000003, 0.975000024}},
+    {{0.00490947906, 0.0309972502, -0.398766935}, {1.0, 1.0, 1.0}, {0.0122736972, 0.0774931237, -0.996917367}, {0.224999994, 0.975000024}},
+    {{-1.37182221e-09, 0.0313836336, -0.398766935}, {1.0, 1.0, 1.0}, {-3.42955553e-09, 0.078459084, -0.996917367}, {0.25, 0.975000024}},
+    {{-0.00490948139, 0.0309972484, -0.398766935}, {1.0, 1.0, 1.0}, {-0.0122737037, 0.0774931237, -0.996917367}, {0.275000006, 0.975000024}},
+    {{-0.00969807804, 0.0298476089, -0.398766935}, {1.0, 1.0, 1.0}, {-0.0242451951, 0.074619025, -0.996917367}, {0.300000012, 0.975000024}},
+    {{-0.0142478747, 0.0279630199, -0.398766935}, {1.0, 1.0, 1.0}, {-0.0356196873, 0.069907546, -0.996917367}, {0.324999988, 0.975000024}},
+    {{-0.0184468348, 0.0253898948, -0.398766935}, {1.0, 1.0, 1.0}, {-0.046117086, 0.0634747371, -0.996917367}, {0.349999994, 0.975000024}},
+    {{-0.0221915804, 0.0221915804, -0.398766935}, {1.0, 1.0, 1.0}, {-0.0554789528, 0.0554789528, -0.996917367}, {0.375, 0.975000024}},
+    {{-0.0253898948, 0.0184468348, -0.398766935}, {1.0, 1.0, 1.0}, {-0.0634747371, 0.046117086, -0.996917367}, {0.400000006, 0.975000024}},
+    {{-0.0279630236, 0.0142478682, -0.398766935}, {1.0, 1.0, 1.0}, {-0.0699075609, 0.0356196687, -0.996917367}, {0.425000012, 0.975000024}},
+    {{-0.0298476107, 0.00969807059, -0.398766935}, {1.0, 1.0, 1.0}, {-0.074619025, 0.0242451765, -0.996917367}, {0.449999988, 0.975000024}},
+    {{-0.0309972484, 0.00490948139, -0.398766935}, {1.0, 1.0, 1.0}, {-0.0774931237, 0.0122737037, -0.996917367}, {0.474999994, 0.975000024}},
+    {{-0.0313836336, -2.74364442e-09, -0.398766935}, {1.0, 1.0, 1.0}, {-0.078459084, -6.85911106e-09, -0.996917367}, {0.5, 0.975000024}},
+    {{-0.0309972484, -0.00490948651, -0.398766935}, {1.0, 1.0, 1.0}, {-0.0774931237, -0.0122737158, -0.996917367}, {0.524999976, 0.975000024}},
+    {{-0.0298476089, -0.00969807524, -0.398766935}, {1.0, 1.0, 1.0}, {-0.074619025, -0.0242451876, -0.996917367}, {0.550000012, 0.975000024}},
+    {{-0.0279630218, -0.0142478729, -0.398766935}, {1.0, 1.0, 1.0}, {-0.0699075535, -0.0356196836, -0.996917367}, {0.574999988, 0.975000024}},
+    {{-0.0253898911, -0.0184468403, -0.398766935}, {1.0, 1.0, 1.0}, {-0.0634747297, -0.0461171009, -0.996917367}, {0.600000024, 0.975000024}},
+    {{-0.0221915767, -0.0221915841, -0.398766935}, {1.0, 1.0, 1.0}, {-0.0554789416, -0.0554789603, -0.996917367}, {0.625, 0.975000024}},
+    {{-0.018446831, -0.0253898967, -0.398766935}, {1.0, 1.0, 1.0}, {-0.0461170785, -0.0634747446, -0.996917367}, {0.649999976, 0.975000024}},
+    {{-0.0142478636, -0.0279630274, -0.398766935}, {1.0, 1.0, 1.0}, {-0.0356196575, -0.0699075684, -0.996917367}, {0.675000012, 0.975000024}},
+    {{-0.0096980799, -0.0298476089, -0.398766935}, {1.0, 1.0, 1.0}, {-0.0242451988, -0.074619025, -0.996917367}, {0.699999988, 0.975000024}},
+    {{-0.00490948372, -0.0309972484, -0.398766935}, {1.0, 1.0, 1.0}, {-0.0122737093, -0.0774931237, -0.996917367}, {0.725000024, 0.975000024}},
+    {{3.74246079e-10, -0.0313836336, -0.398766935}, {1.0, 1.0, 1.0}, {9.35615141e-10, -0.078459084, -0.996917367}, {0.75, 0.975000024}},
+    {{0.00490948418, -0.0309972484, -0.398766935}, {1.0, 1.0, 1.0}, {0.0122737102, -0.0774931237, -0.996917367}, {0.774999976, 0.975000024}},
+    {{0.0096980799, -0.029847607, -0.398766935}, {1.0, 1.0, 1.0}, {0.0242451988, -0.0746190175, -0.996917367}, {0.800000012, 0.975000024}},
+    {{0.0142478775, -0.0279630199, -0.398766935}, {1.0, 1.0, 1.0}, {0.0356196947, -0.069907546, -0.996917367}, {0.824999988, 0.975000024}},
+    {{0.0184468441, -0.0253898874, -0.398766935}, {1.0, 1.0, 1.0}, {0.046117112, -0.0634747148, -0.996917367}, {0.850000024, 0.975000024}},
+    {{0.0221915878, -0.0221915729, -0.398766935}, {1.0, 1.0, 1.0}, {0.0554789677, -0.0554789305, -0.996917367}, {0.875, 0.975000024}},
+    {{0.0253899004, -0.0184468273, -0.398766935}, {1.0, 1.0, 1.0}, {0.063474752, -0.0461170673, -0.996917367}, {0.899999976, 0.975000024}},
+    {{0.0279630218, -0.0142478719, -0.398766935}, {1.0, 1.0, 1.0}, {0.0699075535, -0.0356196798, -0.996917367}, {0.925000012, 0.975000024}},
+    {{0.0298476089, -0.00969807431, -0.398766935}, {1.0, 1.0, 1.0}, {0.074619025, -0.0242451858, -0.996917367}, {0.949999988, 0.975000024}},
+    {{0.0309972502, -0.00490947859, -0.398766935}, {1.0, 1.0, 1.0}, {0.0774931237, -0.0122736963, -0.996917367}, {0.975000024, 0.975000024}},
+    {{0.0313836336, 5.48728885e-09, -0.398766935}, {1.0, 1.0, 1.0}, {0.078459084, 1.37182221e-08, -0.996917367}, {1.0, 0.975000024}},
+    {{-1.7484556e-08, -0.0, -0.400000006}, {1.0, 1.0, 1.0}, {-4.37113883e-08, -0.0, -1.0}, {0.0, 1.0}},
+    {{-1.72692918e-08, -2.73518719e-09, -0.400000006}, {1.0, 1.0, 1.0}, {-4.31732303e-08, -6.83796797e-09, -1.0}, {0.0250000004, 1.0}},
+    {{-1.66288014e-08, -5.40302514e-09, -0.400000006}, {1.0, 1.0, 1.0}, {-4.15720045e-08, -1.35075631e-08, -1.0}, {0.0500000007, 1.0}},
+    {{-1.55788538e-08, -7.93782284e-09, -0.400000006}, {1.0, 1.0, 1.0}, {-3.89471353e-08, -1.98445562e-08, -1.0}, {0.075000003, 1.0}},
+    {{-1.41453027e-08, -1.0277164e-08, -0.400000006}, {1.0, 1.0, 1.0}, {-3.53632572e-08, -2.56929091e-08, -1.0}, {0.100000001, 1.0}},
+    {{-1.2363448e-08, -1.2363448e-08, -0.400000006}, {1.0, 1.0, 1.0}, {-3.09086197e-08, -3.09086197e-08, -1.0}, {0.125, 1.0}},
+    {{-1.0277164e-08, -1.41453036e-08, -0.400000006}, {1.0, 1.0, 1.0}, {-2.56929091e-08, -3.53632572e-08, -1.0}, {0.150000006, 1.0}},
+    {{-7.93782284e-09, -1.55788538e-08, -0.400000006}, {1.0, 1.0, 1.0}, {-1.98445562e-08, -3.89471353e-08, -1.0}, {0.174999997, 1.0}},
+    {{-5.40302425e-09, -1.66288014e-08, -0.400000006}, {1.0, 1.0, 1.0}, {-1.35075604e-08, -4.15720045e-08, -1.0}, {0.200000003, 1.0}},
+    {{-2.73518541e-09, -1.72692918e-08, -0.400000006}, {1.0, 1.0, 1.0}, {-6.83796353e-09, -4.31732303e-08, -1.0}, {0.224999994, 1.0}},
+    {{7.64274228e-16, -1.7484556e-08, -0.400000006}, {1.0, 1.0, 1.0}, {1.91068568e-15, -4.37113883e-08, -1.0}, {0.25, 1.0}},
+    {{2.73518697e-09, -1.72692918e-08, -0.400000006}, {1.0, 1.0, 1.0}, {6.83796753e-09, -4.31732303e-08, -1.0}, {0.275000006, 1.0}},
+    {{5.40302603e-09, -1.66288014e-08, -0.400000006}, {1.0, 1.0, 1.0}, {1.35075648e-08, -4.15720045e-08, -1.0}, {0.300000012, 1.0}},
+    {{7.93782373e-09, -1.5578852e-08, -0.400000006}, {1.0, 1.0, 1.0}, {1.98445598e-08, -3.89471282e-08, -1.0}, {0.324999988, 1.0}},
+    {{1.02771631e-08, -1.41453036e-08, -0.400000006}, {1.0, 1.0, 1.0}, {2.56929074e-08, -3.53632572e-08, -1.0}, {0.349999994, 1.0}},
+    {{1.2363448e-08, -1.2363448e-08, -0.400000006}, {1.0, 1.0, 1.0}, {3.09086197e-08, -3.09086197e-08, -1.0}, {0.375, 1.0}},
+    {{1.41453036e-08, -1.02771631e-08, -0.400000006}, {1.0, 1.0, 1.0}, {3.53632572e-08, -2.56929074e-08, -1.0}, {0.400000006, 1.0}},
+    {{1.55788538e-08, -7.93782018e-09, -0.400000006}, {1.0, 1.0, 1.0}, {3.89471353e-08, -1.98445509e-08, -1.0}, {0.425000012, 1.0}},
+    {{1.66288014e-08, -5.40302159e-09, -0.400000006}, {1.0, 1.0, 1.0}, {4.15720045e-08, -1.35075542e-08, -1.0}, {0.449999988, 1.0}},
+    {{1.72692918e-08, -2.73518674e-09, -0.400000006}, {1.0, 1.0, 1.0}, {4.31732303e-08, -6.83796664e-09, -1.0}, {0.474999994, 1.0}},
+    {{1.7484556e-08, 1.52854846e-15, -0.400000006}, {1.0, 1.0, 1.0}, {4.37113883e-08, 3.82137135e-15, -1.0}, {0.5, 1.0}},
+    {{1.72692918e-08, 2.73518985e-09, -0.400000006}, {1.0, 1.0, 1.0}, {4.31732303e-08, 6.83797463e-09, -1.0}, {0.524999976, 1.0}},
+    {{1.66288014e-08, 5.40302469e-09, -0.400000006}, {1.0, 1.0, 1.0}, {4.15720045e-08, 1.35075613e-08, -1.0}, {0.550000012, 1.0}},
+    {{1.55788538e-08, 7.93782284e-09, -0.400000006}, {1.0, 1.0, 1.0}, {3.89471353e-08, 1.98445562e-08, -1.0}, {0.574999988, 1.0}},
+    {{1.41453018e-08, 1.02771658e-08, -0.400000006}, {1.0, 1.0, 1.0}, {3.53632537e-08, 2.56929145e-08, -1.0}, {0.600000024, 1.0}},
+    {{1.23634463e-08, 1.23634498e-08, -0.400000006}, {1.0, 1.0, 1.0}, {3.09086161e-08, 3.09086232e-08, -1.0}, {0.625, 1.0}},
+    {{1.02771605e-08, 1.41453054e-08, -0.400000006}, {1.0, 1.0, 1.0}, {2.5692902e-08, 3.53632643e-08, -1.0}, {0.649999976, 1.0}},
+    {{7.93781751e-09, 1.55788555e-08, -0.400000006}, {1.0, 1.0, 1.0}, {1.98445438e-08, 3.89471388e-08, -1.0}, {0.675000012, 1.0}},
+    {{5.40302691e-09, 1.66287997e-08, -0.400000006}, {1.0, 1.0, 1.0}, {1.35075675e-08, 4.1572001e-08, -1.0}, {0.699999988, 1.0}},
+    {{2.73518808e-09, 1.72692918e-08, -0.400000006}, {1.0, 1.0, 1.0}, {6.83797019e-09, 4.31732303e-08, -1.0}, {0.725000024, 1.0}},
+    {{-2.08501236e-16, 1.7484556e-08, -0.400000006}, {1.0, 1.0, 1.0}, {-5.21253064e-16, 4.37113883e-08, -1.0}, {0.75, 1.0}},
+    {{-2.73518852e-09, 1.72692918e-08, -0.400000006}, {1.0, 1.0, 1.0}, {-6.83797108e-09, 4.31732303e-08, -1.0}, {0.774999976, 1.0}},
+    {{-5.40302736e-09, 1.66287997e-08, -0.400000006}, {1.0, 1.0, 1.0}, {-1.35075684e-08, 4.1572001e-08, -1.0}, {0.800000012, 1.0}},
+    {{-7.93782551e-09, 1.5578852e-08, -0.400000006}, {1.0, 1.0, 1.0}, {-1.98445633e-08, 3.89471282e-08, -1.0}, {0.824999988, 1.0}},
+    {{-1.02771676e-08, 1.41453e-08, -0.400000006}, {1.0, 1.0, 1.0}, {-2.56929198e-08, 3.53632501e-08, -1.0}, {0.850000024, 1.0}},
+    {{-1.23634525e-08, 1.23634436e-08, -0.400000006}, {1.0, 1.0, 1.0}, {-3.09086303e-08, 3.0908609e-08, -1.0}, {0.875, 1.0}},
+    {{-1.41453071e-08, 1.02771587e-08, -0.400000006}, {1.0, 1.0, 1.0}, {-3.53632679e-08, 2.56928967e-08, -1.0}, {0.899999976, 1.0}},
+    {{-1.55788538e-08, 7.93782284e-09, -0.400000006}, {1.0, 1.0, 1.0}, {-3.89471353e-08, 1.98445562e-08, -1.0}, {0.925000012, 1.0}},
+    {{-1.66288014e-08, 5.40302425e-09, -0.400000006}, {1.0, 1.0, 1.0}, {-4.15720045e-08, 1.35075604e-08, -1.0}, {0.949999988, 1.0}},
+    {{-1.72692918e-08, 2.73518519e-09, -0.400000006}, {1.0, 1.0, 1.0}, {-4.31732303e-08, 6.83796308e-09, -1.0}, {0.975000024, 1.0}},
+    {{-1.7484556e-08, -3.05709691e-15, -0.400000006}, {1.0, 1.0, 1.0}, {-4.37113883e-08, -7.64274271e-15, -1.0}, {1.0, 1.0}},
+};
+
+static const uint32_t BAKED_SPHERE_INDICES[] = {
+    1, 41, 42, 2, 42, 43, 3, 43, 44, 4, 44, 45,
+    5, 45, 46, 6, 46, 47, 7, 47, 48, 8, 48, 49,
+    9, 49, 50, 10, 50, 51, 11, 51, 52, 12, 52, 53,
+    13, 53, 54, 14, 54, 55, 15, 55, 56, 16, 56, 57,
+    17, 57, 58, 18, 58, 59, 19, 59, 60, 20, 60, 61,
+    21, 61, 62, 22, 62, 63, 23, 63, 64, 24, 64, 65,
+    25, 65, 66, 26, 66, 67, 27, 67, 68, 28, 68, 69,
+    29, 69, 70, 30, 70, 71, 31, 71, 72, 32, 72, 73,
+    33, 73, 74, 34, 74, 75, 35, 75, 76, 36, 76, 77,
+    37, 77, 78, 38, 78, 79, 39, 79, 80, 40, 80, 81,
+    41, 82, 42, 42, 82, 83, 42, 83, 43, 43, 83, 84,
+    43, 84, 44, 44, 84, 85, 44, 85, 45, 45, 85, 86,
+    45, 86, 46, 46, 86, 87, 46, 87, 47, 47, 87, 88,
+    47, 88, 48, 48, 88, 89, 48, 89, 49, 49, 89, 90,
+    49, 90, 50, 50, 90, 91, 50, 91, 51, 51, 91, 92,
+    51, 92, 52, 52, 92, 93, 52, 93, 53, 53, 93, 94,
+    53, 94, 54, 54, 94, 95, 54, 95, 55, 55, 95, 96,
+    55, 96, 56, 56, 96, 97, 56, 97, 57, 57, 97, 98,
+    57, 98, 58, 58, 98, 99, 58, 99, 59, 59, 99, 100,
+    59, 100, 60, 60, 100, 101, 60, 101, 61, 61, 101, 102,
+    61, 102, 62, 62, 102, 103, 62, 103, 63, 63, 103, 104,
+    63, 104, 64, 64, 104, 105, 64, 105, 65, 65, 105, 106,
+    65, 106, 66, 66, 106, 107, 66, 107, 67, 67, 107, 108,
+    67, 108, 68, 68, 108, 109, 68, 109, 69, 69, 109, 110,
+    69, 110, 70, 70, 110, 111, 70, 111, 71, 71, 111, 112,
+    71, 112, 72, 72, 112, 113, 72, 113, 73, 73, 113, 114,
+    73, 114, 74, 74, 114, 115, 74, 115, 75, 75, 115, 116,
+    75, 116, 76, 76, 116, 117, 76, 117, 77, 77, 117, 118,
+    77, 118, 78, 78, 118, 119, 78, 119, 79, 79, 119, 120,
+    79, 120, 80, 80, 120, 121, 80, 121, 81, 81, 121, 122,
+    82, 123, 83, 83, 123, 124, 83, 124, 84, 84, 124, 125,
+    84, 125, 85, 85, 125, 126, 85, 126, 86, 86, 126, 127,
+    86, 127, 87, 87, 127, 128, 87, 128, 88, 88, 128, 129,
+    88, 129, 89, 89, 129, 130, 89, 130, 90, 90, 130, 131,
+    90, 131, 91, 91, 131, 132, 91, 132, 92, 92, 132, 133,
+    92, 133, 93, 93, 133, 134, 93, 134, 94, 94, 134, 135,
+    94, 135, 95, 95, 135, 136, 95, 136, 96, 96, 136, 137,
+    96, 137, 97, 97, 137, 138, 97, 138, 98, 98, 138, 139,
+    98, 139, 99, 99, 139, 140, 99, 140, 100, 100, 140, 141,
+    100, 141, 101, 101, 141, 142, 101, 142, 102, 102, 142, 143,
+    102, 143, 103, 103, 143, 144, 103, 144, 104, 104, 144, 145,
+    104, 145, 105, 105, 145, 146, 105, 146, 106, 106, 146, 147,
+    106, 147, 107, 107, 147, 148, 107, 148, 108, 108, 148, 149,
+    108, 149, 109, 109, 149, 150, 109, 150, 110, 110, 150, 151,
+    110, 151, 111, 111, 151, 152, 111, 152, 112, 112, 152, 153,
+    112, 153, 113, 113, 153, 154, 113, 154, 114, 114, 154, 155,
+    114, 155, 115, 115, 155, 156, 115, 156, 116, 116, 156, 157,
+    116, 157, 117, 117, 157, 158, 117, 158, 118, 118, 158, 159,
+    118, 159, 119, 119, 159, 160, 119, 160, 120, 120, 160, 161,
+    120, 161, 121, 121, 161, 162, 121, 162, 122, 122, 162, 163,
+    123, 164, 124, 124, 164, 165, 124, 165, 125, 125, 165, 166,
+    125, 166, 126, 126, 166, 167, 126, 167, 127, 127, 167, 168,
+    127, 168, 128, 128, 168, 169, 128, 169, 129, 129, 169, 170,
+    129, 170, 130, 130, 170, 171, 130, 171, 131, 131, 171, 172,
+    131, 172, 132, 132, 172, 173, 132, 173, 133, 133, 173, 174,
+    133, 174, 134, 134, 174, 175, 134, 175, 135, 135, 175, 176,
+    135, 176, 136, 136, 176, 177, 136, 177, 137, 137, 177, 178,
+    137, 178, 138, 138, 178, 179, 138, 179, 139, 139, 179, 180,
+    139, 180, 140, 140, 180, 181, 140, 181, 141, 141, 181, 182,
+    141, 182, 142, 142, 182, 183, 142, 183, 143, 143, 183, 184,
+    143, 184, 144, 144, 184, 185, 144, 185, 145, 145, 185, 186,
+    145, 186, 146, 146, 186, 187, 146, 187, 147, 147, 187, 188,
+    147, 188, 148, 148, 188, 189, 148, 189, 149, 149, 189, 190,
+    149, 190, 150, 150, 190, 191, 150, 191, 151, 151, 191, 192,
+    151, 192, 152, 152, 192, 193, 152, 193, 153, 153, 193, 194,
+    153, 194, 154, 154, 194, 195, 154, 195, 155, 155, 195, 196,
+    155, 196, 156, 156, 196, 197, 156, 197, 157, 157, 197, 198,
+    157, 198, 158, 158, 198, 199, 158, 199, 159, 159, 199, 200,
+    159, 200, 160, 160, 200, 201, 160, 201, 161, 161, 201, 202,
+    161, 202, 162, 162, 202, 203, 162, 203, 163, 163, 203, 204,
+    164, 205, 165, 165, 205, 206, 165, 206, 166, 166, 206, 207,
+    166, 207, 167, 167, 207, 208, 167, 208, 168, 168, 208, 209,
+    168, 209, 169, 169, 209, 210, 169, 210, 170, 170, 210, 211,
+    170, 211, 171, 171, 211, 212, 171, 212, 172, 172, 212, 213,
+    172, 213, 173, 173, 213, 214, 173, 214, 174, 174, 214, 215,
+    174, 215, 175, 175, 215, 216, 175, 216, 176, 176, 216, 217,
+    176, 217, 177, 177, 217, 218, 177, 218, 178, 178, 218, 219,
+    178, 219, 179, 179, 219, 220, 179, 220, 180, 180, 220, 221,
+    180, 221, 181, 181, 221, 222, 181, 222, 182, 182, 222, 223,
+    182, 223, 183, 183, 223, 224, 183, 224, 184, 184, 224, 225,
+    184, 225, 185, 185, 225, 226, 185, 226, 186, 186, 226, 227,
+    186, 227, 187, 187, 227, 228, 187, 228, 188, 188, 228, 229,
+    188, 229, 189, 189, 229, 230, 189, 230, 190, 190, 230, 231,
+    190, 231, 191, 191, 231, 232, 191, 232, 192, 192, 232, 233,
+    192, 233, 193, 193, 233, 234, 193, 234, 194, 194, 234, 235,
+    194, 235, 195, 195, 235, 236, 195, 236, 196, 196, 236, 237,
+    196, 237, 197, 197, 237, 238, 197, 238, 198, 198, 238, 239,
+    198, 239, 199, 199, 239, 240, 199, 240, 200, 200, 240, 241,
+    200, 241, 201, 201, 241, 242, 201, 242, 202, 202, 242, 243,
+    202, 243, 203, 203, 243, 244, 203, 244, 204, 204, 244, 245,
+    205, 246, 206, 206, 246, 247, 206, 247, 207, 207, 247, 248,
+    207, 248, 208, 208, 248, 249, 208, 249, 209, 209, 249, 250,
+    209, 250, 210, 210, 250, 251, 210, 251, 211, 211, 251, 252,
+    211, 252, 212, 212, 252, 253, 212, 253, 213, 213, 253, 254,
+    213, 254, 214, 214, 254, 255, 214, 255, 215, 215, 255, 256,
+    215, 256, 216, 216, 256, 257, 216, 257, 217, 217, 257, 258,
+    217, 258, 218, 218, 258, 259, 218, 259, 219, 219, 259, 260,
+    219, 260, 220, 220, 260, 261, 220, 261, 221, 221, 261, 262,
+    221, 262, 222, 222, 262, 263, 222, 263, 223, 223, 263, 264,
+    223, 264, 224, 224, 264, 265, 224, 265, 225, 225, 265, 266,
+    225, 266, 226, 226, 266, 267, 226, 267, 227, 227, 267, 268,
+    227, 268, 228, 228, 268, 269, 228, 269, 229, 229, 269, 270,
+    229, 270, 230, 230, 270, 271, 230, 271, 231, 231, 271, 272,
+    231, 272, 232, 232, 272, 273, 232, 273, 233, 233, 273, 274,
+    233, 274, 234, 234, 274, 275, 234, 275, 235, 235, 275, 276,
+    235, 276, 236, 236, 276, 277, 236, 277, 237, 237, 277, 278,
+    237, 278, 238, 238, 278, 279, 238, 279, 239, 239, 279, 280,
+    239, 280, 240, 240, 280, 281, 240, 281, 241, 241, 281, 282,
+    241, 282, 242, 242, 282, 283, 242, 283, 243, 243, 283, 284,
+    243, 284, 244, 244, 284, 285, 244, 285, 245, 245, 285, 286,
+    246, 287, 247, 247, 287, 288, 247, 288, 248, 248, 288, 289,
+    248, 289, 249, 249, 289, 290, 249, 290, 250, 250, 290, 291,
+    250, 291, 251, 251, 291, 292, 251, 292, 252, 252, 292, 293,
+    252, 293, 253, 253, 293, 294, 253, 294, 254, 254, 294, 295,
+    254, 295, 255, 255, 295, 296, 255, 296, 256, 256, 296, 297,
+    256, 297, 257, 257, 297, 298, 257, 298, 258, 258, 298, 299,
+    258, 299, 259, 259, 299, 300, 259, 300, 260, 260, 300, 301,
+    260, 301, 261, 261, 301, 302, 261, 302, 262, 262, 302, 303,
+    262, 303, 263, 263, 303, 304, 263, 304, 264, 264, 304, 305,
+    264, 305, 265, 265, 305, 306, 265, 306, 266, 266, 306, 307,
+    266, 307, 267, 267, 307, 308, 267, 308, 268, 268, 308, 309,
+    268, 309, 269, 269, 309, 310, 269, 310, 270, 270, 310, 311,
+    270, 311, 271, 271, 311, 312, 271, 312, 272, 272, 312, 313,
+    272, 313, 273, 273, 313, 314, 273, 314, 274, 274, 314, 315,
+    274, 315, 275, 275, 315, 316, 275, 316, 276, 276, 316, 317,
+    276, 317, 277, 277, 317, 318, 277, 318, 278, 278, 318, 319,
+    278, 319, 279, 279, 319, 320, 279, 320, 280, 280, 320, 321,
+    280, 321, 281, 281, 321, 322, 281, 322, 282, 282, 322, 323,
+    282, 323, 283, 283, 323, 324, 283, 324, 284, 284, 324, 325,
+    284, 325, 285, 285, 325, 326, 285, 326, 286, 286, 326, 327,
+    287, 328, 288, 288, 328, 329, 288, 329, 289, 289, 329, 330,
+    289, 330, 290, 290, 330, 331, 290, 331, 291, 291, 331, 332,
+    291, 332, 292, 292, 332, 333, 292, 333, 293, 293, 333, 334,
+    293, 334, 294, 294, 334, 335, 294, 335, 295, 295, 335, 336,
+    295, 336, 296, 296, 336, 337, 296, 337, 297, 297, 337, 338,
+    297, 338, 298, 298, 338, 339, 298, 339, 299, 299, 339, 340,
+    299, 340, 300, 300, 340, 341, 300, 341, 301, 301, 341, 342,
+    301, 342, 302, 302, 342, 343, 302, 343, 303, 303, 343, 344,
+    303, 344, 304, 304, 344, 345, 304, 345, 305, 305, 345, 346,
+    305, 346, 306, 306, 346, 347, 306, 347, 307, 307, 347, 348,
+    307, 348, 308, 308, 348, 349, 308, 349, 309, 309, 349, 350,
+    309, 350, 310, 310, 350, 351, 310, 351, 311, 311, 351, 352,
+    311, 352, 312, 312, 352, 353, 312, 353, 313, 313, 353, 354,
+    313, 354, 314, 314, 354, 355, 314, 355, 315, 315, 355, 356,
+    315, 356, 316, 316, 356, 357, 316, 357, 317, 317, 357, 358,
+    317, 358, 318, 318, 358, 359, 318, 359, 319, 319, 359, 360,
+    319, 360, 320, 320, 360, 361, 320, 361, 321, 321, 361, 362,
+    321, 362, 322, 322, 362, 363, 322, 363, 323, 323, 363, 364,
+    323, 364, 324, 324, 364, 365, 324, 365, 325, 325, 365, 366,
+    325, 366, 326, 326, 366, 367, 326, 367, 327, 327, 367, 368,
+    328, 369, 329, 329, 369, 370, 329, 370, 330, 330, 370, 371,
+    330, 371, 331, 331, 371, 372, 331, 372, 332, 332, 372, 373,
+    332, 373, 333, 333, 373, 374, 333, 374, 334, 334, 374, 375,
+    334, 375, 335, 335, 375, 376, 335, 376, 336, 336, 376, 377,
+    336, 377, 337, 337, 377, 378, 337, 378, 338, 338, 378, 379,
+    338, 379, 339, 339, 379, 380, 339, 380, 340, 340, 380, 381,
+    340, 381, 341, 341, 381, 382, 341, 382, 342, 342, 382, 383,
+    342, 383, 343, 343, 383, 384, 343, 384, 344, 344, 384, 385,
+    344, 385, 345, 345, 385, 386, 345, 386, 346, 346, 386, 387,
+    346, 387, 347, 347, 387, 388, 347, 388, 348, 348, 388, 389,
+    348, 389, 349, 349, 389, 390, 349, 390, 350, 350, 390, 391,
+    350, 391, 351, 351, 391, 392, 351, 392, 352, 352, 392, 393,
+    352, 393, 353, 353, 393, 394, 353, 394, 354, 354, 394, 395,
+    354, 395, 355, 355, 395, 396, 355, 396, 356, 356, 396, 397,
+    356, 397, 357, 357, 397, 398, 357, 398, 358, 358, 398, 399,
+    358, 399, 359, 359, 399, 400, 359, 400, 360, 360, 400, 401,
+    360, 401, 361, 361, 401, 402, 361, 402, 362, 362, 402, 403,
+    362, 403, 363, 363, 403, 404, 363, 404, 364, 364, 404, 405,
+    364, 405, 365, 365, 405, 406, 365, 406, 366, 366, 406, 407,
+    366, 407, 367, 367, 407, 408, 367, 408, 368, 368, 408, 409,
+    369, 410, 370, 370, 410, 411, 370, 411, 371, 371, 411, 412,
+    371, 412, 372, 372, 412, 413, 372, 413, 373, 373, 413, 414,
+    373, 414, 374, 374, 414, 415, 374, 415, 375, 375, 415, 416,
+    375, 416, 376, 376, 416, 417, 376, 417, 377, 377, 417, 418,
+    377, 418, 378, 378, 418, 419, 378, 419, 379, 379, 419, 420,
+    379, 420, 380, 380, 420, 421, 380, 421, 381, 381, 421, 422,
+    381, 422, 382, 382, 422, 423, 382, 423, 383, 383, 423, 424,
+    383, 424, 384, 384, 424, 425, 384, 425, 385, 385, 425, 426,
+    385, 426, 386, 386, 426, 427, 386, 427, 387, 387, 427, 428,
+    387, 428, 388, 388, 428, 429, 388, 429, 389, 389, 429, 430,
+    389, 430, 390, 390, 430, 431, 390, 431, 391, 391, 431, 432,
+    391, 432, 392, 392, 432, 433, 392, 433, 393, 393, 433, 434,
+    393, 434, 394, 394, 434, 435, 394, 435, 395, 395, 435, 436,
+    395, 436, 396, 396, 436, 437, 396, 437, 397, 397, 437, 438,
+    397, 438, 398, 398, 438, 439, 398, 439, 399, 399, 439, 440,
+    399, 440, 400, 400, 440, 441, 400, 441, 401, 401, 441, 442,
+    401, 442, 402, 402, 442, 443, 402, 443, 403, 403, 443, 444,
+    403, 444, 404, 404, 444, 445, 404, 445, 405, 405, 445, 446,
+    405, 446, 406, 406, 446, 447, 406, 447, 407, 407, 447, 448,
+    407, 448, 408, 408, 448, 449, 408, 449, 409, 409, 449, 450,
+    410, 451, 411, 411, 451, 452, 411, 452, 412, 412, 452, 453,
+    412, 453, 413, 413, 453, 454, 413, 454, 414, 414, 454, 455,
+    414, 455, 415, 415, 455, 456, 415, 456, 416, 416, 456, 457,
+    416, 457, 417, 417, 457, 458, 417, 458, 418, 418, 458, 459,
+    418, 459, 419, 419, 459, 460, 419, 460, 420, 420, 460, 461,
+    420, 461, 421, 421, 461, 462, 421, 462, 422, 422, 462, 463,
+    422, 463, 423, 423, 463, 464, 423, 464, 424, 424, 464, 465,
+    424, 465, 425, 425, 465, 466, 425, 466, 426, 426, 466, 467,
+    426, 467, 427, 427, 467, 468, 427, 468, 428, 428, 468, 469,
+    428, 469, 429, 429, 469, 470, 429, 470, 430, 430, 470, 471,
+    430, 471, 431, 431, 471, 472, 431, 472, 432, 432, 472, 473,
+    432, 473, 433, 433, 473, 474, 433, 474, 434, 434, 474, 475,
+    434, 475, 435, 435, 475, 476, 435, 476, 436, 436, 476, 477,
+    436, 477, 437, 437, 477, 478, 437, 478, 438, 438, 478, 479,
+    438, 479, 439, 439, 479, 480, 439, 480, 440, 440, 480, 481,
+    440, 481, 441, 441, 481, 482, 441, 482, 442, 442, 482, 483,
+    442, 483, 443, 443, 483, 484, 443, 484, 444, 444, 484, 485,
+    444, 485, 445, 445, 485, 486, 445, 486, 446, 446, 486, 487,
+    446, 487, 447, 447, 487, 488, 447, 488, 448, 448, 488, 489,
+    448, 489, 449, 449, 489, 490, 449, 490, 450, 450, 490, 491,
+    451, 492, 452, 452, 492, 493, 452, 493, 453, 453, 493, 494,
+    453, 494, 454, 454, 494, 495, 454, 495, 455, 455, 495, 496,
+    455, 496, 456, 456, 496, 497, 456, 497, 457, 457, 497, 498,
+    457, 498, 458, 458, 498, 499, 458, 499, 459, 459, 499, 500,
+    459, 500, 460, 460, 500, 501, 460, 501, 461, 461, 501, 502,
+    461, 502, 462, 462, 502, 503, 462, 503, 463, 463, 503, 504,
+    463, 504, 464, 464, 504, 505, 464, 505, 465, 465, 505, 506,
+    465, 506, 466, 466, 506, 507, 466, 507, 467, 467, 507, 508,
+    467, 508, 468, 468, 508, 509, 468, 509, 469, 469, 509, 510,
+    469, 510, 470, 470, 510, 511, 470, 511, 471, 471, 511, 512,
+    471, 512, 472, 472, 512, 513, 472, 513, 473, 473, 513, 514,
+    473, 514, 474, 474, 514, 515, 474, 515, 475, 475, 515, 516,
+    475, 516, 476, 476, 516, 517, 476, 517, 477, 477, 517, 518,
+    477, 518, 478, 478, 518, 519, 478, 519, 479, 479, 519, 520,
+    479, 520, 480, 480, 520, 521, 480, 521, 481, 481, 521, 522,
+    481, 522, 482, 482, 522, 523, 482, 523, 483, 483, 523, 524,
+    483, 524, 484, 484, 524, 525, 484, 525, 485, 485, 525, 526,
+    485, 526, 486, 486, 526, 527, 486, 527, 487, 487, 527, 528,
+    487, 528, 488, 488, 528, 529, 488, 529, 489, 489, 529, 530,
+    489, 530, 490, 490, 530, 531, 490, 531, 491, 491, 531, 532,
+    492, 533, 493, 493, 533, 534, 493, 534, 494, 494, 534, 535,
+    494, 535, 495, 495, 535, 536, 495, 536, 496, 496, 536, 537,
+    496, 537, 497, 497, 537, 538, 497, 538, 498, 498, 538, 539,
+    498, 539, 499, 499, 539, 540, 499, 540, 500, 500, 540, 541,
+    500, 541, 501, 501, 541, 542, 501, 542, 502, 502, 542, 543,
+    502, 543, 503, 503, 543, 544, 503, 544, 504, 504, 544, 545,
+    504, 545, 505, 505, 545, 546, 505, 546, 506, 506, 546, 547,
+    506, 547, 507, 507, 547, 548, 507, 548, 508, 508, 548, 549,
+    508, 549, 509, 509, 549, 550, 509, 550, 510, 510, 550, 551,
+    510, 551, 511, 511, 551, 552, 511, 552, 512, 512, 552, 553,
+    512, 553, 513, 513, 553, 554, 513, 554, 514, 514, 554, 555,
+    514, 555, 515, 515, 555, 556, 515, 556, 516, 516, 556, 557,
+    516, 557, 517, 517, 557, 558, 517, 558, 518, 518, 558, 559,
+    518, 559, 519, 519, 559, 560, 519, 560, 520, 520, 560, 561,
+    520, 561, 521, 521, 561, 562, 521, 562, 522, 522, 562, 563,
+    522, 563, 523, 523, 563, 564, 523, 564, 524, 524, 564, 565,
+    524, 565, 525, 525, 565, 566, 525, 566, 526, 526, 566, 567,
+    526, 567, 527, 527, 567, 568, 527, 568, 528, 528, 568, 569,
+    528, 569, 529, 529, 569, 570, 529, 570, 530, 530, 570, 571,
+    530, 571, 531, 531, 571, 572, 531, 572, 532, 532, 572, 573,
+    533, 574, 534, 534, 574, 575, 534, 575, 535, 535, 575, 576,
+    535, 576, 536, 536, 576, 577, 536, 577, 537, 537, 577, 578,
+    537, 578, 538, 538, 578, 579, 538, 579, 539, 539, 579, 580,
+    539, 580, 540, 540, 580, 581, 540, 581, 541, 541, 581, 582,
+    541, 582, 542, 542, 582, 583, 542, 583, 543, 543, 583, 584,
+    543, 584, 544, 544, 584, 585, 544, 585, 545, 545, 585, 586,
+    545, 586, 546, 546, 586, 587, 546, 587, 547, 547, 587, 588,
+    547, 588, 548, 548, 588, 589, 548, 589, 549, 549, 589, 590,
+    549, 590, 550, 550, 590, 591, 550, 591, 551, 551, 591, 592,
+    551, 592, 552, 552, 592, 593, 552, 593, 553, 553, 593, 594,
+    553, 594, 554, 554, 594, 595, 554, 595, 555, 555, 595, 596,
+    555, 596, 556, 556, 596, 597, 556, 597, 557, 557, 597, 598,
+    557, 598, 558, 558, 598, 599, 558, 599, 559, 559, 599, 600,
+    559, 600, 560, 560, 600, 601, 560, 601, 561, 561, 601, 602,
+    561, 602, 562, 562, 602, 603, 562, 603, 563, 563, 603, 604,
+    563, 604, 564, 564, 604, 605, 564, 605, 565, 565, 605, 606,
+    565, 606, 566, 566, 606, 607, 566, 607, 567, 567, 607, 608,
+    567, 608, 568, 568, 608, 609, 568, 609, 569, 569, 609, 610,
+    569, 610, 570, 570, 610, 611, 570, 611, 571, 571, 611, 612,
+    571, 612, 572, 572, 612, 613, 572, 613, 573, 573, 613, 614,
+    574, 615, 575, 575, 615, 616, 575, 616, 576, 576, 616, 617,
+    576, 617, 577, 577, 617, 618, 577, 618, 578, 578, 618, 619,
+    578, 619, 579, 579, 619, 620, 579, 620, 580, 580, 620, 621,
+    580, 621, 581, 581, 621, 622, 581, 622, 582, 582, 622, 623,
+    582, 623, 583, 583, 623, 624, 583, 624, 584, 584, 624, 625,
+    584, 625, 585, 585, 625, 626, 585, 626, 586, 586, 626, 627,
+    586, 627, 587, 587, 627, 628, 587, 628, 588, 588, 628, 629,
+    588, 629, 589, 589, 629, 630, 589, 630, 590, 590, 630, 631,
+    590, 631, 591, 591, 631, 632, 591, 632, 592, 592, 632, 633,
+    592, 633, 593, 593, 633, 634, 593, 634, 594, 594, 634, 635,
+    594, 635, 595, 595, 635, 636, 595, 636, 596, 596, 636, 637,
+    596, 637, 597, 597, 637, 638, 597, 638, 598, 598, 638, 639,
+    598, 639, 599, 599, 639, 640, 599, 640, 600, 600, 640, 641,
+    600, 641, 601, 601, 641, 642, 601, 642, 602, 602, 642, 643,
+    602, 643, 603, 603, 643, 644, 603, 644, 604, 604, 644, 645,
+    604, 645, 605, 605, 645, 646, 605, 646, 606, 606, 646, 647,
+    606, 647, 607, 607, 647, 648, 607, 648, 608, 608, 648, 649,
+    608, 649, 609, 609, 649, 650, 609, 650, 610, 610, 650, 651,
+    610, 651, 611, 611, 651, 652, 611, 652, 612, 612, 652, 653,
+    612, 653, 613, 613, 653, 654, 613, 654, 614, 614, 654, 655,
+    615, 656, 616, 616, 656, 657, 616, 657, 617, 617, 657, 658,
+    617, 658, 618, 618, 658, 659, 618, 659, 619, 619, 659, 660,
+    619, 660, 620, 620, 660, 661, 620, 661, 621, 621, 661, 662,
+    621, 662, 622, 622, 662, 663, 622, 663, 623, 623, 663, 664,
+    623, 664, 624, 624, 664, 665, 624, 665, 625, 625, 665, 666,
+    625, 666, 626, 626, 666, 667, 626, 667, 627, 627, 667, 668,
+    627, 668, 628, 628, 668, 669, 628, 669, 629, 629, 669, 670,
+    629, 670, 630, 630, 670, 671, 630, 671, 631, 631, 671, 672,
+    631, 672, 632, 632, 672, 673, 632, 673, 633, 633, 673, 674,
+    633, 674, 634, 634, 674, 675, 634, 675, 635, 635, 675, 676,
+    635, 676, 636, 636, 676, 677, 636, 677, 637, 637, 677, 678,
+    637, 678, 638, 638, 678, 679, 638, 679, 639, 639, 679, 680,
+    639, 680, 640, 640, 680, 681, 640, 681, 641, 641, 681, 682,
+    641, 682, 642, 642, 682, 683, 642, 683, 643, 643, 683, 684,
+    643, 684, 644, 644, 684, 685, 644, 685, 645, 645, 685, 686,
+    645, 686, 646, 646, 686, 687, 646, 687, 647, 647, 687, 688,
+    647, 688, 648, 648, 688, 689, 648, 689, 649, 649, 689, 690,
+    649, 690, 650, 650, 690, 691, 650, 691, 651, 651, 691, 692,
+    651, 692, 652, 652, 692, 693, 652, 693, 653, 653, 693, 694,
+    653, 694, 654, 654, 694, 695, 654, 695, 655, 655, 695, 696,
+    656, 697, 657, 657, 697, 698, 657, 698, 658, 658, 698, 699,
+    658, 699, 659, 659, 699, 700, 659, 700, 660, 660, 700, 701,
+    660, 701, 661, 661, 701, 702, 661, 702, 662, 662, 702, 703,
+    662, 703, 663, 663, 703, 704, 663, 704, 664, 664, 704, 705,
+    664, 705, 665, 665, 705, 706, 665, 706, 666, 666, 706, 707,
+    666, 707, 667, 667, 707, 708, 667, 708, 668, 668, 708, 709,
+    668, 709, 669, 669, 709, 710, 669, 710, 670, 670, 710, 711,
+    670, 711, 671, 671, 711, 712, 671, 712, 672, 672, 712, 713,
+    672, 713, 673, 673, 713, 714, 673, 714, 674, 674, 714, 715,
+    674, 715, 675, 675, 715, 716, 675, 716, 676, 676, 716, 717,
+    676, 717, 677, 677, 717, 718, 677, 718, 678, 678, 718, 719,
+    678, 719, 679, 679, 719, 720, 679, 720, 680, 680, 720, 721,
+    680, 721, 681, 681, 721, 722, 681, 722, 682, 682, 722, 723,
+    682, 723, 683, 683, 723, 724, 683, 724, 684, 684, 724, 725,
+    684, 725, 685, 685, 725, 726, 685, 726, 686, 686, 726, 727,
+    686, 727, 687, 687, 727, 728, 687, 728, 688, 688, 728, 729,
+    688, 729, 689, 689, 729, 730, 689, 730, 690, 690, 730, 731,
+    690, 731, 691, 691, 731, 732, 691, 732, 692, 692, 732, 733,
+    692, 733, 693, 693, 733, 734, 693, 734, 694, 694, 734, 735,
+    694, 735, 695, 695, 735, 736, 695, 736, 696, 696, 736, 737,
+    697, 738, 698, 698, 738, 739, 698, 739, 699, 699, 739, 740,
+    699, 740, 700, 700, 740, 741, 700, 741, 701, 701, 741, 742,
+    701, 742, 702, 702, 742, 743, 702, 743, 703, 703, 743, 744,
+    703, 744, 704, 704, 744, 745, 704, 745, 705, 705, 745, 746,
+    705, 746, 706, 706, 746, 747, 706, 747, 707, 707, 747, 748,
+    707, 748, 708, 708, 748, 749, 708, 749, 709, 709, 749, 750,
+    709, 750, 710, 710, 750, 751, 710, 751, 711, 711, 751, 752,
+    711, 752, 712, 712, 752, 753, 712, 753, 713, 713, 753, 754,
+    713, 754, 714, 714, 754, 755, 714, 755, 715, 715, 755, 756,
+    715, 756, 716, 716, 756, 757, 716, 757, 717, 717, 757, 758,
+    717, 758, 718, 718, 758, 759, 718, 759, 719, 719, 759, 760,
+    719, 760, 720, 720, 760, 761, 720, 761, 721, 721, 761, 762,
+    721, 762, 722, 722, 762, 763, 722, 763, 723, 723, 763, 764,
+    723, 764, 724, 724, 764, 765, 724, 765, 725, 725, 765, 766,
+    725, 766, 726, 726, 766, 767, 726, 767, 727, 727, 767, 768,
+    727, 768, 728, 728, 768, 769, 728, 769, 729, 729, 769, 770,
+    729, 770, 730, 730, 770, 771, 730, 771, 731, 731, 771, 772,
+    731, 772, 732, 732, 772, 773, 732, 773, 733, 733, 773, 774,
+    733, 774, 734, 734, 774, 775, 734, 775, 735, 735, 775, 776,
+    735, 776, 736, 736, 776, 777, 736, 777, 737, 737, 777, 778,
+    738, 779, 739, 739, 779, 780, 739, 780, 740, 740, 780, 781,
+    740, 781, 741, 741, 781, 782, 741, 782, 742, 742, 782, 783,
+    742, 783, 743, 743, 783, 784, 743, 784, 744, 744, 784, 785,
+    744, 785, 745, 745, 785, 786, 745, 786, 746, 746, 786, 787,
+    746, 787, 747, 747, 787, 788, 747, 788, 748, 748, 788, 789,
+    748, 789, 749, 749, 789, 790, 749, 790, 750, 750, 790, 791,
+    750, 791, 751, 751, 791, 792, 751, 792, 752, 752, 792, 793,
+    752, 793, 753, 753, 793, 794, 753, 794, 754, 754, 794, 795,
+    754, 795, 755, 755, 795, 796, 755, 796, 756, 756, 796, 797,
+    756, 797, 757, 757, 797, 798, 757, 798, 758, 758, 798, 799,
+    758, 799, 759, 759, 799, 800, 759, 800, 760, 760, 800, 801,
+    760, 801, 761, 761, 801, 802, 761, 802, 762, 762, 802, 803,
+    762, 803, 763, 763, 803, 804, 763, 804, 764, 764, 804, 805,
+    764, 805, 765, 765, 805, 806, 765, 806, 766, 766, 806, 807,
+    766, 807, 767, 767, 807, 808, 767, 808, 768, 768, 808, 809,
+    768, 809, 769, 769, 809, 810, 769, 810, 770, 770, 810, 811,
+    770, 811, 771, 771, 811, 812, 771, 812, 772, 772, 812, 813,
+    772, 813, 773, 773, 813, 814, 773, 814, 774, 774, 814, 815,
+    774, 815, 775, 775, 815, 816, 775, 816, 776, 776, 816, 817,
+    776, 817, 777, 777, 817, 818, 777, 818, 778, 778, 818, 819,
+    779, 820, 780, 780, 820, 821, 780, 821, 781, 781, 821, 822,
+    781, 822, 782, 782, 822, 823, 782, 823, 783, 783, 823, 824,
+    783, 824, 784, 784, 824, 825, 784, 825, 785, 785, 825, 826,
+    785, 826, 786, 786, 826, 827, 786, 827, 787, 787, 827, 828,
+    787, 828, 788, 788, 828, 829, 788, 829, 789, 789, 829, 830,
+    789, 830, 790, 790, 830, 831, 790, 831, 791, 791, 831, 832,
+    791, 832, 792, 792, 832, 833, 792, 833, 793, 793, 833, 834,
+    793, 834, 794, 794, 834, 835, 794, 835, 795, 795, 835, 836,
+    795, 836, 796, 796, 836, 837, 796, 837, 797, 797, 837, 838,
+    797, 838, 798, 798, 838, 839, 798, 839, 799, 799, 839, 840,
+    799, 840, 800, 800, 840, 841, 800, 841, 801, 801, 841, 842,
+    801, 842, 802, 802, 842, 843, 802, 843, 803, 803, 843, 844,
+    803, 844, 804, 804, 844, 845, 804, 845, 805, 805, 845, 846,
+    805, 846, 806, 806, 846, 847, 806, 847, 807, 807, 847, 848,
+    807, 848, 808, 808, 848, 849, 808, 849, 809, 809, 849, 850,
+    809, 850, 810, 810, 850, 851, 810, 851, 811, 811, 851, 852,
+    811, 852, 812, 812, 852, 853, 812, 853, 813, 813, 853, 854,
+    813, 854, 814, 814, 854, 855, 814, 855, 815, 815, 855, 856,
+    815, 856, 816, 816, 856, 857, 816, 857, 817, 817, 857, 858,
+    817, 858, 818, 818, 858, 859, 818, 859, 819, 819, 859, 860,
+    820, 861, 821, 821, 861, 862, 821, 862, 822, 822, 862, 863,
+    822, 863, 823, 823, 863, 864, 823, 864, 824, 824, 864, 865,
+    824, 865, 825, 825, 865, 866, 825, 866, 826, 826, 866, 867,
+    826, 867, 827, 827, 867, 868, 827, 868, 828, 828, 868, 869,
+    828, 869, 829, 829, 869, 870, 829, 870, 830, 830, 870, 871,
+    830, 871, 831, 831, 871, 872, 831, 872, 832, 832, 872, 873,
+    832, 873, 833, 833, 873, 874, 833, 874, 834, 834, 874, 875,
+    834, 875, 835, 835, 875, 876, 835, 876, 836, 836, 876, 877,
+    836, 877, 837, 837, 877, 878, 837, 878, 838, 838, 878, 879,
+    838, 879, 839, 839, 879, 880, 839, 880, 840, 840, 880, 881,
+    840, 881, 841, 841, 881, 882, 841, 882, 842, 842, 882, 883,
+    842, 883, 843, 843, 883, 884, 843, 884, 844, 844, 884, 885,
+    844, 885, 845, 845, 885, 886, 845, 886, 846, 846, 886, 887,
+    846, 887, 847, 847, 887, 888, 847, 888, 848, 848, 888, 889,
+    848, 889, 849, 849, 889, 890, 849, 890, 850, 850, 890, 891,
+    850, 891, 851, 851, 891, 892, 851, 892, 852, 852, 892, 893,
+    852, 893, 853, 853, 893, 894, 853, 894, 854, 854, 894, 895,
+    854, 895, 855, 855, 895, 896, 855, 896, 856, 856, 896, 897,
+    856, 897, 857, 857, 897, 898, 857, 898, 858, 858, 898, 899,
+    858, 899, 859, 859, 899, 900, 859, 900, 860, 860, 900, 901,
+    861, 902, 862, 862, 902, 903, 862, 903, 863, 863, 903, 904,
+    863, 904, 864, 864, 904, 905, 864, 905, 865, 865, 905, 906,
+    865, 906, 866, 866, 906, 907, 866, 907, 867, 867, 907, 908,
+    867, 908, 868, 868, 908, 909, 868, 909, 869, 869, 909, 910,
+    869, 910, 870, 870, 910, 911, 870, 911, 871, 871, 911, 912,
+    871, 912, 872, 872, 912, 913, 872, 913, 873, 873, 913, 914,
+    873, 914, 874, 874, 914, 915, 874, 915, 875, 875, 915, 916,
+    875, 916, 876, 876, 916, 917, 876, 917, 877, 877, 917, 918,
+    877, 918, 878, 878, 918, 919, 878, 919, 879, 879, 919, 920,
+    879, 920, 880, 880, 920, 921, 880, 921, 881, 881, 921, 922,
+    881, 922, 882, 882, 922, 923, 882, 923, 883, 883, 923, 924,
+    883, 924, 884, 884, 924, 925, 884, 925, 885, 885, 925, 926,
+    885, 926, 886, 886, 926, 927, 886, 927, 887, 887, 927, 928,
+    887, 928, 888, 888, 928, 929, 888, 929, 889, 889, 929, 930,
+    889, 930, 890, 890, 930, 931, 890, 931, 891, 891, 931, 932,
+    891, 932, 892, 892, 932, 933, 892, 933, 893, 893, 933, 934,
+    893, 934, 894, 894, 934, 935, 894, 935, 895, 895, 935, 936,
+    895, 936, 896, 896, 936, 937, 896, 937, 897, 897, 937, 938,
+    897, 938, 898, 898, 938, 939, 898, 939, 899, 899, 939, 940,
+    899, 940, 900, 900, 940, 941, 900, 941, 901, 901, 941, 942,
+    902, 943, 903, 903, 943, 944, 903, 944, 904, 904, 944, 945,
+    904, 945, 905, 905, 945, 946, 905, 946, 906, 906, 946, 947,
+    906, 947, 907, 907, 947, 948, 907, 948, 908, 908, 948, 949,
+    908, 949, 909, 909, 949, 950, 909, 950, 910, 910, 950, 951,
+    910, 951, 911, 911, 951, 952, 911, 952, 912, 912, 952, 953,
+    912, 953, 913, 913, 953, 954, 913, 954, 914, 914, 954, 955,
+    914, 955, 915, 915, 955, 956, 915, 956, 916, 916, 956, 957,
+    916, 957, 917, 917, 957, 958, 917, 958, 918, 918, 958, 959,
+    918, 959, 919, 919, 959, 960, 919, 960, 920, 920, 960, 961,
+    920, 961, 921, 921, 961, 962, 921, 962, 922, 922, 962, 963,
+    922, 963, 923, 923, 963, 964, 923, 964, 924, 924, 964, 965,
+    924, 965, 925, 925, 965, 966, 925, 966, 926, 926, 966, 967,
+    926, 967, 927, 927, 967, 968, 927, 968, 928, 928, 968, 969,
+    928, 969, 929, 929, 969, 970, 929, 970, 930, 930, 970, 971,
+    930, 971, 931, 931, 971, 972, 931, 972, 932, 932, 972, 973,
+    932, 973, 933, 933, 973, 974, 933, 974, 934, 934, 974, 975,
+    934, 975, 935, 935, 975, 976, 935, 976, 936, 936, 976, 977,
+    936, 977, 937, 937, 977, 978, 937, 978, 938, 938, 978, 979,
+    938, 979, 939, 939, 979, 980, 939, 980, 940, 940, 980, 981,
+    940, 981, 941, 941, 981, 982, 941, 982, 942, 942, 982, 983,
+    943, 984, 944, 944, 984, 985, 944, 985, 945, 945, 985, 986,
+    945, 986, 946, 946, 986, 987, 946, 987, 947, 947, 987, 988,
+    947, 988, 948, 948, 988, 989, 948, 989, 949, 949, 989, 990,
+    949, 990, 950, 950, 990, 991, 950, 991, 951, 951, 991, 992,
+    951, 992, 952, 952, 992, 993, 952, 993, 953, 953, 993, 994,
+    953, 994, 954, 954, 994, 995, 954, 995, 955, 955, 995, 996,
+    955, 996, 956, 956, 996, 997, 956, 997, 957, 957, 997, 998,
+    957, 998, 958, 958, 998, 999, 958, 999, 959, 959, 999, 1000,
+    959, 1000, 960, 960, 1000, 1001, 960, 1001, 961, 961, 1001, 1002,
+    961, 1002, 962, 962, 1002, 1003, 962, 1003, 963, 963, 1003, 1004,
+    963, 1004, 964, 964, 1004, 1005, 964, 1005, 965, 965, 1005, 1006,
+    965, 1006, 966, 966, 1006, 1007, 966, 1007, 967, 967, 1007, 1008,
+    967, 1008, 968, 968, 1008, 1009, 968, 1009, 969, 969, 1009, 1010,
+    969, 1010, 970, 970, 1010, 1011, 970, 1011, 971, 971, 1011, 1012,
+    971, 1012, 972, 972, 1012, 1013, 972, 1013, 973, 973, 1013, 1014,
+    973, 1014, 974, 974, 1014, 1015, 974, 1015, 975, 975, 1015, 1016,
+    975, 1016, 976, 976, 1016, 1017, 976, 1017, 977, 977, 1017, 1018,
+    977, 1018, 978, 978, 1018, 1019, 978, 1019, 979, 979, 1019, 1020,
+    979, 1020, 980, 980, 1020, 1021, 980, 1021, 981, 981, 1021, 1022,
+    981, 1022, 982, 982, 1022, 1023, 982, 1023, 983, 983, 1023, 1024,
+    984, 1025, 985, 985, 1025, 1026, 985, 1026, 986, 986, 1026, 1027,
+    986, 1027, 987, 987, 1027, 1028, 987, 1028, 988, 988, 1028, 1029,
+    988, 1029, 989, 989, 1029, 1030, 989, 1030, 990, 990, 1030, 1031,
+    990, 1031, 991, 991, 1031, 1032, 991, 1032, 992, 992, 1032, 1033,
+    992, 1033, 993, 993, 1033, 1034, 993, 1034, 994, 994, 1034, 1035,
+    994, 1035, 995, 995, 1035, 1036, 995, 1036, 996, 996, 1036, 1037,
+    996, 1037, 997, 997, 1037, 1038, 997, 1038, 998, 998, 1038, 1039,
+    998, 1039, 999, 999, 1039, 1040, 999, 1040, 1000, 1000, 1040, 1041,
+    1000, 1041, 1001, 1001, 1041, 1042, 1001, 1042, 1002, 1002, 1042, 1043,
+    1002, 1043, 1003, 1003, 1043, 1044, 1003, 1044, 1004, 1004, 1044, 1045,
+    1004, 1045, 1005, 1005, 1045, 1046, 1005, 1046, 1006, 1006, 1046, 1047,
+    1006, 1047, 1007, 1007, 1047, 1048, 1007, 1048, 1008, 1008, 1048, 1049,
+    1008, 1049, 1009, 1009, 1049, 1050, 1009, 1050, 1010, 1010, 1050, 1051,
+    1010, 1051, 1011, 1011, 1051, 1052, 1011, 1052, 1012, 1012, 1052, 1053,
+    1012, 1053, 1013, 1013, 1053, 1054, 1013, 1054, 1014, 1014, 1054, 1055,
+    1014, 1055, 1015, 1015, 1055, 1056, 1015, 1056, 1016, 1016, 1056, 1057,
+    1016, 1057, 1017, 1017, 1057, 1058, 1017, 1058, 1018, 1018, 1058, 1059,
+    1018, 1059, 1019, 1019, 1059, 1060, 1019, 1060, 1020, 1020, 1060, 1061,
+    1020, 1061, 1021, 1021, 1061, 1062, 1021, 1062, 1022, 1022, 1062, 1063,
+    1022, 1063, 1023, 1023, 1063, 1064, 1023, 1064, 1024, 1024, 1064, 1065,
+    1025, 1066, 1026, 1026, 1066, 1067, 1026, 1067, 1027, 1027, 1067, 1068,
+    1027, 1068, 1028, 1028, 1068, 1069, 1028, 1069, 1029, 1029, 1069, 1070,
+    1029, 1070, 1030, 1030, 1070, 1071, 1030, 1071, 1031, 1031, 1071, 1072,
+    1031, 1072, 1032, 1032, 1072, 1073, 1032, 1073, 1033, 1033, 1073, 1074,
+    1033, 1074, 1034, 1034, 1074, 1075, 1034, 1075, 1035, 1035, 1075, 1076,
+    1035, 1076, 1036, 1036, 1076, 1077, 1036, 1077, 1037, 1037, 1077, 1078,
+    1037, 1078, 1038, 1038, 1078, 1079, 1038, 1079, 1039, 1039, 1079, 1080,
+    1039, 1080, 1040, 1040, 1080, 1081, 1040, 1081, 1041, 1041, 1081, 1082,
+    1041, 1082, 1042, 1042, 1082, 1083, 1042, 1083, 1043, 1043, 1083, 1084,
+    1043, 1084, 1044, 1044, 1084, 1085, 1044, 1085, 1045, 1045, 1085, 1086,
+    1045, 1086, 1046, 1046, 1086, 1087, 1046, 1087, 1047, 1047, 1087, 1088,
+    1047, 1088, 1048, 1048, 1088, 1089, 1048, 1089, 1049, 1049, 1089, 1090,
+    1049, 1090, 1050, 1050, 1090, 1091, 1050, 1091, 1051, 1051, 1091, 1092,
+    1051, 1092, 1052, 1052, 1092, 1093, 1052, 1093, 1053, 1053, 1093, 1094,
+    1053, 1094, 1054, 1054, 1094, 1095, 1054, 1095, 1055, 1055, 1095, 1096,
+    1055, 1096, 1056, 1056, 1096, 1097, 1056, 1097, 1057, 1057, 1097, 1098,
+    1057, 1098, 1058, 1058, 1098, 1099, 1058, 1099, 1059, 1059, 1099, 1100,
+    1059, 1100, 1060, 1060, 1100, 1101, 1060, 1101, 1061, 1061, 1101, 1102,
+    1061, 1102, 1062, 1062, 1102, 1103, 1062, 1103, 1063, 1063, 1103, 1104,
+    1063, 1104, 1064, 1064, 1104, 1105, 1064, 1105, 1065, 1065, 1105, 1106,
+    1066, 1107, 1067, 1067, 1107, 1108, 1067, 1108, 1068, 1068, 1108, 1109,
+    1068, 1109, 1069, 1069, 1109, 1110, 1069, 1110, 1070, 1070, 1110, 1111,
+    1070, 1111, 1071, 1071, 1111, 1112, 1071, 1112, 1072, 1072, 1112, 1113,
+    1072, 1113, 1073, 1073, 1113, 1114, 1073, 1114, 1074, 1074, 1114, 1115,
+    1074, 1115, 1075, 1075, 1115, 1116, 1075, 1116, 1076, 1076, 1116, 1117,
+    1076, 1117, 1077, 1077, 1117, 1118, 1077, 1118, 1078, 1078, 1118, 1119,
+    1078, 1119, 1079, 1079, 1119, 1120, 1079, 1120, 1080, 1080, 1120, 1121,
+    1080, 1121, 1081, 1081, 1121, 1122, 1081, 1122, 1082, 1082, 1122, 1123,
+    1082, 1123, 1083, 1083, 1123, 1124, 1083, 1124, 1084, 1084, 1124, 1125,
+    1084, 1125, 1085, 1085, 1125, 1126, 1085, 1126, 1086, 1086, 1126, 1127,
+    1086, 1127, 1087, 1087, 1127, 1128, 1087, 1128, 1088, 1088, 1128, 1129,
+    1088, 1129, 1089, 1089, 1129, 1130, 1089, 1130, 1090, 1090, 1130, 1131,
+    1090, 1131, 1091, 1091, 1131, 1132, 1091, 1132, 1092, 1092, 1132, 1133,
+    1092, 1133, 1093, 1093, 1133, 1134, 1093, 1134, 1094, 1094, 1134, 1135,
+    1094, 1135, 1095, 1095, 1135, 1136, 1095, 1136, 1096, 1096, 1136, 1137,
+    1096, 1137, 1097, 1097, 1137, 1138, 1097, 1138, 1098, 1098, 1138, 1139,
+    1098, 1139, 1099, 1099, 1139, 1140, 1099, 1140, 1100, 1100, 1140, 1141,
+    1100, 1141, 1101, 1101, 1141, 1142, 1101, 1142, 1102, 1102, 1142, 1143,
+    1102, 1143, 1103, 1103, 1143, 1144, 1103, 1144, 1104, 1104, 1144, 1145,
+    1104, 1145, 1105, 1105, 1145, 1146, 1105, 1146, 1106, 1106, 1146, 1147,
+    1107, 1148, 1108, 1108, 1148, 1149, 1108, 1149, 1109, 1109, 1149, 1150,
+    1109, 1150, 1110, 1110, 1150, 1151, 1110, 1151, 1111, 1111, 1151, 1152,
+    1111, 1152, 1112, 1112, 1152, 1153, 1112, 1153, 1113, 1113, 1153, 1154,
+    1113, 1154, 1114, 1114, 1154, 1155, 1114, 1155, 1115, 1115, 1155, 1156,
+    1115, 1156, 1116, 1116, 1156, 1157, 1116, 1157, 1117, 1117, 1157, 1158,
+    1117, 1158, 1118, 1118, 1158, 1159, 1118, 1159, 1119, 1119, 1159, 1160,
+    1119, 1160, 1120, 1120, 1160, 1161, 1120, 1161, 1121, 1121, 1161, 1162,
+    1121, 1162, 1122, 1122, 1162, 1163, 1122, 1163, 1123, 1123, 1163, 1164,
+    1123, 1164, 1124, 1124, 1164, 1165, 1124, 1165, 1125, 1125, 1165, 1166,
+    1125, 1166, 1126, 1126, 1166, 1167, 1126, 1167, 1127, 1127, 1167, 1168,
+    1127, 1168, 1128, 1128, 1168, 1169, 1128, 1169, 1129, 1129, 1169, 1170,
+    1129, 1170, 1130, 1130, 1170, 1171, 1130, 1171, 1131, 1131, 1171, 1172,
+    1131, 1172, 1132, 1132, 1172, 1173, 1132, 1173, 1133, 1133, 1173, 1174,
+    1133, 1174, 1134, 1134, 1174, 1175, 1134, 1175, 1135, 1135, 1175, 1176,
+    1135, 1176, 1136, 1136, 1176, 1177, 1136, 1177, 1137, 1137, 1177, 1178,
+    1137, 1178, 1138, 1138, 1178, 1179, 1138, 1179, 1139, 1139, 1179, 1180,
+    1139, 1180, 1140, 1140, 1180, 1181, 1140, 1181, 1141, 1141, 1181, 1182,
+    1141, 1182, 1142, 1142, 1182, 1183, 1142, 1183, 1143, 1143, 1183, 1184,
+    1143, 1184, 1144, 1144, 1184, 1185, 1144, 1185, 1145, 1145, 1185, 1186,
+    1145, 1186, 1146, 1146, 1186, 1187, 1146, 1187, 1147, 1147, 1187, 1188,
+    1148, 1189, 1149, 1149, 1189, 1190, 1149, 1190, 1150, 1150, 1190, 1191,
+    1150, 1191, 1151, 1151, 1191, 1192, 1151, 1192, 1152, 1152, 1192, 1193,
+    1152, 1193, 1153, 1153, 1193, 1194, 1153, 1194, 1154, 1154, 1194, 1195,
+    1154, 1195, 1155, 1155, 1195, 1196, 1155, 1196, 1156, 1156, 1196, 1197,
+    1156, 1197, 1157, 1157, 1197, 1198, 1157, 1198, 1158, 1158, 1198, 1199,
+    1158, 1199, 1159, 1159, 1199, 1200, 1159, 1200, 1160, 1160, 1200, 1201,
+    1160, 1201, 1161, 1161, 1201, 1202, 1161, 1202, 1162, 1162, 1202, 1203,
+    1162, 1203, 1163, 1163, 1203, 1204, 1163, 1204, 1164, 1164, 1204, 1205,
+    1164, 1205, 1165, 1165, 1205, 1206, 1165, 1206, 1166, 1166, 1206, 1207,
+    1166, 1207, 1167, 1167, 1207, 1208, 1167, 1208, 1168, 1168, 1208, 1209,
+    1168, 1209, 1169, 1169, 1209, 1210, 1169, 1210, 1170, 1170, 1210, 1211,
+    1170, 1211, 1171, 1171, 1211, 1212, 1171, 1212, 1172, 1172, 1212, 1213,
+    1172, 1213, 1173, 1173, 1213, 1214, 1173, 1214, 1174, 1174, 1214, 1215,
+    1174, 1215, 1175, 1175, 1215, 1216, 1175, 1216, 1176, 1176, 1216, 1217,
+    1176, 1217, 1177, 1177, 1217, 1218, 1177, 1218, 1178, 1178, 1218, 1219,
+    1178, 1219, 1179, 1179, 1219, 1220, 1179, 1220, 1180, 1180, 1220, 1221,
+    1180, 1221, 1181, 1181, 1221, 1222, 1181, 1222, 1182, 1182, 1222, 1223,
+    1182, 1223, 1183, 1183, 1223, 1224, 1183, 1224, 1184, 1184, 1224, 1225,
+    1184, 1225, 1185, 1185, 1225, 1226, 1185, 1226, 1186, 1186, 1226, 1227,
+    1186, 1227, 1187, 1187, 1227, 1228, 1187, 1228, 1188, 1188, 1228, 1229,
+    1189, 1230, 1190, 1190, 1230, 1231, 1190, 1231, 1191, 1191, 1231, 1232,
+    1191, 1232, 1192, 1192, 1232, 1233, 1192, 1233, 1193, 1193, 1233, 1234,
+    1193, 1234, 1194, 1194, 1234, 1235, 1194, 1235, 1195, 1195, 1235, 1236,
+    1195, 1236, 1196, 1196, 1236, 1237, 1196, 1237, 1197, 1197, 1237, 1238,
+    1197, 1238, 1198, 1198, 1238, 1239, 1198, 1239, 1199, 1199, 1239, 1240,
+    1199, 1240, 1200, 1200, 1240, 1241, 1200, 1241, 1201, 1201, 1241, 1242,
+    1201, 1242, 1202, 1202, 1242, 1243, 1202, 1243, 1203, 1203, 1243, 1244,
+    1203, 1244, 1204, 1204, 1244, 1245, 1204, 1245, 1205, 1205, 1245, 1246,
+    1205, 1246, 1206, 1206, 1246, 1247, 1206, 1247, 1207, 1207, 1247, 1248,
+    1207, 1248, 1208, 1208, 1248, 1249, 1208, 1249, 1209, 1209, 1249, 1250,
+    1209, 1250, 1210, 1210, 1250, 1251, 1210, 1251, 1211, 1211, 1251, 1252,
+    1211, 1252, 1212, 1212, 1252, 1253, 1212, 1253, 1213, 1213, 1253, 1254,
+    1213, 1254, 1214, 1214, 1254, 1255, 1214, 1255, 1215, 1215, 1255, 1256,
+    1215, 1256, 1216, 1216, 1256, 1257, 1216, 1257, 1217, 1217, 1257, 1258,
+    1217, 1258, 1218, 1218, 1258, 1259, 1218, 1259, 1219, 1219, 1259, 1260,
+    1219, 1260, 1220, 1220, 1260, 1261, 1220, 1261, 1221, 1221, 1261, 1262,
+    1221, 1262, 1222, 1222, 1262, 1263, 1222, 1263, 1223, 1223, 1263, 1264,
+    1223, 1264, 1224, 1224, 1264, 1265, 1224, 1265, 1225, 1225, 1265, 1266,
+    1225, 1266, 1226, 1226, 1266, 1267, 1226, 1267, 1227, 1227, 1267, 1268,
+    1227, 1268, 1228, 1228, 1268, 1269, 1228, 1269, 1229, 1229, 1269, 1270,
+    1230, 1271, 1231, 1231, 1271, 1272, 1231, 1272, 1232, 1232, 1272, 1273,
+    1232, 1273, 1233, 1233, 1273, 1274, 1233, 1274, 1234, 1234, 1274, 1275,
+    1234, 1275, 1235, 1235, 1275, 1276, 1235, 1276, 1236, 1236, 1276, 1277,
+    1236, 1277, 1237, 1237, 1277, 1278, 1237, 1278, 1238, 1238, 1278, 1279,
+    1238, 1279, 1239, 1239, 1279, 1280, 1239, 1280, 1240, 1240, 1280, 1281,
+    1240, 1281, 1241, 1241, 1281, 1282, 1241, 1282, 1242, 1242, 1282, 1283,
+    1242, 1283, 1243, 1243, 1283, 1284, 1243, 1284, 1244, 1244, 1284, 1285,
+    1244, 1285, 1245, 1245, 1285, 1286, 1245, 1286, 1246, 1246, 1286, 1287,
+    1246, 1287, 1247, 1247, 1287, 1288, 1247, 1288, 1248, 1248, 1288, 1289,
+    1248, 1289, 1249, 1249, 1289, 1290, 1249, 1290, 1250, 1250, 1290, 1291,
+    1250, 1291, 1251, 1251, 1291, 1292, 1251, 1292, 1252, 1252, 1292, 1293,
+    1252, 1293, 1253, 1253, 1293, 1294, 1253, 1294, 1254, 1254, 1294, 1295,
+    1254, 1295, 1255, 1255, 1295, 1296, 1255, 1296, 1256, 1256, 1296, 1297,
+    1256, 1297, 1257, 1257, 1297, 1298, 1257, 1298, 1258, 1258, 1298, 1299,
+    1258, 1299, 1259, 1259, 1299, 1300, 1259, 1300, 1260, 1260, 1300, 1301,
+    1260, 1301, 1261, 1261, 1301, 1302, 1261, 1302, 1262, 1262, 1302, 1303,
+    1262, 1303, 1263, 1263, 1303, 1304, 1263, 1304, 1264, 1264, 1304, 1305,
+    1264, 1305, 1265, 1265, 1305, 1306, 1265, 1306, 1266, 1266, 1306, 1307,
+    1266, 1307, 1267, 1267, 1307, 1308, 1267, 1308, 1268, 1268, 1308, 1309,
+    1268, 1309, 1269, 1269, 1309, 1310, 1269, 1310, 1270, 1270, 1310, 1311,
+    1271, 1312, 1272, 1272, 1312, 1313, 1272, 1313, 1273, 1273, 1313, 1314,
+    1273, 1314, 1274, 1274, 1314, 1315, 1274, 1315, 1275, 1275, 1315, 1316,
+    1275, 1316, 1276, 1276, 1316, 1317, 1276, 1317, 1277, 1277, 1317, 1318,
+    1277, 1318, 1278, 1278, 1318, 1319, 1278, 1319, 1279, 1279, 1319, 1320,
+    1279, 1320, 1280, 1280, 1320, 1321, 1280, 1321, 1281, 1281, 1321, 1322,
+    1281, 1322, 1282, 1282, 1322, 1323, 1282, 1323, 1283, 1283, 1323, 1324,
+    1283, 1324, 1284, 1284, 1324, 1325, 1284, 1325, 1285, 1285, 1325, 1326,
+    1285, 1326, 1286, 1286, 1326, 1327, 1286, 1327, 1287, 1287, 1327, 1328,
+    1287, 1328, 1288, 1288, 1328, 1329, 1288, 1329, 1289, 1289, 1329, 1330,
+    1289, 1330, 1290, 1290, 1330, 1331, 1290, 1331, 1291, 1291, 1331, 1332,
+    1291, 1332, 1292, 1292, 1332, 1333, 1292, 1333, 1293, 1293, 1333, 1334,
+    1293, 1334, 1294, 1294, 1334, 1335, 1294, 1335, 1295, 1295, 1335, 1336,
+    1295, 1336, 1296, 1296, 1336, 1337, 1296, 1337, 1297, 1297, 1337, 1338,
+    1297, 1338, 1298, 1298, 1338, 1339, 1298, 1339, 1299, 1299, 1339, 1340,
+    1299, 1340, 1300, 1300, 1340, 1341, 1300, 1341, 1301, 1301, 1341, 1342,
+    1301, 1342, 1302, 1302, 1342, 1343, 1302, 1343, 1303, 1303, 1343, 1344,
+    1303, 1344, 1304, 1304, 1344, 1345, 1304, 1345, 1305, 1305, 1345, 1346,
+    1305, 1346, 1306, 1306, 1346, 1347, 1306, 1347, 1307, 1307, 1347, 1348,
+    1307, 1348, 1308, 1308, 1348, 1349, 1308, 1349, 1309, 1309, 1349, 1350,
+    1309, 1350, 1310, 1310, 1350, 1351, 1310, 1351, 1311, 1311, 1351, 1352,
+    1312, 1353, 1313, 1313, 1353, 1354, 1313, 1354, 1314, 1314, 1354, 1355,
+    1314, 1355, 1315, 1315, 1355, 1356, 1315, 1356, 1316, 1316, 1356, 1357,
+    1316, 1357, 1317, 1317, 1357, 1358, 1317, 1358, 1318, 1318, 1358, 1359,
+    1318, 1359, 1319, 1319, 1359, 1360, 1319, 1360, 1320, 1320, 1360, 1361,
+    1320, 1361, 1321, 1321, 1361, 1362, 1321, 1362, 1322, 1322, 1362, 1363,
+    1322, 1363, 1323, 1323, 1363, 1364, 1323, 1364, 1324, 1324, 1364, 1365,
+    1324, 1365, 1325, 1325, 1365, 1366, 1325, 1366, 1326, 1326, 1366, 1367,
+    1326, 1367, 1327, 1327, 1367, 1368, 1327, 1368, 1328, 1328, 1368, 1369,
+    1328, 1369, 1329, 1329, 1369, 1370, 1329, 1370, 1330, 1330, 1370, 1371,
+    1330, 1371, 1331, 1331, 1371, 1372, 1331, 1372, 1332, 1332, 1372, 1373,
+    1332, 1373, 1333, 1333, 1373, 1374, 1333, 1374, 1334, 1334, 1374, 1375,
+    1334, 1375, 1335, 1335, 1375, 1376, 1335, 1376, 1336, 1336, 1376, 1377,
+    1336, 1377, 1337, 1337, 1377, 1378, 1337, 1378, 1338, 1338, 1378, 1379,
+    1338, 1379, 1339, 1339, 1379, 1380, 1339, 1380, 1340, 1340, 1380, 1381,
+    1340, 1381, 1341, 1341, 1381, 1382, 1341, 1382, 1342, 1342, 1382, 1383,
+    1342, 1383, 1343, 1343, 1383, 1384, 1343, 1384, 1344, 1344, 1384, 1385,
+    1344, 1385, 1345, 1345, 1385, 1386, 1345, 1386, 1346, 1346, 1386, 1387,
+    1346, 1387, 1347, 1347, 1387, 1388, 1347, 1388, 1348, 1348, 1388, 1389,
+    1348, 1389, 1349, 1349, 1389, 1390, 1349, 1390, 1350, 1350, 1390, 1391,
+    1350, 1391, 1351, 1351, 1391, 1392, 1351, 1392, 1352, 1352, 1392, 1393,
+    1353, 1394, 1354, 1354, 1394, 1395, 1354, 1395, 1355, 1355, 1395, 1396,
+    1355, 1396, 1356, 1356, 1396, 1397, 1356, 1397, 1357, 1357, 1397, 1398,
+    1357, 1398, 1358, 1358, 1398, 1399, 1358, 1399, 1359, 1359, 1399, 1400,
+    1359, 1400, 1360, 1360, 1400, 1401, 1360, 1401, 1361, 1361, 1401, 1402,
+    1361, 1402, 1362, 1362, 1402, 1403, 1362, 1403, 1363, 1363, 1403, 1404,
+    1363, 1404, 1364, 1364, 1404, 1405, 1364, 1405, 1365, 1365, 1405, 1406,
+    1365, 1406, 1366, 1366, 1406, 1407, 1366, 1407, 1367, 1367, 1407, 1408,
+    1367, 1408, 1368, 1368, 1408, 1409, 1368, 1409, 1369, 1369, 1409, 1410,
+    1369, 1410, 1370, 1370, 1410, 1411, 1370, 1411, 1371, 1371, 1411, 1412,
+    1371, 1412, 1372, 1372, 1412, 1413, 1372, 1413, 1373, 1373, 1413, 1414,
+    1373, 1414, 1374, 1374, 1414, 1415, 1374, 1415, 1375, 1375, 1415, 1416,
+    1375, 1416, 1376, 1376, 1416, 1417, 1376, 1417, 1377, 1377, 1417, 1418,
+    1377, 1418, 1378, 1378, 1418, 1419, 1378, 1419, 1379, 1379, 1419, 1420,
+    1379, 1420, 1380, 1380, 1420, 1421, 1380, 1421, 1381, 1381, 1421, 1422,
+    1381, 1422, 1382, 1382, 1422, 1423, 1382, 1423, 1383, 1383, 1423, 1424,
+    1383, 1424, 1384, 1384, 1424, 1425, 1384, 1425, 1385, 1385, 1425, 1426,
+    1385, 1426, 1386, 1386, 1426, 1427, 1386, 1427, 1387, 1387, 1427, 1428,
+    1387, 1428, 1388, 1388, 1428, 1429, 1388, 1429, 1389, 1389, 1429, 1430,
+    1389, 1430, 1390, 1390, 1430, 1431, 1390, 1431, 1391, 1391, 1431, 1432,
+    1391, 1432, 1392, 1392, 1432, 1433, 1392, 1433, 1393, 1393, 1433, 1434,
+    1394, 1435, 1395, 1395, 1435, 1436, 1395, 1436, 1396, 1396, 1436, 1437,
+    1396, 1437, 1397, 1397, 1437, 1438, 1397, 1438, 1398, 1398, 1438, 1439,
+    1398, 1439, 1399, 1399, 1439, 1440, 1399, 1440, 1400, 1400, 1440, 1441,
+    1400, 1441, 1401, 1401, 1441, 1442, 1401, 1442, 1402, 1402, 1442, 1443,
+    1402, 1443, 1403, 1403, 1443, 1444, 1403, 1444, 1404, 1404, 1444, 1445,
+    1404, 1445, 1405, 1405, 1445, 1446, 1405, 1446, 1406, 1406, 1446, 1447,
+    1406, 1447, 1407, 1407, 1447, 1448, 1407, 1448, 1408, 1408, 1448, 1449,
+    1408, 1449, 1409, 1409, 1449, 1450, 1409, 1450, 1410, 1410, 1450, 1451,
+    1410, 1451, 1411, 1411, 1451, 1452, 1411, 1452, 1412, 1412, 1452, 1453,
+    1412, 1453, 1413, 1413, 1453, 1454, 1413, 1454, 1414, 1414, 1454, 1455,
+    1414, 1455, 1415, 1415, 1455, 1456, 1415, 1456, 1416, 1416, 1456, 1457,
+    1416, 1457, 1417, 1417, 1457, 1458, 1417, 1458, 1418, 1418, 1458, 1459,
+    1418, 1459, 1419, 1419, 1459, 1460, 1419, 1460, 1420, 1420, 1460, 1461,
+    1420, 1461, 1421, 1421, 1461, 1462, 1421, 1462, 1422, 1422, 1462, 1463,
+    1422, 1463, 1423, 1423, 1463, 1464, 1423, 1464, 1424, 1424, 1464, 1465,
+    1424, 1465, 1425, 1425, 1465, 1466, 1425, 1466, 1426, 1426, 1466, 1467,
+    1426, 1467, 1427, 1427, 1467, 1468, 1427, 1468, 1428, 1428, 1468, 1469,
+    1428, 1469, 1429, 1429, 1469, 1470, 1429, 1470, 1430, 1430, 1470, 1471,
+    1430, 1471, 1431, 1431, 1471, 1472, 1431, 1472, 1432, 1432, 1472, 1473,
+    1432, 1473, 1433, 1433, 1473, 1474, 1433, 1474, 1434, 1434, 1474, 1475,
+    1435, 1476, 1436, 1436, 1476, 1477, 1436, 1477, 1437, 1437, 1477, 1478,
+    1437, 1478, 1438, 1438, 1478, 1479, 1438, 1479, 1439, 1439, 1479, 1480,
+    1439, 1480, 1440, 1440, 1480, 1481, 1440, 1481, 1441, 1441, 1481, 1482,
+    1441, 1482, 1442, 1442, 1482, 1483, 1442, 1483, 1443, 1443, 1483, 1484,
+    1443, 1484, 1444, 1444, 1484, 1485, 1444, 1485, 1445, 1445, 1485, 1486,
+    1445, 1486, 1446, 1446, 1486, 1487, 1446, 1487, 1447, 1447, 1487, 1488,
+    1447, 1488, 1448, 1448, 1488, 1489, 1448, 1489, 1449, 1449, 1489, 1490,
+    1449, 1490, 1450, 1450, 1490, 1491, 1450, 1491, 1451, 1451, 1491, 1492,
+    1451, 1492, 1452, 1452, 1492, 1493, 1452, 1493, 1453, 1453, 1493, 1494,
+    1453, 1494, 1454, 1454, 1494, 1495, 1454, 1495, 1455, 1455, 1495, 1496,
+    1455, 1496, 1456, 1456, 1496, 1497, 1456, 1497, 1457, 1457, 1497, 1498,
+    1457, 1498, 1458, 1458, 1498, 1499, 1458, 1499, 1459, 1459, 1499, 1500,
+    1459, 1500, 1460, 1460, 1500, 1501, 1460, 1501, 1461, 1461, 1501, 1502,
+    1461, 1502, 1462, 1462, 1502, 1503, 1462, 1503, 1463, 1463, 1503, 1504,
+    1463, 1504, 1464, 1464, 1504, 1505, 1464, 1505, 1465, 1465, 1505, 1506,
+    1465, 1506, 1466, 1466, 1506, 1507, 1466, 1507, 1467, 1467, 1507, 1508,
+    1467, 1508, 1468, 1468, 1508, 1509, 1468, 1509, 1469, 1469, 1509, 1510,
+    1469, 1510, 1470, 1470, 1510, 1511, 1470, 1511, 1471, 1471, 1511, 1512,
+    1471, 1512, 1472, 1472, 1512, 1513, 1472, 1513, 1473, 1473, 1513, 1514,
+    1473, 1514, 1474, 1474, 1514, 1515, 1474, 1515, 1475, 1475, 1515, 1516,
+    1476, 1517, 1477, 1477, 1517, 1518, 1477, 1518, 1478, 1478, 1518, 1519,
+    1478, 1519, 1479, 1479, 1519, 1520, 1479, 1520, 1480, 1480, 1520, 1521,
+    1480, 1521, 1481, 1481, 1521, 1522, 1481, 1522, 1482, 1482, 1522, 1523,
+    1482, 1523, 1483, 1483, 1523, 1524, 1483, 1524, 1484, 1484, 1524, 1525,
+    1484, 1525, 1485, 1485, 1525, 1526, 1485, 1526, 1486, 1486, 1526, 1527,
+    1486, 1527, 1487, 1487, 1527, 1528, 1487, 1528, 1488, 1488, 1528, 1529,
+    1488, 1529, 1489, 1489, 1529, 1530, 1489, 1530, 1490, 1490, 1530, 1531,
+    1490, 1531, 1491, 1491, 1531, 1532, 1491, 1532, 1492, 1492, 1532, 1533,
+    1492, 1533, 1493, 1493, 1533, 1534, 1493, 1534, 1494, 1494, 1534, 1535,
+    1494, 1535, 1495, 1495, 1535, 1536, 1495, 1536, 1496, 1496, 1536, 1537,
+    1496, 1537, 1497, 1497, 1537, 1538, 1497, 1538, 1498, 1498, 1538, 1539,
+    1498, 1539, 1499, 1499, 1539, 1540, 1499, 1540, 1500, 1500, 1540, 1541,
+    1500, 1541, 1501, 1501, 1541, 1542, 1501, 1542, 1502, 1502, 1542, 1543,
+    1502, 1543, 1503, 1503, 1543, 1544, 1503, 1544, 1504, 1504, 1544, 1545,
+    1504, 1545, 1505, 1505, 1545, 1546, 1505, 1546, 1506, 1506, 1546, 1547,
+    1506, 1547, 1507, 1507, 1547, 1548, 1507, 1548, 1508, 1508, 1548, 1549,
+    1508, 1549, 1509, 1509, 1549, 1550, 1509, 1550, 1510, 1510, 1550, 1551,
+    1510, 1551, 1511, 1511, 1551, 1552, 1511, 1552, 1512, 1512, 1552, 1553,
+    1512, 1553, 1513, 1513, 1553, 1554, 1513, 1554, 1514, 1514, 1554, 1555,
+    1514, 1555, 1515, 1515, 1555, 1556, 1515, 1556, 1516, 1516, 1556, 1557,
+    1517, 1558, 1518, 1518, 1558, 1559, 1518, 1559, 1519, 1519, 1559, 1560,
+    1519, 1560, 1520, 1520, 1560, 1561, 1520, 1561, 1521, 1521, 1561, 1562,
+    1521, 1562, 1522, 1522, 1562, 1563, 1522, 1563, 1523, 1523, 1563, 1564,
+    1523, 1564, 1524, 1524, 1564, 1565, 1524, 1565, 1525, 1525, 1565, 1566,
+    1525, 1566, 1526, 1526, 1566, 1567, 1526, 1567, 1527, 1527, 1567, 1568,
+    1527, 1568, 1528, 1528, 1568, 1569, 1528, 1569, 1529, 1529, 1569, 1570,
+    1529, 1570, 1530, 1530, 1570, 1571, 1530, 1571, 1531, 1531, 1571, 1572,
+    1531, 1572, 1532, 1532, 1572, 1573, 1532, 1573, 1533, 1533, 1573, 1574,
+    1533, 1574, 1534, 1534, 1574, 1575, 1534, 1575, 1535, 1535, 1575, 1576,
+    1535, 1576, 1536, 1536, 1576, 1577, 1536, 1577, 1537, 1537, 1577, 1578,
+    1537, 1578, 1538, 1538, 1578, 1579, 1538, 1579, 1539, 1539, 1579, 1580,
+    1539, 1580, 1540, 1540, 1580, 1581, 1540, 1581, 1541, 1541, 1581, 1582,
+    1541, 1582, 1542, 1542, 1582, 1583, 1542, 1583, 1543, 1543, 1583, 1584,
+    1543, 1584, 1544, 1544, 1584, 1585, 1544, 1585, 1545, 1545, 1585, 1586,
+    1545, 1586, 1546, 1546, 1586, 1587, 1546, 1587, 1547, 1547, 1587, 1588,
+    1547, 1588, 1548, 1548, 1588, 1589, 1548, 1589, 1549, 1549, 1589, 1590,
+    1549, 1590, 1550, 1550, 1590, 1591, 1550, 1591, 1551, 1551, 1591, 1592,
+    1551, 1592, 1552, 1552, 1592, 1593, 1552, 1593, 1553, 1553, 1593, 1594,
+    1553, 1594, 1554, 1554, 1594, 1595, 1554, 1595, 1555, 1555, 1595, 1596,
+    1555, 1596, 1556, 1556, 1596, 1597, 1556, 1597, 1557, 1557, 1597, 1598,
+    1558, 1599, 1559, 1559, 1599, 1600, 1559, 1600, 1560, 1560, 1600, 1601,
+    1560, 1601, 1561, 1561, 1601, 1602, 1561, 1602, 1562, 1562, 1602, 1603,
+    1562, 1603, 1563, 1563, 1603, 1604, 1563, 1604, 1564, 1564, 1604, 1605,
+    1564, 1605, 1565, 1565, 1605, 1606, 1565, 1606, 1566, 1566, 1606, 1607,
+    1566, 1607, 1567, 1567, 1607, 1608, 1567, 1608, 1568, 1568, 1608, 1609,
+    1568, 1609, 1569, 1569, 1609, 1610, 1569, 1610, 1570, 1570, 1610, 1611,
+    1570, 1611, 1571, 1571, 1611, 1612, 1571, 1612, 1572, 1572, 1612, 1613,
+    1572, 1613, 1573, 1573, 1613, 1614, 1573, 1614, 1574, 1574, 1614, 1615,
+    1574, 1615, 1575, 1575, 1615, 1616, 1575, 1616, 1576, 1576, 1616, 1617,
+    1576, 1617, 1577, 1577, 1617, 1618, 1577, 1618, 1578, 1578, 1618, 1619,
+    1578, 1619, 1579, 1579, 1619, 1620, 1579, 1620, 1580, 1580, 1620, 1621,
+    1580, 1621, 1581, 1581, 1621, 1622, 1581, 1622, 1582, 1582, 1622, 1623,
+    1582, 1623, 1583, 1583, 1623, 1624, 1583, 1624, 1584, 1584, 1624, 1625,
+    1584, 1625, 1585, 1585, 1625, 1626, 1585, 1626, 1586, 1586, 1626, 1627,
+    1586, 1627, 1587, 1587, 1627, 1628, 1587, 1628, 1588, 1588, 1628, 1629,
+    1588, 1629, 1589, 1589, 1629, 1630, 1589, 1630, 1590, 1590, 1630, 1631,
+    1590, 1631, 1591, 1591, 1631, 1632, 1591, 1632, 1592, 1592, 1632, 1633,
+    1592, 1633, 1593, 1593, 1633, 1634, 1593, 1634, 1594, 1594, 1634, 1635,
+    1594, 1635, 1595, 1595, 1635, 1636, 1595, 1636, 1596, 1596, 1636, 1637,
+    1596, 1637, 1597, 1597, 1637, 1638, 1597, 1638, 1598, 1598, 1638, 1639,
+    1599, 1640, 1600, 1600, 1641, 1601, 1601, 1642, 1602, 1602, 1643, 1603,
+    1603, 1644, 1604, 1604, 1645, 1605, 1605, 1646, 1606, 1606, 1647, 1607,
+    1607, 1648, 1608, 1608, 1649, 1609, 1609, 1650, 1610, 1610, 1651, 1611,
+    1611, 1652, 1612, 1612, 1653, 1613, 1613, 1654, 1614, 1614, 1655, 1615,
+    1615, 1656, 1616, 1616, 1657, 1617, 1617, 1658, 1618, 1618, 1659, 1619,
+    1619, 1660, 1620, 1620, 1661, 1621, 1621, 1662, 1622, 1622, 1663, 1623,
+    1623, 1664, 1624, 1624, 1665, 1625, 1625, 1666, 1626, 1626, 1667, 1627,
+    1627, 1668, 1628, 1628, 1669, 1629, 1629, 1670, 1630, 1630, 1671, 1631,
+    1631, 1672, 1632, 1632, 1673, 1633, 1633, 1674, 1634, 1634, 1675, 1635,
+    1635, 1676, 1636, 1636, 1677, 1637, 1637, 1678, 1638, 1638, 1679, 1639,
+};
+
+#endif /* INCLUDE_GEOMETRY_BAKED_SPHERE_MESH */
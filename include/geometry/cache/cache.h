@@ -0,0 +1,74 @@
+#ifndef INCLUDE_GEOMETRY_CACHE_CACHE
+#define INCLUDE_GEOMETRY_CACHE_CACHE
+
+#include "utility/mapped_file.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct Shape Shape;
+
+// bumped whenever the layout below or the output of a generator changes, any
+// entry written by another version is ignored
+#define MESH_CACHE_VERSION 3
+#define MESH_CACHE_MAGIC 0x4843534d // "MSCH"
+
+#define MESH_CACHE_DIRECTORY "cache"
+
+// every blob starts on a cache line, the mapping itself is page aligned
+#define MESH_CACHE_ALIGNMENT 64
+
+// offsets are from the start of the file, the blobs hold exactly what the
+// buffers are created with
+typedef struct MeshCacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key;
+    uint64_t fileSize;
+
+    uint64_t vertexDataOffset;
+    uint64_t vertexDataSize;
+    uint64_t indexDataOffset;
+    uint64_t indexDataSize;
+    uint64_t lodsOffset;
+    uint64_t meshletsOffset;
+
+    uint32_t verticesCount;
+    uint32_t indicesCount;
+    uint32_t lodCount;
+    uint32_t meshletsCount;
+
+    uint64_t attributesOffset;
+    uint32_t indexType;
+    uint32_t topology;
+    uint32_t cullMode;
+    uint32_t indexed;
+    uint32_t primitiveRestart;
+
+    float boundingRadius;
+    float min[3];
+    float max[3];
+} MeshCacheHeader;
+
+// a hit keeps the file mapped until its blobs are uploaded
+typedef struct MeshCacheEntry {
+    MappedFile file;
+    const void *vertexData;
+    uint64_t vertexDataSize;
+    const void *indexData;
+    uint64_t indexDataSize;
+} MeshCacheEntry;
+
+#define MESH_CACHE_KEY_SEED 0xcbf29ce484222325ull
+
+uint64_t hashMeshCacheKey(uint64_t, const void *, size_t);
+
+uint64_t hashFileStamp(uint64_t, const char *);
+
+bool openMeshCache(uint64_t, Shape *, MeshCacheEntry *);
+
+void closeMeshCache(MeshCacheEntry *);
+
+void writeMeshCache(uint64_t, const Shape *, const void *, uint64_t,
+                    const void *, uint64_t);
+
+#endif /* INCLUDE_GEOMETRY_CACHE_CACHE */
@@ -1,8 +1,8 @@
 #ifndef INCLUDE_GEOMETRY_CUBE_CUBE
 #define INCLUDE_GEOMETRY_CUBE_CUBE
 
-typedef struct Vulkan Vulkan;
+typedef struct Shape Shape;
 
-void makeCube(Vulkan *);
+void makeCube(Shape *);
 
 #endif /* INCLUDE_GEOMETRY_CUBE_CUBE */
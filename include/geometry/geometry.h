@@ -16,8 +16,49 @@ typedef enum ShapeType {
     CIRCLE,
     PLAIN,
     RING,
+    MESH,
 } ShapeType;
 
+typedef enum ShapeFlagBits {
+    SHAPE_PACKED_VERTICES = 0x00000001,
+    SHAPE_SPLIT_STREAMS = 0x00000002,
+    SHAPE_DEPTH_PREPASS = 0x00000004,
+    SHAPE_OPTIMISE_OVERDRAW = 0x00000008,
+    SHAPE_TRIANGLE_STRIPS = 0x00000010,
+    SHAPE_LOD_CHAIN = 0x00000020,
+    SHAPE_SIMPLIFY_LODS = 0x00000040,
+    SHAPE_MESHLETS = 0x00000080,
+    SHAPE_SMOOTH_NORMALS = 0x00000100, // meshes only, every normal from faces
+    SHAPE_COMPRESS_TEXTURE = 0x00000200, // block compressed on the cpu when
+                                         // the texture isn't already
+    SHAPE_STREAM_TEXTURE = 0x00000400, // drawn with the smallest levels, the
+                                       // finer ones paged in as it grows
+} ShapeFlagBits;
+typedef uint32_t ShapeFlags;
+
+// what generateShape builds a parametric shape with when it has no level of
+// detail chain
+typedef struct ShapeParameters {
+    uint32_t detail[2];
+    float radius;
+} ShapeParameters;
+
+// one shape of a scene built by generateShapes, the mesh file is only read
+// for MESH shapes
+typedef struct ShapeCreateInfo {
+    ShapeType shapeType;
+    const char *meshFileName;
+    const char *textureFileName;
+    ShapeFlags flags;
+} ShapeCreateInfo;
+
+// offset of every blob in the scene's shared staging buffer, a multiple of
+// any texel size
+#define SCENE_STAGING_ALIGNMENT 16
+
+#define SPHERE_RADIUS 0.4f
+#define CIRCLE_RADIUS 2.0f
+
 #define X .525731112119133606
 #define Z .850650808352039932
 
@@ -67,6 +108,14 @@ typedef struct Vertex {
     vec2 texCoord;
 } Vertex;
 
+// 20 byte alternative to Vertex, selected per shape with SHAPE_PACKED_VERTICES
+typedef struct PackedVertex {
+    uint16_t pos[4];      // half float xyz, w = 1
+    int16_t normal[2];    // octahedral encoded snorm16
+    uint16_t texCoord[2]; // unorm16
+    uint8_t colour[4];    // unorm8 rgba
+} PackedVertex;
+
 typedef Vertex Plane[4];
 typedef Vertex Triangle[3];
 typedef Triangle **Sphere;
@@ -91,17 +140,42 @@ typedef struct ShapeBuffers {
     VkDeviceMemory *indexBufferMemory;
 } ShapeBuffers;
 
+typedef struct ShapeLod ShapeLod;
+typedef struct Meshlet Meshlet;
+typedef struct MeshStream MeshStream;
+
 typedef struct Shape {
     Vertex *vertices;
     uint32_t verticesCount;
 
-    uint16_t *indices;
-    uint16_t indicesCount;
+    uint32_t *indices;
+    uint32_t indicesCount;
+    // narrowed to 16 bit at upload whenever the vertex count allows it
+    VkIndexType indexType;
 
     uint32_t index;
 
     bool indexed;
 
+    // start of the attribute stream when positions are stored separately
+    uint64_t attributesOffset;
+
+    // levels packed back to back in the buffers, finest first
+    ShapeLod *lods;
+    uint32_t lodCount;
+    float boundingRadius;
+    // every level's clusters, each level owning a run of them
+    Meshlet *meshlets;
+    uint32_t meshletsCount;
+    // per swapchain image draws of the level picked for the frame, one per
+    // meshlet that survived culling
+    uint32_t drawsCount;
+    uint32_t visibleDraws; // how many survived for the latest frame
+    VkBuffer *indirectBuffers;
+    VkDeviceMemory *indirectBuffersMemory;
+    // set when the buffers are a pool of chunks paged in from disk
+    MeshStream *stream;
+
     GraphicsPipeline graphicsPipeline;
     DescriptorSet descriptorSet;
     Texture texture;
@@ -117,7 +191,18 @@ typedef uint32_t VkFlags;
 typedef VkFlags VkBufferUsageFlags;
 typedef VkFlags VkMemoryPropertyFlags;
 
-void generateShape(Vulkan *, ShapeType, const char *);
+extern const ShapeParameters shapeParameters[MESH];
+
+void generateShapes(Vulkan *, const ShapeCreateInfo *, uint32_t);
+
+void generateShape(Vulkan *, ShapeType, const char *, ShapeFlags);
+
+void makeDefaultShape(Shape *, ShapeType);
+
+void generateMesh(Vulkan *, const char *, const char *, ShapeFlags);
+
+void generateStreamedMesh(Vulkan *, const char *, const char *, VkDeviceSize,
+                          ShapeFlags);
 
 void createBuffer(VkDeviceSize, VkBufferUsageFlags, VkMemoryPropertyFlags,
                   Vulkan *, VkBuffer *, VkDeviceMemory *);
@@ -133,9 +218,11 @@ typedef struct VkVertexInputBindingDescription VkVertexInputBindingDescription;
 typedef struct VkVertexInputAttributeDescription
     VkVertexInputAttributeDescription;
 
-VkVertexInputBindingDescription getBindingDescription();
+VkVertexInputBindingDescription *
+getBindingDescriptions(const GraphicsPipeline *, bool, uint32_t *);
 
-VkVertexInputAttributeDescription *getAttributeDescriptions();
+VkVertexInputAttributeDescription *
+getAttributeDescriptions(const GraphicsPipeline *, bool, uint32_t *);
 
 void createBufferAndMemory(Vulkan *, VkBuffer *, VkDeviceMemory *, Vertex *,
                            uint16_t);
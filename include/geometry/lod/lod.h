@@ -0,0 +1,60 @@
+#ifndef INCLUDE_GEOMETRY_LOD_LOD
+#define INCLUDE_GEOMETRY_LOD_LOD
+
+#include <stdint.h>
+
+typedef struct Vulkan Vulkan;
+typedef struct Shape Shape;
+typedef struct UniformBufferObject UniformBufferObject;
+typedef enum ShapeType ShapeType;
+typedef uint32_t ShapeFlags;
+
+// segments of the coarsest and finest sphere and circle, doubling between
+#define LOD_MIN_SEGMENTS 8
+#define LOD_MAX_SEGMENTS 256
+
+// subdivisions of the finest icosphere and octasphere
+#define LOD_MAX_SUBDIVISIONS 4
+
+#define LOD_MAX_LEVELS 8
+
+// simplified levels stop before going under this many triangles
+#define LOD_MIN_TRIANGLES 32
+
+// a simplified level is dropped unless it has at most this fraction of the
+// previous level's triangles
+#define LOD_MIN_REDUCTION 0.85f
+
+// largest on screen deviation from the true surface a level may have
+#define LOD_PIXEL_ERROR 1.0f
+
+// one level of detail, all levels share the shape's buffers
+typedef struct ShapeLod {
+    uint32_t firstIndex;
+    uint32_t indicesCount;
+    int32_t vertexOffset;
+    float error; // furthest the level strays from the surface, object space
+    uint32_t firstMeshlet;
+    uint32_t meshletsCount;
+} ShapeLod;
+
+void makeLodChain(Shape *, ShapeType, ShapeFlags);
+
+void makeSimplifiedLodChain(Shape *, ShapeFlags);
+
+void makeSingleLod(Shape *);
+
+float shapeBoundingRadius(const Shape *);
+
+float projectedPixelsPerUnit(const UniformBufferObject *, const float *, float,
+                             float);
+
+uint32_t selectLod(const Shape *, const UniformBufferObject *, float);
+
+void createIndirectBuffers(Vulkan *, Shape *);
+
+void updateIndirectBuffer(Vulkan *, Shape *, uint32_t);
+
+void destroyIndirectBuffers(Vulkan *, Shape *);
+
+#endif /* INCLUDE_GEOMETRY_LOD_LOD */
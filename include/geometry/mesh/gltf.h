@@ -0,0 +1,9 @@
+#ifndef INCLUDE_GEOMETRY_MESH_GLTF
+#define INCLUDE_GEOMETRY_MESH_GLTF
+
+typedef struct Shape Shape;
+typedef struct MappedFile MappedFile;
+
+void loadGltf(Shape *, const char *, const MappedFile *);
+
+#endif /* INCLUDE_GEOMETRY_MESH_GLTF */
@@ -0,0 +1,34 @@
+#ifndef INCLUDE_GEOMETRY_MESH_JSON
+#define INCLUDE_GEOMETRY_MESH_JSON
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef enum JsonType {
+    JSON_OBJECT,
+    JSON_ARRAY,
+    JSON_STRING, // start and end exclude the quotes, escapes are kept
+    JSON_PRIMITIVE, // numbers, true, false and null
+} JsonType;
+
+// Tokens are stored depth first, an object's children alternate key and
+// value. next is the index just past the token's subtree.
+typedef struct JsonToken {
+    JsonType type;
+    const char *start;
+    const char *end;
+    uint32_t size; // members of an object, elements of an array
+    uint32_t next;
+} JsonToken;
+
+uint32_t parseJson(JsonToken **, const char *, const char *);
+
+int32_t jsonFind(const JsonToken *, int32_t, const char *);
+
+int32_t jsonElement(const JsonToken *, int32_t, uint32_t);
+
+bool jsonEquals(const JsonToken *, const char *);
+
+int64_t jsonInt(const JsonToken *, int32_t, int64_t);
+
+#endif /* INCLUDE_GEOMETRY_MESH_JSON */
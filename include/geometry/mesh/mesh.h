@@ -0,0 +1,17 @@
+#ifndef INCLUDE_GEOMETRY_MESH_MESH
+#define INCLUDE_GEOMETRY_MESH_MESH
+
+typedef unsigned int uint32_t;
+typedef unsigned long size_t;
+typedef struct Shape Shape;
+
+// initial room in the loaders' growing arrays
+#define MESH_INITIAL_CAPACITY 1024
+
+void loadMesh(Shape *, const char *);
+
+void *growArray(void *, uint32_t *, uint32_t, size_t);
+
+void generateMissingNormals(Shape *);
+
+#endif /* INCLUDE_GEOMETRY_MESH_MESH */
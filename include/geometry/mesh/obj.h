@@ -0,0 +1,9 @@
+#ifndef INCLUDE_GEOMETRY_MESH_OBJ
+#define INCLUDE_GEOMETRY_MESH_OBJ
+
+typedef struct Shape Shape;
+typedef struct MappedFile MappedFile;
+
+void loadObj(Shape *, const MappedFile *);
+
+#endif /* INCLUDE_GEOMETRY_MESH_OBJ */
@@ -0,0 +1,21 @@
+#ifndef INCLUDE_GEOMETRY_MESH_PARSE
+#define INCLUDE_GEOMETRY_MESH_PARSE
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Locale independent scanning over mapped text, every function advances the
+// cursor past what it consumed and never reads at or beyond the end. Numbers
+// have to start at the cursor, the caller skips whatever separates them.
+
+void skipSpaces(const char **, const char *);
+
+void skipWhitespace(const char **, const char *);
+
+void skipLine(const char **, const char *);
+
+bool parseFloat(const char **, const char *, float *);
+
+bool parseInt(const char **, const char *, int64_t *);
+
+#endif /* INCLUDE_GEOMETRY_MESH_PARSE */
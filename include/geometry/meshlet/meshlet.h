@@ -0,0 +1,32 @@
+#ifndef INCLUDE_GEOMETRY_MESHLET_MESHLET
+#define INCLUDE_GEOMETRY_MESHLET_MESHLET
+
+typedef unsigned int uint32_t;
+typedef int int32_t;
+typedef struct Shape Shape;
+typedef struct Vertex Vertex;
+typedef struct UniformBufferObject UniformBufferObject;
+typedef struct VkDrawIndexedIndirectCommand VkDrawIndexedIndirectCommand;
+
+// small enough for a mesh shader workgroup to own a whole meshlet
+#define MESHLET_MAX_VERTICES 64
+#define MESHLET_MAX_TRIANGLES 124
+
+// a run of the shape's indices drawn as one indirect command, culled as a
+// whole against the camera
+typedef struct Meshlet {
+    float sphere[4]; // xyz centre, w radius, object space
+    float cone[4];   // xyz mean normal, w sine of the cone's half angle
+    uint32_t firstIndex;
+    uint32_t indicesCount;
+} Meshlet;
+
+uint32_t buildMeshlets(Meshlet **, uint32_t *, uint32_t, const Vertex *,
+                       uint32_t);
+
+void buildShapeMeshlets(Shape *);
+
+uint32_t cullMeshlets(VkDrawIndexedIndirectCommand *, const Meshlet *,
+                      uint32_t, int32_t, const UniformBufferObject *);
+
+#endif /* INCLUDE_GEOMETRY_MESHLET_MESHLET */
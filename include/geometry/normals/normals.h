@@ -0,0 +1,20 @@
+#ifndef INCLUDE_GEOMETRY_NORMALS_NORMALS
+#define INCLUDE_GEOMETRY_NORMALS_NORMALS
+
+#include <stdbool.h>
+
+typedef unsigned int uint32_t;
+typedef struct Shape Shape;
+
+// triangles and vertices per job of the normal passes
+#define NORMALS_GRAIN 16384
+
+typedef enum NormalWeighting {
+    NORMALS_AREA_WEIGHTED,  // larger faces pull harder, the cheapest
+    NORMALS_ANGLE_WEIGHTED, // by the angle at the vertex, so how the surface
+                            // is split into triangles does not matter
+} NormalWeighting;
+
+void generateNormals(Shape *, NormalWeighting, const bool *);
+
+#endif /* INCLUDE_GEOMETRY_NORMALS_NORMALS */
@@ -0,0 +1,27 @@
+#ifndef INCLUDE_GEOMETRY_OPTIMISE_OPTIMISE
+#define INCLUDE_GEOMETRY_OPTIMISE_OPTIMISE
+
+typedef unsigned int uint32_t;
+typedef struct Shape Shape;
+typedef uint32_t ShapeFlags;
+
+// fifo size used when simulating the post transform cache
+#define VERTEX_CACHE_SIZE 16
+
+typedef struct VertexCacheStats {
+    float acmr; // transformed vertices per triangle, 0.5 is the ideal
+    float atvr; // transformed vertices per unique vertex, 1.0 is the ideal
+} VertexCacheStats;
+
+VertexCacheStats analyseVertexCache(const uint32_t *, uint32_t, uint32_t,
+                                    uint32_t);
+
+void optimiseVertexCache(uint32_t *, uint32_t, uint32_t);
+
+void optimiseVertexFetch(Shape *);
+
+void stripShape(Shape *);
+
+void optimiseShape(Shape *, ShapeFlags);
+
+#endif /* INCLUDE_GEOMETRY_OPTIMISE_OPTIMISE */
@@ -0,0 +1,25 @@
+#ifndef INCLUDE_GEOMETRY_OPTIMISE_OVERDRAW
+#define INCLUDE_GEOMETRY_OPTIMISE_OVERDRAW
+
+typedef unsigned int uint32_t;
+typedef struct Vertex Vertex;
+
+// how much worse than the whole cluster's acmr a sub cluster may be, higher
+// values give smaller clusters and a better overdraw order
+#define OVERDRAW_THRESHOLD 1.05f
+
+// resolution of each view rasterised by the overdraw estimator
+#define OVERDRAW_VIEWPORT 256
+
+typedef struct OverdrawStats {
+    uint32_t covered; // pixels with at least one fragment
+    uint32_t shaded;  // fragments that passed the depth test
+    float overdraw;   // shaded / covered, 1.0 is the ideal
+} OverdrawStats;
+
+OverdrawStats analyseOverdraw(const uint32_t *, uint32_t, const Vertex *,
+                              uint32_t);
+
+void optimiseOverdraw(uint32_t *, uint32_t, const Vertex *, uint32_t, float);
+
+#endif /* INCLUDE_GEOMETRY_OPTIMISE_OVERDRAW */
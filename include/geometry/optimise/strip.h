@@ -0,0 +1,16 @@
+#ifndef INCLUDE_GEOMETRY_OPTIMISE_STRIP
+#define INCLUDE_GEOMETRY_OPTIMISE_STRIP
+
+typedef unsigned int uint32_t;
+
+// stored in the 32 bit index array, narrowed to 0xffff with the indices
+#define STRIP_RESTART_INDEX 0xffffffffu
+
+// worst case is every triangle on its own followed by a restart
+#define STRIP_BOUND(indicesCount) ((indicesCount) / 3 * 4)
+
+uint32_t stripify(uint32_t *, const uint32_t *, uint32_t, uint32_t);
+
+uint32_t unstripify(uint32_t *, const uint32_t *, uint32_t);
+
+#endif /* INCLUDE_GEOMETRY_OPTIMISE_STRIP */
@@ -0,0 +1,13 @@
+#ifndef INCLUDE_GEOMETRY_PACKING_PACKING
+#define INCLUDE_GEOMETRY_PACKING_PACKING
+
+typedef unsigned int uint32_t;
+typedef unsigned short uint16_t;
+typedef struct Vertex Vertex;
+typedef struct PackedVertex PackedVertex;
+
+uint16_t floatToHalf(float);
+
+PackedVertex *packVertices(const Vertex *, uint32_t);
+
+#endif /* INCLUDE_GEOMETRY_PACKING_PACKING */
@@ -5,11 +5,11 @@
 
 typedef unsigned long size_t;
 
-typedef struct Vulkan Vulkan;
+typedef struct Shape Shape;
 typedef struct Vertex Vertex;
 
 typedef enum ShapeType ShapeTye;
 
-void makeTriSphere(Vulkan *, ShapeType, size_t);
+void makeTriSphere(Shape *, ShapeType, size_t);
 
 #endif /* INCLUDE_GEOMETRY_SHPERE_TRISPHERE */
@@ -0,0 +1,25 @@
+#ifndef INCLUDE_GEOMETRY_SIMPLIFY_SIMPLIFY
+#define INCLUDE_GEOMETRY_SIMPLIFY_SIMPLIFY
+
+typedef unsigned int uint32_t;
+typedef struct Vertex Vertex;
+
+// collapses that would turn a triangle further than this (cosine) are
+// rejected, 0 only stops outright flips
+#define SIMPLIFY_FLIP_THRESHOLD 0.25f
+
+// how much more open edges resist moving than the surface around them
+#define SIMPLIFY_BORDER_WEIGHT 10.0f
+
+typedef enum VertexKind {
+    VERTEX_MANIFOLD, // interior, collapses anywhere
+    VERTEX_BORDER,   // on an open edge, only collapses along it
+    VERTEX_SEAM,     // position shared by two vertices with different
+                     // attributes, both collapse together along the seam
+    VERTEX_LOCKED,   // anything more complex, never moves
+} VertexKind;
+
+uint32_t simplify(uint32_t *, const uint32_t *, uint32_t, const Vertex *,
+                  uint32_t, uint32_t, float, float *);
+
+#endif /* INCLUDE_GEOMETRY_SIMPLIFY_SIMPLIFY */
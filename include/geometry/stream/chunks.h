@@ -0,0 +1,54 @@
+#ifndef INCLUDE_GEOMETRY_STREAM_CHUNKS
+#define INCLUDE_GEOMETRY_STREAM_CHUNKS
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct Shape Shape;
+
+#define CHUNK_FILE_MAGIC 0x4b4e4843 // "CHNK"
+#define CHUNK_FILE_VERSION 1
+
+// limits of a chunk's finest level, which is what sizes a slot of the stream
+// pool, so every level of every chunk fits any slot
+#define CHUNK_MAX_TRIANGLES 8192
+#define CHUNK_MAX_VERTICES 8192
+#define CHUNK_MAX_INDICES (CHUNK_MAX_TRIANGLES * 3)
+
+#define CHUNK_MAX_LEVELS 4
+
+// every level's blob starts on a cache line
+#define CHUNK_ALIGNMENT 64
+
+// a level's blob is its vertices followed by its 16 bit indices, local to the
+// level's vertices
+typedef struct ChunkLevel {
+    uint64_t offset;
+    uint32_t verticesCount;
+    uint32_t indicesCount;
+    float error; // furthest the level strays from the chunk, object space
+    uint32_t reserved;
+} ChunkLevel;
+
+typedef struct ChunkRecord {
+    float sphere[4]; // xyz centre, w radius, object space
+    uint32_t levelsCount;
+    uint32_t reserved;
+    ChunkLevel levels[CHUNK_MAX_LEVELS]; // finest first
+} ChunkRecord;
+
+// the header is followed by the level blobs, then the table of chunks
+typedef struct ChunkFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t chunksCount;
+    uint32_t levelsCount;
+    uint64_t chunksOffset;
+    float boundingRadius;
+    float levelErrors[CHUNK_MAX_LEVELS]; // largest over every chunk
+    uint32_t reserved;
+} ChunkFileHeader;
+
+bool writeChunkedMesh(const Shape *, const char *);
+
+#endif /* INCLUDE_GEOMETRY_STREAM_CHUNKS */
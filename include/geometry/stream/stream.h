@@ -0,0 +1,76 @@
+#ifndef INCLUDE_GEOMETRY_STREAM_STREAM
+#define INCLUDE_GEOMETRY_STREAM_STREAM
+
+#include "geometry/stream/chunks.h"
+#include "utility/job.h"
+#include "utility/mapped_file.h"
+#include <SDL_atomic.h>
+#include <vulkan/vulkan.h>
+
+// uploads in flight at once, each with its own slot sized staging region
+#define STREAM_STAGING_SLOTS 4
+
+// device memory the pool may use when the caller passes 0
+#define STREAM_DEFAULT_BUDGET (256ull << 20)
+
+#define STREAM_SLOT_VERTICES_SIZE (CHUNK_MAX_VERTICES * sizeof(Vertex))
+#define STREAM_SLOT_INDICES_SIZE (CHUNK_MAX_INDICES * sizeof(uint16_t))
+#define STREAM_SLOT_SIZE (STREAM_SLOT_VERTICES_SIZE + STREAM_SLOT_INDICES_SIZE)
+
+typedef enum StreamStagingState {
+    STREAM_STAGING_FREE,
+    STREAM_STAGING_REQUESTED, // waiting for its load job
+    STREAM_STAGING_LOADED,    // in staging, waiting for the render thread
+    STREAM_STAGING_UPLOADING, // copy submitted, waiting for its fence
+} StreamStagingState;
+
+typedef struct MeshStream MeshStream;
+
+typedef struct StreamStaging {
+    MeshStream *stream; // for the load job
+    SDL_atomic_t state;
+    uint32_t chunk;
+    uint32_t level;
+    uint32_t slot;
+    unsigned char *data; // inside the persistently mapped staging buffer
+    VkCommandBuffer commandBuffer;
+    VkFence fence;
+} StreamStaging;
+
+// A chunked mesh paged into a fixed pool of slots, each holding one chunk at
+// one level. The render thread decides what should be resident and records
+// the uploads, load jobs only copy from the file into staging, so the render
+// thread never waits on the disk.
+typedef struct MeshStream {
+    MappedFile file;
+    const ChunkFileHeader *header;
+    const ChunkRecord *chunks;
+
+    uint32_t slotsCount;
+    uint32_t *slotChunks;   // resident chunk per slot, UINT32_MAX when empty
+    uint32_t *slotLevels;   // level the slot holds
+    bool *slotReserved;     // being refilled, never drawn
+    uint32_t *chunkSlots;   // slot per chunk, UINT32_MAX when not resident
+    bool *chunkPending;     // a request for the chunk is in flight
+    float *priorities;      // projected size this frame
+    uint32_t *desiredLevels;
+    uint32_t *candidates;
+
+    VkCommandPool commandPool;
+    VkBuffer stagingBuffer;
+    VkDeviceMemory stagingBufferMemory;
+    StreamStaging staging[STREAM_STAGING_SLOTS];
+
+    JobCounter loads;
+} MeshStream;
+
+typedef struct Vulkan Vulkan;
+typedef struct Shape Shape;
+
+void openMeshStream(Vulkan *, Shape *, const char *, VkDeviceSize, uint32_t);
+
+void updateMeshStream(Vulkan *, Shape *, uint32_t);
+
+void closeMeshStream(Vulkan *, Shape *);
+
+#endif /* INCLUDE_GEOMETRY_STREAM_STREAM */
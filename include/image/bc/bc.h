@@ -0,0 +1,13 @@
+#ifndef INCLUDE_IMAGE_BC_BC
+#define INCLUDE_IMAGE_BC_BC
+
+#include <stdint.h>
+
+typedef struct ImageFormat ImageFormat;
+
+// one level of bc1, bc3 or bc7 blocks decoded to tightly packed rgba8, width
+// * height * 4 bytes
+void decodeBcImage(const ImageFormat *, const unsigned char *, uint32_t,
+                   uint32_t, unsigned char *);
+
+#endif /* INCLUDE_IMAGE_BC_BC */
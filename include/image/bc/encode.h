@@ -0,0 +1,17 @@
+#ifndef INCLUDE_IMAGE_BC_ENCODE
+#define INCLUDE_IMAGE_BC_ENCODE
+
+#include <stdint.h>
+
+typedef struct ImageFormat ImageFormat;
+
+// block rows per job of the encoders
+#define BC_ENCODE_GRAIN 8
+
+// One level of tightly packed rgba8 as bc1, bc3 or bc7 blocks,
+// imageLevelSize bytes of them, a job per few block rows. Bc1 drops alpha.
+// Vectorised with sse2, or avx2 when built for it, to the same output.
+void encodeBcImage(const ImageFormat *, const unsigned char *, uint32_t,
+                   uint32_t, unsigned char *);
+
+#endif /* INCLUDE_IMAGE_BC_ENCODE */
@@ -0,0 +1,33 @@
+#ifndef INCLUDE_IMAGE_FORMAT_FORMAT
+#define INCLUDE_IMAGE_FORMAT_FORMAT
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <vulkan/vulkan.h>
+
+// how a format lays texels out, plain formats in blocks of one texel
+typedef struct ImageFormat {
+    VkFormat format;
+    uint8_t blockWidth;
+    uint8_t blockHeight;
+    uint8_t blockBytes;
+    bool srgb;
+    bool bc; // decodable on the cpu when the device can't sample it
+} ImageFormat;
+
+// NULL for formats a texture can't be loaded in
+const ImageFormat *findImageFormat(VkFormat);
+
+// rgba8 in the same colour space, what a block format decodes to
+VkFormat decodedImageFormat(const ImageFormat *);
+
+VkDeviceSize imageLevelSize(const ImageFormat *, uint32_t, uint32_t);
+
+// every level down to 1x1
+uint32_t fullMipLevels(uint32_t, uint32_t);
+
+static inline uint32_t mipExtent(uint32_t extent, uint32_t level) {
+    return extent >> level ? extent >> level : 1;
+}
+
+#endif /* INCLUDE_IMAGE_FORMAT_FORMAT */
@@ -0,0 +1,32 @@
+#ifndef INCLUDE_IMAGE_KTX_KTX
+#define INCLUDE_IMAGE_KTX_KTX
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <vulkan/vulkan.h>
+
+// levels a texture can have, enough for 32k
+#define KTX2_MAX_LEVELS 16
+
+typedef struct MappedFile MappedFile;
+
+// the 2d image of a ktx2 file, its levels pointing into the file
+typedef struct Ktx2Image {
+    VkFormat format;
+    uint32_t width;
+    uint32_t height;
+    uint32_t levelsCount; // at least 1, the file's own levels
+    bool generateMips;    // the file leaves the rest of the chain to us
+    const unsigned char *levels[KTX2_MAX_LEVELS];
+    VkDeviceSize levelSizes[KTX2_MAX_LEVELS];
+} Ktx2Image;
+
+bool isKtx2(const MappedFile *);
+
+void readKtx2(const MappedFile *, Ktx2Image *);
+
+// the image's levels as a whole ktx2 file in memory, for the caller to free
+unsigned char *writeKtx2(const Ktx2Image *, size_t *);
+
+#endif /* INCLUDE_IMAGE_KTX_KTX */
@@ -0,0 +1,35 @@
+#ifndef INCLUDE_IMAGE_MIP_MIP
+#define INCLUDE_IMAGE_MIP_MIP
+
+#include "image/ktx/ktx.h"
+#include <stdint.h>
+
+// lobes either side of the lanczos kernel each level is filtered with
+#define MIP_LANCZOS_RADIUS 2
+
+// the alpha an alpha test compares against, what coverage is measured at
+#define MIP_ALPHA_REFERENCE 0.5f
+
+// rows per job of the filter passes
+#define MIP_GRAIN 16
+
+typedef enum MipFlags {
+    MIP_SRGB = 0x1,              // colour is srgb encoded, filtered linear
+    MIP_PRESERVE_COVERAGE = 0x2, // alpha scaled so every level keeps the
+                                 // coverage of level 0 at the reference
+} MipFlags;
+
+// every level down to 1x1 as tightly packed rgba8, level 0 the source's copy
+typedef struct MipChain {
+    uint32_t levelsCount;
+    uint32_t widths[KTX2_MAX_LEVELS];
+    uint32_t heights[KTX2_MAX_LEVELS];
+    unsigned char *levels[KTX2_MAX_LEVELS];
+} MipChain;
+
+void generateMipChain(const unsigned char *, uint32_t, uint32_t, MipFlags,
+                      MipChain *);
+
+void freeMipChain(MipChain *);
+
+#endif /* INCLUDE_IMAGE_MIP_MIP */
@@ -0,0 +1,50 @@
+#ifndef INCLUDE_IMAGE_PACKAGE_PACKAGE
+#define INCLUDE_IMAGE_PACKAGE_PACKAGE
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct MappedFile MappedFile;
+
+#define TEXTURE_PACKAGE_MAGIC 0x4b415054 // "TPAK"
+#define TEXTURE_PACKAGE_VERSION 1
+
+// looked for next to the textures it stands in for
+#define TEXTURE_PACKAGE_NAME "textures.pak"
+
+// every texture starts on a page of the mapping
+#define TEXTURE_PACKAGE_ALIGNMENT 4096
+
+#define TEXTURE_PACKAGE_MAX_NAME 64
+
+// the header is followed by the entries, then the textures as ktx2 files
+typedef struct TexturePackageHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t texturesCount;
+    uint32_t reserved;
+} TexturePackageHeader;
+
+typedef struct TexturePackageEntry {
+    char name[TEXTURE_PACKAGE_MAX_NAME]; // the source's file name, no path
+    uint64_t stamp; // of the source when cooked, see textureSourceStamp
+    uint64_t offset;
+    uint64_t size;
+} TexturePackageEntry;
+
+// one texture to write, already a whole ktx2 file
+typedef struct PackagedTexture {
+    const char *name;
+    uint64_t stamp;
+    const unsigned char *data;
+    size_t size;
+} PackagedTexture;
+
+uint64_t textureSourceStamp(const char *);
+
+bool findPackagedTexture(const char *, MappedFile *, MappedFile *);
+
+bool writeTexturePackage(const char *, const PackagedTexture *, uint32_t);
+
+#endif /* INCLUDE_IMAGE_PACKAGE_PACKAGE */
@@ -13,4 +13,10 @@
 #include "light_texture/light_texture_frag_shader.h"
 #include "light_texture/light_texture_vert_shader.h"
 
+#include "light_texture_bindless/light_texture_bindless_frag_shader.h"
+
+#include "light_texture_packed/light_texture_packed_vert_shader.h"
+
+#include "depth/depth_vert_shader.h"
+
 #endif /* INCLUDE_SHADERS_SHADER */
@@ -0,0 +1,55 @@
+#ifndef INCLUDE_UTILITY_JOB
+#define INCLUDE_UTILITY_JOB
+
+#include <SDL_atomic.h>
+#include <stdint.h>
+
+// jobs each thread can queue before it runs further ones itself, a power of
+// two
+#define JOB_QUEUE_CAPACITY 4096
+
+typedef void (*JobFunction)(void *);
+
+// the range [first, last) of a parallelFor
+typedef void (*ParallelForFunction)(void *, uint32_t, uint32_t);
+
+typedef struct Job {
+    JobFunction function;
+    void *data;
+} Job;
+
+typedef struct JobBatch JobBatch;
+
+// Jobs still to finish, zero initialised before first use. A counter can be
+// reused once it has been waited on.
+typedef struct JobCounter {
+    SDL_atomic_t count; // -1 while the last job releases what waits on it
+    SDL_SpinLock lock;
+    JobBatch *waiting; // run by whichever job brings the count to zero
+} JobCounter;
+
+typedef enum JobSystemFlags {
+    JOB_SYSTEM_PIN_THREADS = 0x1, // one worker per core, where supported
+} JobSystemFlags;
+
+// 0 workers starts one per core besides the calling thread, which becomes
+// the only thread outside the pool allowed to run jobs
+void startJobSystem(uint32_t, JobSystemFlags);
+
+void stopJobSystem(void);
+
+uint32_t jobWorkersCount(void);
+
+// without a running job system the jobs run before the call returns
+void runJobs(const Job *, uint32_t, JobCounter *);
+
+void runJobsAfter(JobCounter *, const Job *, uint32_t, JobCounter *);
+
+// runs other jobs until the counter reaches zero
+void waitForJobs(JobCounter *);
+
+// splits [0, count) into ranges of at least the grain, a job each, and waits
+// for them
+void parallelFor(uint32_t, uint32_t, ParallelForFunction, void *);
+
+#endif /* INCLUDE_UTILITY_JOB */
@@ -0,0 +1,26 @@
+#ifndef INCLUDE_UTILITY_MAPPED_FILE
+#define INCLUDE_UTILITY_MAPPED_FILE
+
+#include <stdbool.h>
+
+typedef unsigned long size_t;
+
+// read only view of a whole file, paged in by the os as it is touched
+typedef struct MappedFile {
+    const char *data;
+    size_t size;
+    void *mapping; // file mapping handle, only used on windows
+} MappedFile;
+
+// how the mapping will be read, which decides how far the os reads ahead
+typedef enum MappedFileAccess {
+    MAPPED_FILE_SEQUENTIAL, // front to back, read ahead as far as possible
+    MAPPED_FILE_RANDOM,     // scattered reads of a file that may not fit in
+                            // memory, only the touched pages are read
+} MappedFileAccess;
+
+bool mapFile(const char *, MappedFileAccess, MappedFile *);
+
+void unmapFile(MappedFile *);
+
+#endif /* INCLUDE_UTILITY_MAPPED_FILE */
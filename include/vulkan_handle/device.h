@@ -1,6 +1,8 @@
 #ifndef INCLUDE_VULKAN_HANDLE_DEVICE
 #define INCLUDE_VULKAN_HANDLE_DEVICE
 
+#include <stdbool.h>
+
 typedef struct VkPhysicalDevice_T *VkPhysicalDevice;
 typedef struct VkDevice_T *VkDevice;
 typedef struct VkQueue_T *VkQueue;
@@ -11,6 +13,19 @@ typedef struct Device {
 
     VkQueue graphicsQueue;
     VkQueue presentQueue;
+    // uploads run here alongside rendering, VK_NULL_HANDLE when the device
+    // has no separate transfer family or no timeline semaphores
+    VkQueue transferQueue;
+
+    // one indirect call can issue every meshlet's draw
+    bool multiDrawIndirect;
+    // every texture sampled from one descriptor array, indexed per draw
+    bool bindless;
+    // the heaps' budgets can be asked for, texture streams fit under them
+    bool memoryBudget;
+    // images may take usages only their views' formats support, so srgb
+    // textures can be written through unorm storage views
+    bool extendedUsage;
 } Device;
 
 typedef unsigned int uint32_t;
@@ -18,8 +33,11 @@ typedef unsigned int uint32_t;
 typedef struct QueueFamilyIndices {
     uint32_t graphicsFamily;
     uint32_t presentFamily;
+    uint32_t transferFamily; // without graphics, MAX_FAMILY when there is none
 } QueueFamilyIndices;
 
+#define MAX_FAMILY 1000
+
 typedef struct VkSurfaceKHR_T *VkSurfaceKHR;
 
 QueueFamilyIndices findQueueFamilies(VkPhysicalDevice, VkSurfaceKHR);
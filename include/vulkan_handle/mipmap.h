@@ -0,0 +1,64 @@
+#ifndef INCLUDE_VULKAN_HANDLE_MIPMAP
+#define INCLUDE_VULKAN_HANDLE_MIPMAP
+
+#include <stdint.h>
+
+// levels one dispatch generates below the first, the shader's bindings
+#define MIP_COMPUTE_MAX_LEVELS 12
+// the largest side whose level 6 a single group reduces the rest of
+#define MIP_COMPUTE_MAX_SIZE 4096
+// dispatches recorded between two releases of their scratch
+#define MIP_COMPUTE_MAX_DISPATCHES 32
+
+typedef struct VkDescriptorSetLayout_T *VkDescriptorSetLayout;
+typedef struct VkPipelineLayout_T *VkPipelineLayout;
+typedef struct VkPipeline_T *VkPipeline;
+typedef struct VkDescriptorPool_T *VkDescriptorPool;
+typedef struct VkBuffer_T *VkBuffer;
+typedef struct VkDeviceMemory_T *VkDeviceMemory;
+typedef struct VkImageView_T *VkImageView;
+typedef struct VkCommandBuffer_T *VkCommandBuffer;
+typedef uint64_t VkDeviceSize;
+typedef enum VkFormat VkFormat;
+
+// How the levels a texture doesn't store are filled in: a compute dispatch
+// when the device writes rgba8 storage images, the blit chain when it can
+// blit the format, and the cpu filter, before upload, when it can do neither.
+typedef enum MipGeneration {
+    MIP_GENERATION_NONE, // every level is stored, or only those are sampled
+    MIP_GENERATION_COMPUTE,
+    MIP_GENERATION_BLIT,
+    MIP_GENERATION_CPU,
+} MipGeneration;
+
+// The compute downsampler, with the views, descriptor sets and counters its
+// dispatches use until the submission they were recorded into has finished.
+typedef struct MipGenerator {
+    VkDescriptorSetLayout descriptorSetLayout;
+    VkPipelineLayout pipelineLayout;
+    VkPipeline pipeline; // null when the graphics queue can't dispatch
+    VkDescriptorPool descriptorPool;
+
+    VkBuffer counterBuffer; // a slot per dispatch, for its last group
+    VkDeviceMemory counterBufferMemory;
+    VkDeviceSize counterStride;
+
+    uint32_t dispatchesCount;
+    VkImageView views[MIP_COMPUTE_MAX_DISPATCHES][MIP_COMPUTE_MAX_LEVELS + 1];
+} MipGenerator;
+
+typedef struct Vulkan Vulkan;
+typedef struct Texture Texture;
+
+void createMipGenerator(Vulkan *);
+
+void destroyMipGenerator(Vulkan *);
+
+MipGeneration chooseMipGeneration(Vulkan *, VkFormat, uint32_t, uint32_t);
+
+void recordMipGeneration(Vulkan *, VkCommandBuffer, const Texture *, uint32_t,
+                         uint32_t);
+
+void releaseMipScratch(Vulkan *);
+
+#endif /* INCLUDE_VULKAN_HANDLE_MIPMAP */
@@ -1,6 +1,7 @@
 #ifndef INCLUDE_VULKAN_HANDLE_PIPELINE
 #define INCLUDE_VULKAN_HANDLE_PIPELINE
 
+#include <stdbool.h>
 #include <vulkan/vulkan.h>
 
 typedef struct VkPipelineLayout_T *VkPipelineLayout;
@@ -8,11 +9,21 @@ typedef struct VkPipeline_T *VkPipeline;
 typedef struct VkRenderPass_T *VkRenderPass;
 typedef struct VkDescriptorSetLayout_T *VkDescriptorSetLayout;
 
+typedef enum VertexFormat {
+    VERTEX_FORMAT_FLOAT,
+    VERTEX_FORMAT_PACKED,
+} VertexFormat;
+
 typedef struct GraphicsPipeline {
     VkPipelineLayout pipelineLayout;
     VkPipeline graphicsPipeline;
+    VkPipeline depthPipeline;
     VkPrimitiveTopology topology;
+    bool primitiveRestart;
     VkCullModeFlagBits cullMode;
+    VertexFormat vertexFormat;
+    bool splitStreams;
+    bool depthPrepass;
 } GraphicsPipeline;
 
 typedef struct Vulkan Vulkan;
@@ -1,7 +1,12 @@
 #ifndef INCLUDE_VULKAN_HANDLE_TEXTURE
 #define INCLUDE_VULKAN_HANDLE_TEXTURE
 
+#include "image/ktx/ktx.h"
+#include "utility/mapped_file.h"
+#include "vulkan_handle/mipmap.h"
+#include <stdbool.h>
 #include <stdint.h>
+#include <vulkan/vulkan.h>
 
 typedef enum VkSampleCountFlagBits VkSampleCountFlagBits;
 typedef enum VkImageUsageFlagBits VkImageUsageFlagBits;
@@ -11,23 +16,75 @@ typedef struct VkDeviceMemory_T *VkDeviceMemory;
 typedef struct VkImageView_T *VkImageView;
 typedef struct VkSampler_T *VkSampler;
 typedef struct Resource Resource;
+typedef struct TextureStream TextureStream;
 
 typedef struct Texture {
+    VkFormat format;
     uint32_t mipLevels;
 
     VkImage textureImage;
     VkDeviceMemory textureImageMemory;
     VkImageView textureImageView;
     VkSampler textureSampler;
+    // set when the levels are paged in over time, the handles above are then
+    // whichever the stream is sampled through at the moment
+    TextureStream *stream;
+    // its index in the texture table when the device has one
+    uint32_t slot;
 } Texture;
 
 typedef struct Vulkan Vulkan;
+typedef struct SDL_Surface SDL_Surface;
+typedef struct VkBuffer_T *VkBuffer;
+typedef struct VkCommandBuffer_T *VkCommandBuffer;
+typedef uint64_t VkDeviceSize;
+
+// A texture's levels on the cpu until they are staged, decoded from a png or
+// jpeg, or the levels of a ktx2 file as stored, on its own or cooked into a
+// package.
+typedef struct TexturePixels {
+    VkFormat format;      // the image's, rgba8 for anything decoded
+    uint32_t width;
+    uint32_t height;
+    uint32_t levelsCount; // staged, the rest of the chain is generated
+    uint32_t mipLevels;
+    MipGeneration mipGeneration; // of the levels not in the file
+    VkDeviceSize levelOffsets[KTX2_MAX_LEVELS]; // into the staged bytes
+    VkDeviceSize size;
+    SDL_Surface *surface; // converted to rgba8 as it is staged
+    MappedFile file; // the ktx2 file or the whole package it is in
+    Ktx2Image ktx;
+    bool decode; // bc blocks the device can't sample, decoded as staged
+    bool encode; // a decoded image block compressed as staged
+} TexturePixels;
+
+typedef enum TextureFlagBits {
+    TEXTURE_COMPRESS = 0x1, // png and jpeg as bc1, or bc7 with alpha
+    TEXTURE_STREAM = 0x2,   // every level staged, none generated on the
+                            // device, so each can be uploaded on its own
+} TextureFlagBits;
+typedef uint32_t TextureFlags;
+
+void loadTexturePixels(Vulkan *, const char *, TextureFlags, TexturePixels *);
+
+void writeTexturePixels(const TexturePixels *, void *);
+
+void writeTextureLevel(const TexturePixels *, uint32_t, void *);
 
-void createTextureImage(Vulkan *, const char *);
+void freeTexturePixels(TexturePixels *);
 
-void createTextureImageView(Vulkan *);
+void createTextureImage(Vulkan *, Texture *, const TexturePixels *);
 
-void createTextureSampler(Vulkan *);
+void recordTextureUpload(Vulkan *, VkCommandBuffer, const Texture *,
+                         const TexturePixels *, VkBuffer, VkDeviceSize);
+
+void uploadTexture(Vulkan *, Texture *, const char *);
+
+void createTextureImageView(Vulkan *, Texture *);
+
+void createTextureSampler(Vulkan *, Texture *);
+
+VkSampler acquireTextureSampler(Vulkan *, uint32_t, float);
 
 void createImageViews(Vulkan *);
 
@@ -45,11 +102,10 @@ typedef enum VkSampleCountFlagBits VkSampleCountFlagBits;
 typedef enum VkImageTiling VkImageTiling;
 typedef VkFlags VkImageUsageFlags;
 typedef VkFlags VkMemoryPropertyFlags;
+typedef VkFlags VkImageCreateFlags;
 void createImage(uint32_t, uint32_t, uint32_t, VkSampleCountFlagBits, VkFormat,
-                 VkImageTiling, VkImageUsageFlags, VkMemoryPropertyFlags,
-                 Vulkan *, VkImage *, VkDeviceMemory *);
-
-typedef struct VkCommandBuffer_T *VkCommandBuffer;
+                 VkImageTiling, VkImageUsageFlags, VkImageCreateFlags,
+                 VkMemoryPropertyFlags, Vulkan *, VkImage *, VkDeviceMemory *);
 
 VkCommandBuffer beginSingleTimeCommands(Vulkan *);
 
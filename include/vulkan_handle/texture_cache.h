@@ -0,0 +1,49 @@
+#ifndef INCLUDE_VULKAN_HANDLE_TEXTURE_CACHE
+#define INCLUDE_VULKAN_HANDLE_TEXTURE_CACHE
+
+#include "vulkan_handle/texture.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <vulkan/vulkan.h>
+
+// A texture shared by every shape that names the same file, by its
+// canonical path and the hash of its contents, loaded with the same flags.
+// Destroyed when the last of them releases it.
+typedef struct CachedTexture {
+    char *path;
+    uint64_t contentHash;
+    TextureFlags flags;
+    Texture texture; // empty until the upload of the first has finished
+    uint32_t references;
+    VkDeviceSize size; // held against the texture budget when not streamed
+} CachedTexture;
+
+// a sampler for every distinct create info, however many textures use it
+typedef struct CachedSampler {
+    VkSamplerCreateInfo info;
+    VkSampler sampler;
+    uint32_t references;
+} CachedSampler;
+
+typedef struct TextureCache {
+    CachedTexture *textures;
+    uint32_t texturesCount;
+    CachedSampler *samplers;
+    uint32_t samplersCount;
+} TextureCache;
+
+uint32_t acquireTexture(Vulkan *, const char *, TextureFlags, bool *);
+
+void storeCachedTexture(Vulkan *, uint32_t, const Texture *);
+
+const Texture *cachedTexture(Vulkan *, uint32_t);
+
+void releaseTexture(Vulkan *, const Texture *);
+
+VkSampler acquireSampler(Vulkan *, const VkSamplerCreateInfo *);
+
+void releaseSampler(Vulkan *, VkSampler);
+
+void destroyTextureCache(Vulkan *);
+
+#endif /* INCLUDE_VULKAN_HANDLE_TEXTURE_CACHE */
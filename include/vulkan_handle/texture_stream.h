@@ -0,0 +1,121 @@
+#ifndef INCLUDE_VULKAN_HANDLE_TEXTURE_STREAM
+#define INCLUDE_VULKAN_HANDLE_TEXTURE_STREAM
+
+#include "utility/job.h"
+#include "vulkan_handle/texture.h"
+#include <SDL_atomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <vulkan/vulkan.h>
+
+// levels no wider or higher than this are uploaded with the shape, the
+// finer ones are streamed in after it is drawn
+#define TEXTURE_STREAM_TAIL_EXTENT 64
+
+// device memory every texture together may use when the budget is left at 0
+// and the device can't say how much it has
+#define TEXTURE_STREAM_DEFAULT_BUDGET (128ull << 20)
+
+// of the heap's memory left unused, how much textures may grow into
+#define TEXTURE_STREAM_HEAP_SHARE 0.75
+
+// frames between asking the device for its budget
+#define TEXTURE_STREAM_BUDGET_FRAMES 60
+
+// frames a texture goes undrawn before it only wants its tail, so it is the
+// first to give up levels when the budget runs out
+#define TEXTURE_STREAM_IDLE_FRAMES 120
+
+// pixels a texel may stretch across on screen before the next finer level is
+// wanted
+#define TEXTURE_STREAM_TEXEL_PIXELS 1.0f
+
+typedef enum TextureStreamState {
+    TEXTURE_STREAM_IDLE,
+    TEXTURE_STREAM_LOADING,      // a job is writing a level into staging
+    TEXTURE_STREAM_LOADED,       // in staging, waiting for the render thread
+    TEXTURE_STREAM_TRANSFERRING, // copied on the transfer queue, waiting
+                                 // for the render thread to acquire it
+    TEXTURE_STREAM_UPLOADING,    // copy submitted, waiting for its fence
+    TEXTURE_STREAM_RESIZING,     // levels copied into a new image, likewise
+} TextureStreamState;
+
+// The image a streamed texture is sampled through, holding the chain from
+// firstLevel down, and what it costs against the budget. Any of it may be
+// missing once it is retired.
+typedef struct TextureResidency {
+    VkImage image;
+    VkDeviceMemory memory;
+    VkImageView view;
+    VkSampler sampler;
+    uint32_t firstLevel;
+    VkDeviceSize size;
+} TextureResidency;
+
+// replaced handles, destroyed once no swapchain image's descriptor sets name
+// them any more
+typedef struct RetiredResidency {
+    TextureResidency residency;
+    uint32_t pendingImages; // a bit per swapchain image not yet rewritten
+} RetiredResidency;
+
+// A texture paged in level by level, coarsest first. The render thread picks
+// the levels its shapes need on screen and fits them in the budget, load
+// jobs only write a level into staging, so the render thread never waits on
+// the file or the decoder.
+typedef struct TextureStream {
+    TexturePixels pixels; // the whole chain's layout and where it comes from
+    unsigned char *levels; // every level written up front, for sources that
+                           // can't give them one at a time
+    uint32_t tailLevel;    // the first of those uploaded with the shape
+
+    TextureResidency resident;
+    uint32_t loadedLevel; // finest level with its texels in the image, the
+                          // sampler's minLod hides the ones above it
+    uint32_t wantedLevel; // finest level any shape using it needs
+    float priority;       // how large the largest of them is on screen
+    uint64_t lastUsedFrame; // last drawn by any of them
+
+    SDL_atomic_t state;
+    uint32_t level;         // being loaded and uploaded
+    TextureResidency next;  // being filled while resizing
+    VkBuffer stagingBuffer; // sized for the level
+    VkDeviceMemory stagingBufferMemory;
+    unsigned char *staging;
+    VkCommandBuffer commandBuffer;
+    VkFence fence;
+    VkCommandBuffer transferCommandBuffer; // null without a transfer queue
+    uint64_t transferValue;
+    JobCounter load;
+} TextureStream;
+
+// The residency of every texture. Streamed ones are grown and shrunk a
+// level at a time to fit the budget, the least recently drawn giving up
+// theirs first, the rest are held whole and only counted against it.
+typedef struct TextureStreams {
+    TextureStream **streams;
+    uint32_t streamsCount;
+    VkDeviceSize budget;       // a limit of its own, 0 to go by the device
+    VkDeviceSize deviceBudget; // textures' share of the heap, 0 when the
+                               // device has no VK_EXT_memory_budget
+    VkDeviceSize used;         // every image still allocated, retired too
+    VkDeviceSize retiredSize;  // of those, the ones waiting to be destroyed
+    VkDeviceSize pinned;       // textures that aren't streamed
+    uint64_t frame;
+    RetiredResidency *retired;
+    uint32_t retiredCount;
+    VkCommandPool commandPool;
+} TextureStreams;
+
+void loadTextureStream(Vulkan *, const char *, TextureFlags,
+                       TextureStream **);
+
+void createTextureStream(Vulkan *, TextureStream *, Texture *);
+
+bool updateTextureStreams(Vulkan *, uint32_t);
+
+void closeTextureStream(Vulkan *, TextureStream *);
+
+void destroyTextureStreams(Vulkan *);
+
+#endif /* INCLUDE_VULKAN_HANDLE_TEXTURE_STREAM */
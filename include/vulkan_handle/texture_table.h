@@ -0,0 +1,46 @@
+#ifndef INCLUDE_VULKAN_HANDLE_TEXTURE_TABLE
+#define INCLUDE_VULKAN_HANDLE_TEXTURE_TABLE
+
+#include "vulkan_handle/texture.h"
+#include "vulkan_handle/uniforms.h"
+#include <stdint.h>
+#include <vulkan/vulkan.h>
+
+// the most textures the table holds, fewer where the device's update after
+// bind limits are lower
+#define TEXTURE_TABLE_MAX_TEXTURES 4096
+
+// Every texture in one partially bound array, binding 1 of a set per
+// swapchain image that also holds the scene's uniform buffer at binding 0.
+// Shapes push the index of theirs, so the set is bound once a frame and
+// draws no longer differ in their descriptors.
+typedef struct TextureTable {
+    DescriptorSet descriptorSet;
+    VkPipelineLayout pipelineLayout; // to bind the set with, any shape's
+                                     // layout is compatible with it
+    VkDescriptorImageInfo *slots;    // what each index samples, no view
+                                     // when it is free
+    uint32_t slotsCount;
+    uint32_t capacity;
+} TextureTable;
+
+// what a shape pushes for the fragment shader
+typedef struct TextureTableConstants {
+    uint32_t textureIndex;
+} TextureTableConstants;
+
+void createTextureTable(Vulkan *);
+
+void createTextureTableSets(Vulkan *);
+
+uint32_t addTableTexture(Vulkan *, const Texture *);
+
+void updateTableTexture(Vulkan *, uint32_t, uint32_t, const Texture *);
+
+void removeTableTexture(Vulkan *, uint32_t);
+
+void destroyTextureTableSets(Vulkan *);
+
+void destroyTextureTable(Vulkan *);
+
+#endif /* INCLUDE_VULKAN_HANDLE_TEXTURE_TABLE */
@@ -0,0 +1,36 @@
+#ifndef INCLUDE_VULKAN_HANDLE_TRANSFER
+#define INCLUDE_VULKAN_HANDLE_TRANSFER
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <vulkan/vulkan.h>
+
+typedef struct Vulkan Vulkan;
+
+// Uploads on the device's transfer queue, overlapping the frames on the
+// graphics one. Each submission signals the next value of one timeline
+// semaphore, which the graphics queue waits on before it acquires what the
+// upload released to it.
+typedef struct Transfer {
+    VkCommandPool commandPool; // on the transfer family
+    VkSemaphore timeline;
+    uint64_t submitted; // the value the last submission signals
+    uint32_t graphicsFamily;
+    uint32_t transferFamily;
+    PFN_vkGetSemaphoreCounterValueKHR getCounterValue;
+    PFN_vkWaitSemaphoresKHR waitSemaphores;
+} Transfer;
+
+void createTransfer(Vulkan *);
+
+uint64_t submitTransfer(Vulkan *, VkCommandBuffer);
+
+bool transferFinished(Vulkan *, uint64_t);
+
+void waitForTransfer(Vulkan *, uint64_t);
+
+void submitTransferAcquire(Vulkan *, VkCommandBuffer, uint64_t, VkFence);
+
+void destroyTransfer(Vulkan *);
+
+#endif /* INCLUDE_VULKAN_HANDLE_TRANSFER */
@@ -41,4 +41,7 @@ void createDescriptorPool(Vulkan *, VkDescriptorPool *);
 
 void createDescriptorSets(Vulkan *, DescriptorSet *, Texture *);
 
+void updateTextureDescriptor(Vulkan *, DescriptorSet *, uint32_t,
+                             const Texture *);
+
 #endif /* INCLUDE_VULKAN_HANDLE_UNIFORMS */
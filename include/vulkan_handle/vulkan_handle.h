@@ -3,8 +3,13 @@
 
 #include "device.h"
 #include "geometry/geometry.h"
+#include "mipmap.h"
 #include "render.h"
 #include "swapchain.h"
+#include "texture_cache.h"
+#include "texture_stream.h"
+#include "texture_table.h"
+#include "transfer.h"
 #include "uniforms.h"
 #include "validation.h"
 #include "window/window.h"
@@ -26,6 +31,11 @@ typedef struct Vulkan {
     UniformBufferObject ubo;
     Camera camera;
     Window window;
+    MipGenerator mipGenerator;
+    TextureCache textureCache;
+    TextureStreams textureStreams;
+    TextureTable textureTable;
+    Transfer transfer;
 
     Resource colour;
     Resource depth;
@@ -37,6 +47,10 @@ extern void terminate(Vulkan *);
 
 extern void mainLoop(Vulkan *);
 
-extern void generateShape(Vulkan *, ShapeType, const char *);
+extern void generateShapes(Vulkan *, const ShapeCreateInfo *, uint32_t);
+extern void generateShape(Vulkan *, ShapeType, const char *, ShapeFlags);
+extern void generateMesh(Vulkan *, const char *, const char *, ShapeFlags);
+extern void generateStreamedMesh(Vulkan *, const char *, const char *,
+                                 VkDeviceSize, ShapeFlags);
 
 #endif /* INCLUDE_VULKAN_HANDLE_VULKAN_HANDLE */
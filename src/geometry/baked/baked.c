@@ -0,0 +1,53 @@
+#include "geometry/baked/baked.h"
+#include "geometry/baked/circle_mesh.h"
+#include "geometry/baked/icosphere_mesh.h"
+#include "geometry/baked/octasphere_mesh.h"
+#include "geometry/baked/ring_mesh.h"
+#include "geometry/baked/sphere_mesh.h"
+#include "geometry/geometry.h"
+#include "vulkan_handle/memory.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define BAKED_MESH(name)                                                       \
+    {                                                                          \
+        .parameters = &BAKED_##name##_PARAMETERS,                              \
+        .vertices = BAKED_##name##_VERTICES,                                   \
+        .verticesCount = SIZEOF(BAKED_##name##_VERTICES),                      \
+        .indices = BAKED_##name##_INDICES,                                     \
+        .indicesCount = SIZEOF(BAKED_##name##_INDICES),                        \
+    }
+
+static const BakedMesh bakedMeshes[MESH] = {
+    [SPHERE] = BAKED_MESH(SPHERE),         [ICOSPHERE] = BAKED_MESH(ICOSPHERE),
+    [OCTASPHERE] = BAKED_MESH(OCTASPHERE), [CIRCLE] = BAKED_MESH(CIRCLE),
+    [RING] = BAKED_MESH(RING),
+};
+
+// the shape takes a copy it owns, as the optimisation passes reorder it in
+// place, false when nothing was baked with these parameters
+bool copyBakedMesh(Shape *shape, ShapeType shapeType,
+                   const ShapeParameters *parameters) {
+    if (shapeType >= MESH) {
+        return false;
+    }
+
+    const BakedMesh *baked = &bakedMeshes[shapeType];
+    if (!baked->vertices ||
+        memcmp(baked->parameters, parameters, sizeof(*parameters)) != 0) {
+        return false;
+    }
+
+    size_t verticesSize = baked->verticesCount * sizeof(*shape->vertices);
+    size_t indicesSize = baked->indicesCount * sizeof(*shape->indices);
+
+    shape->vertices = malloc(verticesSize);
+    memcpy(shape->vertices, baked->vertices, verticesSize);
+    shape->verticesCount = baked->verticesCount;
+
+    shape->indices = malloc(indicesSize);
+    memcpy(shape->indices, baked->indices, indicesSize);
+    shape->indicesCount = baked->indicesCount;
+
+    return true;
+}
@@ -0,0 +1,216 @@
+// mkdir and the stat timestamps are hidden by a strict -std=c18
+#define _POSIX_C_SOURCE 200809L
+
+#include "geometry/cache/cache.h"
+#include "geometry/geometry.h"
+#include "geometry/lod/lod.h"
+#include "geometry/meshlet/meshlet.h"
+#include <float.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <vulkan/vulkan.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#define makeDirectory(name) _mkdir(name)
+#else
+#define makeDirectory(name) mkdir(name, 0755)
+#endif
+
+#define FNV_PRIME 0x100000001b3ull
+
+// fnv-1a, chained so a key can be built from several fields
+inline uint64_t hashMeshCacheKey(uint64_t hash, const void *data,
+                                 size_t size) {
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+// a source file counts as changed when its size or modification time does
+uint64_t hashFileStamp(uint64_t hash, const char *fileName) {
+    hash = hashMeshCacheKey(hash, fileName, strlen(fileName));
+
+    struct stat info;
+    if (stat(fileName, &info) != 0) {
+        return hash;
+    }
+
+    int64_t stamp[2] = {(int64_t)info.st_size, (int64_t)info.st_mtime};
+    return hashMeshCacheKey(hash, stamp, sizeof(stamp));
+}
+
+static inline uint64_t alignOffset(uint64_t offset) {
+    return (offset + MESH_CACHE_ALIGNMENT - 1) &
+           ~(uint64_t)(MESH_CACHE_ALIGNMENT - 1);
+}
+
+static inline void cacheFileName(char *fileName, size_t size, uint64_t key) {
+    snprintf(fileName, size, "%s/%016" PRIx64 ".mesh", MESH_CACHE_DIRECTORY,
+             key);
+}
+
+static inline bool inFile(const MeshCacheHeader *header, uint64_t offset,
+                          uint64_t size) {
+    return offset <= header->fileSize && size <= header->fileSize - offset;
+}
+
+// a truncated or foreign file is a miss rather than an error
+static bool validHeader(const MeshCacheHeader *header, uint64_t key,
+                        size_t fileSize) {
+    return header->magic == MESH_CACHE_MAGIC &&
+           header->version == MESH_CACHE_VERSION && header->key == key &&
+           header->fileSize == fileSize &&
+           inFile(header, header->vertexDataOffset, header->vertexDataSize) &&
+           inFile(header, header->indexDataOffset, header->indexDataSize) &&
+           inFile(header, header->lodsOffset,
+                  (uint64_t)header->lodCount * sizeof(ShapeLod)) &&
+           inFile(header, header->meshletsOffset,
+                  (uint64_t)header->meshletsCount * sizeof(Meshlet));
+}
+
+// on a hit the shape gets everything but its vertices and indices, which are
+// uploaded straight from the mapped blobs
+bool openMeshCache(uint64_t key, Shape *shape, MeshCacheEntry *entry) {
+    *entry = (MeshCacheEntry){0};
+
+    char fileName[64];
+    cacheFileName(fileName, sizeof(fileName), key);
+
+    MappedFile file;
+    if (!mapFile(fileName, MAPPED_FILE_SEQUENTIAL, &file)) {
+        return false;
+    }
+
+    const MeshCacheHeader *header = (const MeshCacheHeader *)file.data;
+    if (file.size < sizeof(*header) || !validHeader(header, key, file.size)) {
+        unmapFile(&file);
+        return false;
+    }
+
+    shape->verticesCount = header->verticesCount;
+    shape->indicesCount = header->indicesCount;
+    shape->indexType = header->indexType;
+    shape->indexed = header->indexed;
+    shape->attributesOffset = header->attributesOffset;
+    shape->boundingRadius = header->boundingRadius;
+    shape->graphicsPipeline.topology = header->topology;
+    shape->graphicsPipeline.cullMode = header->cullMode;
+    shape->graphicsPipeline.primitiveRestart = header->primitiveRestart;
+
+    // small and read every frame, so they are copied out of the mapping
+    if (header->lodCount) {
+        size_t size = header->lodCount * sizeof(*shape->lods);
+        shape->lods = malloc(size);
+        memcpy(shape->lods, file.data + header->lodsOffset, size);
+        shape->lodCount = header->lodCount;
+    }
+    if (header->meshletsCount) {
+        size_t size = header->meshletsCount * sizeof(*shape->meshlets);
+        shape->meshlets = malloc(size);
+        memcpy(shape->meshlets, file.data + header->meshletsOffset, size);
+        shape->meshletsCount = header->meshletsCount;
+    }
+
+    entry->vertexData = file.data + header->vertexDataOffset;
+    entry->vertexDataSize = header->vertexDataSize;
+    entry->indexData = file.data + header->indexDataOffset;
+    entry->indexDataSize = header->indexDataSize;
+    entry->file = file;
+
+    return true;
+}
+
+void closeMeshCache(MeshCacheEntry *entry) {
+    if (entry->file.data) {
+        unmapFile(&entry->file);
+    }
+    *entry = (MeshCacheEntry){0};
+}
+
+static inline bool writeBlob(FILE *file, uint64_t offset, const void *data,
+                             uint64_t size) {
+    return fseek(file, (long)offset, SEEK_SET) == 0 &&
+           fwrite(data, 1, size, file) == size;
+}
+
+// best effort, a cache that cannot be written only costs the next start up
+// the time it took to generate the shape
+void writeMeshCache(uint64_t key, const Shape *shape, const void *vertexData,
+                    uint64_t vertexDataSize, const void *indexData,
+                    uint64_t indexDataSize) {
+    if (!shape->verticesCount) {
+        return;
+    }
+
+    MeshCacheHeader header = {
+        .magic = MESH_CACHE_MAGIC,
+        .version = MESH_CACHE_VERSION,
+        .key = key,
+        .vertexDataSize = vertexDataSize,
+        .indexDataSize = indexDataSize,
+        .verticesCount = shape->verticesCount,
+        .indicesCount = shape->indicesCount,
+        .lodCount = shape->lodCount,
+        .meshletsCount = shape->meshletsCount,
+        .attributesOffset = shape->attributesOffset,
+        .indexType = shape->indexType,
+        .topology = shape->graphicsPipeline.topology,
+        .cullMode = shape->graphicsPipeline.cullMode,
+        .indexed = shape->indexed,
+        .primitiveRestart = shape->graphicsPipeline.primitiveRestart,
+        .boundingRadius = shape->boundingRadius,
+        .min = {FLT_MAX, FLT_MAX, FLT_MAX},
+        .max = {-FLT_MAX, -FLT_MAX, -FLT_MAX},
+    };
+
+    for (uint32_t i = 0; i < shape->verticesCount; i++) {
+        for (uint32_t k = 0; k < 3; k++) {
+            float value = shape->vertices[i].pos[k];
+            header.min[k] = value < header.min[k] ? value : header.min[k];
+            header.max[k] = value > header.max[k] ? value : header.max[k];
+        }
+    }
+
+    uint64_t lodsSize = (uint64_t)shape->lodCount * sizeof(*shape->lods);
+    uint64_t meshletsSize =
+        (uint64_t)shape->meshletsCount * sizeof(*shape->meshlets);
+
+    header.vertexDataOffset = alignOffset(sizeof(header));
+    header.indexDataOffset =
+        alignOffset(header.vertexDataOffset + vertexDataSize);
+    header.lodsOffset = alignOffset(header.indexDataOffset + indexDataSize);
+    header.meshletsOffset = alignOffset(header.lodsOffset + lodsSize);
+    header.fileSize = header.meshletsOffset + meshletsSize;
+
+    makeDirectory(MESH_CACHE_DIRECTORY);
+
+    char fileName[64];
+    char partialFileName[72];
+    cacheFileName(fileName, sizeof(fileName), key);
+    snprintf(partialFileName, sizeof(partialFileName), "%s.part", fileName);
+
+    FILE *file = fopen(partialFileName, "wb");
+    if (!file) {
+        return;
+    }
+
+    bool written =
+        writeBlob(file, 0, &header, sizeof(header)) &&
+        writeBlob(file, header.vertexDataOffset, vertexData, vertexDataSize) &&
+        writeBlob(file, header.indexDataOffset, indexData, indexDataSize) &&
+        writeBlob(file, header.lodsOffset, shape->lods, lodsSize) &&
+        writeBlob(file, header.meshletsOffset, shape->meshlets, meshletsSize);
+    written &= fclose(file) == 0;
+
+    // only a complete file is ever seen under the real name
+    remove(fileName);
+    if (!written || rename(partialFileName, fileName) != 0) {
+        remove(partialFileName);
+    }
+}
@@ -1,8 +1,8 @@
 #include "geometry/cube/cube.h"
 #include "geometry/geometry.h"
 #include "vulkan_handle/memory.h"
-#include "vulkan_handle/vulkan_handle.h"
 #include <cglm/vec3.h>
+#include <stdlib.h>
 #include <string.h>
 
 Cube cube = {
@@ -44,7 +44,7 @@ Cube cube = {
     },
 };
 
-const uint16_t indices[] = {
+const uint32_t indices[] = {
     0,  1,  2,  2,  3,  0,  // top
     4,  5,  6,  6,  7,  4,  // bottom
     8,  9,  10, 8,  10, 11, // right
@@ -53,26 +53,22 @@ const uint16_t indices[] = {
     20, 21, 22, 20, 22, 23, // back
 };
 
-void makeCube(Vulkan *vulkan) {
+void makeCube(Shape *shape) {
     size_t count = SIZEOF(cube);
 
-    allocateVerticesAndIndices(vulkan, count * 4, count * 6);
-
-    // TODO: clean up
+    shape->vertices = malloc(count * 4 * sizeof(*shape->vertices));
+    shape->indices = malloc(SIZEOF(indices) * sizeof(*shape->indices));
 
+    // normals are worked out on the copy, the table is shared by every cube
     for (uint32_t i = 0; i < count; i++) {
-        Vertex *shape = cube[i];
-
-        calculateNormals(shape, 4);
+        Vertex *face = shape->vertices + shape->verticesCount;
+        memcpy(face, cube[i], 4 * sizeof(*face));
 
-        memcpy(vulkan->shapes[vulkan->shapeCount].vertices +
-                   vulkan->shapes[vulkan->shapeCount].verticesCount,
-               shape, 4 * sizeof(*shape));
+        calculateNormals(face, 4);
 
-        vulkan->shapes[vulkan->shapeCount].verticesCount += 4;
+        shape->verticesCount += 4;
     }
 
-    memcpy(vulkan->shapes[vulkan->shapeCount].indices, indices,
-           SIZEOF(indices) * sizeof(*indices));
-    vulkan->shapes[vulkan->shapeCount].indicesCount = SIZEOF(indices);
+    memcpy(shape->indices, indices, SIZEOF(indices) * sizeof(*indices));
+    shape->indicesCount = SIZEOF(indices);
 }
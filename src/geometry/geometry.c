@@ -1,12 +1,28 @@
 #include "geometry/geometry.h"
 #include "error_handle.h"
+#include "geometry/baked/baked.h"
+#include "geometry/cache/cache.h"
 #include "geometry/circle/circle.h"
 #include "geometry/cube/cube.h"
+#include "geometry/lod/lod.h"
+#include "geometry/mesh/mesh.h"
+#include "geometry/meshlet/meshlet.h"
+#include "geometry/normals/normals.h"
+#include "geometry/optimise/optimise.h"
+#include "geometry/optimise/overdraw.h"
+#include "geometry/optimise/strip.h"
+#include "geometry/packing/packing.h"
 #include "geometry/ring/ring.h"
 #include "geometry/shpere/sphere.h"
 #include "geometry/shpere/trisphere.h"
+#include "geometry/simplify/simplify.h"
+#include "geometry/stream/stream.h"
+#include "utility/job.h"
 #include "vulkan_handle/memory.h"
+#include "vulkan_handle/mipmap.h"
 #include "vulkan_handle/texture.h"
+#include "vulkan_handle/texture_cache.h"
+#include "vulkan_handle/texture_stream.h"
 #include "vulkan_handle/vulkan_handle.h"
 #include <cglm/vec2.h>
 #include <cglm/vec3.h>
@@ -25,15 +41,54 @@ inline void getMiddlePoint(vec3 point1, vec3 point2, vec3 res) {
     res[2] = (point1[2] + point2[2]) / 2.0f;
 }
 
-inline VkVertexInputBindingDescription getBindingDescription() {
-    VkVertexInputBindingDescription bindingDescription = {};
-    bindingDescription.binding = 0;
-    bindingDescription.stride = sizeof(Vertex);
-    bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+static inline uint32_t vertexStride(VertexFormat vertexFormat) {
+    return vertexFormat == VERTEX_FORMAT_PACKED ? sizeof(PackedVertex)
+                                                : sizeof(Vertex);
+}
+
+static inline uint32_t positionSize(VertexFormat vertexFormat) {
+    return vertexFormat == VERTEX_FORMAT_PACKED
+               ? sizeof(((PackedVertex *)0)->pos)
+               : sizeof(((Vertex *)0)->pos);
+}
 
+static inline VkVertexInputBindingDescription
+createBindingDescription(uint32_t binding, uint32_t stride) {
+    VkVertexInputBindingDescription bindingDescription = {
+        .binding = binding,
+        .stride = stride,
+        .inputRate = VK_VERTEX_INPUT_RATE_VERTEX,
+    };
     return bindingDescription;
 }
 
+// split streams use binding 0 for positions and binding 1 for everything else,
+// a positions only pipeline never binds the attribute stream
+inline VkVertexInputBindingDescription *
+getBindingDescriptions(const GraphicsPipeline *graphicsPipeline,
+                       bool positionsOnly, uint32_t *count) {
+    uint32_t stride = vertexStride(graphicsPipeline->vertexFormat);
+    uint32_t positionStride = positionSize(graphicsPipeline->vertexFormat);
+
+    *count = graphicsPipeline->splitStreams && !positionsOnly ? 2 : 1;
+
+    VkVertexInputBindingDescription *bindingDescriptions =
+        malloc(*count * sizeof(*bindingDescriptions));
+
+    if (!graphicsPipeline->splitStreams) {
+        bindingDescriptions[0] = createBindingDescription(0, stride);
+        return bindingDescriptions;
+    }
+
+    bindingDescriptions[0] = createBindingDescription(0, positionStride);
+    if (!positionsOnly) {
+        bindingDescriptions[1] =
+            createBindingDescription(1, stride - positionStride);
+    }
+
+    return bindingDescriptions;
+}
+
 inline void normalize(vec3 a, Vertex *b, float length) {
     // get the distance between a and b along the x and y axes
     vec3 d;
@@ -48,30 +103,76 @@ inline void normalize(vec3 a, Vertex *b, float length) {
     glm_vec3_add(a, d, (*b).pos);
 }
 
-inline VkVertexInputAttributeDescription *getAttributeDescriptions() {
+static inline void
+getPackedAttributeDescriptions(VkVertexInputAttributeDescription *descriptions) {
+    descriptions[0].binding = 0;
+    descriptions[0].location = 0;
+    descriptions[0].format = VK_FORMAT_R16G16B16A16_SFLOAT;
+    descriptions[0].offset = offsetof(PackedVertex, pos);
+
+    descriptions[1].binding = 0;
+    descriptions[1].location = 1;
+    descriptions[1].format = VK_FORMAT_R8G8B8A8_UNORM;
+    descriptions[1].offset = offsetof(PackedVertex, colour);
+
+    descriptions[2].binding = 0;
+    descriptions[2].location = 2;
+    descriptions[2].format = VK_FORMAT_R16G16_SNORM;
+    descriptions[2].offset = offsetof(PackedVertex, normal);
+
+    descriptions[3].binding = 0;
+    descriptions[3].location = 3;
+    descriptions[3].format = VK_FORMAT_R16G16_UNORM;
+    descriptions[3].offset = offsetof(PackedVertex, texCoord);
+}
+
+static inline void
+getFloatAttributeDescriptions(VkVertexInputAttributeDescription *descriptions) {
+    descriptions[0].binding = 0;
+    descriptions[0].location = 0;
+    descriptions[0].format = VK_FORMAT_R32G32B32_SFLOAT;
+    descriptions[0].offset = offsetof(Vertex, pos);
+
+    descriptions[1].binding = 0;
+    descriptions[1].location = 1;
+    descriptions[1].format = VK_FORMAT_R32G32B32_SFLOAT;
+    descriptions[1].offset = offsetof(Vertex, colour);
+
+    descriptions[2].binding = 0;
+    descriptions[2].location = 2;
+    descriptions[2].format = VK_FORMAT_R32G32B32_SFLOAT;
+    descriptions[2].offset = offsetof(Vertex, normal);
+
+    descriptions[3].binding = 0;
+    descriptions[3].location = 3;
+    descriptions[3].format = VK_FORMAT_R32G32_SFLOAT;
+    descriptions[3].offset = offsetof(Vertex, texCoord);
+}
+
+inline VkVertexInputAttributeDescription *
+getAttributeDescriptions(const GraphicsPipeline *graphicsPipeline,
+                         bool positionsOnly, uint32_t *count) {
 
     VkVertexInputAttributeDescription *attributeDescriptions =
         malloc(4 * sizeof(*attributeDescriptions));
 
-    attributeDescriptions[0].binding = 0;
-    attributeDescriptions[0].location = 0;
-    attributeDescriptions[0].format = VK_FORMAT_R32G32B32_SFLOAT;
-    attributeDescriptions[0].offset = offsetof(Vertex, pos);
-
-    attributeDescriptions[1].binding = 0;
-    attributeDescriptions[1].location = 1;
-    attributeDescriptions[1].format = VK_FORMAT_R32G32B32_SFLOAT;
-    attributeDescriptions[1].offset = offsetof(Vertex, colour);
+    if (graphicsPipeline->vertexFormat == VERTEX_FORMAT_PACKED) {
+        getPackedAttributeDescriptions(attributeDescriptions);
+    } else {
+        getFloatAttributeDescriptions(attributeDescriptions);
+    }
 
-    attributeDescriptions[2].binding = 0;
-    attributeDescriptions[2].location = 2;
-    attributeDescriptions[2].format = VK_FORMAT_R32G32B32_SFLOAT;
-    attributeDescriptions[2].offset = offsetof(Vertex, normal);
+    *count = positionsOnly ? 1 : 4;
 
-    attributeDescriptions[3].binding = 0;
-    attributeDescriptions[3].location = 3;
-    attributeDescriptions[3].format = VK_FORMAT_R32G32_SFLOAT;
-    attributeDescriptions[3].offset = offsetof(Vertex, texCoord);
+    // position always leads the vertex, so the remaining attributes keep
+    // their order in the second stream
+    if (graphicsPipeline->splitStreams) {
+        uint32_t positionStride = positionSize(graphicsPipeline->vertexFormat);
+        for (uint32_t i = 1; i < 4; i++) {
+            attributeDescriptions[i].binding = 1;
+            attributeDescriptions[i].offset -= positionStride;
+        }
+    }
 
     return attributeDescriptions;
 }
@@ -190,53 +291,179 @@ void createVertexIndexBuffer(Vulkan *vulkan, void *data, uint64_t bufferSize,
     vkFreeMemory(vulkan->device.device, stagingBufferMemory, NULL);
 }
 
-inline void generateShape(Vulkan *vulkan, ShapeType shapeType,
-                          const char *textureFileName) {
+// de-interleave so every position comes first, followed by the attributes
+static void *splitVertexStreams(const void *vertices, uint32_t verticesCount,
+                                uint32_t stride, uint32_t positionStride) {
+    const unsigned char *src = vertices;
+    unsigned char *split = malloc((size_t)verticesCount * stride);
+    unsigned char *positions = split;
+    unsigned char *attributes = split + (size_t)verticesCount * positionStride;
+    uint32_t attributeStride = stride - positionStride;
+
+    for (uint32_t i = 0; i < verticesCount; i++, src += stride) {
+        memcpy(positions + (size_t)i * positionStride, src, positionStride);
+        memcpy(attributes + (size_t)i * attributeStride, src + positionStride,
+               attributeStride);
+    }
 
-    vulkan->shapes = realloc(vulkan->shapes, (vulkan->shapeCount + 1) *
-                                                 sizeof(*vulkan->shapes));
-    vulkan->shapes[vulkan->shapeCount] = EmptyShape;
+    return split;
+}
+
+// the vertices exactly as the vertex buffer holds them, the shape's own array
+// when no conversion is needed
+static void *shapeVertexData(Shape *shape, uint64_t *size) {
+    VertexFormat vertexFormat = shape->graphicsPipeline.vertexFormat;
+    uint32_t stride = vertexStride(vertexFormat);
+
+    void *vertexData = shape->vertices;
+    if (vertexFormat == VERTEX_FORMAT_PACKED) {
+        vertexData = packVertices(shape->vertices, shape->verticesCount);
+    }
+
+    shape->attributesOffset = 0;
+    if (shape->graphicsPipeline.splitStreams) {
+        uint32_t positionStride = positionSize(vertexFormat);
+        void *split = splitVertexStreams(vertexData, shape->verticesCount,
+                                         stride, positionStride);
+        if (vertexData != shape->vertices) {
+            freeMem(1, vertexData);
+        }
+        vertexData = split;
+        shape->attributesOffset =
+            (uint64_t)shape->verticesCount * positionStride;
+    }
+
+    *size = (uint64_t)stride * shape->verticesCount;
+    return vertexData;
+}
 
-    Shape *shape = &vulkan->shapes[vulkan->shapeCount];
+// the indices exactly as the index buffer holds them, the shape's own array
+// when they need all 32 bits
+static void *shapeIndexData(Shape *shape, uint64_t *size) {
+    // levels of detail index from their own vertex offset, so it is the
+    // largest index rather than the vertex count that has to fit
+    uint32_t maxIndex = 0;
+    for (uint32_t i = 0; i < shape->indicesCount; i++) {
+        if (shape->indices[i] != STRIP_RESTART_INDEX &&
+            shape->indices[i] > maxIndex) {
+            maxIndex = shape->indices[i];
+        }
+    }
+
+    // 0xffff is taken by the restart index when primitive restart is on
+    uint32_t limit =
+        shape->graphicsPipeline.primitiveRestart ? UINT16_MAX : UINT16_MAX + 1;
 
-    vulkan->shapes[vulkan->shapeCount].graphicsPipeline.topology =
-        VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
-    vulkan->shapes[vulkan->shapeCount].graphicsPipeline.cullMode =
-        VK_CULL_MODE_BACK_BIT;
-    vulkan->shapes[vulkan->shapeCount].indexed = true;
+    if (maxIndex >= limit) {
+        shape->indexType = VK_INDEX_TYPE_UINT32;
+        *size = sizeof(*shape->indices) * shape->indicesCount;
+        return shape->indices;
+    }
+
+    uint16_t *narrowed = malloc(shape->indicesCount * sizeof(*narrowed));
+    for (uint32_t i = 0; i < shape->indicesCount; i++) {
+        narrowed[i] = shape->indices[i] == STRIP_RESTART_INDEX
+                          ? UINT16_MAX
+                          : (uint16_t)shape->indices[i];
+    }
+
+    shape->indexType = VK_INDEX_TYPE_UINT16;
+    *size = sizeof(*narrowed) * shape->indicesCount;
+    return narrowed;
+}
+
+// hashed into the cache key and recorded with the baked tables, so a change
+// regenerates the shape rather than loading a stale one
+const ShapeParameters shapeParameters[MESH] = {
+    [SPHERE] = {.detail = {40, 40}, .radius = SPHERE_RADIUS},
+    [ICOSPHERE] = {.detail = {3}},
+    [OCTASPHERE] = {.detail = {3}},
+    [CIRCLE] = {.detail = {40}, .radius = CIRCLE_RADIUS},
+    [RING] = {.detail = {60}, .radius = 2.0f},
+};
+
+// the limits the level of detail and optimisation passes work to, which every
+// cached shape depends on
+static const float shapeTunables[] = {
+    LOD_MIN_SEGMENTS,       LOD_MAX_SEGMENTS,     LOD_MAX_SUBDIVISIONS,
+    LOD_MAX_LEVELS,         LOD_MIN_TRIANGLES,    LOD_MIN_REDUCTION,
+    SPHERE_RADIUS,          CIRCLE_RADIUS,        VERTEX_CACHE_SIZE,
+    OVERDRAW_THRESHOLD,     OVERDRAW_VIEWPORT,    SIMPLIFY_FLIP_THRESHOLD,
+    SIMPLIFY_BORDER_WEIGHT, MESHLET_MAX_VERTICES, MESHLET_MAX_TRIANGLES,
+};
+
+// generated from shapeParameters, which is also what the baked tables hold
+void makeDefaultShape(Shape *shape, ShapeType shapeType) {
+    const ShapeParameters *parameters = &shapeParameters[shapeType];
 
     switch (shapeType) {
-    case CUBE:
-        makeCube(vulkan);
-        break;
     case SPHERE:
-        makeSphere(shape, 40, 40, 0.4);
+        makeSphere(shape, parameters->detail[0], parameters->detail[1],
+                   parameters->radius);
         break;
     case ICOSPHERE:
     case OCTASPHERE:
-        makeTriSphere(vulkan, shapeType, 3);
+        makeTriSphere(shape, shapeType, parameters->detail[0]);
         break;
     case CIRCLE:
-        makeCircle(shape, 40, 2);
-        break;
-    case PLAIN:
+        makeCircle(shape, parameters->detail[0], parameters->radius);
         break;
     case RING:
-        makeRing(shape, 60, 2);
-        vulkan->shapes[vulkan->shapeCount].graphicsPipeline.topology =
-            VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP;
-        vulkan->shapes[vulkan->shapeCount].graphicsPipeline.cullMode =
-            VK_CULL_MODE_NONE;
-        vulkan->shapes[vulkan->shapeCount].indexed = false;
+        makeRing(shape, parameters->detail[0], parameters->radius);
+        break;
     default:
         break;
     }
+}
+
+static uint64_t shapeCacheKey(ShapeType shapeType, const char *meshFileName,
+                              ShapeFlags flags) {
+    uint64_t key = MESH_CACHE_KEY_SEED;
+    key = hashMeshCacheKey(key, &shapeType, sizeof(shapeType));
+    key = hashMeshCacheKey(key, &flags, sizeof(flags));
+    key = hashMeshCacheKey(key, shapeTunables, sizeof(shapeTunables));
+
+    if (meshFileName) {
+        return hashFileStamp(key, meshFileName);
+    }
+    if (shapeType < MESH) {
+        key = hashMeshCacheKey(key, &shapeParameters[shapeType],
+                               sizeof(*shapeParameters));
+    }
+    return key;
+}
+
+// the shapes following the current ones, set up with the pipeline state
+// every shape starts from
+static Shape *addShapes(Vulkan *vulkan, const ShapeCreateInfo *createInfos,
+                        uint32_t count) {
+    vulkan->shapes = realloc(vulkan->shapes, (vulkan->shapeCount + count) *
+                                                 sizeof(*vulkan->shapes));
+
+    Shape *shapes = &vulkan->shapes[vulkan->shapeCount];
+    for (uint32_t i = 0; i < count; i++) {
+        Shape *shape = &shapes[i];
+        ShapeFlags flags = createInfos[i].flags;
+
+        *shape = EmptyShape;
+        shape->graphicsPipeline.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        shape->graphicsPipeline.cullMode = VK_CULL_MODE_BACK_BIT;
+        shape->indexed = true;
+        shape->graphicsPipeline.vertexFormat = flags & SHAPE_PACKED_VERTICES
+                                                   ? VERTEX_FORMAT_PACKED
+                                                   : VERTEX_FORMAT_FLOAT;
+        shape->graphicsPipeline.splitStreams = flags & SHAPE_SPLIT_STREAMS;
+        shape->graphicsPipeline.depthPrepass = flags & SHAPE_DEPTH_PREPASS;
+    }
 
-    createTextureImage(vulkan, textureFileName);
-    createTextureImageView(vulkan);
-    createTextureSampler(vulkan);
+    return shapes;
+}
 
-    vulkan->shapeCount++;
+// room for the buffers of the shapes addShapes claimed, returns the first
+// one's index
+static uint32_t growShapeBuffers(Vulkan *vulkan, uint32_t count) {
+    uint32_t firstIndex = vulkan->shapeCount;
+    vulkan->shapeCount += count;
 
     vulkan->shapeBuffers.vertexBuffer = realloc(
         vulkan->shapeBuffers.vertexBuffer,
@@ -251,32 +478,395 @@ inline void generateShape(Vulkan *vulkan, ShapeType shapeType,
         vulkan->shapeBuffers.indexBufferMemory,
         vulkan->shapeCount * sizeof(*vulkan->shapeBuffers.indexBufferMemory));
 
-    //
-    uint32_t shape_index = vulkan->shapeCount - 1;
-
-    createVertexIndexBuffer(
-        vulkan, vulkan->shapes[shape_index].vertices,
-        sizeof(*vulkan->shapes[shape_index].vertices) *
-            vulkan->shapes[shape_index].verticesCount,
-        &vulkan->shapeBuffers.vertexBuffer[shape_index],
-        &vulkan->shapeBuffers.vertexBufferMemory[shape_index],
-        VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
-    createVertexIndexBuffer(
-        vulkan, vulkan->shapes[shape_index].indices,
-        sizeof(*vulkan->shapes[shape_index].indices) *
-            vulkan->shapes[shape_index].indicesCount,
-        &vulkan->shapeBuffers.indexBuffer[shape_index],
-        &vulkan->shapeBuffers.indexBufferMemory[shape_index],
-        VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
-
-    createDescriptorSetLayout(
-        vulkan, &vulkan->shapes[shape_index].descriptorSet.descriptorSetLayout);
-    createGraphicsPipeline(
-        vulkan, &vulkan->shapes[shape_index].descriptorSet.descriptorSetLayout,
-        &vulkan->shapes[shape_index].graphicsPipeline);
-    createDescriptorPool(
-        vulkan, &vulkan->shapes[shape_index].descriptorSet.descriptorPool);
-    createUniformBuffers(vulkan, &vulkan->shapes[shape_index].descriptorSet);
-    createDescriptorSets(vulkan, &vulkan->shapes[shape_index].descriptorSet,
-                         &vulkan->shapes[shape_index].texture);
+    return firstIndex;
+}
+
+// bindless shapes draw through the texture table's sets, not their own
+static void createShapePipeline(Vulkan *vulkan, Shape *shape) {
+    if (vulkan->device.bindless) {
+        createGraphicsPipeline(
+            vulkan, &vulkan->textureTable.descriptorSet.descriptorSetLayout,
+            &shape->graphicsPipeline);
+    } else {
+        createDescriptorSetLayout(vulkan,
+                                  &shape->descriptorSet.descriptorSetLayout);
+        createGraphicsPipeline(vulkan,
+                               &shape->descriptorSet.descriptorSetLayout,
+                               &shape->graphicsPipeline);
+        createDescriptorPool(vulkan, &shape->descriptorSet.descriptorPool);
+        createUniformBuffers(vulkan, &shape->descriptorSet);
+        createDescriptorSets(vulkan, &shape->descriptorSet, &shape->texture);
+    }
+    if (shape->lodCount) {
+        createIndirectBuffers(vulkan, shape);
+    }
+}
+
+// the geometry of a parametric shape, every level at once when it has a
+// chain
+static void makeShapeGeometry(Shape *shape, ShapeType shapeType,
+                              ShapeFlags flags) {
+    // parametric shapes can build every level of detail in one go
+    if (flags & SHAPE_LOD_CHAIN) {
+        makeLodChain(shape, shapeType, flags);
+    }
+
+    if (shape->lodCount) {
+        return;
+    }
+
+    switch (shapeType) {
+    case CUBE:
+        makeCube(shape);
+        break;
+    case PLAIN:
+        break;
+    case RING:
+        shape->graphicsPipeline.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP;
+        shape->graphicsPipeline.cullMode = VK_CULL_MODE_NONE;
+        shape->indexed = false;
+        // fall through
+    default:
+        if (!copyBakedMesh(shape, shapeType, &shapeParameters[shapeType])) {
+            makeDefaultShape(shape, shapeType);
+        }
+        break;
+    }
+}
+
+// one shape's share of generateShapes, what its jobs hand to the upload
+typedef struct ShapeBuild {
+    Vulkan *vulkan;
+    const ShapeCreateInfo *createInfo;
+    Shape *shape;
+    MeshCacheEntry cached;
+    void *vertexData;
+    uint64_t vertexDataSize;
+    void *indexData;
+    uint64_t indexDataSize;
+    uint32_t textureEntry; // in the texture cache
+    bool loadTexture;      // first to use it, the rest share its upload
+    TexturePixels pixels;
+    TextureStream *textureStream; // in place of the pixels when streamed
+    unsigned char *staging; // mapped, vertices then indices then pixels
+    VkDeviceSize stagingOffsets[3];
+} ShapeBuild;
+
+// everything up to the exact bytes of the buffers, a cached shape has those
+// in its mapping already
+static void buildShape(void *data) {
+    ShapeBuild *build = data;
+    const ShapeCreateInfo *createInfo = build->createInfo;
+    Shape *shape = build->shape;
+    ShapeFlags flags = createInfo->flags;
+
+    uint64_t cacheKey = shapeCacheKey(createInfo->shapeType,
+                                      createInfo->meshFileName, flags);
+    if (openMeshCache(cacheKey, shape, &build->cached)) {
+        build->vertexData = (void *)build->cached.vertexData;
+        build->vertexDataSize = build->cached.vertexDataSize;
+        build->indexData = (void *)build->cached.indexData;
+        build->indexDataSize = build->cached.indexDataSize;
+        return;
+    }
+
+    if (createInfo->shapeType == MESH) {
+        loadMesh(shape, createInfo->meshFileName);
+        if (flags & SHAPE_SMOOTH_NORMALS) {
+            generateNormals(shape, NORMALS_ANGLE_WEIGHTED, NULL);
+        }
+    } else {
+        makeShapeGeometry(shape, createInfo->shapeType, flags);
+    }
+
+    // anything else indexed gets its levels from the simplifier
+    if ((flags & SHAPE_SIMPLIFY_LODS) && !shape->lodCount) {
+        makeSimplifiedLodChain(shape, flags);
+    }
+
+    if (!shape->lodCount) {
+        optimiseShape(shape, flags);
+    }
+    if (shape->meshletsCount && !shape->lodCount) {
+        makeSingleLod(shape);
+    }
+    // how large it is on screen picks its texture's levels
+    if ((flags & SHAPE_STREAM_TEXTURE) && !shape->boundingRadius) {
+        shape->boundingRadius = shapeBoundingRadius(shape);
+    }
+
+    build->vertexData = shapeVertexData(shape, &build->vertexDataSize);
+    build->indexData = shapeIndexData(shape, &build->indexDataSize);
+    writeMeshCache(cacheKey, shape, build->vertexData, build->vertexDataSize,
+                   build->indexData, build->indexDataSize);
+}
+
+static void freeShapeBuild(ShapeBuild *build) {
+    if (build->cached.file.data) {
+        closeMeshCache(&build->cached);
+    } else {
+        if (build->vertexData != build->shape->vertices) {
+            freeMem(1, build->vertexData);
+        }
+        if (build->indexData != build->shape->indices) {
+            freeMem(1, build->indexData);
+        }
+    }
+
+    freeTexturePixels(&build->pixels);
+}
+
+static inline TextureFlags shapeTextureFlags(ShapeFlags flags) {
+    return (flags & SHAPE_COMPRESS_TEXTURE ? TEXTURE_COMPRESS : 0) |
+           (flags & SHAPE_STREAM_TEXTURE ? TEXTURE_STREAM : 0);
+}
+
+static void decodeShapeTexture(void *data) {
+    ShapeBuild *build = data;
+    TextureFlags flags = shapeTextureFlags(build->createInfo->flags);
+    if (flags & TEXTURE_STREAM) {
+        loadTextureStream(build->vulkan, build->createInfo->textureFileName,
+                          flags, &build->textureStream);
+    } else {
+        loadTexturePixels(build->vulkan, build->createInfo->textureFileName,
+                          flags, &build->pixels);
+    }
+}
+
+// a streamed texture uploads its tail on its own
+static inline bool stagesTexture(const ShapeBuild *build) {
+    return build->loadTexture && !build->textureStream;
+}
+
+static inline VkDeviceSize alignStaging(VkDeviceSize offset) {
+    return (offset + SCENE_STAGING_ALIGNMENT - 1) &
+           ~(VkDeviceSize)(SCENE_STAGING_ALIGNMENT - 1);
+}
+
+// copied and converted by a job per shape while the calling thread creates
+// the buffers and images they go to
+static void stageShape(void *data) {
+    ShapeBuild *build = data;
+    unsigned char *staging = build->staging;
+
+    memcpy(staging + build->stagingOffsets[0], build->vertexData,
+           build->vertexDataSize);
+    memcpy(staging + build->stagingOffsets[1], build->indexData,
+           build->indexDataSize);
+    if (stagesTexture(build)) {
+        writeTexturePixels(&build->pixels,
+                           staging + build->stagingOffsets[2]);
+    }
+}
+
+// every buffer and texture of the scene through one staging buffer and one
+// submission
+static void uploadShapes(Vulkan *vulkan, ShapeBuild *builds, uint32_t count,
+                         uint32_t firstIndex) {
+    VkDeviceSize stagingSize = 0;
+
+    for (uint32_t i = 0; i < count; i++) {
+        VkDeviceSize *offsets = builds[i].stagingOffsets;
+        offsets[0] = stagingSize;
+        offsets[1] = alignStaging(offsets[0] + builds[i].vertexDataSize);
+        offsets[2] = alignStaging(offsets[1] + builds[i].indexDataSize);
+        stagingSize = alignStaging(offsets[2] + builds[i].pixels.size);
+    }
+
+    VkBuffer stagingBuffer;
+    VkDeviceMemory stagingBufferMemory;
+    createBuffer(stagingSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                 VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                     VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                 vulkan, &stagingBuffer, &stagingBufferMemory);
+
+    unsigned char *staging;
+    vkMapMemory(vulkan->device.device, stagingBufferMemory, 0, stagingSize, 0,
+                (void **)&staging);
+
+    Job *jobs = malloc(count * sizeof(*jobs));
+    for (uint32_t i = 0; i < count; i++) {
+        builds[i].staging = staging;
+        jobs[i] = (Job){.function = stageShape, .data = &builds[i]};
+    }
+
+    JobCounter staged = {0};
+    runJobs(jobs, count, &staged);
+
+    for (uint32_t i = 0; i < count; i++) {
+        ShapeBuild *build = &builds[i];
+        uint32_t shapeIndex = firstIndex + i;
+
+        createBuffer(build->vertexDataSize,
+                     VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+                         VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+                     VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, vulkan,
+                     &vulkan->shapeBuffers.vertexBuffer[shapeIndex],
+                     &vulkan->shapeBuffers.vertexBufferMemory[shapeIndex]);
+        createBuffer(build->indexDataSize,
+                     VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+                         VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+                     VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, vulkan,
+                     &vulkan->shapeBuffers.indexBuffer[shapeIndex],
+                     &vulkan->shapeBuffers.indexBufferMemory[shapeIndex]);
+        if (stagesTexture(build)) {
+            createTextureImage(vulkan, &build->shape->texture,
+                               &build->pixels);
+        }
+    }
+
+    waitForJobs(&staged);
+    vkUnmapMemory(vulkan->device.device, stagingBufferMemory);
+
+    VkCommandBuffer commandBuffer = beginSingleTimeCommands(vulkan);
+
+    for (uint32_t i = 0; i < count; i++) {
+        ShapeBuild *build = &builds[i];
+        uint32_t shapeIndex = firstIndex + i;
+
+        VkBufferCopy vertexCopy = {
+            .srcOffset = build->stagingOffsets[0],
+            .size = build->vertexDataSize,
+        };
+        VkBufferCopy indexCopy = {
+            .srcOffset = build->stagingOffsets[1],
+            .size = build->indexDataSize,
+        };
+        vkCmdCopyBuffer(commandBuffer, stagingBuffer,
+                        vulkan->shapeBuffers.vertexBuffer[shapeIndex], 1,
+                        &vertexCopy);
+        vkCmdCopyBuffer(commandBuffer, stagingBuffer,
+                        vulkan->shapeBuffers.indexBuffer[shapeIndex], 1,
+                        &indexCopy);
+
+        if (stagesTexture(build)) {
+            recordTextureUpload(vulkan, commandBuffer, &build->shape->texture,
+                                &build->pixels, stagingBuffer,
+                                build->stagingOffsets[2]);
+        }
+    }
+
+    endSingleTimeCommands(vulkan, commandBuffer);
+    releaseMipScratch(vulkan);
+
+    vkDestroyBuffer(vulkan->device.device, stagingBuffer, NULL);
+    vkFreeMemory(vulkan->device.device, stagingBufferMemory, NULL);
+
+    freeMem(1, jobs);
+}
+
+// Builds every shape of a scene at once. Each shape's geometry and its
+// texture are separate jobs, so the slowest single asset bounds the scene
+// rather than their sum, then everything is uploaded in a single submission
+// and the pipelines are created. A texture is only decoded and uploaded by
+// the first shape to use it, in this scene or an earlier one.
+void generateShapes(Vulkan *vulkan, const ShapeCreateInfo *createInfos,
+                    uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        if (createInfos[i].shapeType == MESH && !createInfos[i].meshFileName) {
+            THROW_ERROR("mesh shapes need a mesh file!\n");
+        }
+    }
+
+    Shape *shapes = addShapes(vulkan, createInfos, count);
+
+    ShapeBuild *builds = calloc(count, sizeof(*builds));
+    Job *jobs = malloc(count * 2 * sizeof(*jobs));
+    uint32_t jobsCount = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        builds[i].vulkan = vulkan;
+        builds[i].createInfo = &createInfos[i];
+        builds[i].shape = &shapes[i];
+        builds[i].textureEntry = acquireTexture(
+            vulkan, createInfos[i].textureFileName,
+            shapeTextureFlags(createInfos[i].flags), &builds[i].loadTexture);
+
+        jobs[jobsCount++] = (Job){.function = buildShape, .data = &builds[i]};
+        if (builds[i].loadTexture) {
+            jobs[jobsCount++] =
+                (Job){.function = decodeShapeTexture, .data = &builds[i]};
+        }
+    }
+
+    JobCounter built = {0};
+    runJobs(jobs, jobsCount, &built);
+    waitForJobs(&built);
+
+    uint32_t firstIndex = growShapeBuffers(vulkan, count);
+
+    uploadShapes(vulkan, builds, count, firstIndex);
+
+    for (uint32_t i = 0; i < count; i++) {
+        freeShapeBuild(&builds[i]);
+
+        if (builds[i].textureStream) {
+            createTextureStream(vulkan, builds[i].textureStream,
+                                &shapes[i].texture);
+        } else if (builds[i].loadTexture) {
+            createTextureImageView(vulkan, &shapes[i].texture);
+            createTextureSampler(vulkan, &shapes[i].texture);
+        }
+        if (builds[i].loadTexture) {
+            storeCachedTexture(vulkan, builds[i].textureEntry,
+                               &shapes[i].texture);
+        }
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        shapes[i].texture = *cachedTexture(vulkan, builds[i].textureEntry);
+        createShapePipeline(vulkan, &shapes[i]);
+    }
+
+    freeMem(2, builds, jobs);
+}
+
+inline void generateShape(Vulkan *vulkan, ShapeType shapeType,
+                          const char *textureFileName, ShapeFlags flags) {
+    if (shapeType == MESH) {
+        THROW_ERROR("mesh shapes are loaded with generateMesh!\n");
+    }
+
+    ShapeCreateInfo createInfo = {
+        .shapeType = shapeType,
+        .textureFileName = textureFileName,
+        .flags = flags,
+    };
+    generateShapes(vulkan, &createInfo, 1);
+}
+
+// a shape from an obj, gltf or glb file, which otherwise goes through
+// everything a generated shape does
+void generateMesh(Vulkan *vulkan, const char *meshFileName,
+                  const char *textureFileName, ShapeFlags flags) {
+    ShapeCreateInfo createInfo = {
+        .shapeType = MESH,
+        .meshFileName = meshFileName,
+        .textureFileName = textureFileName,
+        .flags = flags,
+    };
+    generateShapes(vulkan, &createInfo, 1);
+}
+
+// a chunked mesh written by chunk_mesh, paged into a pool of at most budget
+// bytes as the camera moves rather than loaded up front, 0 picks
+// STREAM_DEFAULT_BUDGET
+void generateStreamedMesh(Vulkan *vulkan, const char *chunkFileName,
+                          const char *textureFileName, VkDeviceSize budget,
+                          ShapeFlags flags) {
+    // chunks are stored as plain interleaved vertices, uploaded untouched
+    ShapeCreateInfo createInfo = {
+        .shapeType = MESH,
+        .meshFileName = chunkFileName,
+        .textureFileName = textureFileName,
+        .flags = flags & ~(SHAPE_PACKED_VERTICES | SHAPE_SPLIT_STREAMS),
+    };
+    Shape *shape = addShapes(vulkan, &createInfo, 1);
+
+    uploadTexture(vulkan, &shape->texture, textureFileName);
+
+    uint32_t shapeIndex = growShapeBuffers(vulkan, 1);
+
+    openMeshStream(vulkan, shape, chunkFileName, budget, shapeIndex);
+
+    createShapePipeline(vulkan, shape);
 }
@@ -0,0 +1,437 @@
+#include "geometry/lod/lod.h"
+#include "geometry/circle/circle.h"
+#include "geometry/geometry.h"
+#include "geometry/meshlet/meshlet.h"
+#include "geometry/optimise/optimise.h"
+#include "geometry/optimise/overdraw.h"
+#include "geometry/shpere/sphere.h"
+#include "geometry/shpere/trisphere.h"
+#include "geometry/simplify/simplify.h"
+#include "geometry/stream/stream.h"
+#include "utility/job.h"
+#include "vulkan_handle/memory.h"
+#include "vulkan_handle/vulkan_handle.h"
+#include <cglm/mat4.h>
+#include <cglm/vec3.h>
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vulkan/vulkan.h>
+
+// central angle of an icosahedron edge
+#define ICOSAHEDRON_EDGE_ANGLE 1.10714872f
+
+static inline void makeLevel(Shape *level, ShapeType shapeType,
+                             uint32_t detail) {
+    switch (shapeType) {
+    case SPHERE:
+        makeSphere(level, detail, detail, SPHERE_RADIUS);
+        break;
+    case CIRCLE:
+        makeCircle(level, detail, CIRCLE_RADIUS);
+        break;
+    case ICOSPHERE:
+    case OCTASPHERE:
+        makeTriSphere(level, shapeType, detail);
+        break;
+    default:
+        break;
+    }
+}
+
+// depth of the flat triangles below the surface, half a step in from the
+// vertices that lie on it
+static inline float levelError(ShapeType shapeType, uint32_t detail,
+                               float radius) {
+    float step;
+    switch (shapeType) {
+    case ICOSPHERE:
+        step = ICOSAHEDRON_EDGE_ANGLE / (1u << detail);
+        break;
+    case OCTASPHERE:
+        step = GLM_PI_2f / (1u << detail);
+        break;
+    default:
+        step = 2.0f * GLM_PIf / detail;
+        break;
+    }
+    return radius * (1.0f - cosf(step * 0.5f));
+}
+
+// about the origin, where every shape is built
+float shapeBoundingRadius(const Shape *shape) {
+    float radius = 0.0f;
+    for (uint32_t i = 0; i < shape->verticesCount; i++) {
+        radius = fmaxf(radius, glm_vec3_norm(shape->vertices[i].pos));
+    }
+    return radius;
+}
+
+// a level's meshlets index its own indices, so they move along with them
+static void appendMeshlets(Shape *shape, ShapeLod *lod, const Shape *level) {
+    lod->firstMeshlet = shape->meshletsCount;
+    lod->meshletsCount = level->meshletsCount;
+
+    shape->meshlets = realloc(shape->meshlets, (shape->meshletsCount +
+                                                level->meshletsCount) *
+                                                   sizeof(*shape->meshlets));
+    for (uint32_t i = 0; i < level->meshletsCount; i++) {
+        shape->meshlets[shape->meshletsCount + i] = level->meshlets[i];
+        shape->meshlets[shape->meshletsCount + i].firstIndex +=
+            lod->firstIndex;
+    }
+    shape->meshletsCount += level->meshletsCount;
+}
+
+void makeLodChain(Shape *shape, ShapeType shapeType, ShapeFlags flags) {
+    uint32_t details[LOD_MAX_LEVELS];
+    uint32_t levelCount = 0;
+
+    // finest first, so level 0 is full detail
+    switch (shapeType) {
+    case SPHERE:
+    case CIRCLE:
+        for (uint32_t s = LOD_MAX_SEGMENTS; s >= LOD_MIN_SEGMENTS; s /= 2) {
+            details[levelCount++] = s;
+        }
+        break;
+    case ICOSPHERE:
+    case OCTASPHERE:
+        for (uint32_t d = LOD_MAX_SUBDIVISIONS + 1; d > 0; d--) {
+            details[levelCount++] = d - 1;
+        }
+        break;
+    default:
+        return;
+    }
+
+    shape->lods = malloc(levelCount * sizeof(*shape->lods));
+    shape->lodCount = levelCount;
+
+    // stripping changes the topology, every level starts from the original
+    GraphicsPipeline graphicsPipeline = shape->graphicsPipeline;
+
+    for (uint32_t i = 0; i < levelCount; i++) {
+        Shape level = {
+            .graphicsPipeline = graphicsPipeline,
+            .indexed = true,
+        };
+        makeLevel(&level, shapeType, details[i]);
+
+        // levels are optimised on their own as each is drawn on its own
+        optimiseShape(&level, flags);
+
+        shape->vertices =
+            realloc(shape->vertices, (shape->verticesCount +
+                                      level.verticesCount) *
+                                         sizeof(*shape->vertices));
+        memcpy(shape->vertices + shape->verticesCount, level.vertices,
+               level.verticesCount * sizeof(*level.vertices));
+
+        shape->indices =
+            realloc(shape->indices, (shape->indicesCount +
+                                     level.indicesCount) *
+                                        sizeof(*shape->indices));
+        memcpy(shape->indices + shape->indicesCount, level.indices,
+               level.indicesCount * sizeof(*level.indices));
+
+        shape->lods[i] = (ShapeLod){
+            .firstIndex = shape->indicesCount,
+            .indicesCount = level.indicesCount,
+            .vertexOffset = (int32_t)shape->verticesCount,
+        };
+        appendMeshlets(shape, &shape->lods[i], &level);
+
+        shape->verticesCount += level.verticesCount;
+        shape->indicesCount += level.indicesCount;
+
+        // every level ends up with the same topology
+        shape->graphicsPipeline.topology = level.graphicsPipeline.topology;
+        shape->graphicsPipeline.primitiveRestart =
+            level.graphicsPipeline.primitiveRestart;
+
+        freeMem(3, level.vertices, level.indices, level.meshlets);
+    }
+
+    shape->boundingRadius = shapeBoundingRadius(shape);
+
+    for (uint32_t i = 0; i < levelCount; i++) {
+        shape->lods[i].error =
+            levelError(shapeType, details[i], shape->boundingRadius);
+    }
+}
+
+typedef struct SimplifyTask {
+    const Shape *shape;
+    uint32_t targetIndicesCount;
+    uint32_t *indices;
+    uint32_t indicesCount;
+    float error;
+} SimplifyTask;
+
+static void simplifyLevel(void *data) {
+    SimplifyTask *task = data;
+    const Shape *shape = task->shape;
+
+    task->indices = malloc(shape->indicesCount * sizeof(*task->indices));
+    task->indicesCount =
+        simplify(task->indices, shape->indices, shape->indicesCount,
+                 shape->vertices, shape->verticesCount,
+                 task->targetIndicesCount, FLT_MAX, &task->error);
+}
+
+// Halves the triangle count per level with the simplifier, every level is
+// simplified from the full mesh as its own job. The levels collapse onto
+// existing vertices, so they all share the shape's vertices.
+void makeSimplifiedLodChain(Shape *shape, ShapeFlags flags) {
+    if (!shape->indexed || shape->graphicsPipeline.topology !=
+                               VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST) {
+        return;
+    }
+
+    optimiseVertexCache(shape->indices, shape->indicesCount,
+                        shape->verticesCount);
+    optimiseVertexFetch(shape);
+
+    SimplifyTask tasks[LOD_MAX_LEVELS];
+    Job jobs[LOD_MAX_LEVELS];
+    uint32_t tasksCount = 0;
+
+    for (uint32_t i = 1; i < LOD_MAX_LEVELS; i++) {
+        uint32_t targetTriangles = shape->indicesCount / 3 >> i;
+        if (targetTriangles < LOD_MIN_TRIANGLES) {
+            break;
+        }
+
+        tasks[tasksCount] = (SimplifyTask){
+            .shape = shape,
+            .targetIndicesCount = targetTriangles * 3,
+        };
+        jobs[tasksCount] = (Job){
+            .function = simplifyLevel,
+            .data = &tasks[tasksCount],
+        };
+        tasksCount++;
+    }
+
+    JobCounter simplified = {0};
+    runJobs(jobs, tasksCount, &simplified);
+    waitForJobs(&simplified);
+
+    shape->lods = malloc((tasksCount + 1) * sizeof(*shape->lods));
+    shape->lodCount = 0;
+
+    GraphicsPipeline graphicsPipeline = shape->graphicsPipeline;
+    uint32_t *indices = NULL;
+    uint32_t indicesCount = 0;
+    // triangle list length of the last level kept, before any stripping
+    uint32_t previousCount = 0;
+
+    for (uint32_t i = 0; i <= tasksCount; i++) {
+        Shape level = {
+            .vertices = shape->vertices,
+            .verticesCount = shape->verticesCount,
+            .graphicsPipeline = graphicsPipeline,
+            .indexed = true,
+        };
+
+        if (i == 0) {
+            level.indices = malloc(shape->indicesCount * sizeof(*indices));
+            memcpy(level.indices, shape->indices,
+                   shape->indicesCount * sizeof(*indices));
+            level.indicesCount = shape->indicesCount;
+        } else {
+            level.indices = tasks[i - 1].indices;
+            level.indicesCount = tasks[i - 1].indicesCount;
+
+            // the simplifier stalled, the level would only cost memory
+            if (level.indicesCount > previousCount * LOD_MIN_REDUCTION) {
+                freeMem(1, level.indices);
+                continue;
+            }
+
+            // vertex order is shared, only the triangle order is per level
+            optimiseVertexCache(level.indices, level.indicesCount,
+                                level.verticesCount);
+        }
+
+        if (flags & SHAPE_OPTIMISE_OVERDRAW) {
+            optimiseOverdraw(level.indices, level.indicesCount,
+                             level.vertices, level.verticesCount,
+                             OVERDRAW_THRESHOLD);
+        }
+
+        previousCount = level.indicesCount;
+        if (flags & SHAPE_MESHLETS) {
+            buildShapeMeshlets(&level);
+        }
+        if (flags & SHAPE_TRIANGLE_STRIPS) {
+            stripShape(&level);
+        }
+
+        indices = realloc(indices, (indicesCount + level.indicesCount) *
+                                       sizeof(*indices));
+        memcpy(indices + indicesCount, level.indices,
+               level.indicesCount * sizeof(*indices));
+
+        shape->lods[shape->lodCount] = (ShapeLod){
+            .firstIndex = indicesCount,
+            .indicesCount = level.indicesCount,
+            .vertexOffset = 0,
+            .error = i == 0 ? 0.0f : tasks[i - 1].error,
+        };
+        appendMeshlets(shape, &shape->lods[shape->lodCount++], &level);
+        indicesCount += level.indicesCount;
+
+        shape->graphicsPipeline.topology = level.graphicsPipeline.topology;
+        shape->graphicsPipeline.primitiveRestart =
+            level.graphicsPipeline.primitiveRestart;
+
+        freeMem(2, level.indices, level.meshlets);
+    }
+
+    freeMem(1, shape->indices);
+    shape->indices = indices;
+    shape->indicesCount = indicesCount;
+
+    shape->boundingRadius = shapeBoundingRadius(shape);
+}
+
+// a shape without levels still needs one to draw its meshlets indirectly
+void makeSingleLod(Shape *shape) {
+    shape->lods = malloc(sizeof(*shape->lods));
+    shape->lods[0] = (ShapeLod){
+        .firstIndex = 0,
+        .indicesCount = shape->indicesCount,
+        .vertexOffset = 0,
+        .error = 0.0f,
+        .firstMeshlet = 0,
+        .meshletsCount = shape->meshletsCount,
+    };
+    shape->lodCount = 1;
+
+    shape->boundingRadius = shapeBoundingRadius(shape);
+}
+
+// pixels an object space unit covers at the nearest point of a sphere, given
+// as its object space centre and radius, infinite once the camera is inside
+float projectedPixelsPerUnit(const UniformBufferObject *ubo,
+                             const float *centre, float radius,
+                             float viewportHeight) {
+    mat4 modelView;
+    glm_mat4_mul((vec4 *)ubo->view, (vec4 *)ubo->model, modelView);
+
+    float scale = fmaxf(glm_vec3_norm(modelView[0]),
+                        fmaxf(glm_vec3_norm(modelView[1]),
+                              glm_vec3_norm(modelView[2])));
+
+    vec3 viewCentre;
+    glm_mat4_mulv3(modelView, (float *)centre, 1.0f, viewCentre);
+    float nearest = glm_vec3_norm(viewCentre) - radius * scale;
+
+    if (nearest <= 0.0f) {
+        return INFINITY;
+    }
+
+    return fabsf(ubo->proj[1][1]) * viewportHeight * 0.5f * scale / nearest;
+}
+
+// coarsest level whose error projects to no more than LOD_PIXEL_ERROR at the
+// nearest point of the shape's bounding sphere
+uint32_t selectLod(const Shape *shape, const UniformBufferObject *ubo,
+                   float viewportHeight) {
+    float pixelsPerUnit = projectedPixelsPerUnit(
+        ubo, GLM_VEC3_ZERO, shape->boundingRadius, viewportHeight);
+
+    for (uint32_t i = shape->lodCount; i > 0; i--) {
+        if (shape->lods[i - 1].error * pixelsPerUnit <= LOD_PIXEL_ERROR) {
+            return i - 1;
+        }
+    }
+
+    return 0;
+}
+
+void createIndirectBuffers(Vulkan *vulkan, Shape *shape) {
+    uint32_t imagesCount = vulkan->swapchain.swapChainImagesCount;
+
+    // room for every meshlet of the largest level, or every slot of a stream
+    shape->drawsCount = 1;
+    for (uint32_t i = 0; i < shape->lodCount; i++) {
+        if (shape->lods[i].meshletsCount > shape->drawsCount) {
+            shape->drawsCount = shape->lods[i].meshletsCount;
+        }
+    }
+    if (shape->stream) {
+        shape->drawsCount = shape->stream->slotsCount;
+    }
+
+    shape->indirectBuffers = malloc(imagesCount * sizeof(VkBuffer));
+    shape->indirectBuffersMemory = malloc(imagesCount * sizeof(VkDeviceMemory));
+
+    for (uint32_t i = 0; i < imagesCount; i++) {
+        createBuffer(shape->drawsCount * sizeof(VkDrawIndexedIndirectCommand),
+                     VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
+                     VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                         VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                     vulkan, &shape->indirectBuffers[i],
+                     &shape->indirectBuffersMemory[i]);
+    }
+}
+
+// the command buffers are recorded once, so the level and the meshlets that
+// survive culling reach them through the indirect draws rather than a
+// re-record
+void updateIndirectBuffer(Vulkan *vulkan, Shape *shape, uint32_t imageIndex) {
+    if (shape->stream) {
+        updateMeshStream(vulkan, shape, imageIndex);
+        return;
+    }
+
+    const ShapeLod *lod =
+        &shape->lods[selectLod(shape, &vulkan->ubo,
+                               vulkan->swapchain.swapChainExtent->height)];
+
+    VkDrawIndexedIndirectCommand *commands;
+    vkMapMemory(vulkan->device.device, shape->indirectBuffersMemory[imageIndex],
+                0, shape->drawsCount * sizeof(*commands), 0,
+                (void **)&commands);
+
+    uint32_t drawsCount;
+    if (lod->meshletsCount) {
+        drawsCount = cullMeshlets(commands,
+                                  &shape->meshlets[lod->firstMeshlet],
+                                  lod->meshletsCount, lod->vertexOffset,
+                                  &vulkan->ubo);
+    } else {
+        // the level as one meshlet, bounded by the shape's sphere and never
+        // facing away as a whole
+        Meshlet whole = {
+            .sphere = {0.0f, 0.0f, 0.0f, shape->boundingRadius},
+            .cone = {0.0f, 0.0f, 0.0f, 1.0f},
+            .firstIndex = lod->firstIndex,
+            .indicesCount = lod->indicesCount,
+        };
+        drawsCount = cullMeshlets(commands, &whole, 1, lod->vertexOffset,
+                                  &vulkan->ubo);
+    }
+    shape->visibleDraws = drawsCount;
+
+    // the recorded draw count is fixed, the rest draw nothing
+    memset(&commands[drawsCount], 0,
+           (shape->drawsCount - drawsCount) * sizeof(*commands));
+
+    vkUnmapMemory(vulkan->device.device,
+                  shape->indirectBuffersMemory[imageIndex]);
+}
+
+void destroyIndirectBuffers(Vulkan *vulkan, Shape *shape) {
+    for (uint32_t i = 0; i < vulkan->swapchain.swapChainImagesCount; i++) {
+        vkDestroyBuffer(vulkan->device.device, shape->indirectBuffers[i], NULL);
+        vkFreeMemory(vulkan->device.device, shape->indirectBuffersMemory[i],
+                     NULL);
+    }
+
+    freeMem(2, shape->indirectBuffers, shape->indirectBuffersMemory);
+}
@@ -0,0 +1,401 @@
+#include "geometry/mesh/gltf.h"
+#include "geometry/geometry.h"
+#include "geometry/mesh/json.h"
+#include "geometry/mesh/mesh.h"
+#include "utility/error_handle.h"
+#include "utility/mapped_file.h"
+#include "vulkan_handle/memory.h"
+#include <cglm/vec2.h>
+#include <cglm/vec3.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define GLB_MAGIC 0x46546c67u // glTF
+#define GLB_CHUNK_JSON 0x4e4f534au
+#define GLB_CHUNK_BIN 0x004e4942u
+#define GLB_HEADER_SIZE 12
+#define GLB_CHUNK_HEADER_SIZE 8
+
+#define GLTF_UNSIGNED_BYTE 5121
+#define GLTF_UNSIGNED_SHORT 5123
+#define GLTF_UNSIGNED_INT 5125
+#define GLTF_FLOAT 5126
+#define GLTF_TRIANGLES 4
+
+typedef struct GltfBuffer {
+    const unsigned char *data;
+    size_t size;
+    MappedFile file;       // external .bin files
+    unsigned char *decoded; // base64 data uris
+} GltfBuffer;
+
+typedef struct GltfDocument {
+    const JsonToken *tokens;
+    GltfBuffer *buffers;
+    uint32_t buffersCount;
+    int32_t accessors;
+    int32_t bufferViews;
+} GltfDocument;
+
+// strided view of one attribute or index accessor
+typedef struct GltfAccessor {
+    const unsigned char *data;
+    uint32_t count;
+    uint32_t stride;
+    uint32_t componentType;
+    uint32_t componentSize;
+    uint32_t components;
+} GltfAccessor;
+
+static inline uint32_t readUint32(const char *at) {
+    uint32_t value;
+    memcpy(&value, at, sizeof(value));
+    return value;
+}
+
+static int8_t base64Value(char c) {
+    if (c >= 'A' && c <= 'Z') {
+        return c - 'A';
+    }
+    if (c >= 'a' && c <= 'z') {
+        return c - 'a' + 26;
+    }
+    if (c >= '0' && c <= '9') {
+        return c - '0' + 52;
+    }
+    return c == '+' ? 62 : c == '/' ? 63 : -1;
+}
+
+static unsigned char *decodeBase64(const char *at, const char *end,
+                                   size_t *size) {
+    unsigned char *decoded = malloc((end - at) / 4 * 3 + 3);
+    uint32_t bits = 0, bitsCount = 0;
+    *size = 0;
+
+    for (; at < end; at++) {
+        int8_t value = base64Value(*at);
+        if (value < 0) {
+            break;
+        }
+        bits = bits << 6 | value;
+        bitsCount += 6;
+        if (bitsCount >= 8) {
+            bitsCount -= 8;
+            decoded[(*size)++] = (unsigned char)(bits >> bitsCount);
+        }
+    }
+
+    return decoded;
+}
+
+// uris are relative to the gltf file
+static void loadBuffer(GltfBuffer *buffer, const JsonToken *uri,
+                       const char *fileName) {
+    static const char dataPrefix[] = "data:";
+    size_t uriLength = uri->end - uri->start;
+
+    if (uriLength > sizeof(dataPrefix) - 1 &&
+        memcmp(uri->start, dataPrefix, sizeof(dataPrefix) - 1) == 0) {
+        const char *payload = memchr(uri->start, ',', uriLength);
+        if (!payload) {
+            THROW_ERROR("gltf data uri has no payload!\n");
+        }
+        buffer->decoded = decodeBase64(payload + 1, uri->end, &buffer->size);
+        buffer->data = buffer->decoded;
+        return;
+    }
+
+    const char *slash = strrchr(fileName, '/');
+    const char *backslash = strrchr(fileName, '\\');
+    if (backslash > slash) {
+        slash = backslash;
+    }
+    size_t directoryLength = slash ? (size_t)(slash - fileName) + 1 : 0;
+
+    char *path = malloc(directoryLength + uriLength + 1);
+    memcpy(path, fileName, directoryLength);
+    memcpy(path + directoryLength, uri->start, uriLength);
+    path[directoryLength + uriLength] = '\0';
+
+    if (!mapFile(path, MAPPED_FILE_SEQUENTIAL, &buffer->file)) {
+        THROW_ERROR("failed to open gltf buffer!\n");
+    }
+    freeMem(1, path);
+
+    buffer->data = (const unsigned char *)buffer->file.data;
+    buffer->size = buffer->file.size;
+}
+
+static uint32_t typeComponents(const JsonToken *type) {
+    static const char *types[] = {"SCALAR", "VEC2", "VEC3", "VEC4"};
+    for (uint32_t i = 0; i < SIZEOF(types); i++) {
+        if (jsonEquals(type, types[i])) {
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+static uint32_t componentSize(uint32_t componentType) {
+    switch (componentType) {
+    case GLTF_UNSIGNED_BYTE:
+        return 1;
+    case GLTF_UNSIGNED_SHORT:
+        return 2;
+    case GLTF_UNSIGNED_INT:
+    case GLTF_FLOAT:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+static void readAccessor(const GltfDocument *document, int64_t index,
+                         GltfAccessor *accessor) {
+    const JsonToken *tokens = document->tokens;
+
+    // a missing index wraps past every array and is caught as absent
+    int32_t token =
+        jsonElement(tokens, document->accessors, (uint32_t)index);
+    if (token < 0) {
+        THROW_ERROR("gltf accessor is missing!\n");
+    }
+
+    int32_t view = jsonElement(
+        tokens, document->bufferViews,
+        (uint32_t)jsonInt(tokens, jsonFind(tokens, token, "bufferView"), -1));
+    if (view < 0) {
+        THROW_ERROR("gltf accessors without a buffer view are unsupported!\n");
+    }
+
+    int64_t bufferIndex = jsonInt(tokens, jsonFind(tokens, view, "buffer"), -1);
+    if (bufferIndex < 0 || bufferIndex >= document->buffersCount) {
+        THROW_ERROR("gltf buffer view refers to a missing buffer!\n");
+    }
+    const GltfBuffer *buffer = &document->buffers[bufferIndex];
+
+    int32_t type = jsonFind(tokens, token, "type");
+    *accessor = (GltfAccessor){
+        .count = (uint32_t)jsonInt(tokens, jsonFind(tokens, token, "count"), 0),
+        .componentType = (uint32_t)jsonInt(
+            tokens, jsonFind(tokens, token, "componentType"), 0),
+        .components = type < 0 ? 0 : typeComponents(&tokens[type]),
+    };
+    accessor->componentSize = componentSize(accessor->componentType);
+    if (!accessor->componentSize || !accessor->components) {
+        THROW_ERROR("gltf accessor has an unsupported type!\n");
+    }
+
+    uint32_t elementSize = accessor->componentSize * accessor->components;
+    accessor->stride = (uint32_t)jsonInt(
+        tokens, jsonFind(tokens, view, "byteStride"), elementSize);
+
+    size_t offset =
+        jsonInt(tokens, jsonFind(tokens, view, "byteOffset"), 0) +
+        jsonInt(tokens, jsonFind(tokens, token, "byteOffset"), 0);
+    if (accessor->count &&
+        offset + (size_t)accessor->stride * (accessor->count - 1) +
+                elementSize >
+            buffer->size) {
+        THROW_ERROR("gltf accessor runs past its buffer!\n");
+    }
+    accessor->data = buffer->data + offset;
+}
+
+// floats as they are, unsigned integers as normalised
+static inline float readFloat(const GltfAccessor *accessor, uint32_t element,
+                              uint32_t component) {
+    const unsigned char *at = accessor->data +
+                              (size_t)element * accessor->stride +
+                              component * accessor->componentSize;
+    switch (accessor->componentType) {
+    case GLTF_FLOAT: {
+        float value;
+        memcpy(&value, at, sizeof(value));
+        return value;
+    }
+    case GLTF_UNSIGNED_BYTE:
+        return *at / 255.0f;
+    case GLTF_UNSIGNED_SHORT: {
+        uint16_t value;
+        memcpy(&value, at, sizeof(value));
+        return value / 65535.0f;
+    }
+    default:
+        return 0.0f;
+    }
+}
+
+static inline uint32_t readIndex(const GltfAccessor *accessor,
+                                 uint32_t element) {
+    const unsigned char *at =
+        accessor->data + (size_t)element * accessor->stride;
+    switch (accessor->componentType) {
+    case GLTF_UNSIGNED_BYTE:
+        return *at;
+    case GLTF_UNSIGNED_SHORT: {
+        uint16_t value;
+        memcpy(&value, at, sizeof(value));
+        return value;
+    }
+    default: {
+        uint32_t value;
+        memcpy(&value, at, sizeof(value));
+        return value;
+    }
+    }
+}
+
+static void loadPrimitive(Shape *shape, const GltfDocument *document,
+                          int32_t primitive) {
+    const JsonToken *tokens = document->tokens;
+
+    if (jsonInt(tokens, jsonFind(tokens, primitive, "mode"), GLTF_TRIANGLES) !=
+        GLTF_TRIANGLES) {
+        return;
+    }
+
+    int32_t attributes = jsonFind(tokens, primitive, "attributes");
+    if (attributes < 0) {
+        return;
+    }
+
+    GltfAccessor positions;
+    readAccessor(document,
+                 jsonInt(tokens, jsonFind(tokens, attributes, "POSITION"), -1),
+                 &positions);
+    if (positions.componentType != GLTF_FLOAT || positions.components != 3) {
+        THROW_ERROR("gltf positions have to be float vec3!\n");
+    }
+
+    GltfAccessor normals = {0}, texCoords = {0};
+    int64_t normalsIndex =
+        jsonInt(tokens, jsonFind(tokens, attributes, "NORMAL"), -1);
+    int64_t texCoordsIndex =
+        jsonInt(tokens, jsonFind(tokens, attributes, "TEXCOORD_0"), -1);
+    if (normalsIndex >= 0) {
+        readAccessor(document, normalsIndex, &normals);
+    }
+    if (texCoordsIndex >= 0) {
+        readAccessor(document, texCoordsIndex, &texCoords);
+    }
+
+    uint32_t base = shape->verticesCount;
+    shape->vertices = realloc(shape->vertices, (base + positions.count) *
+                                                   sizeof(*shape->vertices));
+
+    for (uint32_t i = 0; i < positions.count; i++) {
+        Vertex *vertex = &shape->vertices[base + i];
+        for (uint32_t k = 0; k < 3; k++) {
+            vertex->pos[k] = readFloat(&positions, i, k);
+            // left at zero to be generated from the faces
+            vertex->normal[k] =
+                i < normals.count ? readFloat(&normals, i, k) : 0.0f;
+        }
+        for (uint32_t k = 0; k < 2; k++) {
+            vertex->texCoord[k] =
+                i < texCoords.count ? readFloat(&texCoords, i, k) : 0.0f;
+        }
+        glm_vec3_copy((vec3)WHITE, vertex->colour);
+    }
+    shape->verticesCount += positions.count;
+
+    int64_t indicesIndex =
+        jsonInt(tokens, jsonFind(tokens, primitive, "indices"), -1);
+    GltfAccessor indices = {.count = positions.count};
+    if (indicesIndex >= 0) {
+        readAccessor(document, indicesIndex, &indices);
+    }
+
+    uint32_t count = indices.count - indices.count % 3;
+    shape->indices = realloc(shape->indices, (shape->indicesCount + count) *
+                                                 sizeof(*shape->indices));
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t index = indices.data ? readIndex(&indices, i) : i;
+        if (index >= positions.count) {
+            THROW_ERROR("gltf index refers to a missing vertex!\n");
+        }
+        shape->indices[shape->indicesCount++] = base + index;
+    }
+}
+
+// Every triangle primitive of every mesh, in object space. Node transforms,
+// sparse accessors and the other texture coordinate sets are not read.
+void loadGltf(Shape *shape, const char *fileName, const MappedFile *file) {
+    const char *json = file->data;
+    const char *jsonEnd = file->data + file->size;
+    GltfBuffer binary = {0};
+
+    if (file->size >= GLB_HEADER_SIZE + GLB_CHUNK_HEADER_SIZE &&
+        readUint32(file->data) == GLB_MAGIC) {
+        uint32_t length = readUint32(file->data + GLB_HEADER_SIZE);
+        if (readUint32(file->data + GLB_HEADER_SIZE + 4) != GLB_CHUNK_JSON ||
+            GLB_HEADER_SIZE + GLB_CHUNK_HEADER_SIZE + (size_t)length >
+                file->size) {
+            THROW_ERROR("glb file does not start with json!\n");
+        }
+        json = file->data + GLB_HEADER_SIZE + GLB_CHUNK_HEADER_SIZE;
+        jsonEnd = json + length;
+
+        // the optional binary chunk stands in for the first buffer
+        const char *chunk = jsonEnd;
+        if ((size_t)(chunk - file->data) + GLB_CHUNK_HEADER_SIZE <=
+                file->size &&
+            readUint32(chunk + 4) == GLB_CHUNK_BIN) {
+            binary.data = (const unsigned char *)chunk + GLB_CHUNK_HEADER_SIZE;
+            binary.size = readUint32(chunk);
+            if ((size_t)(chunk - file->data) + GLB_CHUNK_HEADER_SIZE +
+                    binary.size >
+                file->size) {
+                THROW_ERROR("glb binary chunk is truncated!\n");
+            }
+        }
+    }
+
+    JsonToken *tokens;
+    if (!parseJson(&tokens, json, jsonEnd)) {
+        THROW_ERROR("gltf file is not valid json!\n");
+    }
+
+    GltfDocument document = {
+        .tokens = tokens,
+        .accessors = jsonFind(tokens, 0, "accessors"),
+        .bufferViews = jsonFind(tokens, 0, "bufferViews"),
+    };
+
+    int32_t buffers = jsonFind(tokens, 0, "buffers");
+    document.buffersCount = buffers < 0 ? 0 : tokens[buffers].size;
+    document.buffers =
+        calloc(document.buffersCount, sizeof(*document.buffers));
+
+    for (uint32_t i = 0; i < document.buffersCount; i++) {
+        int32_t uri = jsonFind(tokens, jsonElement(tokens, buffers, i), "uri");
+        if (uri >= 0) {
+            loadBuffer(&document.buffers[i], &tokens[uri], fileName);
+        } else if (i == 0 && binary.data) {
+            document.buffers[i] = binary;
+        } else {
+            THROW_ERROR("gltf buffer has no data!\n");
+        }
+    }
+
+    int32_t meshes = jsonFind(tokens, 0, "meshes");
+    for (uint32_t m = 0; meshes >= 0 && m < tokens[meshes].size; m++) {
+        int32_t primitives =
+            jsonFind(tokens, jsonElement(tokens, meshes, m), "primitives");
+        for (uint32_t p = 0; primitives >= 0 && p < tokens[primitives].size;
+             p++) {
+            loadPrimitive(shape, &document,
+                          jsonElement(tokens, primitives, p));
+        }
+    }
+
+    for (uint32_t i = 0; i < document.buffersCount; i++) {
+        if (document.buffers[i].file.data) {
+            unmapFile(&document.buffers[i].file);
+        }
+        freeMem(1, document.buffers[i].decoded);
+    }
+    freeMem(2, document.buffers, tokens);
+}
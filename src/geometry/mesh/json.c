@@ -0,0 +1,164 @@
+#include "geometry/mesh/json.h"
+#include "geometry/mesh/parse.h"
+#include <stdlib.h>
+#include <string.h>
+
+// containers deeper than this are not something a mesh file needs
+#define JSON_MAX_DEPTH 64
+
+typedef struct JsonParser {
+    JsonToken *tokens;
+    uint32_t count;
+    uint32_t capacity;
+} JsonParser;
+
+static uint32_t addToken(JsonParser *parser, JsonType type,
+                         const char *start) {
+    if (parser->count == parser->capacity) {
+        parser->capacity = parser->capacity ? parser->capacity * 2 : 256;
+        parser->tokens = realloc(parser->tokens,
+                                 parser->capacity * sizeof(*parser->tokens));
+    }
+    parser->tokens[parser->count] = (JsonToken){
+        .type = type,
+        .start = start,
+    };
+    return parser->count++;
+}
+
+// Returns the number of tokens, or 0 when the text is not valid json. The
+// tokens point into the text, which has to outlive them.
+uint32_t parseJson(JsonToken **tokens, const char *text, const char *end) {
+    JsonParser parser = {0};
+    uint32_t open[JSON_MAX_DEPTH];
+    uint32_t depth = 0;
+
+    const char *at = text;
+    while (true) {
+        skipWhitespace(&at, end);
+        if (at == end) {
+            break;
+        }
+
+        char c = *at;
+        if (c == ',' || c == ':') {
+            at++;
+            continue;
+        }
+
+        if (c == '}' || c == ']') {
+            if (depth == 0) {
+                goto invalid;
+            }
+            JsonToken *container = &parser.tokens[open[--depth]];
+            container->end = ++at;
+            container->next = parser.count;
+            continue;
+        }
+
+        // every token is a child of the open container
+        if (depth) {
+            parser.tokens[open[depth - 1]].size++;
+        }
+
+        if (c == '{' || c == '[') {
+            if (depth == JSON_MAX_DEPTH) {
+                goto invalid;
+            }
+            open[depth++] =
+                addToken(&parser, c == '{' ? JSON_OBJECT : JSON_ARRAY, at++);
+            continue;
+        }
+
+        uint32_t token;
+        if (c == '"') {
+            token = addToken(&parser, JSON_STRING, ++at);
+            while (at < end && *at != '"') {
+                at += *at == '\\' ? 2 : 1;
+            }
+            if (at >= end) {
+                goto invalid;
+            }
+            parser.tokens[token].end = at++;
+        } else {
+            token = addToken(&parser, JSON_PRIMITIVE, at);
+            while (at < end && *at != ',' && *at != ':' && *at != '}' &&
+                   *at != ']' && *at != ' ' && *at != '\t' && *at != '\n' &&
+                   *at != '\r') {
+                at++;
+            }
+            parser.tokens[token].end = at;
+        }
+        parser.tokens[token].next = token + 1;
+    }
+
+    if (depth != 0 || parser.count == 0) {
+        goto invalid;
+    }
+
+    // an object's size counted keys and values separately
+    for (uint32_t i = 0; i < parser.count; i++) {
+        if (parser.tokens[i].type == JSON_OBJECT) {
+            parser.tokens[i].size /= 2;
+        }
+    }
+
+    *tokens = parser.tokens;
+    return parser.count;
+
+invalid:
+    free(parser.tokens);
+    *tokens = NULL;
+    return 0;
+}
+
+bool jsonEquals(const JsonToken *token, const char *string) {
+    size_t length = strlen(string);
+    return token->type == JSON_STRING &&
+           (size_t)(token->end - token->start) == length &&
+           memcmp(token->start, string, length) == 0;
+}
+
+// Lookups return -1 when the key or element is absent, and take -1 for a
+// missing container, so a chain of them only has to be checked at the end.
+
+// value of the key in the object
+int32_t jsonFind(const JsonToken *tokens, int32_t object, const char *key) {
+    if (object < 0 || tokens[object].type != JSON_OBJECT) {
+        return -1;
+    }
+
+    uint32_t at = (uint32_t)object + 1;
+    for (uint32_t i = 0; i < tokens[object].size; i++) {
+        uint32_t value = tokens[at].next;
+        if (jsonEquals(&tokens[at], key)) {
+            return (int32_t)value;
+        }
+        at = tokens[value].next;
+    }
+    return -1;
+}
+
+int32_t jsonElement(const JsonToken *tokens, int32_t array, uint32_t index) {
+    if (array < 0 || tokens[array].type != JSON_ARRAY ||
+        index >= tokens[array].size) {
+        return -1;
+    }
+
+    uint32_t at = (uint32_t)array + 1;
+    for (uint32_t i = 0; i < index; i++) {
+        at = tokens[at].next;
+    }
+    return (int32_t)at;
+}
+
+// integer value of the token, or the fallback when it is absent
+int64_t jsonInt(const JsonToken *tokens, int32_t token, int64_t fallback) {
+    if (token < 0 || tokens[token].type != JSON_PRIMITIVE) {
+        return fallback;
+    }
+
+    const char *at = tokens[token].start;
+    int64_t value;
+    return parseInt(&at, tokens[token].end, &value) ? value : fallback;
+}
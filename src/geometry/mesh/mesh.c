@@ -0,0 +1,92 @@
+#include "geometry/mesh/mesh.h"
+#include "geometry/geometry.h"
+#include "geometry/mesh/gltf.h"
+#include "geometry/mesh/obj.h"
+#include "geometry/normals/normals.h"
+#include "utility/error_handle.h"
+#include "utility/mapped_file.h"
+#include "vulkan_handle/memory.h"
+#include <cglm/vec3.h>
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+// doubles the array until it holds at least count elements
+inline void *growArray(void *array, uint32_t *capacity, uint32_t count,
+                       size_t elementSize) {
+    if (count <= *capacity) {
+        return array;
+    }
+
+    uint32_t grown = *capacity ? *capacity : MESH_INITIAL_CAPACITY;
+    while (grown < count) {
+        grown *= 2;
+    }
+    *capacity = grown;
+
+    return realloc(array, grown * elementSize);
+}
+
+// vertices loaded without a normal have it at zero, they get the angle
+// weighted sum of the faces around them
+void generateMissingNormals(Shape *shape) {
+    bool *missing = malloc(shape->verticesCount * sizeof(*missing));
+    bool anyMissing = false;
+    for (uint32_t i = 0; i < shape->verticesCount; i++) {
+        missing[i] = glm_vec3_norm2(shape->vertices[i].normal) == 0.0f;
+        anyMissing |= missing[i];
+    }
+
+    if (anyMissing) {
+        generateNormals(shape, NORMALS_ANGLE_WEIGHTED, missing);
+    }
+
+    freeMem(1, missing);
+}
+
+static bool hasExtension(const char *fileName, const char *extension) {
+    size_t nameLength = strlen(fileName);
+    size_t extensionLength = strlen(extension);
+    if (nameLength < extensionLength) {
+        return false;
+    }
+
+    const char *suffix = fileName + nameLength - extensionLength;
+    for (size_t i = 0; i < extensionLength; i++) {
+        if (tolower((unsigned char)suffix[i]) != extension[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// indexed triangle list from a wavefront obj, gltf or glb file
+void loadMesh(Shape *shape, const char *fileName) {
+    MappedFile file;
+    if (!mapFile(fileName, MAPPED_FILE_SEQUENTIAL, &file)) {
+        THROW_ERROR("failed to open mesh file!\n");
+    }
+
+    if (hasExtension(fileName, ".obj")) {
+        loadObj(shape, &file);
+    } else if (hasExtension(fileName, ".gltf") ||
+               hasExtension(fileName, ".glb")) {
+        loadGltf(shape, fileName, &file);
+    } else {
+        THROW_ERROR("unsupported mesh file format!\n");
+    }
+
+    unmapFile(&file);
+
+    if (shape->indicesCount == 0) {
+        THROW_ERROR("mesh file has no triangles!\n");
+    }
+
+    // the loaders grow by doubling, give back the slack
+    shape->vertices = realloc(shape->vertices,
+                              shape->verticesCount * sizeof(*shape->vertices));
+    shape->indices = realloc(shape->indices,
+                             shape->indicesCount * sizeof(*shape->indices));
+
+    generateMissingNormals(shape);
+}
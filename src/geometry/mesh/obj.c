@@ -0,0 +1,261 @@
+#include "geometry/mesh/obj.h"
+#include "geometry/geometry.h"
+#include "geometry/mesh/mesh.h"
+#include "geometry/mesh/parse.h"
+#include "utility/error_handle.h"
+#include "utility/mapped_file.h"
+#include "vulkan_handle/memory.h"
+#include <cglm/vec2.h>
+#include <cglm/vec3.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// face corners are looked up in a table at most this full
+#define VERTEX_MAP_LOAD 0.5f
+
+// a face corner, indices into the file's v, vt and vn lists or -1
+typedef struct ObjCorner {
+    int32_t position;
+    int32_t texCoord;
+    int32_t normal;
+} ObjCorner;
+
+typedef struct ObjLoader {
+    Shape *shape;
+    uint32_t verticesCapacity;
+    uint32_t indicesCapacity;
+
+    vec3 *positions;
+    uint32_t positionsCount;
+    uint32_t positionsCapacity;
+    vec2 *texCoords;
+    uint32_t texCoordsCount;
+    uint32_t texCoordsCapacity;
+    vec3 *normals;
+    uint32_t normalsCount;
+    uint32_t normalsCapacity;
+
+    // open addressing from a corner to the vertex made for it, the corner
+    // itself is kept per vertex
+    ObjCorner *corners;
+    uint32_t *table;
+    uint32_t tableCapacity;
+} ObjLoader;
+
+static inline uint32_t hashCorner(const ObjCorner *corner) {
+    uint32_t hash = (uint32_t)corner->position * 0x9e3779b1u;
+    hash = (hash ^ (hash >> 15)) + (uint32_t)corner->texCoord * 0x85ebca77u;
+    hash = (hash ^ (hash >> 13)) + (uint32_t)corner->normal * 0xc2b2ae3du;
+    return hash ^ (hash >> 16);
+}
+
+static void resizeTable(ObjLoader *loader, uint32_t capacity) {
+    free(loader->table);
+    loader->table = malloc(capacity * sizeof(*loader->table));
+    memset(loader->table, 0xff, capacity * sizeof(*loader->table));
+    loader->tableCapacity = capacity;
+
+    for (uint32_t v = 0; v < loader->shape->verticesCount; v++) {
+        uint32_t slot = hashCorner(&loader->corners[v]) & (capacity - 1);
+        while (loader->table[slot] != UINT32_MAX) {
+            slot = (slot + 1) & (capacity - 1);
+        }
+        loader->table[slot] = v;
+    }
+}
+
+static void addVertex(ObjLoader *loader, const ObjCorner *corner) {
+    Shape *shape = loader->shape;
+    if (shape->verticesCount == loader->verticesCapacity) {
+        loader->verticesCapacity = loader->verticesCapacity
+                                       ? loader->verticesCapacity * 2
+                                       : MESH_INITIAL_CAPACITY;
+        shape->vertices =
+            realloc(shape->vertices,
+                    loader->verticesCapacity * sizeof(*shape->vertices));
+        loader->corners =
+            realloc(loader->corners,
+                    loader->verticesCapacity * sizeof(*loader->corners));
+    }
+
+    Vertex *vertex = &shape->vertices[shape->verticesCount];
+    glm_vec3_copy(loader->positions[corner->position], vertex->pos);
+    glm_vec3_copy((vec3)WHITE, vertex->colour);
+
+    // left at zero to be generated from the faces
+    if (corner->normal >= 0) {
+        glm_vec3_copy(loader->normals[corner->normal], vertex->normal);
+    } else {
+        glm_vec3_zero(vertex->normal);
+    }
+
+    // obj puts the texture origin bottom left, vulkan top left
+    if (corner->texCoord >= 0) {
+        vertex->texCoord[0] = loader->texCoords[corner->texCoord][0];
+        vertex->texCoord[1] = 1.0f - loader->texCoords[corner->texCoord][1];
+    } else {
+        glm_vec2_zero(vertex->texCoord);
+    }
+
+    loader->corners[shape->verticesCount++] = *corner;
+}
+
+static uint32_t findVertex(ObjLoader *loader, const ObjCorner *corner) {
+    uint32_t mask = loader->tableCapacity - 1;
+    uint32_t slot = hashCorner(corner) & mask;
+
+    for (; loader->table[slot] != UINT32_MAX; slot = (slot + 1) & mask) {
+        const ObjCorner *existing = &loader->corners[loader->table[slot]];
+        if (existing->position == corner->position &&
+            existing->texCoord == corner->texCoord &&
+            existing->normal == corner->normal) {
+            return loader->table[slot];
+        }
+    }
+
+    uint32_t vertex = loader->shape->verticesCount;
+    addVertex(loader, corner);
+    loader->table[slot] = vertex;
+
+    if (loader->shape->verticesCount >
+        loader->tableCapacity * VERTEX_MAP_LOAD) {
+        resizeTable(loader, loader->tableCapacity * 2);
+    }
+
+    return vertex;
+}
+
+// 1 based, negative counts back from the latest, 0 is absent
+static inline bool resolveIndex(int64_t index, uint32_t count,
+                                int32_t *resolved) {
+    if (index > 0 && index <= count) {
+        *resolved = (int32_t)(index - 1);
+    } else if (index < 0 && -index <= count) {
+        *resolved = (int32_t)(count + index);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// v, v/vt, v//vn or v/vt/vn
+static bool parseCorner(const char **at, const char *end,
+                        const ObjLoader *loader, ObjCorner *corner) {
+    int64_t index;
+    *corner = (ObjCorner){-1, -1, -1};
+
+    if (!parseInt(at, end, &index) ||
+        !resolveIndex(index, loader->positionsCount, &corner->position)) {
+        return false;
+    }
+
+    if (*at < end && **at == '/') {
+        (*at)++;
+        if (*at < end && **at != '/' && parseInt(at, end, &index) &&
+            !resolveIndex(index, loader->texCoordsCount, &corner->texCoord)) {
+            return false;
+        }
+    }
+
+    if (*at < end && **at == '/') {
+        (*at)++;
+        if (parseInt(at, end, &index) &&
+            !resolveIndex(index, loader->normalsCount, &corner->normal)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// polygons are fanned out from their first corner
+static void parseFace(ObjLoader *loader, const char **at, const char *end) {
+    Shape *shape = loader->shape;
+    uint32_t first = 0, previous = 0;
+
+    for (uint32_t corners = 0;; corners++) {
+        skipSpaces(at, end);
+        if (*at == end || **at == '\n' || **at == '#') {
+            break;
+        }
+
+        ObjCorner corner;
+        if (!parseCorner(at, end, loader, &corner)) {
+            THROW_ERROR("obj face refers to a missing vertex!\n");
+        }
+        uint32_t vertex = findVertex(loader, &corner);
+
+        if (corners >= 2) {
+            shape->indices = growArray(shape->indices,
+                                       &loader->indicesCapacity,
+                                       shape->indicesCount + 3,
+                                       sizeof(*shape->indices));
+            shape->indices[shape->indicesCount++] = first;
+            shape->indices[shape->indicesCount++] = previous;
+            shape->indices[shape->indicesCount++] = vertex;
+        } else if (corners == 0) {
+            first = vertex;
+        }
+        previous = vertex;
+    }
+}
+
+static void parseVector(const char **at, const char *end, float *vector,
+                        uint32_t size) {
+    for (uint32_t i = 0; i < size; i++) {
+        skipSpaces(at, end);
+        if (!parseFloat(at, end, &vector[i])) {
+            THROW_ERROR("obj vertex is missing a component!\n");
+        }
+    }
+}
+
+// Single pass over the mapped file, corners become vertices as the faces
+// reach them so only the referenced combinations are ever stored. Anything
+// but geometry (groups, materials, smoothing) is skipped.
+void loadObj(Shape *shape, const MappedFile *file) {
+    ObjLoader loader = {.shape = shape};
+    resizeTable(&loader, MESH_INITIAL_CAPACITY);
+
+    const char *at = file->data;
+    const char *end = file->data + file->size;
+
+    while (at < end) {
+        skipWhitespace(&at, end);
+        if (at == end) {
+            break;
+        }
+
+        if (at[0] == 'v' && end - at > 1 && (at[1] == ' ' || at[1] == '\t')) {
+            at++;
+            loader.positions = growArray(
+                loader.positions, &loader.positionsCapacity,
+                loader.positionsCount + 1, sizeof(*loader.positions));
+            parseVector(&at, end, loader.positions[loader.positionsCount++],
+                        3);
+        } else if (at[0] == 'v' && end - at > 2 && at[1] == 't') {
+            at += 2;
+            loader.texCoords = growArray(
+                loader.texCoords, &loader.texCoordsCapacity,
+                loader.texCoordsCount + 1, sizeof(*loader.texCoords));
+            parseVector(&at, end, loader.texCoords[loader.texCoordsCount++],
+                        2);
+        } else if (at[0] == 'v' && end - at > 2 && at[1] == 'n') {
+            at += 2;
+            loader.normals =
+                growArray(loader.normals, &loader.normalsCapacity,
+                          loader.normalsCount + 1, sizeof(*loader.normals));
+            parseVector(&at, end, loader.normals[loader.normalsCount++], 3);
+        } else if (at[0] == 'f' && end - at > 1 &&
+                   (at[1] == ' ' || at[1] == '\t')) {
+            at++;
+            parseFace(&loader, &at, end);
+        }
+
+        skipLine(&at, end);
+    }
+
+    freeMem(5, loader.positions, loader.texCoords, loader.normals,
+            loader.corners, loader.table);
+}
@@ -0,0 +1,132 @@
+#include "geometry/mesh/parse.h"
+
+// mantissa digits past this cannot change a float, they only scale it
+#define MAX_MANTISSA_DIGITS 18
+
+// exact in a double up to 1e22
+static const double powersOfTen[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+static inline bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+// spaces and tabs, the line end is left for the caller
+inline void skipSpaces(const char **at, const char *end) {
+    while (*at < end && (**at == ' ' || **at == '\t' || **at == '\r')) {
+        (*at)++;
+    }
+}
+
+inline void skipWhitespace(const char **at, const char *end) {
+    while (*at < end && (**at == ' ' || **at == '\t' || **at == '\r' ||
+                         **at == '\n')) {
+        (*at)++;
+    }
+}
+
+// past the next newline
+inline void skipLine(const char **at, const char *end) {
+    while (*at < end && **at != '\n') {
+        (*at)++;
+    }
+    if (*at < end) {
+        (*at)++;
+    }
+}
+
+static inline double scaleByPowerOfTen(double value, int32_t exponent) {
+    while (exponent > 22) {
+        value *= 1e22;
+        exponent -= 22;
+    }
+    while (exponent < -22) {
+        value /= 1e22;
+        exponent += 22;
+    }
+    return exponent >= 0 ? value * powersOfTen[exponent]
+                         : value / powersOfTen[-exponent];
+}
+
+// [+-]digits[.digits][(e|E)[+-]digits], strtod without the locale lookups
+inline bool parseFloat(const char **at, const char *end, float *value) {
+    const char *p = *at;
+
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p++ == '-';
+    }
+
+    uint64_t mantissa = 0;
+    uint32_t digits = 0;
+    int32_t exponent = 0;
+    bool any = false;
+
+    for (; p < end && isDigit(*p); p++, any = true) {
+        if (digits < MAX_MANTISSA_DIGITS) {
+            mantissa = mantissa * 10 + (*p - '0');
+            digits += mantissa != 0;
+        } else {
+            exponent++;
+        }
+    }
+
+    if (p < end && *p == '.') {
+        for (p++; p < end && isDigit(*p); p++, any = true) {
+            if (digits < MAX_MANTISSA_DIGITS) {
+                mantissa = mantissa * 10 + (*p - '0');
+                digits += mantissa != 0;
+                exponent--;
+            }
+        }
+    }
+
+    if (!any) {
+        return false;
+    }
+
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char *e = p + 1;
+        bool negativeExponent = false;
+        if (e < end && (*e == '-' || *e == '+')) {
+            negativeExponent = *e++ == '-';
+        }
+        if (e < end && isDigit(*e)) {
+            int32_t written = 0;
+            for (; e < end && isDigit(*e); e++) {
+                if (written < 10000) {
+                    written = written * 10 + (*e - '0');
+                }
+            }
+            exponent += negativeExponent ? -written : written;
+            p = e;
+        }
+    }
+
+    double result = scaleByPowerOfTen((double)mantissa, exponent);
+    *value = (float)(negative ? -result : result);
+    *at = p;
+    return true;
+}
+
+inline bool parseInt(const char **at, const char *end, int64_t *value) {
+    const char *p = *at;
+
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p++ == '-';
+    }
+
+    if (p == end || !isDigit(*p)) {
+        return false;
+    }
+
+    int64_t result = 0;
+    for (; p < end && isDigit(*p); p++) {
+        result = result * 10 + (*p - '0');
+    }
+
+    *value = negative ? -result : result;
+    *at = p;
+    return true;
+}
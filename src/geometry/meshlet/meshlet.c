@@ -0,0 +1,427 @@
+#include "geometry/meshlet/meshlet.h"
+#include "geometry/geometry.h"
+#include "vulkan_handle/memory.h"
+#include <cglm/mat4.h>
+#include <cglm/vec3.h>
+#include <cglm/vec4.h>
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vulkan/vulkan.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+typedef struct MeshletAdjacency {
+    uint32_t *offsets;   // per vertex start into triangles
+    uint32_t *triangles; // triangles using each vertex
+    bool *used;
+    vec3 *normals; // unit face normals, zero when degenerate
+} MeshletAdjacency;
+
+typedef struct MeshletBuilder {
+    uint32_t *marks; // meshlet a vertex was last added to, plus one
+    uint32_t *candidates;
+    uint32_t candidatesCount;
+    uint32_t candidatesCapacity;
+    uint32_t verticesCount;
+    uint32_t trianglesCount;
+    vec3 normal; // sum of the meshlet's face normals
+} MeshletBuilder;
+
+// unit normal of a counter clockwise triangle, false when it has no area
+static inline bool faceNormal(const Vertex *vertices, const uint32_t *triangle,
+                              vec3 normal) {
+    vec3 e1, e2;
+    glm_vec3_sub((float *)vertices[triangle[1]].pos,
+                 (float *)vertices[triangle[0]].pos, e1);
+    glm_vec3_sub((float *)vertices[triangle[2]].pos,
+                 (float *)vertices[triangle[0]].pos, e2);
+    glm_vec3_cross(e1, e2, normal);
+
+    float length = glm_vec3_norm(normal);
+    glm_vec3_scale(normal, length > 0.0f ? 1.0f / length : 0.0f, normal);
+    return length > 0.0f;
+}
+
+static void makeAdjacency(MeshletAdjacency *adjacency, const uint32_t *indices,
+                          uint32_t indicesCount, const Vertex *vertices,
+                          uint32_t verticesCount) {
+    uint32_t trianglesCount = indicesCount / 3;
+
+    adjacency->offsets = calloc(verticesCount + 1, sizeof(uint32_t));
+    adjacency->triangles = malloc(indicesCount * sizeof(uint32_t));
+    adjacency->used = calloc(trianglesCount, sizeof(bool));
+    adjacency->normals = malloc(trianglesCount * sizeof(vec3));
+
+    for (uint32_t i = 0; i < indicesCount; i++) {
+        adjacency->offsets[indices[i] + 1]++;
+    }
+    for (uint32_t i = 0; i < verticesCount; i++) {
+        adjacency->offsets[i + 1] += adjacency->offsets[i];
+    }
+
+    uint32_t *fill = malloc(verticesCount * sizeof(*fill));
+    memcpy(fill, adjacency->offsets, verticesCount * sizeof(*fill));
+    for (uint32_t i = 0; i < indicesCount; i++) {
+        adjacency->triangles[fill[indices[i]]++] = i / 3;
+    }
+    freeMem(1, fill);
+
+    for (uint32_t t = 0; t < trianglesCount; t++) {
+        faceNormal(vertices, &indices[t * 3], adjacency->normals[t]);
+    }
+}
+
+static inline uint32_t newVertices(const MeshletBuilder *builder,
+                                   const uint32_t *triangle, uint32_t mark) {
+    return (builder->marks[triangle[0]] != mark) +
+           (builder->marks[triangle[1]] != mark) +
+           (builder->marks[triangle[2]] != mark);
+}
+
+static void addTriangle(MeshletBuilder *builder,
+                        const MeshletAdjacency *adjacency,
+                        const uint32_t *indices, uint32_t triangle,
+                        uint32_t mark) {
+    adjacency->used[triangle] = true;
+    builder->trianglesCount++;
+    glm_vec3_add(builder->normal, adjacency->normals[triangle],
+                 builder->normal);
+
+    for (uint32_t k = 0; k < 3; k++) {
+        uint32_t vertex = indices[triangle * 3 + k];
+        if (builder->marks[vertex] == mark) {
+            continue;
+        }
+        builder->marks[vertex] = mark;
+        builder->verticesCount++;
+
+        // the vertex's other triangles now cost less to add
+        for (uint32_t i = adjacency->offsets[vertex];
+             i < adjacency->offsets[vertex + 1]; i++) {
+            if (adjacency->used[adjacency->triangles[i]]) {
+                continue;
+            }
+            if (builder->candidatesCount == builder->candidatesCapacity) {
+                builder->candidatesCapacity *= 2;
+                builder->candidates =
+                    realloc(builder->candidates,
+                            builder->candidatesCapacity *
+                                sizeof(*builder->candidates));
+            }
+            builder->candidates[builder->candidatesCount++] =
+                adjacency->triangles[i];
+        }
+    }
+}
+
+// the candidate adding the fewest vertices, ties go to the one closest to
+// the meshlet's facing so its cone stays narrow
+static uint32_t nextTriangle(MeshletBuilder *builder,
+                             const MeshletAdjacency *adjacency,
+                             const uint32_t *indices, uint32_t mark) {
+    uint32_t best = UINT32_MAX;
+    uint32_t bestNew = UINT32_MAX;
+    float bestFacing = -FLT_MAX;
+
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < builder->candidatesCount; i++) {
+        uint32_t triangle = builder->candidates[i];
+        if (adjacency->used[triangle]) {
+            continue;
+        }
+        builder->candidates[kept++] = triangle;
+
+        uint32_t added = newVertices(builder, &indices[triangle * 3], mark);
+        if (builder->verticesCount + added > MESHLET_MAX_VERTICES) {
+            continue;
+        }
+
+        float facing = glm_vec3_dot(builder->normal,
+                                    adjacency->normals[triangle]);
+        if (added < bestNew || (added == bestNew && facing > bestFacing)) {
+            best = triangle;
+            bestNew = added;
+            bestFacing = facing;
+        }
+    }
+    builder->candidatesCount = kept;
+
+    return best;
+}
+
+static void meshletBounds(Meshlet *meshlet, const uint32_t *indices,
+                          const Vertex *vertices) {
+    vec3 min = {FLT_MAX, FLT_MAX, FLT_MAX};
+    vec3 max = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+    for (uint32_t i = 0; i < meshlet->indicesCount; i++) {
+        const float *pos = vertices[indices[i]].pos;
+        for (uint32_t k = 0; k < 3; k++) {
+            min[k] = fminf(min[k], pos[k]);
+            max[k] = fmaxf(max[k], pos[k]);
+        }
+    }
+
+    vec3 centre;
+    glm_vec3_center(min, max, centre);
+
+    float radius = 0.0f;
+    for (uint32_t i = 0; i < meshlet->indicesCount; i++) {
+        radius = fmaxf(radius, glm_vec3_distance(
+                                   centre, (float *)vertices[indices[i]].pos));
+    }
+
+    vec3 axis = GLM_VEC3_ZERO_INIT;
+    for (uint32_t i = 0; i < meshlet->indicesCount; i += 3) {
+        vec3 normal;
+        faceNormal(vertices, &indices[i], normal);
+        glm_vec3_add(axis, normal, axis);
+    }
+    glm_vec3_normalize(axis);
+
+    float minFacing = 1.0f;
+    for (uint32_t i = 0; i < meshlet->indicesCount; i += 3) {
+        vec3 normal;
+        if (faceNormal(vertices, &indices[i], normal)) {
+            minFacing = fminf(minFacing, glm_vec3_dot(axis, normal));
+        }
+    }
+
+    memcpy(meshlet->sphere, centre, sizeof(centre));
+    meshlet->sphere[3] = radius;
+    memcpy(meshlet->cone, axis, sizeof(axis));
+    // a cone of half a sphere or more faces every way, a cutoff of one is
+    // never passed
+    meshlet->cone[3] =
+        minFacing > 0.0f ? sqrtf(1.0f - minFacing * minFacing) : 1.0f;
+}
+
+// Greedy clustering seeded in the existing order, which is cache optimised,
+// grown across shared vertices until either limit is hit. The indices are
+// rewritten so every meshlet is a contiguous run of them.
+uint32_t buildMeshlets(Meshlet **meshlets, uint32_t *indices,
+                       uint32_t indicesCount, const Vertex *vertices,
+                       uint32_t verticesCount) {
+    uint32_t trianglesCount = indicesCount / 3;
+    if (trianglesCount == 0) {
+        *meshlets = NULL;
+        return 0;
+    }
+
+    MeshletAdjacency adjacency;
+    makeAdjacency(&adjacency, indices, indicesCount, vertices, verticesCount);
+
+    MeshletBuilder builder = {
+        .marks = calloc(verticesCount, sizeof(uint32_t)),
+        .candidatesCapacity = MESHLET_MAX_VERTICES * 8,
+    };
+    builder.candidates =
+        malloc(builder.candidatesCapacity * sizeof(*builder.candidates));
+
+    uint32_t *ordered = malloc(indicesCount * sizeof(*ordered));
+    uint32_t orderedCount = 0;
+
+    *meshlets = malloc(trianglesCount * sizeof(**meshlets));
+    uint32_t meshletsCount = 0;
+
+    uint32_t seed = 0;
+    while (true) {
+        while (seed < trianglesCount && adjacency.used[seed]) {
+            seed++;
+        }
+        if (seed == trianglesCount) {
+            break;
+        }
+
+        uint32_t mark = meshletsCount + 1;
+        Meshlet *meshlet = &(*meshlets)[meshletsCount++];
+        meshlet->firstIndex = orderedCount;
+
+        builder.verticesCount = builder.trianglesCount = 0;
+        builder.candidatesCount = 0;
+        glm_vec3_zero(builder.normal);
+
+        uint32_t triangle = seed;
+        while (triangle != UINT32_MAX) {
+            addTriangle(&builder, &adjacency, indices, triangle, mark);
+            memcpy(&ordered[orderedCount], &indices[triangle * 3],
+                   3 * sizeof(*ordered));
+            orderedCount += 3;
+
+            if (builder.trianglesCount == MESHLET_MAX_TRIANGLES) {
+                break;
+            }
+            triangle = nextTriangle(&builder, &adjacency, indices, mark);
+        }
+
+        meshlet->indicesCount = orderedCount - meshlet->firstIndex;
+    }
+
+    memcpy(indices, ordered, orderedCount * sizeof(*indices));
+
+    for (uint32_t i = 0; i < meshletsCount; i++) {
+        meshletBounds(&(*meshlets)[i], &indices[(*meshlets)[i].firstIndex],
+                      vertices);
+    }
+
+    *meshlets = realloc(*meshlets, meshletsCount * sizeof(**meshlets));
+
+    freeMem(7, adjacency.offsets, adjacency.triangles, adjacency.used,
+            adjacency.normals, builder.marks, builder.candidates, ordered);
+
+    return meshletsCount;
+}
+
+void buildShapeMeshlets(Shape *shape) {
+    shape->meshletsCount =
+        buildMeshlets(&shape->meshlets, shape->indices, shape->indicesCount,
+                      shape->vertices, shape->verticesCount);
+
+#ifdef MESH_STATS
+    printf("mesh %u triangles, %u meshlets of %.1f triangles\n",
+           shape->indicesCount / 3, shape->meshletsCount,
+           shape->indicesCount / 3.0f / shape->meshletsCount);
+#endif
+}
+
+// camera and frustum carried into the shape's object space
+typedef struct CullView {
+    vec4 planes[6];
+    vec3 camera;
+} CullView;
+
+static void makeCullView(CullView *view, const UniformBufferObject *ubo) {
+    mat4 modelView, clip;
+    glm_mat4_mul((vec4 *)ubo->view, (vec4 *)ubo->model, modelView);
+    glm_mat4_mul((vec4 *)ubo->proj, modelView, clip);
+
+    mat4 inverse;
+    glm_mat4_inv(modelView, inverse);
+    glm_vec3_copy(inverse[3], view->camera);
+
+    // Gribb and Hartmann, rows of the clip matrix with a 0 to 1 depth range
+    for (uint32_t k = 0; k < 4; k++) {
+        view->planes[0][k] = clip[k][3] + clip[k][0];
+        view->planes[1][k] = clip[k][3] - clip[k][0];
+        view->planes[2][k] = clip[k][3] + clip[k][1];
+        view->planes[3][k] = clip[k][3] - clip[k][1];
+        view->planes[4][k] = clip[k][2];
+        view->planes[5][k] = clip[k][3] - clip[k][2];
+    }
+    for (uint32_t i = 0; i < 6; i++) {
+        float length = glm_vec3_norm(view->planes[i]);
+        glm_vec4_scale(view->planes[i], 1.0f / length, view->planes[i]);
+    }
+}
+
+// off screen, or every triangle faces away from the camera
+static inline bool meshletCulled(const Meshlet *meshlet,
+                                 const CullView *view) {
+    const float *sphere = meshlet->sphere;
+
+    for (uint32_t i = 0; i < 6; i++) {
+        if (glm_vec3_dot((float *)view->planes[i], (float *)sphere) +
+                view->planes[i][3] <
+            -sphere[3]) {
+            return true;
+        }
+    }
+
+    vec3 toCentre;
+    glm_vec3_sub((float *)sphere, (float *)view->camera, toCentre);
+    return glm_vec3_dot(toCentre, (float *)meshlet->cone) >=
+           meshlet->cone[3] * glm_vec3_norm(toCentre) + sphere[3];
+}
+
+#ifdef __SSE2__
+// four meshlets a time, transposed so every lane holds one meshlet
+static inline int meshletsCulled4(const Meshlet *meshlets,
+                                  const CullView *view) {
+    __m128 x = _mm_loadu_ps(meshlets[0].sphere);
+    __m128 y = _mm_loadu_ps(meshlets[1].sphere);
+    __m128 z = _mm_loadu_ps(meshlets[2].sphere);
+    __m128 r = _mm_loadu_ps(meshlets[3].sphere);
+    _MM_TRANSPOSE4_PS(x, y, z, r);
+
+    __m128 culled = _mm_setzero_ps();
+    for (uint32_t i = 0; i < 6; i++) {
+        __m128 distance = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(view->planes[i][0])),
+                       _mm_mul_ps(y, _mm_set1_ps(view->planes[i][1]))),
+            _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(view->planes[i][2])),
+                       _mm_set1_ps(view->planes[i][3])));
+        culled = _mm_or_ps(
+            culled,
+            _mm_cmplt_ps(distance, _mm_sub_ps(_mm_setzero_ps(), r)));
+    }
+
+    __m128 ax = _mm_loadu_ps(meshlets[0].cone);
+    __m128 ay = _mm_loadu_ps(meshlets[1].cone);
+    __m128 az = _mm_loadu_ps(meshlets[2].cone);
+    __m128 cutoff = _mm_loadu_ps(meshlets[3].cone);
+    _MM_TRANSPOSE4_PS(ax, ay, az, cutoff);
+
+    __m128 dx = _mm_sub_ps(x, _mm_set1_ps(view->camera[0]));
+    __m128 dy = _mm_sub_ps(y, _mm_set1_ps(view->camera[1]));
+    __m128 dz = _mm_sub_ps(z, _mm_set1_ps(view->camera[2]));
+
+    __m128 facing =
+        _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, ax), _mm_mul_ps(dy, ay)),
+                   _mm_mul_ps(dz, az));
+    __m128 distance = _mm_sqrt_ps(
+        _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)),
+                   _mm_mul_ps(dz, dz)));
+    culled = _mm_or_ps(
+        culled,
+        _mm_cmpge_ps(facing, _mm_add_ps(_mm_mul_ps(cutoff, distance), r)));
+
+    return _mm_movemask_ps(culled);
+}
+#endif
+
+static inline void writeDraw(VkDrawIndexedIndirectCommand *command,
+                             const Meshlet *meshlet, int32_t vertexOffset) {
+    *command = (VkDrawIndexedIndirectCommand){
+        .indexCount = meshlet->indicesCount,
+        .instanceCount = 1,
+        .firstIndex = meshlet->firstIndex,
+        .vertexOffset = vertexOffset,
+        .firstInstance = 0,
+    };
+}
+
+// writes a draw for every meshlet that may be seen and returns how many
+uint32_t cullMeshlets(VkDrawIndexedIndirectCommand *commands,
+                      const Meshlet *meshlets, uint32_t meshletsCount,
+                      int32_t vertexOffset, const UniformBufferObject *ubo) {
+    CullView view;
+    makeCullView(&view, ubo);
+
+    uint32_t drawsCount = 0;
+    uint32_t i = 0;
+
+#ifdef __SSE2__
+    for (; i + 4 <= meshletsCount; i += 4) {
+        int culled = meshletsCulled4(&meshlets[i], &view);
+        for (uint32_t k = 0; k < 4; k++) {
+            if (!(culled & (1 << k))) {
+                writeDraw(&commands[drawsCount++], &meshlets[i + k],
+                          vertexOffset);
+            }
+        }
+    }
+#endif
+
+    for (; i < meshletsCount; i++) {
+        if (!meshletCulled(&meshlets[i], &view)) {
+            writeDraw(&commands[drawsCount++], &meshlets[i], vertexOffset);
+        }
+    }
+
+    return drawsCount;
+}
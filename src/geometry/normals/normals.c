@@ -0,0 +1,297 @@
+#include "geometry/normals/normals.h"
+#include "error_handle.h"
+#include "geometry/geometry.h"
+#include "utility/job.h"
+#include "vulkan_handle/memory.h"
+#include <cglm/util.h>
+#include <cglm/vec3.h>
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// Per triangle values are structure of arrays, so four triangles fill a
+// vector with no shuffling on the way out.
+typedef struct NormalsBuild {
+    const uint32_t *indices;
+    uint32_t trianglesCount;
+    NormalWeighting weighting;
+    float *faceX, *faceY, *faceZ; // length twice the area when area weighted,
+                                  // otherwise unit
+    float *angles[3];             // per corner, angle weighted only
+    Vertex *vertices;
+    const bool *only;
+} NormalsBuild;
+
+// abramowitz and stegun 4.4.45, within 7e-5 radians, close enough for a
+// weight and cheap to vectorise
+static inline float approximateAcos(float x) {
+    x = fminf(fmaxf(x, -1.0f), 1.0f);
+    float a = fabsf(x);
+    float r = sqrtf(1.0f - a) *
+              (1.5707288f +
+               a * (-0.2121144f + a * (0.0742610f + a * -0.0187293f)));
+    return x < 0.0f ? GLM_PIf - r : r;
+}
+
+static inline float cornerAngle(const float *a, const float *b) {
+    float lengths = (a[0] * a[0] + a[1] * a[1] + a[2] * a[2]) *
+                    (b[0] * b[0] + b[1] * b[1] + b[2] * b[2]);
+    if (lengths <= 0.0f) {
+        return 0.0f;
+    }
+    float cosine = (a[0] * b[0] + a[1] * b[1] + a[2] * b[2]) / sqrtf(lengths);
+    return approximateAcos(cosine);
+}
+
+static void faceNormal(NormalsBuild *build, uint32_t triangle) {
+    const uint32_t *corners = &build->indices[triangle * 3];
+    const float *p[3];
+    for (uint32_t k = 0; k < 3; k++) {
+        p[k] = build->vertices[corners[k]].pos;
+    }
+
+    float e01[3], e02[3], e12[3];
+    for (uint32_t k = 0; k < 3; k++) {
+        e01[k] = p[1][k] - p[0][k];
+        e02[k] = p[2][k] - p[0][k];
+        e12[k] = p[2][k] - p[1][k];
+    }
+
+    float n[3] = {
+        e01[1] * e02[2] - e01[2] * e02[1],
+        e01[2] * e02[0] - e01[0] * e02[2],
+        e01[0] * e02[1] - e01[1] * e02[0],
+    };
+
+    if (build->weighting == NORMALS_AREA_WEIGHTED) {
+        build->faceX[triangle] = n[0];
+        build->faceY[triangle] = n[1];
+        build->faceZ[triangle] = n[2];
+        return;
+    }
+
+    float length = sqrtf(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+    float scale = length > 0.0f ? 1.0f / length : 0.0f;
+    build->faceX[triangle] = n[0] * scale;
+    build->faceY[triangle] = n[1] * scale;
+    build->faceZ[triangle] = n[2] * scale;
+
+    float e10[3] = {-e01[0], -e01[1], -e01[2]};
+    float e20[3] = {-e02[0], -e02[1], -e02[2]};
+    float e21[3] = {-e12[0], -e12[1], -e12[2]};
+    build->angles[0][triangle] = cornerAngle(e01, e02);
+    build->angles[1][triangle] = cornerAngle(e10, e12);
+    build->angles[2][triangle] = cornerAngle(e20, e21);
+}
+
+#ifdef __SSE2__
+// one axis of one corner of four triangles
+static inline __m128 gather4(const Vertex *vertices, const uint32_t *indices,
+                             uint32_t corner, uint32_t axis) {
+    return _mm_setr_ps(vertices[indices[corner]].pos[axis],
+                       vertices[indices[3 + corner]].pos[axis],
+                       vertices[indices[6 + corner]].pos[axis],
+                       vertices[indices[9 + corner]].pos[axis]);
+}
+
+static inline __m128 acos4(__m128 x) {
+    const __m128 one = _mm_set1_ps(1.0f);
+    x = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-1.0f)), one);
+    __m128 negative = _mm_cmplt_ps(x, _mm_setzero_ps());
+    __m128 a = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+
+    __m128 polynomial = _mm_add_ps(
+        _mm_set1_ps(0.0742610f), _mm_mul_ps(a, _mm_set1_ps(-0.0187293f)));
+    polynomial = _mm_add_ps(_mm_set1_ps(-0.2121144f),
+                            _mm_mul_ps(a, polynomial));
+    polynomial =
+        _mm_add_ps(_mm_set1_ps(1.5707288f), _mm_mul_ps(a, polynomial));
+    __m128 r = _mm_mul_ps(_mm_sqrt_ps(_mm_sub_ps(one, a)), polynomial);
+
+    __m128 reflected = _mm_sub_ps(_mm_set1_ps(GLM_PIf), r);
+    return _mm_or_ps(_mm_and_ps(negative, reflected),
+                     _mm_andnot_ps(negative, r));
+}
+
+static inline __m128 dot4(__m128 ax, __m128 ay, __m128 az, __m128 bx,
+                          __m128 by, __m128 bz) {
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)),
+                      _mm_mul_ps(az, bz));
+}
+
+// zero where either edge has no length
+static inline __m128 cornerAngle4(__m128 ax, __m128 ay, __m128 az, __m128 bx,
+                                  __m128 by, __m128 bz) {
+    __m128 lengths = _mm_mul_ps(dot4(ax, ay, az, ax, ay, az),
+                                dot4(bx, by, bz, bx, by, bz));
+    __m128 valid = _mm_cmpgt_ps(lengths, _mm_setzero_ps());
+    __m128 cosine = _mm_div_ps(dot4(ax, ay, az, bx, by, bz),
+                               _mm_sqrt_ps(_mm_max_ps(
+                                   lengths, _mm_set1_ps(FLT_MIN))));
+    return _mm_and_ps(valid, acos4(cosine));
+}
+
+// four triangles from first on, one per lane
+static void faceNormals4(NormalsBuild *build, uint32_t first) {
+    const uint32_t *indices = &build->indices[first * 3];
+
+    const Vertex *vertices = build->vertices;
+
+    __m128 x0 = gather4(vertices, indices, 0, 0);
+    __m128 y0 = gather4(vertices, indices, 0, 1);
+    __m128 z0 = gather4(vertices, indices, 0, 2);
+    __m128 x1 = gather4(vertices, indices, 1, 0);
+    __m128 y1 = gather4(vertices, indices, 1, 1);
+    __m128 z1 = gather4(vertices, indices, 1, 2);
+    __m128 x2 = gather4(vertices, indices, 2, 0);
+    __m128 y2 = gather4(vertices, indices, 2, 1);
+    __m128 z2 = gather4(vertices, indices, 2, 2);
+
+    __m128 e01x = _mm_sub_ps(x1, x0), e01y = _mm_sub_ps(y1, y0),
+           e01z = _mm_sub_ps(z1, z0);
+    __m128 e02x = _mm_sub_ps(x2, x0), e02y = _mm_sub_ps(y2, y0),
+           e02z = _mm_sub_ps(z2, z0);
+
+    __m128 nx = _mm_sub_ps(_mm_mul_ps(e01y, e02z), _mm_mul_ps(e01z, e02y));
+    __m128 ny = _mm_sub_ps(_mm_mul_ps(e01z, e02x), _mm_mul_ps(e01x, e02z));
+    __m128 nz = _mm_sub_ps(_mm_mul_ps(e01x, e02y), _mm_mul_ps(e01y, e02x));
+
+    if (build->weighting == NORMALS_AREA_WEIGHTED) {
+        _mm_storeu_ps(&build->faceX[first], nx);
+        _mm_storeu_ps(&build->faceY[first], ny);
+        _mm_storeu_ps(&build->faceZ[first], nz);
+        return;
+    }
+
+    __m128 length = _mm_sqrt_ps(dot4(nx, ny, nz, nx, ny, nz));
+    __m128 scale = _mm_and_ps(
+        _mm_cmpgt_ps(length, _mm_setzero_ps()),
+        _mm_div_ps(_mm_set1_ps(1.0f),
+                   _mm_max_ps(length, _mm_set1_ps(FLT_MIN))));
+    _mm_storeu_ps(&build->faceX[first], _mm_mul_ps(nx, scale));
+    _mm_storeu_ps(&build->faceY[first], _mm_mul_ps(ny, scale));
+    _mm_storeu_ps(&build->faceZ[first], _mm_mul_ps(nz, scale));
+
+    __m128 e12x = _mm_sub_ps(x2, x1), e12y = _mm_sub_ps(y2, y1),
+           e12z = _mm_sub_ps(z2, z1);
+    __m128 zero = _mm_setzero_ps();
+
+    _mm_storeu_ps(&build->angles[0][first],
+                  cornerAngle4(e01x, e01y, e01z, e02x, e02y, e02z));
+    _mm_storeu_ps(&build->angles[1][first],
+                  cornerAngle4(_mm_sub_ps(zero, e01x), _mm_sub_ps(zero, e01y),
+                               _mm_sub_ps(zero, e01z), e12x, e12y, e12z));
+    _mm_storeu_ps(&build->angles[2][first],
+                  cornerAngle4(_mm_sub_ps(zero, e02x), _mm_sub_ps(zero, e02y),
+                               _mm_sub_ps(zero, e02z), _mm_sub_ps(zero, e12x),
+                               _mm_sub_ps(zero, e12y),
+                               _mm_sub_ps(zero, e12z)));
+}
+#endif
+
+static void faceNormals(void *data, uint32_t first, uint32_t last) {
+    NormalsBuild *build = data;
+    uint32_t i = first;
+
+#ifdef __SSE2__
+    for (; i + 4 <= last; i += 4) {
+        faceNormals4(build, i);
+    }
+#endif
+
+    for (; i < last; i++) {
+        faceNormal(build, i);
+    }
+}
+
+static inline bool writesNormal(const NormalsBuild *build, uint32_t vertex) {
+    return !build->only || build->only[vertex];
+}
+
+// Each job owns a block of vertices and reads every triangle, only adding to
+// the corners in its block. No two jobs write the same normal, nothing is
+// sorted, and every normal sums its faces in triangle order however many
+// jobs there are.
+static void accumulateNormals(void *data, uint32_t first, uint32_t last) {
+    NormalsBuild *build = data;
+    Vertex *vertices = build->vertices;
+
+    for (uint32_t i = first; i < last; i++) {
+        if (writesNormal(build, i)) {
+            glm_vec3_zero(vertices[i].normal);
+        }
+    }
+
+    for (uint32_t i = 0; i < build->trianglesCount; i++) {
+        for (uint32_t k = 0; k < 3; k++) {
+            uint32_t vertex = build->indices[i * 3 + k];
+            if (vertex < first || vertex >= last ||
+                !writesNormal(build, vertex)) {
+                continue;
+            }
+
+            float weight = build->weighting == NORMALS_ANGLE_WEIGHTED
+                               ? build->angles[k][i]
+                               : 1.0f;
+            float *normal = vertices[vertex].normal;
+            normal[0] += build->faceX[i] * weight;
+            normal[1] += build->faceY[i] * weight;
+            normal[2] += build->faceZ[i] * weight;
+        }
+    }
+
+    for (uint32_t i = first; i < last; i++) {
+        if (writesNormal(build, i)) {
+            glm_vec3_normalize(vertices[i].normal);
+        }
+    }
+}
+
+// Smooth normals for an indexed triangle list, each the weighted sum of the
+// faces around the vertex. Only the vertices marked in the mask are written
+// when one is given.
+void generateNormals(Shape *shape, NormalWeighting weighting,
+                     const bool *only) {
+    uint32_t verticesCount = shape->verticesCount;
+    uint32_t trianglesCount = shape->indicesCount / 3;
+    if (!verticesCount || !trianglesCount) {
+        return;
+    }
+
+    NormalsBuild build = {
+        .indices = shape->indices,
+        .trianglesCount = trianglesCount,
+        .weighting = weighting,
+        .faceX = malloc(trianglesCount * sizeof(float)),
+        .faceY = malloc(trianglesCount * sizeof(float)),
+        .faceZ = malloc(trianglesCount * sizeof(float)),
+        .vertices = shape->vertices,
+        .only = only,
+    };
+    if (!build.faceX || !build.faceY || !build.faceZ) {
+        THROW_ERROR("failed to allocate normals!\n");
+    }
+
+    for (uint32_t k = 0; k < 3 && weighting == NORMALS_ANGLE_WEIGHTED; k++) {
+        build.angles[k] = malloc(trianglesCount * sizeof(float));
+        if (!build.angles[k]) {
+            THROW_ERROR("failed to allocate normals!\n");
+        }
+    }
+
+    parallelFor(trianglesCount, NORMALS_GRAIN, faceNormals, &build);
+
+    // a block per thread, every block costs a pass over the indices
+    uint32_t threadsCount = jobWorkersCount() + 1;
+    uint32_t block = (verticesCount + threadsCount - 1) / threadsCount;
+    parallelFor(verticesCount, block > NORMALS_GRAIN ? block : NORMALS_GRAIN,
+                accumulateNormals, &build);
+
+    freeMem(6, build.faceX, build.faceY, build.faceZ, build.angles[0],
+            build.angles[1], build.angles[2]);
+}
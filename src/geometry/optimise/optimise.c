@@ -0,0 +1,390 @@
+#include "geometry/optimise/optimise.h"
+#include "geometry/geometry.h"
+#include "geometry/meshlet/meshlet.h"
+#include "geometry/optimise/overdraw.h"
+#include "geometry/optimise/strip.h"
+#include "vulkan_handle/memory.h"
+#include <SDL_atomic.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Tom Forsyth, "Linear-Speed Vertex Cache Optimisation"
+#define FORSYTH_CACHE_SIZE 32
+#define FORSYTH_MAX_VALENCE 32
+#define CACHE_DECAY_POWER 1.5f
+#define LAST_TRI_SCORE 0.75f
+#define VALENCE_BOOST_SCALE 2.0f
+#define VALENCE_BOOST_POWER 0.5f
+
+typedef struct ForsythVertex {
+    uint32_t trianglesOffset;
+    uint32_t activeTriangles;
+    int32_t cachePosition;
+    float score;
+} ForsythVertex;
+
+static float cacheScores[FORSYTH_CACHE_SIZE];
+static float valenceScores[FORSYTH_MAX_VALENCE];
+// shapes are optimised on several threads at once, threads racing to fill
+// the tables all write the same values
+static SDL_atomic_t scoresInitialised;
+
+static inline void initialiseScores() {
+    if (SDL_AtomicGet(&scoresInitialised)) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < FORSYTH_CACHE_SIZE; i++) {
+        // the last triangle's vertices get a fixed score so the algorithm does
+        // not favour the most recent one over the other two
+        if (i < 3) {
+            cacheScores[i] = LAST_TRI_SCORE;
+            continue;
+        }
+        float scaler = 1.0f / (FORSYTH_CACHE_SIZE - 3);
+        cacheScores[i] = powf(1.0f - (i - 3) * scaler, CACHE_DECAY_POWER);
+    }
+
+    for (uint32_t i = 1; i < FORSYTH_MAX_VALENCE; i++) {
+        valenceScores[i] =
+            VALENCE_BOOST_SCALE * powf((float)i, -VALENCE_BOOST_POWER);
+    }
+
+    SDL_AtomicSet(&scoresInitialised, 1);
+}
+
+static inline float vertexScore(const ForsythVertex *vertex) {
+    if (vertex->activeTriangles == 0) {
+        return -1.0f;
+    }
+
+    float score = vertex->cachePosition < 0
+                      ? 0.0f
+                      : cacheScores[vertex->cachePosition];
+
+    // low valence vertices are boosted so stragglers get finished off
+    uint32_t valence = vertex->activeTriangles < FORSYTH_MAX_VALENCE
+                           ? vertex->activeTriangles
+                           : FORSYTH_MAX_VALENCE - 1;
+
+    return score + valenceScores[valence];
+}
+
+static inline float triangleScore(const ForsythVertex *vertices,
+                                  const uint32_t *triangle) {
+    return vertices[triangle[0]].score + vertices[triangle[1]].score +
+           vertices[triangle[2]].score;
+}
+
+void optimiseVertexCache(uint32_t *indices, uint32_t indicesCount,
+                         uint32_t verticesCount) {
+    uint32_t trianglesCount = indicesCount / 3;
+    if (trianglesCount == 0) {
+        return;
+    }
+
+    initialiseScores();
+
+    ForsythVertex *vertices = calloc(verticesCount, sizeof(*vertices));
+    for (uint32_t i = 0; i < indicesCount; i++) {
+        vertices[indices[i]].activeTriangles++;
+    }
+
+    // per vertex triangle lists stored back to back
+    uint32_t offset = 0;
+    for (uint32_t i = 0; i < verticesCount; i++) {
+        vertices[i].trianglesOffset = offset;
+        offset += vertices[i].activeTriangles;
+        vertices[i].activeTriangles = 0;
+        vertices[i].cachePosition = -1;
+    }
+
+    uint32_t *vertexTriangles = malloc(indicesCount * sizeof(*vertexTriangles));
+    for (uint32_t i = 0; i < indicesCount; i++) {
+        ForsythVertex *vertex = &vertices[indices[i]];
+        vertexTriangles[vertex->trianglesOffset + vertex->activeTriangles++] =
+            i / 3;
+    }
+
+    for (uint32_t i = 0; i < verticesCount; i++) {
+        vertices[i].score = vertexScore(&vertices[i]);
+    }
+
+    float *triangleScores = malloc(trianglesCount * sizeof(*triangleScores));
+    bool *emitted = calloc(trianglesCount, sizeof(*emitted));
+    uint32_t *output = malloc(indicesCount * sizeof(*output));
+
+    uint32_t bestTriangle = 0;
+    float bestScore = -1.0f;
+    for (uint32_t i = 0; i < trianglesCount; i++) {
+        triangleScores[i] = triangleScore(vertices, &indices[i * 3]);
+        if (triangleScores[i] > bestScore) {
+            bestScore = triangleScores[i];
+            bestTriangle = i;
+        }
+    }
+
+    uint32_t cache[FORSYTH_CACHE_SIZE + 3];
+    uint32_t cacheCount = 0;
+    uint32_t scanCursor = 0;
+
+    for (uint32_t emittedCount = 0; emittedCount < trianglesCount;
+         emittedCount++) {
+        // nothing in the cache scored, restart from the next untouched one
+        if (bestScore < 0.0f) {
+            while (emitted[scanCursor]) {
+                scanCursor++;
+            }
+            bestTriangle = scanCursor;
+        }
+
+        const uint32_t *triangle = &indices[bestTriangle * 3];
+        memcpy(&output[emittedCount * 3], triangle, 3 * sizeof(*triangle));
+        emitted[bestTriangle] = true;
+
+        // drop the triangle from its vertices' active lists
+        for (uint32_t i = 0; i < 3; i++) {
+            ForsythVertex *vertex = &vertices[triangle[i]];
+            uint32_t *list = &vertexTriangles[vertex->trianglesOffset];
+            for (uint32_t j = 0; j < vertex->activeTriangles; j++) {
+                if (list[j] == bestTriangle) {
+                    list[j] = list[--vertex->activeTriangles];
+                    break;
+                }
+            }
+        }
+
+        // move the triangle's vertices to the front of the lru cache
+        uint32_t newCache[FORSYTH_CACHE_SIZE + 3];
+        uint32_t newCacheCount = 0;
+        for (uint32_t i = 0; i < 3; i++) {
+            newCache[newCacheCount++] = triangle[i];
+        }
+        for (uint32_t i = 0; i < cacheCount; i++) {
+            uint32_t index = cache[i];
+            if (index != triangle[0] && index != triangle[1] &&
+                index != triangle[2]) {
+                newCache[newCacheCount++] = index;
+            }
+        }
+
+        for (uint32_t i = 0; i < newCacheCount; i++) {
+            ForsythVertex *vertex = &vertices[newCache[i]];
+            vertex->cachePosition = i < FORSYTH_CACHE_SIZE ? (int32_t)i : -1;
+            vertex->score = vertexScore(vertex);
+        }
+
+        // only triangles touching the cache can have changed score
+        bestScore = -1.0f;
+        for (uint32_t i = 0; i < newCacheCount; i++) {
+            ForsythVertex *vertex = &vertices[newCache[i]];
+            uint32_t *list = &vertexTriangles[vertex->trianglesOffset];
+            for (uint32_t j = 0; j < vertex->activeTriangles; j++) {
+                uint32_t t = list[j];
+                triangleScores[t] = triangleScore(vertices, &indices[t * 3]);
+                if (triangleScores[t] > bestScore) {
+                    bestScore = triangleScores[t];
+                    bestTriangle = t;
+                }
+            }
+        }
+
+        cacheCount = newCacheCount < FORSYTH_CACHE_SIZE ? newCacheCount
+                                                        : FORSYTH_CACHE_SIZE;
+        memcpy(cache, newCache, cacheCount * sizeof(*cache));
+    }
+
+    memcpy(indices, output, indicesCount * sizeof(*indices));
+
+    freeMem(5, vertices, vertexTriangles, triangleScores, emitted, output);
+}
+
+// order vertices by first use so the fetches walk memory linearly
+void optimiseVertexFetch(Shape *shape) {
+    uint32_t *remap = malloc(shape->verticesCount * sizeof(*remap));
+    memset(remap, 0xff, shape->verticesCount * sizeof(*remap));
+
+    Vertex *vertices = malloc(shape->verticesCount * sizeof(*vertices));
+    uint32_t next = 0;
+
+    for (uint32_t i = 0; i < shape->indicesCount; i++) {
+        uint32_t index = shape->indices[i];
+        if (remap[index] == UINT32_MAX) {
+            remap[index] = next;
+            vertices[next++] = shape->vertices[index];
+        }
+        shape->indices[i] = remap[index];
+    }
+
+    // keep anything the index buffer never references at the end
+    for (uint32_t i = 0; i < shape->verticesCount; i++) {
+        if (remap[i] == UINT32_MAX) {
+            vertices[next++] = shape->vertices[i];
+        }
+    }
+
+    freeMem(2, shape->vertices, remap);
+    shape->vertices = vertices;
+}
+
+// every meshlet is stripped on its own and stays a run of its own, through
+// vertices local to it so the stripifier's tables stay meshlet sized
+static uint32_t stripMeshlets(uint32_t *strip, Shape *shape) {
+    uint32_t *slots = malloc(shape->verticesCount * sizeof(*slots));
+    memset(slots, 0xff, shape->verticesCount * sizeof(*slots));
+
+    uint32_t local[MESHLET_MAX_TRIANGLES * 3];
+    uint32_t global[MESHLET_MAX_VERTICES];
+    uint32_t written = 0;
+
+    for (uint32_t m = 0; m < shape->meshletsCount; m++) {
+        Meshlet *meshlet = &shape->meshlets[m];
+        const uint32_t *indices = &shape->indices[meshlet->firstIndex];
+
+        uint32_t localCount = 0;
+        for (uint32_t i = 0; i < meshlet->indicesCount; i++) {
+            if (slots[indices[i]] == UINT32_MAX) {
+                slots[indices[i]] = localCount;
+                global[localCount++] = indices[i];
+            }
+            local[i] = slots[indices[i]];
+        }
+
+        uint32_t count =
+            stripify(&strip[written], local, meshlet->indicesCount,
+                     localCount);
+        for (uint32_t i = written; i < written + count; i++) {
+            if (strip[i] != STRIP_RESTART_INDEX) {
+                strip[i] = global[strip[i]];
+            }
+        }
+
+        for (uint32_t i = 0; i < localCount; i++) {
+            slots[global[i]] = UINT32_MAX;
+        }
+
+        meshlet->firstIndex = written;
+        meshlet->indicesCount = count;
+        written += count;
+    }
+
+    freeMem(1, slots);
+
+    return written;
+}
+
+void stripShape(Shape *shape) {
+    uint32_t *strip =
+        malloc(STRIP_BOUND(shape->indicesCount) * sizeof(*strip));
+    uint32_t stripCount =
+        shape->meshletsCount
+            ? stripMeshlets(strip, shape)
+            : stripify(strip, shape->indices, shape->indicesCount,
+                       shape->verticesCount);
+
+#ifdef MESH_STATS
+    printf("mesh %u triangles, %u list indices -> %u strip indices\n",
+           shape->indicesCount / 3, shape->indicesCount, stripCount);
+#endif
+
+    freeMem(1, shape->indices);
+    shape->indices = realloc(strip, stripCount * sizeof(*strip));
+    shape->indicesCount = stripCount;
+
+    shape->graphicsPipeline.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP;
+    shape->graphicsPipeline.primitiveRestart = true;
+}
+
+VertexCacheStats analyseVertexCache(const uint32_t *indices,
+                                    uint32_t indicesCount,
+                                    uint32_t verticesCount,
+                                    uint32_t cacheSize) {
+    VertexCacheStats stats = {0.0f, 0.0f};
+    if (indicesCount < 3) {
+        return stats;
+    }
+
+    // timestamp of when each vertex entered the fifo
+    uint32_t *entered = calloc(verticesCount, sizeof(*entered));
+    bool *referenced = calloc(verticesCount, sizeof(*referenced));
+    uint32_t transformed = 0;
+    uint32_t unique = 0;
+
+    for (uint32_t i = 0; i < indicesCount; i++) {
+        uint32_t index = indices[i];
+
+        if (!referenced[index]) {
+            referenced[index] = true;
+            unique++;
+        }
+
+        if (entered[index] == 0 || transformed - entered[index] >= cacheSize) {
+            entered[index] = ++transformed;
+        }
+    }
+
+    stats.acmr = (float)transformed / (indicesCount / 3);
+    stats.atvr = (float)transformed / unique;
+
+    freeMem(2, entered, referenced);
+
+    return stats;
+}
+
+void optimiseShape(Shape *shape, ShapeFlags flags) {
+    if (!shape->indexed || shape->indicesCount < 3 ||
+        shape->graphicsPipeline.topology !=
+            VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST) {
+        return;
+    }
+
+#ifdef MESH_STATS
+    VertexCacheStats before =
+        analyseVertexCache(shape->indices, shape->indicesCount,
+                           shape->verticesCount, VERTEX_CACHE_SIZE);
+    OverdrawStats overdrawBefore =
+        analyseOverdraw(shape->indices, shape->indicesCount, shape->vertices,
+                        shape->verticesCount);
+#endif
+
+    optimiseVertexCache(shape->indices, shape->indicesCount,
+                        shape->verticesCount);
+
+    // reorders clusters of the cache friendly order, so it has to run after
+    if (flags & SHAPE_OPTIMISE_OVERDRAW) {
+        optimiseOverdraw(shape->indices, shape->indicesCount, shape->vertices,
+                         shape->verticesCount, OVERDRAW_THRESHOLD);
+    }
+
+    optimiseVertexFetch(shape);
+
+#ifdef MESH_STATS
+    VertexCacheStats after =
+        analyseVertexCache(shape->indices, shape->indicesCount,
+                           shape->verticesCount, VERTEX_CACHE_SIZE);
+    printf("mesh %u triangles, acmr %.3f -> %.3f, atvr %.3f -> %.3f\n",
+           shape->indicesCount / 3, before.acmr, after.acmr, before.atvr,
+           after.atvr);
+
+    OverdrawStats overdrawAfter =
+        analyseOverdraw(shape->indices, shape->indicesCount, shape->vertices,
+                        shape->verticesCount);
+    printf("mesh %u triangles, overdraw %.3f -> %.3f\n",
+           shape->indicesCount / 3, overdrawBefore.overdraw,
+           overdrawAfter.overdraw);
+#endif
+
+    // clusters are contiguous runs of triangles, so any stripping has to
+    // keep within them
+    if (flags & SHAPE_MESHLETS) {
+        buildShapeMeshlets(shape);
+    }
+
+    // last, everything above works on triangle lists
+    if (flags & SHAPE_TRIANGLE_STRIPS) {
+        stripShape(shape);
+    }
+}
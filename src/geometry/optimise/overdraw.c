@@ -0,0 +1,283 @@
+#include "geometry/optimise/overdraw.h"
+#include "geometry/geometry.h"
+#include "geometry/optimise/optimise.h"
+#include "vulkan_handle/memory.h"
+#include <cglm/vec3.h>
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// fifo cache that can be flushed without touching every vertex
+typedef struct CacheSim {
+    uint32_t *entered;
+    uint32_t transformed;
+    uint32_t flushedAt;
+} CacheSim;
+
+static inline uint32_t cacheMisses(CacheSim *cache,
+                                   const uint32_t *triangle) {
+    uint32_t misses = 0;
+    for (uint32_t i = 0; i < 3; i++) {
+        uint32_t entered = cache->entered[triangle[i]];
+        if (entered <= cache->flushedAt ||
+            cache->transformed - entered >= VERTEX_CACHE_SIZE) {
+            cache->entered[triangle[i]] = ++cache->transformed;
+            misses++;
+        }
+    }
+    return misses;
+}
+
+static inline void flushCache(CacheSim *cache) {
+    cache->flushedAt = cache->transformed;
+}
+
+// Sander, Nehab and Barczak, "Fast Triangle Reordering for Vertex Locality
+// and Reduced Overdraw". Hard boundaries sit where the cache order already
+// starts over, soft ones split those further while the acmr stays close to
+// that of the whole hard cluster.
+static uint32_t *generateClusters(const uint32_t *indices,
+                                  uint32_t trianglesCount,
+                                  uint32_t verticesCount, float threshold,
+                                  uint32_t *clustersCount) {
+    CacheSim cache = {calloc(verticesCount, sizeof(uint32_t)), 0, 0};
+
+    uint32_t *hard = malloc((trianglesCount + 1) * sizeof(*hard));
+    uint32_t hardCount = 0;
+    for (uint32_t i = 0; i < trianglesCount; i++) {
+        if (cacheMisses(&cache, &indices[i * 3]) == 3 || i == 0) {
+            hard[hardCount++] = i;
+        }
+    }
+    hard[hardCount] = trianglesCount;
+
+    uint32_t *clusters = malloc((trianglesCount + 1) * sizeof(*clusters));
+    *clustersCount = 0;
+
+    for (uint32_t c = 0; c < hardCount; c++) {
+        uint32_t start = hard[c], end = hard[c + 1];
+
+        flushCache(&cache);
+        uint32_t misses = 0;
+        for (uint32_t i = start; i < end; i++) {
+            misses += cacheMisses(&cache, &indices[i * 3]);
+        }
+        float clusterThreshold = threshold * misses / (end - start);
+
+        clusters[(*clustersCount)++] = start;
+
+        flushCache(&cache);
+        uint32_t runningMisses = 0, runningTriangles = 0;
+        for (uint32_t i = start; i < end; i++) {
+            runningMisses += cacheMisses(&cache, &indices[i * 3]);
+            runningTriangles++;
+
+            if ((float)runningMisses / runningTriangles <= clusterThreshold &&
+                i + 1 < end) {
+                clusters[(*clustersCount)++] = i + 1;
+                flushCache(&cache);
+                runningMisses = runningTriangles = 0;
+            }
+        }
+    }
+    clusters[*clustersCount] = trianglesCount;
+
+    freeMem(2, cache.entered, hard);
+
+    return clusters;
+}
+
+typedef struct ClusterSort {
+    float key;
+    uint32_t cluster;
+} ClusterSort;
+
+static int compareClusters(const void *a, const void *b) {
+    float keyA = ((const ClusterSort *)a)->key;
+    float keyB = ((const ClusterSort *)b)->key;
+    return (keyA < keyB) - (keyA > keyB);
+}
+
+void optimiseOverdraw(uint32_t *indices, uint32_t indicesCount,
+                      const Vertex *vertices, uint32_t verticesCount,
+                      float threshold) {
+    uint32_t trianglesCount = indicesCount / 3;
+    if (trianglesCount == 0) {
+        return;
+    }
+
+    uint32_t clustersCount;
+    uint32_t *clusters = generateClusters(indices, trianglesCount,
+                                          verticesCount, threshold,
+                                          &clustersCount);
+
+    vec3 meshCentroid = GLM_VEC3_ZERO_INIT;
+    for (uint32_t i = 0; i < indicesCount; i++) {
+        glm_vec3_add(meshCentroid, (float *)vertices[indices[i]].pos,
+                     meshCentroid);
+    }
+    glm_vec3_scale(meshCentroid, 1.0f / indicesCount, meshCentroid);
+
+    // clusters facing away from the middle of the mesh are the likeliest to
+    // occlude the rest, so they are drawn first
+    ClusterSort *sort = malloc(clustersCount * sizeof(*sort));
+    for (uint32_t c = 0; c < clustersCount; c++) {
+        vec3 centroid = GLM_VEC3_ZERO_INIT;
+        vec3 normal = GLM_VEC3_ZERO_INIT;
+        float area = 0.0f;
+
+        for (uint32_t i = clusters[c]; i < clusters[c + 1]; i++) {
+            const float *p0 = vertices[indices[i * 3 + 0]].pos;
+            const float *p1 = vertices[indices[i * 3 + 1]].pos;
+            const float *p2 = vertices[indices[i * 3 + 2]].pos;
+
+            vec3 e1, e2, n;
+            glm_vec3_sub((float *)p1, (float *)p0, e1);
+            glm_vec3_sub((float *)p2, (float *)p0, e2);
+            glm_vec3_cross(e1, e2, n);
+
+            float triangleArea = glm_vec3_norm(n);
+            for (uint32_t k = 0; k < 3; k++) {
+                centroid[k] += (p0[k] + p1[k] + p2[k]) * triangleArea / 3.0f;
+            }
+            glm_vec3_add(normal, n, normal);
+            area += triangleArea;
+        }
+
+        if (area > 0.0f) {
+            glm_vec3_scale(centroid, 1.0f / area, centroid);
+        }
+        glm_vec3_normalize(normal);
+
+        vec3 outward;
+        glm_vec3_sub(centroid, meshCentroid, outward);
+
+        sort[c].key = glm_vec3_dot(outward, normal);
+        sort[c].cluster = c;
+    }
+
+    qsort(sort, clustersCount, sizeof(*sort), compareClusters);
+
+    uint32_t *sorted = malloc(indicesCount * sizeof(*sorted));
+    uint32_t written = 0;
+    for (uint32_t c = 0; c < clustersCount; c++) {
+        uint32_t start = clusters[sort[c].cluster];
+        uint32_t count = (clusters[sort[c].cluster + 1] - start) * 3;
+        memcpy(&sorted[written], &indices[start * 3],
+               count * sizeof(*sorted));
+        written += count;
+    }
+
+    memcpy(indices, sorted, indicesCount * sizeof(*indices));
+
+    freeMem(3, clusters, sort, sorted);
+}
+
+// rasterise one orthographic view, u x v = w points at the camera
+static void rasteriseView(const uint32_t *indices, uint32_t indicesCount,
+                          const float (*projected)[3], float *depth,
+                          uint32_t *shaded) {
+    for (uint32_t i = 0; i < indicesCount; i += 3) {
+        const float *a = projected[indices[i + 0]];
+        const float *b = projected[indices[i + 1]];
+        const float *c = projected[indices[i + 2]];
+
+        float area =
+            (b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]);
+        // back facing or degenerate
+        if (area <= 0.0f) {
+            continue;
+        }
+
+        int minX = (int)fmaxf(floorf(fminf(a[0], fminf(b[0], c[0]))), 0.0f);
+        int minY = (int)fmaxf(floorf(fminf(a[1], fminf(b[1], c[1]))), 0.0f);
+        int maxX = (int)fminf(ceilf(fmaxf(a[0], fmaxf(b[0], c[0]))),
+                              OVERDRAW_VIEWPORT - 1);
+        int maxY = (int)fminf(ceilf(fmaxf(a[1], fmaxf(b[1], c[1]))),
+                              OVERDRAW_VIEWPORT - 1);
+
+        for (int y = minY; y <= maxY; y++) {
+            for (int x = minX; x <= maxX; x++) {
+                float px = x + 0.5f, py = y + 0.5f;
+
+                float w0 =
+                    (b[0] - px) * (c[1] - py) - (b[1] - py) * (c[0] - px);
+                float w1 =
+                    (c[0] - px) * (a[1] - py) - (c[1] - py) * (a[0] - px);
+                float w2 = area - w0 - w1;
+                if (w0 < 0.0f || w1 < 0.0f || w2 < 0.0f) {
+                    continue;
+                }
+
+                float z = (w0 * a[2] + w1 * b[2] + w2 * c[2]) / area;
+                float *stored = &depth[y * OVERDRAW_VIEWPORT + x];
+                if (z < *stored) {
+                    *stored = z;
+                    (*shaded)++;
+                }
+            }
+        }
+    }
+}
+
+// fragments shaded with early depth testing, averaged over the six axis views
+OverdrawStats analyseOverdraw(const uint32_t *indices, uint32_t indicesCount,
+                              const Vertex *vertices, uint32_t verticesCount) {
+    OverdrawStats stats = {0, 0, 0.0f};
+    if (indicesCount < 3 || verticesCount == 0) {
+        return stats;
+    }
+
+    vec3 min = {FLT_MAX, FLT_MAX, FLT_MAX};
+    vec3 max = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+    for (uint32_t i = 0; i < verticesCount; i++) {
+        for (uint32_t k = 0; k < 3; k++) {
+            min[k] = fminf(min[k], vertices[i].pos[k]);
+            max[k] = fmaxf(max[k], vertices[i].pos[k]);
+        }
+    }
+    float extent =
+        fmaxf(max[0] - min[0], fmaxf(max[1] - min[1], max[2] - min[2]));
+    float scale = extent > 0.0f ? (OVERDRAW_VIEWPORT - 1) / extent : 0.0f;
+
+    float (*projected)[3] = malloc(verticesCount * sizeof(*projected));
+    uint32_t pixelsCount = OVERDRAW_VIEWPORT * OVERDRAW_VIEWPORT;
+    float *depth = malloc(pixelsCount * sizeof(*depth));
+
+    for (uint32_t axis = 0; axis < 3; axis++) {
+        uint32_t u = (axis + 1) % 3, v = (axis + 2) % 3;
+
+        for (uint32_t side = 0; side < 2; side++) {
+            // looking down -w swaps u and v so the winding stays the same
+            for (uint32_t i = 0; i < verticesCount; i++) {
+                float pu = (vertices[i].pos[u] - min[u]) * scale;
+                float pv = (vertices[i].pos[v] - min[v]) * scale;
+                float pw = (vertices[i].pos[axis] - min[axis]) * scale;
+
+                projected[i][0] = side ? pv : pu;
+                projected[i][1] = side ? pu : pv;
+                projected[i][2] = side ? pw : -pw;
+            }
+
+            for (uint32_t i = 0; i < pixelsCount; i++) {
+                depth[i] = FLT_MAX;
+            }
+
+            rasteriseView(indices, indicesCount,
+                          (const float(*)[3])projected, depth, &stats.shaded);
+
+            for (uint32_t i = 0; i < pixelsCount; i++) {
+                stats.covered += depth[i] != FLT_MAX;
+            }
+        }
+    }
+
+    stats.overdraw =
+        stats.covered ? (float)stats.shaded / stats.covered : 0.0f;
+
+    freeMem(2, projected, depth);
+
+    return stats;
+}
@@ -0,0 +1,231 @@
+#include "geometry/optimise/strip.h"
+#include "geometry/optimise/optimise.h"
+#include "vulkan_handle/memory.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct StripAdjacency {
+    const uint32_t *indices;
+    uint32_t *offsets;   // per vertex start into triangles, plus one
+    uint32_t *triangles; // every triangle a vertex belongs to, back to back
+    bool *emitted;
+} StripAdjacency;
+
+// fifo of the vertices the strips emitted most recently
+typedef struct StripCache {
+    uint32_t *entered;
+    uint32_t transformed;
+    uint32_t recent[VERTEX_CACHE_SIZE];
+} StripCache;
+
+static inline bool inCache(const StripCache *cache, uint32_t vertex) {
+    return cache->entered[vertex] != 0 &&
+           cache->transformed - cache->entered[vertex] < VERTEX_CACHE_SIZE;
+}
+
+static inline void pushCache(StripCache *cache, uint32_t vertex) {
+    if (!inCache(cache, vertex)) {
+        cache->recent[cache->transformed % VERTEX_CACHE_SIZE] = vertex;
+        cache->entered[vertex] = ++cache->transformed;
+    }
+}
+
+// the unused triangle with the directed edge a -> b, and its third vertex
+static bool findEdge(const StripAdjacency *adjacency, uint32_t a, uint32_t b,
+                     uint32_t *triangle, uint32_t *third) {
+    for (uint32_t i = adjacency->offsets[a]; i < adjacency->offsets[a + 1];
+         i++) {
+        uint32_t t = adjacency->triangles[i];
+        if (adjacency->emitted[t]) {
+            continue;
+        }
+
+        const uint32_t *v = &adjacency->indices[t * 3];
+        for (uint32_t e = 0; e < 3; e++) {
+            if (v[e] == a && v[(e + 1) % 3] == b) {
+                *triangle = t;
+                *third = v[(e + 2) % 3];
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static uint32_t unusedNeighbours(const StripAdjacency *adjacency,
+                                 uint32_t triangle) {
+    const uint32_t *v = &adjacency->indices[triangle * 3];
+    uint32_t neighbours = 0, t, third;
+    for (uint32_t e = 0; e < 3; e++) {
+        neighbours += findEdge(adjacency, v[(e + 1) % 3], v[e], &t, &third);
+    }
+    return neighbours;
+}
+
+// Restart next to what was just drawn, so the new strip runs alongside the
+// last one and reuses its vertices, preferring triangles at the edge of the
+// unused region as they leave the longest run ahead of them.
+static uint32_t pickStart(const StripAdjacency *adjacency,
+                          const StripCache *cache, uint32_t trianglesCount,
+                          uint32_t *cursor) {
+    uint32_t best = UINT32_MAX;
+    int32_t bestScore = INT32_MIN;
+
+    uint32_t cached = cache->transformed < VERTEX_CACHE_SIZE
+                          ? cache->transformed
+                          : VERTEX_CACHE_SIZE;
+    for (uint32_t c = 0; c < cached; c++) {
+        uint32_t vertex = cache->recent[c];
+        for (uint32_t i = adjacency->offsets[vertex];
+             i < adjacency->offsets[vertex + 1]; i++) {
+            uint32_t t = adjacency->triangles[i];
+            if (adjacency->emitted[t]) {
+                continue;
+            }
+
+            const uint32_t *v = &adjacency->indices[t * 3];
+            int32_t hits = inCache(cache, v[0]) + inCache(cache, v[1]) +
+                           inCache(cache, v[2]);
+            int32_t score = hits * 4 - (int32_t)unusedNeighbours(adjacency, t);
+            if (score > bestScore) {
+                bestScore = score;
+                best = t;
+            }
+        }
+    }
+
+    // nothing left around the cache, carry on in the list order
+    if (best == UINT32_MAX) {
+        while (*cursor < trianglesCount && adjacency->emitted[*cursor]) {
+            (*cursor)++;
+        }
+        best = *cursor;
+    }
+
+    return best;
+}
+
+// Greedy strips that follow the mesh adjacency and restart next to the
+// previous strip, separated with STRIP_RESTART_INDEX. Returns the number of
+// indices written to the destination, which must hold
+// STRIP_BOUND(indicesCount).
+uint32_t stripify(uint32_t *destination, const uint32_t *indices,
+                  uint32_t indicesCount, uint32_t verticesCount) {
+    uint32_t trianglesCount = indicesCount / 3;
+
+    StripAdjacency adjacency = {
+        .indices = indices,
+        .offsets = calloc(verticesCount + 1, sizeof(uint32_t)),
+        .triangles = malloc(indicesCount * sizeof(uint32_t)),
+        .emitted = calloc(trianglesCount, sizeof(bool)),
+    };
+
+    for (uint32_t i = 0; i < indicesCount; i++) {
+        adjacency.offsets[indices[i] + 1]++;
+    }
+    for (uint32_t i = 0; i < verticesCount; i++) {
+        adjacency.offsets[i + 1] += adjacency.offsets[i];
+    }
+
+    uint32_t *fill = malloc(verticesCount * sizeof(*fill));
+    memcpy(fill, adjacency.offsets, verticesCount * sizeof(*fill));
+    for (uint32_t i = 0; i < indicesCount; i++) {
+        adjacency.triangles[fill[indices[i]]++] = i / 3;
+    }
+
+    StripCache cache = {
+        .entered = calloc(verticesCount, sizeof(uint32_t)),
+        .transformed = 0,
+    };
+
+    uint32_t written = 0;
+    uint32_t cursor = 0;
+
+    // strip vertices n - 2 and n - 1, and the parity of the next triangle
+    uint32_t a = 0, b = 0;
+    bool odd = false;
+    bool inStrip = false;
+
+    for (uint32_t emittedCount = 0; emittedCount < trianglesCount;
+         emittedCount++) {
+        uint32_t triangle, third;
+
+        // odd triangles are wound (n - 1, n - 2, n)
+        if (inStrip && findEdge(&adjacency, odd ? b : a, odd ? a : b,
+                                &triangle, &third)) {
+            destination[written++] = third;
+            pushCache(&cache, third);
+            adjacency.emitted[triangle] = true;
+
+            a = b;
+            b = third;
+            odd = !odd;
+            continue;
+        }
+
+        if (inStrip) {
+            destination[written++] = STRIP_RESTART_INDEX;
+        }
+
+        uint32_t start = pickStart(&adjacency, &cache, trianglesCount, &cursor);
+        const uint32_t *v = &indices[start * 3];
+
+        // rotate so the strip leaves through an edge with a neighbour
+        uint32_t rotation = 0;
+        for (uint32_t r = 0; r < 3; r++) {
+            if (findEdge(&adjacency, v[(r + 2) % 3], v[(r + 1) % 3],
+                         &triangle, &third)) {
+                rotation = r;
+                break;
+            }
+        }
+
+        for (uint32_t i = 0; i < 3; i++) {
+            destination[written++] = v[(rotation + i) % 3];
+            pushCache(&cache, v[(rotation + i) % 3]);
+        }
+        adjacency.emitted[start] = true;
+
+        a = v[(rotation + 1) % 3];
+        b = v[(rotation + 2) % 3];
+        odd = true;
+        inStrip = true;
+    }
+
+    freeMem(5, adjacency.offsets, adjacency.triangles, adjacency.emitted,
+            fill, cache.entered);
+
+    return written;
+}
+
+// back to a triangle list, for analysis, returns the number of indices
+// written to the destination which must hold (indicesCount - 2) * 3
+uint32_t unstripify(uint32_t *destination, const uint32_t *indices,
+                    uint32_t indicesCount) {
+    uint32_t written = 0;
+    uint32_t start = 0;
+
+    for (uint32_t i = 0; i < indicesCount; i++) {
+        if (indices[i] == STRIP_RESTART_INDEX) {
+            start = i + 1;
+            continue;
+        }
+        if (i - start < 2) {
+            continue;
+        }
+
+        uint32_t a = indices[i - 2], b = indices[i - 1], c = indices[i];
+        if ((i - start) % 2 == 0) {
+            destination[written++] = a;
+            destination[written++] = b;
+        } else {
+            destination[written++] = b;
+            destination[written++] = a;
+        }
+        destination[written++] = c;
+    }
+
+    return written;
+}
@@ -0,0 +1,114 @@
+#include "geometry/packing/packing.h"
+#include "geometry/geometry.h"
+#include <cglm/util.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HALF_ONE 0x3c00
+
+inline uint16_t floatToHalf(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    uint16_t sign = (bits >> 16) & 0x8000;
+    int32_t exponent = (int32_t)((bits >> 23) & 0xff) - 127 + 15;
+    uint32_t mantissa = bits & 0x7fffff;
+
+    // nan and inf keep their class, anything too large saturates to inf
+    if (((bits >> 23) & 0xff) == 0xff) {
+        return sign | 0x7c00 | (mantissa ? 0x200 : 0);
+    }
+    if (exponent >= 31) {
+        return sign | 0x7c00;
+    }
+
+    // too small for a subnormal half
+    if (exponent < -10) {
+        return sign;
+    }
+
+    // subnormal half, shift the implicit leading bit into the mantissa
+    if (exponent <= 0) {
+        mantissa |= 0x800000;
+        uint32_t shift = 14 - exponent;
+        uint32_t half = mantissa >> shift;
+        uint32_t rest = mantissa & ((1u << shift) - 1);
+        uint32_t midpoint = 1u << (shift - 1);
+        if (rest > midpoint || (rest == midpoint && (half & 1))) {
+            half++;
+        }
+        return sign | half;
+    }
+
+    // round to nearest even, a carry out of the mantissa bumps the exponent
+    uint32_t half = ((uint32_t)exponent << 10) | (mantissa >> 13);
+    uint32_t rest = mantissa & 0x1fff;
+    if (rest > 0x1000 || (rest == 0x1000 && (half & 1))) {
+        half++;
+    }
+
+    return sign | (half > 0x7bff ? 0x7c00 : half);
+}
+
+static inline int16_t toSnorm16(float value) {
+    return (int16_t)roundf(glm_clamp(value, -1.0f, 1.0f) * 32767.0f);
+}
+
+static inline uint16_t toUnorm16(float value) {
+    return (uint16_t)roundf(glm_clamp(value, 0.0f, 1.0f) * 65535.0f);
+}
+
+static inline uint8_t toUnorm8(float value) {
+    return (uint8_t)roundf(glm_clamp(value, 0.0f, 1.0f) * 255.0f);
+}
+
+static inline float signNotZero(float value) {
+    return value >= 0.0f ? 1.0f : -1.0f;
+}
+
+// project the unit normal onto the octahedron |x| + |y| + |z| = 1 and fold the
+// lower hemisphere over the diagonals so it fits in two components
+static inline void octahedralEncode(const vec3 normal, int16_t *encoded) {
+    float l1 = fabsf(normal[0]) + fabsf(normal[1]) + fabsf(normal[2]);
+    if (l1 == 0.0f) {
+        encoded[0] = encoded[1] = 0;
+        return;
+    }
+
+    float x = normal[0] / l1;
+    float y = normal[1] / l1;
+
+    if (normal[2] < 0.0f) {
+        float foldedX = (1.0f - fabsf(y)) * signNotZero(x);
+        y = (1.0f - fabsf(x)) * signNotZero(y);
+        x = foldedX;
+    }
+
+    encoded[0] = toSnorm16(x);
+    encoded[1] = toSnorm16(y);
+}
+
+PackedVertex *packVertices(const Vertex *vertices, uint32_t verticesCount) {
+    PackedVertex *packed = malloc(verticesCount * sizeof(*packed));
+
+    for (uint32_t i = 0; i < verticesCount; i++) {
+        packed[i].pos[0] = floatToHalf(vertices[i].pos[0]);
+        packed[i].pos[1] = floatToHalf(vertices[i].pos[1]);
+        packed[i].pos[2] = floatToHalf(vertices[i].pos[2]);
+        packed[i].pos[3] = HALF_ONE;
+
+        octahedralEncode(vertices[i].normal, packed[i].normal);
+
+        packed[i].texCoord[0] = toUnorm16(vertices[i].texCoord[0]);
+        packed[i].texCoord[1] = toUnorm16(vertices[i].texCoord[1]);
+
+        packed[i].colour[0] = toUnorm8(vertices[i].colour[0]);
+        packed[i].colour[1] = toUnorm8(vertices[i].colour[1]);
+        packed[i].colour[2] = toUnorm8(vertices[i].colour[2]);
+        packed[i].colour[3] = UINT8_MAX;
+    }
+
+    return packed;
+}
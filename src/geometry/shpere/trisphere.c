@@ -3,6 +3,7 @@
 #include "vulkan_handle/memory.h"
 #include <cglm/vec2.h>
 #include <cglm/vec3.h>
+#include <stdlib.h>
 #include <string.h>
 #include <vulkan_handle/vulkan_handle.h>
 
@@ -277,7 +278,7 @@ static inline void calculateIndicesForSphere(Shape *vulkanShape,
     vulkanShape->index += indices;
 }
 
-void makeTriSphere(Vulkan *vulkan, ShapeType shapeType, size_t depth) {
+void makeTriSphere(Shape *shape, ShapeType shapeType, size_t depth) {
 
     Triangle *vertexData = NULL;
     uint32_t count = 0;
@@ -299,7 +300,8 @@ void makeTriSphere(Vulkan *vulkan, ShapeType shapeType, size_t depth) {
     size_t verticesPerFace = perFace * 3;
     size_t numVertices = count * verticesPerFace;
 
-    allocateVerticesAndIndices(vulkan, numVertices, numVertices);
+    shape->vertices = malloc(numVertices * sizeof(*shape->vertices));
+    shape->indices = malloc(numVertices * sizeof(*shape->indices));
 
     for (size_t i = 0; i < count; i++) {
         Vertex *face = vertexData[i];
@@ -320,16 +322,18 @@ void makeTriSphere(Vulkan *vulkan, ShapeType shapeType, size_t depth) {
             glm_vec3_copy(arc[j].pos, arc[j].normal);
 
             glm_vec3_copy(face->colour, arc[j].colour);
+
+            // never textured, zeroed so the baked tables are reproducible
+            glm_vec2_zero(arc[j].texCoord);
         }
 
-        memcpy(vulkan->shapes[vulkan->shapeCount].vertices +
-                   vulkan->shapes[vulkan->shapeCount].verticesCount,
-               arc, verticesPerFace * sizeof(*arc));
+        memcpy(shape->vertices + shape->verticesCount, arc,
+               verticesPerFace * sizeof(*arc));
 
-        vulkan->shapes[vulkan->shapeCount].verticesCount += verticesPerFace;
+        shape->verticesCount += verticesPerFace;
 
-        calculateIndicesForSphere(vulkan->shapes, verticesPerFace);
+        calculateIndicesForSphere(shape, verticesPerFace);
 
-        vulkan->shapes[vulkan->shapeCount].indicesCount += verticesPerFace;
+        shape->indicesCount += verticesPerFace;
     }
 }
@@ -0,0 +1,517 @@
+#include "geometry/simplify/simplify.h"
+#include "geometry/geometry.h"
+#include "vulkan_handle/memory.h"
+#include <cglm/vec3.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Garland and Heckbert, "Surface Simplification Using Quadric Error Metrics",
+// restricted to collapsing an edge onto one of its existing end points so the
+// result indexes the original vertex buffer
+
+typedef struct Quadric {
+    float a00, a11, a22;
+    float a10, a20, a21;
+    float b0, b1, b2;
+    float c;
+    float w;
+} Quadric;
+
+typedef struct Collapse {
+    uint32_t from;
+    uint32_t to;
+    float error;
+} Collapse;
+
+// vertex to triangle lists of the current index buffer
+typedef struct Adjacency {
+    uint32_t *offsets;
+    uint32_t *triangles;
+} Adjacency;
+
+static inline uint32_t hashBytes(const void *data, size_t size) {
+    const unsigned char *bytes = data;
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// first vertex whose leading size bytes match, for every vertex
+static uint32_t *buildRemap(const Vertex *vertices, uint32_t verticesCount,
+                            size_t size) {
+    uint32_t tableSize = 1;
+    while (tableSize < verticesCount * 2) {
+        tableSize *= 2;
+    }
+
+    uint32_t *table = malloc(tableSize * sizeof(*table));
+    memset(table, 0xff, tableSize * sizeof(*table));
+    uint32_t *remap = malloc(verticesCount * sizeof(*remap));
+
+    for (uint32_t i = 0; i < verticesCount; i++) {
+        uint32_t slot = hashBytes(&vertices[i], size) & (tableSize - 1);
+        while (table[slot] != UINT32_MAX &&
+               memcmp(&vertices[table[slot]], &vertices[i], size) != 0) {
+            slot = (slot + 1) & (tableSize - 1);
+        }
+        if (table[slot] == UINT32_MAX) {
+            table[slot] = i;
+        }
+        remap[i] = table[slot];
+    }
+
+    freeMem(1, table);
+
+    return remap;
+}
+
+static void buildAdjacency(Adjacency *adjacency, const uint32_t *indices,
+                           uint32_t indicesCount, uint32_t verticesCount) {
+    memset(adjacency->offsets, 0, (verticesCount + 1) * sizeof(uint32_t));
+    for (uint32_t i = 0; i < indicesCount; i++) {
+        adjacency->offsets[indices[i] + 1]++;
+    }
+    for (uint32_t i = 0; i < verticesCount; i++) {
+        adjacency->offsets[i + 1] += adjacency->offsets[i];
+    }
+    for (uint32_t i = 0; i < indicesCount; i++) {
+        adjacency->triangles[adjacency->offsets[indices[i]]++] = i / 3;
+    }
+    // filling moved every offset onto the next vertex's start
+    for (uint32_t i = verticesCount; i > 0; i--) {
+        adjacency->offsets[i] = adjacency->offsets[i - 1];
+    }
+    adjacency->offsets[0] = 0;
+}
+
+static bool hasEdge(const Adjacency *adjacency, const uint32_t *indices,
+                    uint32_t a, uint32_t b) {
+    for (uint32_t i = adjacency->offsets[a]; i < adjacency->offsets[a + 1];
+         i++) {
+        const uint32_t *triangle = &indices[adjacency->triangles[i] * 3];
+        for (uint32_t e = 0; e < 3; e++) {
+            if (triangle[e] == a && triangle[(e + 1) % 3] == b) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// an edge only one triangle uses, in either direction
+static inline bool isOpenEdge(const Adjacency *adjacency,
+                              const uint32_t *indices, uint32_t a,
+                              uint32_t b) {
+    return hasEdge(adjacency, indices, a, b) !=
+           hasEdge(adjacency, indices, b, a);
+}
+
+static inline void addPlane(Quadric *quadric, const vec3 normal,
+                            float distance, float weight) {
+    float a = normal[0], b = normal[1], c = normal[2];
+    quadric->a00 += weight * a * a;
+    quadric->a11 += weight * b * b;
+    quadric->a22 += weight * c * c;
+    quadric->a10 += weight * a * b;
+    quadric->a20 += weight * a * c;
+    quadric->a21 += weight * b * c;
+    quadric->b0 += weight * a * distance;
+    quadric->b1 += weight * b * distance;
+    quadric->b2 += weight * c * distance;
+    quadric->c += weight * distance * distance;
+    quadric->w += weight;
+}
+
+static inline void addQuadric(Quadric *quadric, const Quadric *other) {
+    quadric->a00 += other->a00;
+    quadric->a11 += other->a11;
+    quadric->a22 += other->a22;
+    quadric->a10 += other->a10;
+    quadric->a20 += other->a20;
+    quadric->a21 += other->a21;
+    quadric->b0 += other->b0;
+    quadric->b1 += other->b1;
+    quadric->b2 += other->b2;
+    quadric->c += other->c;
+    quadric->w += other->w;
+}
+
+// squared distance, averaged over the planes by weight
+static inline float quadricError(const Quadric *q, const float *v) {
+    float rx = 2.0f * (q->b0 + q->a10 * v[1]) + q->a00 * v[0];
+    float ry = 2.0f * (q->b1 + q->a21 * v[2]) + q->a11 * v[1];
+    float rz = 2.0f * (q->b2 + q->a20 * v[0]) + q->a22 * v[2];
+
+    float error = q->c + rx * v[0] + ry * v[1] + rz * v[2];
+
+    return fabsf(error) / (q->w > 0.0f ? q->w : 1.0f);
+}
+
+static VertexKind *classifyVertices(const uint32_t *indices,
+                                    uint32_t indicesCount,
+                                    const Adjacency *adjacency,
+                                    const uint32_t *wedges,
+                                    const uint32_t *positionRemap,
+                                    uint32_t verticesCount) {
+    uint32_t *openOut = calloc(verticesCount, sizeof(*openOut));
+    uint32_t *openIn = calloc(verticesCount, sizeof(*openIn));
+    uint32_t *openNext = malloc(verticesCount * sizeof(*openNext));
+    uint32_t *openPrevious = malloc(verticesCount * sizeof(*openPrevious));
+
+    for (uint32_t i = 0; i < indicesCount; i++) {
+        uint32_t a = indices[i];
+        uint32_t b = indices[i % 3 == 2 ? i - 2 : i + 1];
+
+        if (!hasEdge(adjacency, indices, b, a)) {
+            openOut[a]++;
+            openNext[a] = b;
+            openIn[b]++;
+            openPrevious[b] = a;
+        }
+    }
+
+    VertexKind *kinds = malloc(verticesCount * sizeof(*kinds));
+    for (uint32_t v = 0; v < verticesCount; v++) {
+        uint32_t w = wedges[v];
+
+        if (w == v) {
+            kinds[v] = openOut[v] == 0 && openIn[v] == 0 ? VERTEX_MANIFOLD
+                       : openOut[v] == 1 && openIn[v] == 1 ? VERTEX_BORDER
+                                                           : VERTEX_LOCKED;
+            continue;
+        }
+
+        // both sides of a seam run in opposite directions along it
+        bool seam = wedges[w] == v && openOut[v] == 1 && openIn[v] == 1 &&
+                    openOut[w] == 1 && openIn[w] == 1 &&
+                    positionRemap[openNext[v]] ==
+                        positionRemap[openPrevious[w]] &&
+                    positionRemap[openPrevious[v]] ==
+                        positionRemap[openNext[w]];
+
+        kinds[v] = seam ? VERTEX_SEAM : VERTEX_LOCKED;
+    }
+
+    freeMem(4, openOut, openIn, openNext, openPrevious);
+
+    return kinds;
+}
+
+static void computeQuadrics(Quadric *quadrics, const uint32_t *indices,
+                            uint32_t indicesCount, const Vertex *vertices,
+                            const uint32_t *positionRemap,
+                            const Adjacency *adjacency) {
+    for (uint32_t i = 0; i < indicesCount; i += 3) {
+        const float *p0 = vertices[indices[i + 0]].pos;
+        const float *p1 = vertices[indices[i + 1]].pos;
+        const float *p2 = vertices[indices[i + 2]].pos;
+
+        vec3 e1, e2, normal;
+        glm_vec3_sub((float *)p1, (float *)p0, e1);
+        glm_vec3_sub((float *)p2, (float *)p0, e2);
+        glm_vec3_cross(e1, e2, normal);
+
+        float area = glm_vec3_norm(normal);
+        if (area == 0.0f) {
+            continue;
+        }
+        glm_vec3_scale(normal, 1.0f / area, normal);
+        float distance = -glm_vec3_dot(normal, (float *)p0);
+
+        for (uint32_t k = 0; k < 3; k++) {
+            addPlane(&quadrics[positionRemap[indices[i + k]]], normal,
+                     distance, area);
+        }
+
+        // open edges get a plane standing on them so borders and seams
+        // keep their outline
+        for (uint32_t k = 0; k < 3; k++) {
+            uint32_t a = indices[i + k], b = indices[i + (k + 1) % 3];
+            if (hasEdge(adjacency, indices, b, a)) {
+                continue;
+            }
+
+            vec3 edge, edgeNormal;
+            glm_vec3_sub((float *)vertices[b].pos, (float *)vertices[a].pos,
+                         edge);
+            glm_vec3_cross(edge, normal, edgeNormal);
+            float length = glm_vec3_norm(edge);
+            if (length == 0.0f) {
+                continue;
+            }
+            glm_vec3_normalize(edgeNormal);
+            float edgeDistance =
+                -glm_vec3_dot(edgeNormal, (float *)vertices[a].pos);
+            float weight = length * length * SIMPLIFY_BORDER_WEIGHT;
+
+            addPlane(&quadrics[positionRemap[a]], edgeNormal, edgeDistance,
+                     weight);
+            addPlane(&quadrics[positionRemap[b]], edgeNormal, edgeDistance,
+                     weight);
+        }
+    }
+}
+
+// the other wedge's end of a seam edge, or UINT32_MAX if there is none
+static inline uint32_t seamPartner(const VertexKind *kinds,
+                                   const uint32_t *wedges,
+                                   const Adjacency *adjacency,
+                                   const uint32_t *indices, uint32_t from,
+                                   uint32_t to) {
+    uint32_t otherFrom = wedges[from];
+    uint32_t otherTo = kinds[to] == VERTEX_SEAM ? wedges[to] : to;
+
+    return isOpenEdge(adjacency, indices, otherFrom, otherTo) ? otherTo
+                                                              : UINT32_MAX;
+}
+
+static inline bool canCollapse(const VertexKind *kinds,
+                               const uint32_t *wedges,
+                               const uint32_t *positionRemap,
+                               const Adjacency *adjacency,
+                               const uint32_t *indices, uint32_t from,
+                               uint32_t to) {
+    if (positionRemap[from] == positionRemap[to]) {
+        return false;
+    }
+
+    switch (kinds[from]) {
+    case VERTEX_MANIFOLD:
+        return true;
+    case VERTEX_BORDER:
+        return isOpenEdge(adjacency, indices, from, to);
+    case VERTEX_SEAM:
+        return kinds[to] == VERTEX_SEAM &&
+               isOpenEdge(adjacency, indices, from, to) &&
+               seamPartner(kinds, wedges, adjacency, indices, from, to) !=
+                   UINT32_MAX;
+    default:
+        return false;
+    }
+}
+
+// moving from onto to must not turn any surviving triangle around
+static bool collapseFlips(const Adjacency *adjacency, const uint32_t *indices,
+                          const Vertex *vertices,
+                          const uint32_t *positionRemap, uint32_t from,
+                          uint32_t to, uint32_t *removed) {
+    for (uint32_t i = adjacency->offsets[from];
+         i < adjacency->offsets[from + 1]; i++) {
+        const uint32_t *triangle = &indices[adjacency->triangles[i] * 3];
+
+        bool hasTo = false;
+        for (uint32_t k = 0; k < 3; k++) {
+            hasTo |= positionRemap[triangle[k]] == positionRemap[to];
+        }
+        if (hasTo) {
+            (*removed)++;
+            continue;
+        }
+
+        vec3 p[3], q[3];
+        for (uint32_t k = 0; k < 3; k++) {
+            glm_vec3_copy((float *)vertices[triangle[k]].pos, p[k]);
+            glm_vec3_copy(triangle[k] == from ? (float *)vertices[to].pos
+                                              : p[k],
+                          q[k]);
+        }
+
+        vec3 e1, e2, before, after;
+        glm_vec3_sub(p[1], p[0], e1);
+        glm_vec3_sub(p[2], p[0], e2);
+        glm_vec3_cross(e1, e2, before);
+        glm_vec3_sub(q[1], q[0], e1);
+        glm_vec3_sub(q[2], q[0], e2);
+        glm_vec3_cross(e1, e2, after);
+
+        if (glm_vec3_dot(before, after) <=
+            SIMPLIFY_FLIP_THRESHOLD * glm_vec3_norm(before) *
+                glm_vec3_norm(after)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static int compareCollapses(const void *a, const void *b) {
+    float errorA = ((const Collapse *)a)->error;
+    float errorB = ((const Collapse *)b)->error;
+    return (errorA > errorB) - (errorA < errorB);
+}
+
+// Reduces the triangle list until it has at most targetIndicesCount indices
+// or no collapse is left under targetError (object space distance). The
+// destination must hold indicesCount indices, the error of the result is
+// written to resultError when it is not NULL.
+uint32_t simplify(uint32_t *destination, const uint32_t *indices,
+                  uint32_t indicesCount, const Vertex *vertices,
+                  uint32_t verticesCount, uint32_t targetIndicesCount,
+                  float targetError, float *resultError) {
+    // identical vertices are welded so unwelded input still has connectivity
+    uint32_t *wedgeRemap = buildRemap(vertices, verticesCount, sizeof(Vertex));
+    uint32_t *positionRemap =
+        buildRemap(vertices, verticesCount, sizeof(vertices->pos));
+
+    uint32_t count = indicesCount;
+    for (uint32_t i = 0; i < count; i++) {
+        destination[i] = wedgeRemap[indices[i]];
+    }
+
+    // vertices sharing a position form a cycle
+    uint32_t *wedges = malloc(verticesCount * sizeof(*wedges));
+    for (uint32_t v = 0; v < verticesCount; v++) {
+        wedges[v] = v;
+    }
+    for (uint32_t v = 0; v < verticesCount; v++) {
+        uint32_t p = positionRemap[v];
+        if (wedgeRemap[v] == v && p != v) {
+            wedges[v] = wedges[p];
+            wedges[p] = v;
+        }
+    }
+
+    Adjacency adjacency = {
+        .offsets = malloc((verticesCount + 1) * sizeof(uint32_t)),
+        .triangles = malloc(indicesCount * sizeof(uint32_t)),
+    };
+    buildAdjacency(&adjacency, destination, count, verticesCount);
+
+    VertexKind *kinds =
+        classifyVertices(destination, count, &adjacency, wedges,
+                         positionRemap, verticesCount);
+
+    Quadric *quadrics = calloc(verticesCount, sizeof(*quadrics));
+    computeQuadrics(quadrics, destination, count, vertices, positionRemap,
+                    &adjacency);
+
+    Collapse *collapses = malloc(indicesCount * 2 * sizeof(*collapses));
+    uint32_t *collapseRemap = malloc(verticesCount * sizeof(*collapseRemap));
+    bool *locked = malloc(verticesCount * sizeof(*locked));
+    for (uint32_t v = 0; v < verticesCount; v++) {
+        collapseRemap[v] = v;
+    }
+
+    float maxError = 0.0f;
+    float errorLimit = targetError * targetError;
+
+    while (count > targetIndicesCount) {
+        uint32_t collapsesCount = 0;
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t a = destination[i];
+            uint32_t b = destination[i % 3 == 2 ? i - 2 : i + 1];
+
+            if (canCollapse(kinds, wedges, positionRemap, &adjacency,
+                            destination, a, b)) {
+                collapses[collapsesCount++] = (Collapse){
+                    a, b,
+                    quadricError(&quadrics[positionRemap[a]],
+                                 vertices[b].pos)};
+            }
+            // open edges are only seen from one side
+            if (!hasEdge(&adjacency, destination, b, a) &&
+                canCollapse(kinds, wedges, positionRemap, &adjacency,
+                            destination, b, a)) {
+                collapses[collapsesCount++] = (Collapse){
+                    b, a,
+                    quadricError(&quadrics[positionRemap[b]],
+                                 vertices[a].pos)};
+            }
+        }
+
+        qsort(collapses, collapsesCount, sizeof(*collapses),
+              compareCollapses);
+
+        memset(locked, 0, verticesCount * sizeof(*locked));
+
+        uint32_t trianglesToRemove = (count - targetIndicesCount) / 3;
+        uint32_t removed = 0;
+        uint32_t performed = 0;
+
+        for (uint32_t i = 0; i < collapsesCount && removed < trianglesToRemove;
+             i++) {
+            Collapse *collapse = &collapses[i];
+            if (collapse->error > errorLimit) {
+                break;
+            }
+
+            uint32_t from = collapse->from, to = collapse->to;
+            uint32_t fromPosition = positionRemap[from];
+            uint32_t toPosition = positionRemap[to];
+            if (locked[fromPosition] || locked[toPosition]) {
+                continue;
+            }
+
+            uint32_t otherFrom = UINT32_MAX, otherTo = UINT32_MAX;
+            if (kinds[from] == VERTEX_SEAM) {
+                otherFrom = wedges[from];
+                otherTo = seamPartner(kinds, wedges, &adjacency, destination,
+                                      from, to);
+            }
+
+            uint32_t removedHere = 0;
+            if (collapseFlips(&adjacency, destination, vertices,
+                              positionRemap, from, to, &removedHere) ||
+                (otherFrom != UINT32_MAX &&
+                 collapseFlips(&adjacency, destination, vertices,
+                               positionRemap, otherFrom, otherTo,
+                               &removedHere))) {
+                continue;
+            }
+
+            collapseRemap[from] = to;
+            if (otherFrom != UINT32_MAX) {
+                collapseRemap[otherFrom] = otherTo;
+            }
+
+            addQuadric(&quadrics[toPosition], &quadrics[fromPosition]);
+
+            locked[fromPosition] = locked[toPosition] = true;
+            removed += removedHere;
+            performed++;
+
+            if (collapse->error > maxError) {
+                maxError = collapse->error;
+            }
+        }
+
+        if (performed == 0) {
+            break;
+        }
+
+        // apply the pass, dropping triangles that collapsed to a line
+        uint32_t written = 0;
+        for (uint32_t i = 0; i < count; i += 3) {
+            uint32_t a = collapseRemap[destination[i + 0]];
+            uint32_t b = collapseRemap[destination[i + 1]];
+            uint32_t c = collapseRemap[destination[i + 2]];
+
+            uint32_t pa = positionRemap[a], pb = positionRemap[b],
+                     pc = positionRemap[c];
+            if (pa == pb || pb == pc || pc == pa) {
+                continue;
+            }
+
+            destination[written++] = a;
+            destination[written++] = b;
+            destination[written++] = c;
+        }
+        count = written;
+
+        buildAdjacency(&adjacency, destination, count, verticesCount);
+    }
+
+    if (resultError) {
+        *resultError = sqrtf(maxError);
+    }
+
+    freeMem(10, wedgeRemap, positionRemap, wedges, adjacency.offsets,
+            adjacency.triangles, kinds, quadrics, collapses, collapseRemap,
+            locked);
+
+    return count;
+}
@@ -0,0 +1,332 @@
+#include "geometry/stream/chunks.h"
+#include "geometry/geometry.h"
+#include "geometry/lod/lod.h"
+#include "geometry/optimise/optimise.h"
+#include "geometry/simplify/simplify.h"
+#include "vulkan_handle/memory.h"
+#include <cglm/vec3.h>
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vulkan/vulkan.h>
+
+typedef struct ChunkWriter {
+    const Shape *shape;
+    vec3 *centroids;
+    uint32_t *remap; // shape vertex to chunk vertex, all unset between chunks
+    FILE *file;
+    uint64_t offset;
+    ChunkFileHeader header;
+    ChunkRecord *chunks;
+    uint32_t chunksCapacity;
+    bool failed;
+} ChunkWriter;
+
+static void writeBytes(ChunkWriter *writer, const void *data, uint64_t size) {
+    if (size && fwrite(data, 1, size, writer->file) != size) {
+        writer->failed = true;
+    }
+    writer->offset += size;
+}
+
+static void alignFile(ChunkWriter *writer) {
+    static const unsigned char zeros[CHUNK_ALIGNMENT];
+    uint64_t padding = -writer->offset & (CHUNK_ALIGNMENT - 1);
+    writeBytes(writer, zeros, padding);
+}
+
+static uint32_t uniqueVertices(ChunkWriter *writer, const uint32_t *triangles,
+                               uint32_t count) {
+    const uint32_t *indices = writer->shape->indices;
+    uint32_t unique = 0;
+
+    for (uint32_t i = 0; i < count; i++) {
+        for (uint32_t k = 0; k < 3; k++) {
+            uint32_t index = indices[triangles[i] * 3 + k];
+            if (writer->remap[index] == UINT32_MAX) {
+                writer->remap[index] = unique++;
+            }
+        }
+    }
+
+    // put the table back the way the next caller expects it
+    for (uint32_t i = 0; i < count; i++) {
+        for (uint32_t k = 0; k < 3; k++) {
+            writer->remap[indices[triangles[i] * 3 + k]] = UINT32_MAX;
+        }
+    }
+
+    return unique;
+}
+
+// quickselect, afterwards the lower half of the triangles lies below the
+// median centroid on the axis and the upper half above it
+static void splitAtMedian(uint32_t *triangles, uint32_t count,
+                          const vec3 *centroids, uint32_t axis) {
+    uint32_t first = 0;
+    uint32_t last = count - 1;
+    uint32_t median = count / 2;
+
+    while (first < last) {
+        float pivot = centroids[triangles[(first + last) / 2]][axis];
+        uint32_t i = first;
+        uint32_t j = last;
+
+        while (i <= j) {
+            while (centroids[triangles[i]][axis] < pivot) {
+                i++;
+            }
+            while (centroids[triangles[j]][axis] > pivot) {
+                j--;
+            }
+            if (i <= j) {
+                uint32_t swap = triangles[i];
+                triangles[i++] = triangles[j];
+                triangles[j] = swap;
+                if (j == 0) {
+                    break;
+                }
+                j--;
+            }
+        }
+
+        if (median <= j) {
+            last = j;
+        } else if (median >= i) {
+            first = i;
+        } else {
+            break;
+        }
+    }
+}
+
+static void boundingSphere(const Vertex *vertices, uint32_t verticesCount,
+                           float *sphere) {
+    vec3 min = {FLT_MAX, FLT_MAX, FLT_MAX};
+    vec3 max = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+    for (uint32_t i = 0; i < verticesCount; i++) {
+        glm_vec3_minv(min, (float *)vertices[i].pos, min);
+        glm_vec3_maxv(max, (float *)vertices[i].pos, max);
+    }
+
+    glm_vec3_center(min, max, sphere);
+    sphere[3] = 0.0f;
+    for (uint32_t i = 0; i < verticesCount; i++) {
+        sphere[3] = fmaxf(sphere[3],
+                          glm_vec3_distance(sphere, (float *)vertices[i].pos));
+    }
+}
+
+// optimised for the vertex cache and written with only the vertices it uses
+static void writeLevel(ChunkWriter *writer, const Shape *chunk,
+                       const uint32_t *indices, uint32_t indicesCount,
+                       ChunkLevel *level) {
+    Shape optimised = {
+        .vertices = malloc(chunk->verticesCount * sizeof(*chunk->vertices)),
+        .verticesCount = chunk->verticesCount,
+        .indices = malloc(indicesCount * sizeof(*indices)),
+        .indicesCount = indicesCount,
+        .indexed = true,
+        .graphicsPipeline.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
+    };
+    memcpy(optimised.vertices, chunk->vertices,
+           chunk->verticesCount * sizeof(*chunk->vertices));
+    memcpy(optimised.indices, indices, indicesCount * sizeof(*indices));
+
+    // fetch order puts every used vertex first
+    optimiseShape(&optimised, 0);
+
+    uint32_t usedCount = 0;
+    uint16_t *narrowed = malloc(indicesCount * sizeof(*narrowed));
+    for (uint32_t i = 0; i < indicesCount; i++) {
+        narrowed[i] = (uint16_t)optimised.indices[i];
+        if (optimised.indices[i] >= usedCount) {
+            usedCount = optimised.indices[i] + 1;
+        }
+    }
+
+    alignFile(writer);
+    level->offset = writer->offset;
+    level->verticesCount = usedCount;
+    level->indicesCount = indicesCount;
+
+    writeBytes(writer, optimised.vertices,
+               usedCount * sizeof(*optimised.vertices));
+    writeBytes(writer, narrowed, indicesCount * sizeof(*narrowed));
+
+    freeMem(3, optimised.vertices, optimised.indices, narrowed);
+}
+
+// Every level is simplified from the finest on its own, halving the triangles
+// each time. The simplifier's border weight keeps the chunk's open edges
+// close to where the neighbouring chunk's edges are.
+static void writeChunk(ChunkWriter *writer, const uint32_t *triangles,
+                       uint32_t count) {
+    const Shape *shape = writer->shape;
+
+    Shape chunk = {
+        .vertices = malloc(count * 3 * sizeof(*chunk.vertices)),
+        .indices = malloc(count * 3 * sizeof(*chunk.indices)),
+        .indicesCount = count * 3,
+    };
+    for (uint32_t i = 0; i < count; i++) {
+        for (uint32_t k = 0; k < 3; k++) {
+            uint32_t index = shape->indices[triangles[i] * 3 + k];
+            if (writer->remap[index] == UINT32_MAX) {
+                writer->remap[index] = chunk.verticesCount;
+                chunk.vertices[chunk.verticesCount++] = shape->vertices[index];
+            }
+            chunk.indices[i * 3 + k] = writer->remap[index];
+        }
+    }
+    for (uint32_t i = 0; i < chunk.indicesCount; i++) {
+        writer->remap[shape->indices[triangles[i / 3] * 3 + i % 3]] =
+            UINT32_MAX;
+    }
+
+    if (writer->header.chunksCount == writer->chunksCapacity) {
+        writer->chunksCapacity = writer->chunksCapacity * 2 + 16;
+        writer->chunks =
+            realloc(writer->chunks,
+                    writer->chunksCapacity * sizeof(*writer->chunks));
+    }
+    ChunkRecord *record = &writer->chunks[writer->header.chunksCount++];
+    *record = (ChunkRecord){0};
+
+    boundingSphere(chunk.vertices, chunk.verticesCount, record->sphere);
+
+    uint32_t *simplified = malloc(chunk.indicesCount * sizeof(*simplified));
+    uint32_t previousCount = chunk.indicesCount;
+
+    writeLevel(writer, &chunk, chunk.indices, chunk.indicesCount,
+               &record->levels[record->levelsCount++]);
+
+    for (uint32_t i = 1; i < CHUNK_MAX_LEVELS; i++) {
+        uint32_t targetTriangles = count >> i;
+        if (targetTriangles < LOD_MIN_TRIANGLES) {
+            break;
+        }
+
+        float error;
+        uint32_t simplifiedCount =
+            simplify(simplified, chunk.indices, chunk.indicesCount,
+                     chunk.vertices, chunk.verticesCount,
+                     targetTriangles * 3, FLT_MAX, &error);
+
+        // the simplifier stalled, the level would only cost memory
+        if (simplifiedCount > previousCount * LOD_MIN_REDUCTION) {
+            break;
+        }
+        previousCount = simplifiedCount;
+
+        ChunkLevel *level = &record->levels[record->levelsCount++];
+        writeLevel(writer, &chunk, simplified, simplifiedCount, level);
+        level->error = error;
+    }
+
+    for (uint32_t i = 0; i < record->levelsCount; i++) {
+        writer->header.levelErrors[i] =
+            fmaxf(writer->header.levelErrors[i], record->levels[i].error);
+    }
+    if (record->levelsCount > writer->header.levelsCount) {
+        writer->header.levelsCount = record->levelsCount;
+    }
+
+    freeMem(3, chunk.vertices, chunk.indices, simplified);
+}
+
+// splits along the longest axis of the centroids until a chunk fits a slot
+static void partition(ChunkWriter *writer, uint32_t *triangles,
+                      uint32_t count) {
+    if (count <= CHUNK_MAX_TRIANGLES &&
+        uniqueVertices(writer, triangles, count) <= CHUNK_MAX_VERTICES) {
+        writeChunk(writer, triangles, count);
+        return;
+    }
+
+    vec3 min = {FLT_MAX, FLT_MAX, FLT_MAX};
+    vec3 max = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+    for (uint32_t i = 0; i < count; i++) {
+        glm_vec3_minv(min, writer->centroids[triangles[i]], min);
+        glm_vec3_maxv(max, writer->centroids[triangles[i]], max);
+    }
+
+    vec3 extent;
+    glm_vec3_sub(max, min, extent);
+    uint32_t axis = extent[0] > extent[1] ? 0 : 1;
+    axis = extent[2] > extent[axis] ? 2 : axis;
+
+    splitAtMedian(triangles, count, writer->centroids, axis);
+
+    partition(writer, triangles, count / 2);
+    partition(writer, triangles + count / 2, count - count / 2);
+}
+
+// Splits an indexed triangle list into spatially coherent chunks, each with
+// its own levels of detail, for generateStreamedMesh to page in. The whole
+// mesh is held in memory while writing, only playback is out of core.
+bool writeChunkedMesh(const Shape *shape, const char *fileName) {
+    if (shape->indicesCount < 3) {
+        return false;
+    }
+
+    FILE *file = fopen(fileName, "wb");
+    if (!file) {
+        return false;
+    }
+
+    uint32_t trianglesCount = shape->indicesCount / 3;
+
+    ChunkWriter writer = {
+        .shape = shape,
+        .centroids = malloc(trianglesCount * sizeof(*writer.centroids)),
+        .remap = malloc(shape->verticesCount * sizeof(*writer.remap)),
+        .file = file,
+        .header =
+            {
+                .magic = CHUNK_FILE_MAGIC,
+                .version = CHUNK_FILE_VERSION,
+            },
+    };
+    memset(writer.remap, 0xff, shape->verticesCount * sizeof(*writer.remap));
+
+    uint32_t *triangles = malloc(trianglesCount * sizeof(*triangles));
+    for (uint32_t i = 0; i < trianglesCount; i++) {
+        const uint32_t *triangle = &shape->indices[i * 3];
+        glm_vec3_add(shape->vertices[triangle[0]].pos,
+                     shape->vertices[triangle[1]].pos, writer.centroids[i]);
+        glm_vec3_add(writer.centroids[i], shape->vertices[triangle[2]].pos,
+                     writer.centroids[i]);
+        glm_vec3_scale(writer.centroids[i], 1.0f / 3.0f, writer.centroids[i]);
+        triangles[i] = i;
+
+        for (uint32_t k = 0; k < 3; k++) {
+            writer.header.boundingRadius =
+                fmaxf(writer.header.boundingRadius,
+                      glm_vec3_norm(shape->vertices[triangle[k]].pos));
+        }
+    }
+
+    // room for the header, rewritten once the chunks are known
+    writeBytes(&writer, &writer.header, sizeof(writer.header));
+
+    partition(&writer, triangles, trianglesCount);
+
+    alignFile(&writer);
+    writer.header.chunksOffset = writer.offset;
+    writeBytes(&writer, writer.chunks,
+               writer.header.chunksCount * sizeof(*writer.chunks));
+
+    bool written = !writer.failed && fseek(file, 0, SEEK_SET) == 0 &&
+                   fwrite(&writer.header, sizeof(writer.header), 1, file) == 1;
+    written &= fclose(file) == 0;
+
+    freeMem(4, writer.centroids, writer.remap, writer.chunks, triangles);
+
+    if (!written) {
+        remove(fileName);
+    }
+    return written;
+}
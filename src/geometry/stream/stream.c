@@ -0,0 +1,472 @@
+#include "geometry/stream/stream.h"
+#include "error_handle.h"
+#include "geometry/geometry.h"
+#include "geometry/lod/lod.h"
+#include "geometry/meshlet/meshlet.h"
+#include "vulkan_handle/memory.h"
+#include "vulkan_handle/vulkan_handle.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// copies a requested level from the mapping into staging, the only place the
+// file is read once the stream is open, so page faults never reach the render
+// thread
+static void loadChunk(void *data) {
+    StreamStaging *staging = data;
+    const MeshStream *stream = staging->stream;
+
+    const ChunkLevel *level =
+        &stream->chunks[staging->chunk].levels[staging->level];
+    const char *blob = stream->file.data + level->offset;
+    size_t verticesSize = level->verticesCount * sizeof(Vertex);
+
+    memcpy(staging->data, blob, verticesSize);
+    memcpy(staging->data + STREAM_SLOT_VERTICES_SIZE, blob + verticesSize,
+           level->indicesCount * sizeof(uint16_t));
+
+    SDL_AtomicSet(&staging->state, STREAM_STAGING_LOADED);
+}
+
+static inline bool validChunks(const MappedFile *file) {
+    const ChunkFileHeader *header = (const ChunkFileHeader *)file->data;
+    if (file->size < sizeof(*header) || header->magic != CHUNK_FILE_MAGIC ||
+        header->version != CHUNK_FILE_VERSION || !header->chunksCount ||
+        header->chunksOffset > file->size ||
+        (file->size - header->chunksOffset) / sizeof(ChunkRecord) <
+            header->chunksCount) {
+        return false;
+    }
+
+    const ChunkRecord *chunks =
+        (const ChunkRecord *)(file->data + header->chunksOffset);
+    for (uint32_t i = 0; i < header->chunksCount; i++) {
+        if (!chunks[i].levelsCount ||
+            chunks[i].levelsCount > CHUNK_MAX_LEVELS) {
+            return false;
+        }
+        for (uint32_t k = 0; k < chunks[i].levelsCount; k++) {
+            const ChunkLevel *level = &chunks[i].levels[k];
+            uint64_t size = level->verticesCount * sizeof(Vertex) +
+                            level->indicesCount * sizeof(uint16_t);
+            if (level->verticesCount > CHUNK_MAX_VERTICES ||
+                level->indicesCount > CHUNK_MAX_INDICES ||
+                level->offset > file->size ||
+                size > file->size - level->offset) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+static void createStreamStaging(Vulkan *vulkan, MeshStream *stream) {
+    QueueFamilyIndices queueFamilyIndices = findQueueFamilies(
+        vulkan->device.physicalDevice, vulkan->window.surface);
+
+    VkCommandPoolCreateInfo poolInfo = {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+        .flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
+        .queueFamilyIndex = queueFamilyIndices.graphicsFamily,
+    };
+
+    if (vkCreateCommandPool(vulkan->device.device, &poolInfo, NULL,
+                            &stream->commandPool) != VK_SUCCESS) {
+        THROW_ERROR("failed to create stream command pool!\n");
+    }
+
+    VkCommandBuffer commandBuffers[STREAM_STAGING_SLOTS];
+    VkCommandBufferAllocateInfo allocInfo = {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+        .commandPool = stream->commandPool,
+        .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+        .commandBufferCount = STREAM_STAGING_SLOTS,
+    };
+
+    if (vkAllocateCommandBuffers(vulkan->device.device, &allocInfo,
+                                 commandBuffers) != VK_SUCCESS) {
+        THROW_ERROR("failed to allocate stream command buffers!\n");
+    }
+
+    createBuffer(STREAM_STAGING_SLOTS * STREAM_SLOT_SIZE,
+                 VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                 VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                     VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                 vulkan, &stream->stagingBuffer, &stream->stagingBufferMemory);
+
+    // mapped for as long as the stream lives, the load jobs write straight in
+    unsigned char *data;
+    vkMapMemory(vulkan->device.device, stream->stagingBufferMemory, 0,
+                VK_WHOLE_SIZE, 0, (void **)&data);
+
+    VkFenceCreateInfo fenceInfo = {
+        .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+    };
+
+    for (uint32_t i = 0; i < STREAM_STAGING_SLOTS; i++) {
+        StreamStaging *staging = &stream->staging[i];
+        staging->stream = stream;
+        staging->data = data + i * STREAM_SLOT_SIZE;
+        staging->commandBuffer = commandBuffers[i];
+        SDL_AtomicSet(&staging->state, STREAM_STAGING_FREE);
+
+        if (vkCreateFence(vulkan->device.device, &fenceInfo, NULL,
+                          &staging->fence) != VK_SUCCESS) {
+            THROW_ERROR("failed to create stream fence!\n");
+        }
+    }
+}
+
+// The pool is the shape's vertex and index buffer, split into equal slots, as
+// many as the budget allows and no more than there are chunks.
+void openMeshStream(Vulkan *vulkan, Shape *shape, const char *fileName,
+                    VkDeviceSize budget, uint32_t shapeIndex) {
+    MeshStream *stream = calloc(1, sizeof(*stream));
+
+    if (!mapFile(fileName, MAPPED_FILE_RANDOM, &stream->file) ||
+        !validChunks(&stream->file)) {
+        THROW_ERROR("failed to open chunked mesh!\n");
+    }
+
+    stream->header = (const ChunkFileHeader *)stream->file.data;
+    stream->chunks =
+        (const ChunkRecord *)(stream->file.data + stream->header->chunksOffset);
+
+    uint32_t chunksCount = stream->header->chunksCount;
+    VkDeviceSize slots = (budget ? budget : STREAM_DEFAULT_BUDGET) /
+                         STREAM_SLOT_SIZE;
+    stream->slotsCount = slots < chunksCount ? (uint32_t)slots : chunksCount;
+    if (!stream->slotsCount) {
+        THROW_ERROR("stream budget is smaller than a chunk!\n");
+    }
+
+    stream->slotChunks = malloc(stream->slotsCount * sizeof(uint32_t));
+    stream->slotLevels = calloc(stream->slotsCount, sizeof(uint32_t));
+    stream->slotReserved = calloc(stream->slotsCount, sizeof(bool));
+    stream->chunkSlots = malloc(chunksCount * sizeof(uint32_t));
+    stream->chunkPending = calloc(chunksCount, sizeof(bool));
+    stream->priorities = malloc(chunksCount * sizeof(float));
+    stream->desiredLevels = malloc(chunksCount * sizeof(uint32_t));
+    stream->candidates = malloc(chunksCount * sizeof(uint32_t));
+    memset(stream->slotChunks, 0xff, stream->slotsCount * sizeof(uint32_t));
+    memset(stream->chunkSlots, 0xff, chunksCount * sizeof(uint32_t));
+
+    createBuffer(stream->slotsCount * STREAM_SLOT_VERTICES_SIZE,
+                 VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+                     VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+                 VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, vulkan,
+                 &vulkan->shapeBuffers.vertexBuffer[shapeIndex],
+                 &vulkan->shapeBuffers.vertexBufferMemory[shapeIndex]);
+    createBuffer(stream->slotsCount * STREAM_SLOT_INDICES_SIZE,
+                 VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+                     VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+                 VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, vulkan,
+                 &vulkan->shapeBuffers.indexBuffer[shapeIndex],
+                 &vulkan->shapeBuffers.indexBufferMemory[shapeIndex]);
+
+    createStreamStaging(vulkan, stream);
+
+    // levels are picked per chunk, the shape's levels only carry the errors
+    shape->lodCount = stream->header->levelsCount;
+    shape->lods = calloc(shape->lodCount, sizeof(*shape->lods));
+    for (uint32_t i = 0; i < shape->lodCount; i++) {
+        shape->lods[i].error = stream->header->levelErrors[i];
+    }
+    shape->boundingRadius = stream->header->boundingRadius;
+    shape->indexType = VK_INDEX_TYPE_UINT16;
+    shape->indexed = true;
+    shape->stream = stream;
+}
+
+// puts the chunk in its slot and records the copy out of staging, the
+// barriers keep it from overwriting a slot earlier frames still read
+static void submitUpload(Vulkan *vulkan, Shape *shape, StreamStaging *staging,
+                         uint32_t shapeIndex) {
+    MeshStream *stream = shape->stream;
+    const ChunkLevel *level =
+        &stream->chunks[staging->chunk].levels[staging->level];
+
+    VkDeviceSize stagingOffset = staging->data - stream->staging[0].data;
+    VkBufferCopy vertexCopy = {
+        .srcOffset = stagingOffset,
+        .dstOffset = staging->slot * STREAM_SLOT_VERTICES_SIZE,
+        .size = level->verticesCount * sizeof(Vertex),
+    };
+    VkBufferCopy indexCopy = {
+        .srcOffset = stagingOffset + STREAM_SLOT_VERTICES_SIZE,
+        .dstOffset = staging->slot * STREAM_SLOT_INDICES_SIZE,
+        .size = level->indicesCount * sizeof(uint16_t),
+    };
+
+    VkCommandBufferBeginInfo beginInfo = {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+        .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+    };
+    vkBeginCommandBuffer(staging->commandBuffer, &beginInfo);
+
+    VkMemoryBarrier beforeCopy = {
+        .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+        .srcAccessMask = 0,
+        .dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+    };
+    vkCmdPipelineBarrier(staging->commandBuffer,
+                         VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+                         VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &beforeCopy, 0,
+                         NULL, 0, NULL);
+
+    vkCmdCopyBuffer(staging->commandBuffer, stream->stagingBuffer,
+                    vulkan->shapeBuffers.vertexBuffer[shapeIndex], 1,
+                    &vertexCopy);
+    vkCmdCopyBuffer(staging->commandBuffer, stream->stagingBuffer,
+                    vulkan->shapeBuffers.indexBuffer[shapeIndex], 1,
+                    &indexCopy);
+
+    VkMemoryBarrier afterCopy = {
+        .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+        .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .dstAccessMask =
+            VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT,
+    };
+    vkCmdPipelineBarrier(staging->commandBuffer,
+                         VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, 0, 1, &afterCopy,
+                         0, NULL, 0, NULL);
+
+    vkEndCommandBuffer(staging->commandBuffer);
+
+    VkSubmitInfo submitInfo = {
+        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .commandBufferCount = 1,
+        .pCommandBuffers = &staging->commandBuffer,
+    };
+
+    // the same queue as the frame, submitted ahead of it, so the frame is
+    // ordered after the copy without a semaphore
+    if (vkQueueSubmit(vulkan->device.graphicsQueue, 1, &submitInfo,
+                      staging->fence) != VK_SUCCESS) {
+        THROW_ERROR("failed to submit stream upload!\n");
+    }
+
+    stream->slotChunks[staging->slot] = staging->chunk;
+    stream->slotLevels[staging->slot] = staging->level;
+    stream->slotReserved[staging->slot] = false;
+    stream->chunkSlots[staging->chunk] = staging->slot;
+    stream->chunkPending[staging->chunk] = false;
+
+    SDL_AtomicSet(&staging->state, STREAM_STAGING_UPLOADING);
+}
+
+static void finishUploads(Vulkan *vulkan, Shape *shape, uint32_t shapeIndex) {
+    MeshStream *stream = shape->stream;
+
+    for (uint32_t i = 0; i < STREAM_STAGING_SLOTS; i++) {
+        StreamStaging *staging = &stream->staging[i];
+        int state = SDL_AtomicGet(&staging->state);
+
+        if (state == STREAM_STAGING_UPLOADING &&
+            vkGetFenceStatus(vulkan->device.device, staging->fence) ==
+                VK_SUCCESS) {
+            vkResetFences(vulkan->device.device, 1, &staging->fence);
+            SDL_AtomicSet(&staging->state, STREAM_STAGING_FREE);
+        } else if (state == STREAM_STAGING_LOADED) {
+            submitUpload(vulkan, shape, staging, shapeIndex);
+        }
+    }
+}
+
+// finest level whose error projects under LOD_PIXEL_ERROR, and how large the
+// chunk is on screen, which orders the requests
+static void prioritiseChunks(Vulkan *vulkan, MeshStream *stream) {
+    float viewportHeight = vulkan->swapchain.swapChainExtent->height;
+
+    for (uint32_t i = 0; i < stream->header->chunksCount; i++) {
+        const ChunkRecord *chunk = &stream->chunks[i];
+        float pixelsPerUnit = projectedPixelsPerUnit(
+            &vulkan->ubo, chunk->sphere, chunk->sphere[3], viewportHeight);
+
+        uint32_t level = chunk->levelsCount - 1;
+        while (level > 0 &&
+               chunk->levels[level].error * pixelsPerUnit > LOD_PIXEL_ERROR) {
+            level--;
+        }
+
+        stream->desiredLevels[i] = level;
+        stream->priorities[i] = pixelsPerUnit * chunk->sphere[3];
+    }
+}
+
+// qsort has no context argument, only the render thread ever sorts
+static const float *sortPriorities;
+
+static int compareCandidates(const void *a, const void *b) {
+    float pa = sortPriorities[*(const uint32_t *)a];
+    float pb = sortPriorities[*(const uint32_t *)b];
+    return (pa < pb) - (pa > pb);
+}
+
+// the resident chunk that matters least, UINT32_MAX when every slot is busy
+// being filled or upgraded
+static uint32_t leastImportantSlot(const MeshStream *stream) {
+    uint32_t slot = UINT32_MAX;
+    for (uint32_t i = 0; i < stream->slotsCount; i++) {
+        if (stream->slotReserved[i]) {
+            continue;
+        }
+        if (stream->slotChunks[i] == UINT32_MAX) {
+            return i;
+        }
+        if (stream->chunkPending[stream->slotChunks[i]]) {
+            continue;
+        }
+        if (slot == UINT32_MAX ||
+            stream->priorities[stream->slotChunks[i]] <
+                stream->priorities[stream->slotChunks[slot]]) {
+            slot = i;
+        }
+    }
+    return slot;
+}
+
+// hands the most important missing or too coarse chunks to free staging
+// regions, evicting whatever matters less to make room
+static void requestChunks(MeshStream *stream) {
+    uint32_t candidatesCount = 0;
+    for (uint32_t i = 0; i < stream->header->chunksCount; i++) {
+        uint32_t slot = stream->chunkSlots[i];
+        if (!stream->chunkPending[i] &&
+            (slot == UINT32_MAX ||
+             stream->slotLevels[slot] > stream->desiredLevels[i])) {
+            stream->candidates[candidatesCount++] = i;
+        }
+    }
+
+    sortPriorities = stream->priorities;
+    qsort(stream->candidates, candidatesCount, sizeof(uint32_t),
+          compareCandidates);
+
+    uint32_t next = 0;
+
+    for (uint32_t i = 0; i < STREAM_STAGING_SLOTS && next < candidatesCount;
+         i++) {
+        StreamStaging *staging = &stream->staging[i];
+        if (SDL_AtomicGet(&staging->state) != STREAM_STAGING_FREE) {
+            continue;
+        }
+
+        uint32_t chunk = stream->candidates[next++];
+
+        // a finer level replaces the chunk's own, which is drawn until then
+        uint32_t slot = stream->chunkSlots[chunk];
+        if (slot == UINT32_MAX) {
+            slot = leastImportantSlot(stream);
+            if (slot == UINT32_MAX) {
+                break;
+            }
+
+            uint32_t evicted = stream->slotChunks[slot];
+            if (evicted != UINT32_MAX) {
+                if (stream->priorities[evicted] >= stream->priorities[chunk]) {
+                    break;
+                }
+                stream->chunkSlots[evicted] = UINT32_MAX;
+                stream->slotChunks[slot] = UINT32_MAX;
+            }
+            stream->slotReserved[slot] = true;
+        }
+
+        staging->chunk = chunk;
+        staging->level = stream->desiredLevels[chunk];
+        staging->slot = slot;
+        stream->chunkPending[chunk] = true;
+
+        SDL_AtomicSet(&staging->state, STREAM_STAGING_REQUESTED);
+
+        Job load = {
+            .function = loadChunk,
+            .data = staging,
+        };
+        runJobs(&load, 1, &stream->loads);
+    }
+}
+
+// Called in place of the whole shape's level selection, it never waits: the
+// uploads that are ready go out, the rest show up in a later frame, and the
+// frame draws whatever is resident after culling each chunk on its own.
+void updateMeshStream(Vulkan *vulkan, Shape *shape, uint32_t imageIndex) {
+    MeshStream *stream = shape->stream;
+    uint32_t shapeIndex = (uint32_t)(shape - vulkan->shapes);
+
+    finishUploads(vulkan, shape, shapeIndex);
+    prioritiseChunks(vulkan, stream);
+    requestChunks(stream);
+
+    // every resident slot as a meshlet, so chunks are culled the same way
+    Meshlet *resident = malloc(stream->slotsCount * sizeof(*resident));
+    uint32_t residentCount = 0;
+
+    for (uint32_t i = 0; i < stream->slotsCount; i++) {
+        uint32_t chunk = stream->slotChunks[i];
+        if (chunk == UINT32_MAX || stream->slotReserved[i]) {
+            continue;
+        }
+
+        Meshlet *meshlet = &resident[residentCount++];
+        memcpy(meshlet->sphere, stream->chunks[chunk].sphere,
+               sizeof(meshlet->sphere));
+        // no cone, a chunk is too large to face away as a whole
+        meshlet->cone[0] = meshlet->cone[1] = meshlet->cone[2] = 0.0f;
+        meshlet->cone[3] = 1.0f;
+        meshlet->firstIndex = i * CHUNK_MAX_INDICES;
+        meshlet->indicesCount =
+            stream->chunks[chunk].levels[stream->slotLevels[i]].indicesCount;
+    }
+
+    VkDrawIndexedIndirectCommand *commands;
+    vkMapMemory(vulkan->device.device, shape->indirectBuffersMemory[imageIndex],
+                0, shape->drawsCount * sizeof(*commands), 0,
+                (void **)&commands);
+
+    uint32_t drawsCount =
+        cullMeshlets(commands, resident, residentCount, 0, &vulkan->ubo);
+    shape->visibleDraws = drawsCount;
+
+    // indices are local to their slot's vertices
+    for (uint32_t i = 0; i < drawsCount; i++) {
+        commands[i].vertexOffset =
+            (int32_t)(commands[i].firstIndex / CHUNK_MAX_INDICES *
+                      CHUNK_MAX_VERTICES);
+    }
+
+    memset(&commands[drawsCount], 0,
+           (shape->drawsCount - drawsCount) * sizeof(*commands));
+
+    vkUnmapMemory(vulkan->device.device,
+                  shape->indirectBuffersMemory[imageIndex]);
+
+    freeMem(1, resident);
+}
+
+// the pool itself is the shape's buffers and goes with them
+void closeMeshStream(Vulkan *vulkan, Shape *shape) {
+    MeshStream *stream = shape->stream;
+
+    // the loads write into the staging buffer about to be unmapped
+    waitForJobs(&stream->loads);
+
+    for (uint32_t i = 0; i < STREAM_STAGING_SLOTS; i++) {
+        vkDestroyFence(vulkan->device.device, stream->staging[i].fence, NULL);
+    }
+    vkDestroyCommandPool(vulkan->device.device, stream->commandPool, NULL);
+
+    vkUnmapMemory(vulkan->device.device, stream->stagingBufferMemory);
+    vkDestroyBuffer(vulkan->device.device, stream->stagingBuffer, NULL);
+    vkFreeMemory(vulkan->device.device, stream->stagingBufferMemory, NULL);
+
+    unmapFile(&stream->file);
+
+    freeMem(9, stream->slotChunks, stream->slotLevels, stream->slotReserved,
+            stream->chunkSlots, stream->chunkPending, stream->priorities,
+            stream->desiredLevels, stream->candidates, stream);
+    shape->stream = NULL;
+}
@@ -0,0 +1,378 @@
+#include "image/bc/bc.h"
+#include "image/format/format.h"
+#include <stdbool.h>
+#include <string.h>
+
+// bit i of the mask is the subset of texel i
+static const uint16_t partitions2[64] = {
+    0xcccc, 0x8888, 0xeeee, 0xecc8, 0xc880, 0xfeec, 0xfec8, 0xec80,
+    0xc800, 0xffec, 0xfe80, 0xe800, 0xffe8, 0xff00, 0xfff0, 0xf000,
+    0xf710, 0x008e, 0x7100, 0x08ce, 0x008c, 0x7310, 0x3100, 0x8cce,
+    0x088c, 0x3110, 0x6666, 0x366c, 0x17e8, 0x0ff0, 0x718e, 0x399c,
+    0xaaaa, 0xf0f0, 0x5a5a, 0x33cc, 0x3c3c, 0x55aa, 0x9696, 0xa55a,
+    0x73ce, 0x13c8, 0x324c, 0x3bdc, 0x6996, 0xc33c, 0x9966, 0x0660,
+    0x0272, 0x04e4, 0x4e40, 0x2720, 0xc936, 0x936c, 0x39c6, 0x639c,
+    0x9336, 0x9cc6, 0x817e, 0xe718, 0xccf0, 0x0fcc, 0x7744, 0xee22,
+};
+
+static const uint8_t partitions3[64][16] = {
+    {0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 1, 2, 2, 2, 2},
+    {0, 0, 0, 1, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 2, 1},
+    {0, 0, 0, 0, 2, 0, 0, 1, 2, 2, 1, 1, 2, 2, 1, 1},
+    {0, 2, 2, 2, 0, 0, 2, 2, 0, 0, 1, 1, 0, 1, 1, 1},
+    {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2},
+    {0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 2, 2, 0, 0, 2, 2},
+    {0, 0, 2, 2, 0, 0, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1},
+    {0, 0, 1, 1, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1},
+    {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2},
+    {0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2},
+    {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2},
+    {0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2},
+    {0, 1, 1, 2, 0, 1, 1, 2, 0, 1, 1, 2, 0, 1, 1, 2},
+    {0, 1, 2, 2, 0, 1, 2, 2, 0, 1, 2, 2, 0, 1, 2, 2},
+    {0, 0, 1, 1, 0, 1, 1, 2, 1, 1, 2, 2, 1, 2, 2, 2},
+    {0, 0, 1, 1, 2, 0, 0, 1, 2, 2, 0, 0, 2, 2, 2, 0},
+    {0, 0, 0, 1, 0, 0, 1, 1, 0, 1, 1, 2, 1, 1, 2, 2},
+    {0, 1, 1, 1, 0, 0, 1, 1, 2, 0, 0, 1, 2, 2, 0, 0},
+    {0, 0, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2},
+    {0, 0, 2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 1, 1, 1, 1},
+    {0, 1, 1, 1, 0, 1, 1, 1, 0, 2, 2, 2, 0, 2, 2, 2},
+    {0, 0, 0, 1, 0, 0, 0, 1, 2, 2, 2, 1, 2, 2, 2, 1},
+    {0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 2, 2, 0, 1, 2, 2},
+    {0, 0, 0, 0, 1, 1, 0, 0, 2, 2, 1, 0, 2, 2, 1, 0},
+    {0, 1, 2, 2, 0, 1, 2, 2, 0, 0, 1, 1, 0, 0, 0, 0},
+    {0, 0, 1, 2, 0, 0, 1, 2, 1, 1, 2, 2, 2, 2, 2, 2},
+    {0, 1, 1, 0, 1, 2, 2, 1, 1, 2, 2, 1, 0, 1, 1, 0},
+    {0, 0, 0, 0, 0, 1, 1, 0, 1, 2, 2, 1, 1, 2, 2, 1},
+    {0, 0, 2, 2, 1, 1, 0, 2, 1, 1, 0, 2, 0, 0, 2, 2},
+    {0, 1, 1, 0, 0, 1, 1, 0, 2, 0, 0, 2, 2, 2, 2, 2},
+    {0, 0, 1, 1, 0, 1, 2, 2, 0, 1, 2, 2, 0, 0, 1, 1},
+    {0, 0, 0, 0, 2, 0, 0, 0, 2, 2, 1, 1, 2, 2, 2, 1},
+    {0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 2, 2, 2},
+    {0, 2, 2, 2, 0, 0, 2, 2, 0, 0, 1, 2, 0, 0, 1, 1},
+    {0, 0, 1, 1, 0, 0, 1, 2, 0, 0, 2, 2, 0, 2, 2, 2},
+    {0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0},
+    {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 0, 0, 0, 0},
+    {0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0},
+    {0, 1, 2, 0, 2, 0, 1, 2, 1, 2, 0, 1, 0, 1, 2, 0},
+    {0, 0, 1, 1, 2, 2, 0, 0, 1, 1, 2, 2, 0, 0, 1, 1},
+    {0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 0, 0, 0, 0, 1, 1},
+    {0, 1, 0, 1, 0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2},
+    {0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 2, 1, 2, 1, 2, 1},
+    {0, 0, 2, 2, 1, 1, 2, 2, 0, 0, 2, 2, 1, 1, 2, 2},
+    {0, 0, 2, 2, 0, 0, 1, 1, 0, 0, 2, 2, 0, 0, 1, 1},
+    {0, 2, 2, 0, 1, 2, 2, 1, 0, 2, 2, 0, 1, 2, 2, 1},
+    {0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 0, 1, 0, 1},
+    {0, 0, 0, 0, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1},
+    {0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 2, 2, 2, 2},
+    {0, 2, 2, 2, 0, 1, 1, 1, 0, 2, 2, 2, 0, 1, 1, 1},
+    {0, 0, 0, 2, 1, 1, 1, 2, 0, 0, 0, 2, 1, 1, 1, 2},
+    {0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1, 2},
+    {0, 2, 2, 2, 0, 1, 1, 1, 0, 1, 1, 1, 0, 2, 2, 2},
+    {0, 0, 0, 2, 1, 1, 1, 2, 1, 1, 1, 2, 0, 0, 0, 2},
+    {0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 2, 2},
+    {0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 1, 2},
+    {0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 2, 2, 2, 2, 2, 2},
+    {0, 0, 2, 2, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 2, 2},
+    {0, 0, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2, 0, 0, 2, 2},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2},
+    {0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 1},
+    {0, 2, 2, 2, 1, 2, 2, 2, 0, 2, 2, 2, 1, 2, 2, 2},
+    {0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2},
+    {0, 1, 1, 1, 2, 0, 1, 1, 2, 2, 0, 1, 2, 2, 2, 0},
+};
+
+// the texel of each later subset whose index drops its top bit, subset 0
+// always has texel 0
+static const uint8_t anchors2[64] = {
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 2,  8,  2,  2,  8,  8,  15, 2,  8,  2,  2,  8,  8,  2,  2,
+    15, 15, 6,  8,  2,  8,  15, 15, 2,  8,  2,  2,  2,  15, 15, 6,
+    6,  2,  6,  8,  15, 15, 2,  2,  15, 15, 15, 15, 15, 2,  2,  15,
+};
+
+static const uint8_t anchors3[2][64] = {
+    {
+        3,  3,  15, 15, 8,  3,  15, 15, 8,  8,  6,  6,  6,  5,  3,  3,
+        3,  3,  8,  15, 3,  3,  6,  10, 5,  8,  8,  6,  8,  5,  15, 15,
+        8,  15, 3,  5,  6,  10, 8,  15, 15, 3,  15, 5,  15, 15, 15, 15,
+        3,  15, 5,  5,  5,  8,  5,  10, 5,  10, 8,  13, 15, 12, 3,  3,
+    },
+    {
+        15, 8,  8,  3,  15, 15, 3,  8,  15, 15, 15, 15, 15, 15, 15, 8,
+        15, 8,  15, 3,  15, 8,  15, 8,  3,  15, 6,  10, 15, 15, 10, 8,
+        15, 3,  15, 10, 10, 8,  9,  10, 6,  15, 8,  15, 3,  6,  6,  8,
+        15, 3,  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 3,  15, 15, 8,
+    },
+};
+
+static const uint8_t weights2[4] = {0, 21, 43, 64};
+static const uint8_t weights3[8] = {0, 9, 18, 27, 37, 46, 55, 64};
+static const uint8_t weights4[16] = {0,  4,  9,  13, 17, 21, 26, 30,
+                                     34, 38, 43, 47, 51, 55, 60, 64};
+
+typedef struct Bc7Mode {
+    uint8_t subsets;
+    uint8_t partitionBits;
+    uint8_t rotationBits;
+    uint8_t indexSelectionBits;
+    uint8_t colourBits;
+    uint8_t alphaBits;
+    uint8_t endpointPBits; // one per endpoint
+    uint8_t sharedPBits;   // one per subset
+    uint8_t indexBits;
+    uint8_t secondaryIndexBits;
+} Bc7Mode;
+
+static const Bc7Mode bc7Modes[8] = {
+    {3, 4, 0, 0, 4, 0, 1, 0, 3, 0}, {2, 6, 0, 0, 6, 0, 0, 1, 3, 0},
+    {3, 6, 0, 0, 5, 0, 0, 0, 2, 0}, {2, 6, 0, 0, 7, 0, 1, 0, 2, 0},
+    {1, 0, 2, 1, 5, 6, 0, 0, 2, 3}, {1, 0, 2, 0, 7, 8, 0, 0, 2, 2},
+    {1, 0, 0, 0, 7, 7, 1, 0, 4, 0}, {2, 6, 0, 0, 5, 5, 1, 0, 2, 0},
+};
+
+typedef struct BitReader {
+    const unsigned char *data;
+    uint32_t position;
+} BitReader;
+
+static uint32_t readBits(BitReader *reader, uint32_t count) {
+    uint32_t value = 0;
+    for (uint32_t i = 0; i < count; i++, reader->position++) {
+        uint32_t bit =
+            (reader->data[reader->position >> 3] >> (reader->position & 7)) &
+            1;
+        value |= bit << i;
+    }
+    return value;
+}
+
+// widened to 8 bits by repeating the top bits
+static inline uint8_t expandBits(uint32_t value, uint32_t bits) {
+    return (uint8_t)((value << (8 - bits)) | (value >> (2 * bits - 8)));
+}
+
+static inline uint8_t interpolate(uint8_t e0, uint8_t e1, uint32_t index,
+                                  uint32_t bits) {
+    const uint8_t *weights =
+        bits == 2 ? weights2 : bits == 3 ? weights3 : weights4;
+    uint32_t w = weights[index];
+    return (uint8_t)(((64 - w) * e0 + w * e1 + 32) >> 6);
+}
+
+static uint32_t bc7Subset(uint32_t subsets, uint32_t partition,
+                          uint32_t texel) {
+    if (subsets == 2) {
+        return (partitions2[partition] >> texel) & 1;
+    }
+    return subsets == 3 ? partitions3[partition][texel] : 0;
+}
+
+static bool isAnchor(uint32_t subsets, uint32_t partition, uint32_t texel) {
+    if (texel == 0) {
+        return true;
+    }
+    if (subsets == 2) {
+        return anchors2[partition] == texel;
+    }
+    return subsets == 3 && (anchors3[0][partition] == texel ||
+                            anchors3[1][partition] == texel);
+}
+
+static void decodeBc7Block(const unsigned char *block, uint8_t texels[16][4]) {
+    uint32_t modeIndex = 0;
+    while (modeIndex < 8 && !(block[0] & (1 << modeIndex))) {
+        modeIndex++;
+    }
+    // reserved, decoded as transparent black like the hardware does
+    if (modeIndex == 8) {
+        memset(texels, 0, 16 * 4);
+        return;
+    }
+
+    const Bc7Mode *mode = &bc7Modes[modeIndex];
+    BitReader reader = {.data = block, .position = modeIndex + 1};
+
+    uint32_t partition = readBits(&reader, mode->partitionBits);
+    uint32_t rotation = readBits(&reader, mode->rotationBits);
+    uint32_t indexSelection = readBits(&reader, mode->indexSelectionBits);
+
+    uint32_t endpointsCount = mode->subsets * 2;
+    uint32_t endpoints[6][4];
+    for (uint32_t c = 0; c < 3; c++) {
+        for (uint32_t e = 0; e < endpointsCount; e++) {
+            endpoints[e][c] = readBits(&reader, mode->colourBits);
+        }
+    }
+    for (uint32_t e = 0; e < endpointsCount; e++) {
+        endpoints[e][3] = readBits(&reader, mode->alphaBits);
+    }
+
+    uint32_t pBits[6] = {0};
+    for (uint32_t e = 0; e < endpointsCount && mode->endpointPBits; e++) {
+        pBits[e] = readBits(&reader, 1);
+    }
+    for (uint32_t s = 0; s < mode->subsets && mode->sharedPBits; s++) {
+        pBits[s * 2] = pBits[s * 2 + 1] = readBits(&reader, 1);
+    }
+
+    uint32_t pBitsCount = mode->endpointPBits | mode->sharedPBits;
+    uint8_t colours[6][4];
+    for (uint32_t e = 0; e < endpointsCount; e++) {
+        for (uint32_t c = 0; c < 4; c++) {
+            uint32_t bits = c < 3 ? mode->colourBits : mode->alphaBits;
+            if (!bits) {
+                colours[e][c] = 255;
+                continue;
+            }
+            uint32_t value = (endpoints[e][c] << pBitsCount) | pBits[e];
+            colours[e][c] = expandBits(value, bits + pBitsCount);
+        }
+    }
+
+    uint32_t indices[16], secondaryIndices[16] = {0};
+    for (uint32_t i = 0; i < 16; i++) {
+        indices[i] = readBits(&reader, mode->indexBits -
+                                           isAnchor(mode->subsets, partition,
+                                                    i));
+    }
+    for (uint32_t i = 0; i < 16 && mode->secondaryIndexBits; i++) {
+        secondaryIndices[i] =
+            readBits(&reader, mode->secondaryIndexBits - (i == 0));
+    }
+
+    for (uint32_t i = 0; i < 16; i++) {
+        uint32_t subset = bc7Subset(mode->subsets, partition, i);
+        const uint8_t *e0 = colours[subset * 2];
+        const uint8_t *e1 = colours[subset * 2 + 1];
+
+        uint32_t colourIndex = indices[i], colourBits = mode->indexBits;
+        uint32_t alphaIndex = indices[i], alphaBits = mode->indexBits;
+        if (mode->secondaryIndexBits) {
+            if (indexSelection) {
+                colourIndex = secondaryIndices[i];
+                colourBits = mode->secondaryIndexBits;
+            } else {
+                alphaIndex = secondaryIndices[i];
+                alphaBits = mode->secondaryIndexBits;
+            }
+        }
+
+        for (uint32_t c = 0; c < 3; c++) {
+            texels[i][c] = interpolate(e0[c], e1[c], colourIndex, colourBits);
+        }
+        texels[i][3] = interpolate(e0[3], e1[3], alphaIndex, alphaBits);
+
+        if (rotation) {
+            uint8_t swapped = texels[i][rotation - 1];
+            texels[i][rotation - 1] = texels[i][3];
+            texels[i][3] = swapped;
+        }
+    }
+}
+
+static inline void expand565(uint32_t colour, uint32_t rgb[3]) {
+    uint32_t r = (colour >> 11) & 31, g = (colour >> 5) & 63, b = colour & 31;
+    rgb[0] = (r << 3) | (r >> 2);
+    rgb[1] = (g << 2) | (g >> 4);
+    rgb[2] = (b << 3) | (b >> 2);
+}
+
+// bc1 picks three colours and transparent black by the order of its
+// endpoints, bc3's colour block always has four
+static void decodeColourBlock(const unsigned char *block, bool fourColours,
+                              bool transparent, uint8_t texels[16][4]) {
+    uint32_t c0 = block[0] | block[1] << 8;
+    uint32_t c1 = block[2] | block[3] << 8;
+
+    uint32_t palette[4][4];
+    expand565(c0, palette[0]);
+    expand565(c1, palette[1]);
+    palette[0][3] = palette[1][3] = palette[2][3] = palette[3][3] = 255;
+
+    for (uint32_t c = 0; c < 3; c++) {
+        if (fourColours || c0 > c1) {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+        } else {
+            palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+            palette[3][c] = 0;
+        }
+    }
+    if (!fourColours && c0 <= c1 && transparent) {
+        palette[3][3] = 0;
+    }
+
+    uint32_t indices = block[4] | block[5] << 8 | block[6] << 16 |
+                       (uint32_t)block[7] << 24;
+    for (uint32_t i = 0; i < 16; i++) {
+        const uint32_t *colour = palette[(indices >> (i * 2)) & 3];
+        for (uint32_t c = 0; c < 4; c++) {
+            texels[i][c] = (uint8_t)colour[c];
+        }
+    }
+}
+
+static void decodeAlphaBlock(const unsigned char *block,
+                             uint8_t texels[16][4]) {
+    uint32_t a0 = block[0], a1 = block[1];
+
+    uint32_t alphas[8] = {a0, a1};
+    if (a0 > a1) {
+        for (uint32_t i = 2; i < 8; i++) {
+            alphas[i] = ((8 - i) * a0 + (i - 1) * a1) / 7;
+        }
+    } else {
+        for (uint32_t i = 2; i < 6; i++) {
+            alphas[i] = ((6 - i) * a0 + (i - 1) * a1) / 5;
+        }
+        alphas[6] = 0;
+        alphas[7] = 255;
+    }
+
+    uint64_t indices = 0;
+    for (uint32_t i = 0; i < 6; i++) {
+        indices |= (uint64_t)block[2 + i] << (i * 8);
+    }
+    for (uint32_t i = 0; i < 16; i++) {
+        texels[i][3] = (uint8_t)alphas[(indices >> (i * 3)) & 7];
+    }
+}
+
+void decodeBcImage(const ImageFormat *imageFormat,
+                   const unsigned char *blocks, uint32_t width,
+                   uint32_t height, unsigned char *rgba) {
+    VkFormat format = imageFormat->format;
+    bool bc1 = imageFormat->blockBytes == 8;
+    bool bc7 = format == VK_FORMAT_BC7_UNORM_BLOCK ||
+               format == VK_FORMAT_BC7_SRGB_BLOCK;
+    bool transparent = format == VK_FORMAT_BC1_RGBA_UNORM_BLOCK ||
+                       format == VK_FORMAT_BC1_RGBA_SRGB_BLOCK;
+
+    uint32_t blocksWide = (width + 3) / 4;
+    uint32_t blocksHigh = (height + 3) / 4;
+
+    for (uint32_t by = 0; by < blocksHigh; by++) {
+        for (uint32_t bx = 0; bx < blocksWide; bx++) {
+            uint8_t texels[16][4];
+            if (bc1) {
+                decodeColourBlock(blocks, false, transparent, texels);
+            } else if (bc7) {
+                decodeBc7Block(blocks, texels);
+            } else {
+                decodeColourBlock(blocks + 8, true, false, texels);
+                decodeAlphaBlock(blocks, texels);
+            }
+            blocks += imageFormat->blockBytes;
+
+            // partial blocks at the right and bottom edges
+            uint32_t columns = width - bx * 4 < 4 ? width - bx * 4 : 4;
+            uint32_t rows = height - by * 4 < 4 ? height - by * 4 : 4;
+            for (uint32_t y = 0; y < rows; y++) {
+                unsigned char *row =
+                    rgba + (((size_t)by * 4 + y) * width + bx * 4) * 4;
+                memcpy(row, texels[y * 4], columns * 4);
+            }
+        }
+    }
+}
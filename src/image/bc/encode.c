@@ -0,0 +1,589 @@
+#include "image/bc/encode.h"
+#include "image/format/format.h"
+#include "utility/job.h"
+#include <float.h>
+#include <math.h>
+#include <stdbool.h>
+#include <string.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// bc7 interpolation weights out of 64, as the decoder blends
+static const uint8_t weights2[4] = {0, 21, 43, 64};
+static const uint8_t weights4[16] = {0,  4,  9,  13, 17, 21, 26, 30,
+                                     34, 38, 43, 47, 51, 55, 60, 64};
+
+// how far towards the second endpoint each bc1 index lies
+static const float bc1Weights[4] = {0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f};
+
+typedef struct BcEncode {
+    const ImageFormat *imageFormat;
+    const unsigned char *rgba;
+    uint32_t width;
+    uint32_t height;
+    unsigned char *blocks;
+} BcEncode;
+
+// a block's texels a channel at a time, so a vector holds one channel of
+// four or eight texels
+typedef struct BcBlock {
+    _Alignas(32) float channels[4][16];
+} BcBlock;
+
+typedef struct BitWriter {
+    unsigned char *data;
+    uint32_t position;
+} BitWriter;
+
+static void writeBits(BitWriter *writer, uint32_t value, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++, writer->position++) {
+        writer->data[writer->position >> 3] |=
+            (unsigned char)(((value >> i) & 1) << (writer->position & 7));
+    }
+}
+
+// the 4x4 texels of a block, repeating the last row and column past the edge
+static void loadBlock(const BcEncode *encode, uint32_t bx, uint32_t by,
+                      BcBlock *block) {
+    for (uint32_t y = 0; y < 4; y++) {
+        uint32_t row = by * 4 + y < encode->height ? by * 4 + y
+                                                   : encode->height - 1;
+        for (uint32_t x = 0; x < 4; x++) {
+            uint32_t column =
+                bx * 4 + x < encode->width ? bx * 4 + x : encode->width - 1;
+            const unsigned char *texel =
+                &encode->rgba[((size_t)row * encode->width + column) * 4];
+            for (uint32_t c = 0; c < 4; c++) {
+                block->channels[c][y * 4 + x] = texel[c];
+            }
+        }
+    }
+}
+
+// The nearest palette entry of every texel over count channels from first,
+// returning the summed squared error. Texels and palettes hold whole numbers
+// so every path sums exactly and picks the same indices.
+static float pickNearest(const BcBlock *block, uint32_t first, uint32_t count,
+                         const float (*palette)[4], uint32_t paletteCount,
+                         uint8_t indices[16]) {
+#if defined(__AVX2__)
+    __m256 total = _mm256_setzero_ps();
+    for (uint32_t i = 0; i < 16; i += 8) {
+        __m256 best = _mm256_set1_ps(FLT_MAX);
+        __m256i bestIndices = _mm256_setzero_si256();
+        for (uint32_t p = 0; p < paletteCount; p++) {
+            __m256 distance = _mm256_setzero_ps();
+            for (uint32_t c = first; c < first + count; c++) {
+                __m256 d = _mm256_sub_ps(_mm256_load_ps(&block->channels[c][i]),
+                                         _mm256_set1_ps(palette[p][c]));
+                distance = _mm256_add_ps(distance, _mm256_mul_ps(d, d));
+            }
+            __m256 closer = _mm256_cmp_ps(distance, best, _CMP_LT_OQ);
+            best = _mm256_blendv_ps(best, distance, closer);
+            bestIndices = _mm256_blendv_epi8(bestIndices,
+                                             _mm256_set1_epi32((int32_t)p),
+                                             _mm256_castps_si256(closer));
+        }
+        total = _mm256_add_ps(total, best);
+
+        _Alignas(32) int32_t lanes[8];
+        _mm256_store_si256((__m256i *)lanes, bestIndices);
+        for (uint32_t k = 0; k < 8; k++) {
+            indices[i + k] = (uint8_t)lanes[k];
+        }
+    }
+    _Alignas(32) float sums[8];
+    _mm256_store_ps(sums, total);
+    return sums[0] + sums[1] + sums[2] + sums[3] + sums[4] + sums[5] +
+           sums[6] + sums[7];
+#elif defined(__SSE2__)
+    __m128 total = _mm_setzero_ps();
+    for (uint32_t i = 0; i < 16; i += 4) {
+        __m128 best = _mm_set1_ps(FLT_MAX);
+        __m128i bestIndices = _mm_setzero_si128();
+        for (uint32_t p = 0; p < paletteCount; p++) {
+            __m128 distance = _mm_setzero_ps();
+            for (uint32_t c = first; c < first + count; c++) {
+                __m128 d = _mm_sub_ps(_mm_load_ps(&block->channels[c][i]),
+                                      _mm_set1_ps(palette[p][c]));
+                distance = _mm_add_ps(distance, _mm_mul_ps(d, d));
+            }
+            __m128i closer = _mm_castps_si128(_mm_cmplt_ps(distance, best));
+            best = _mm_min_ps(distance, best);
+            bestIndices = _mm_or_si128(
+                _mm_and_si128(closer, _mm_set1_epi32((int32_t)p)),
+                _mm_andnot_si128(closer, bestIndices));
+        }
+        total = _mm_add_ps(total, best);
+
+        _Alignas(16) int32_t lanes[4];
+        _mm_store_si128((__m128i *)lanes, bestIndices);
+        for (uint32_t k = 0; k < 4; k++) {
+            indices[i + k] = (uint8_t)lanes[k];
+        }
+    }
+    _Alignas(16) float sums[4];
+    _mm_store_ps(sums, total);
+    return sums[0] + sums[1] + sums[2] + sums[3];
+#else
+    float total = 0.0f;
+    for (uint32_t i = 0; i < 16; i++) {
+        float best = FLT_MAX;
+        for (uint32_t p = 0; p < paletteCount; p++) {
+            float distance = 0.0f;
+            for (uint32_t c = first; c < first + count; c++) {
+                float d = block->channels[c][i] - palette[p][c];
+                distance += d * d;
+            }
+            if (distance < best) {
+                best = distance;
+                indices[i] = (uint8_t)p;
+            }
+        }
+        total += best;
+    }
+    return total;
+#endif
+}
+
+// Endpoints at the ends of the principal axis of the block's colours over
+// count channels from first, found by power iteration from the grey axis.
+static void principalEndpoints(const BcBlock *block, uint32_t first,
+                               uint32_t count, float endpoints[2][4]) {
+    float mean[4] = {0};
+    for (uint32_t c = first; c < first + count; c++) {
+        for (uint32_t i = 0; i < 16; i++) {
+            mean[c] += block->channels[c][i];
+        }
+        mean[c] /= 16.0f;
+    }
+
+    float covariance[4][4] = {{0}};
+    for (uint32_t i = 0; i < 16; i++) {
+        for (uint32_t c = first; c < first + count; c++) {
+            for (uint32_t k = c; k < first + count; k++) {
+                covariance[c][k] += (block->channels[c][i] - mean[c]) *
+                                    (block->channels[k][i] - mean[k]);
+            }
+        }
+    }
+
+    float axis[4] = {0};
+    for (uint32_t c = first; c < first + count; c++) {
+        axis[c] = 1.0f;
+    }
+    for (uint32_t iteration = 0; iteration < 8; iteration++) {
+        float next[4] = {0}, length = 0.0f;
+        for (uint32_t c = first; c < first + count; c++) {
+            for (uint32_t k = first; k < first + count; k++) {
+                next[c] += (c <= k ? covariance[c][k] : covariance[k][c]) *
+                           axis[k];
+            }
+            length += next[c] * next[c];
+        }
+        if (length < FLT_EPSILON) {
+            break;
+        }
+        length = sqrtf(length);
+        for (uint32_t c = first; c < first + count; c++) {
+            axis[c] = next[c] / length;
+        }
+    }
+
+    float lowest = FLT_MAX, highest = -FLT_MAX;
+    for (uint32_t i = 0; i < 16; i++) {
+        float t = 0.0f;
+        for (uint32_t c = first; c < first + count; c++) {
+            t += (block->channels[c][i] - mean[c]) * axis[c];
+        }
+        lowest = fminf(lowest, t);
+        highest = fmaxf(highest, t);
+    }
+
+    for (uint32_t c = first; c < first + count; c++) {
+        endpoints[0][c] = mean[c] + axis[c] * lowest;
+        endpoints[1][c] = mean[c] + axis[c] * highest;
+    }
+}
+
+// The endpoints that best fit the texels for the indices they were given,
+// the least squares solution with each texel a blend of the two.
+static bool fitEndpoints(const BcBlock *block, uint32_t first, uint32_t count,
+                         const uint8_t indices[16], const float *weights,
+                         float endpoints[2][4]) {
+    float aa = 0.0f, bb = 0.0f, ab = 0.0f;
+    float ax[4] = {0}, bx[4] = {0};
+    for (uint32_t i = 0; i < 16; i++) {
+        float b = weights[indices[i]], a = 1.0f - b;
+        aa += a * a;
+        bb += b * b;
+        ab += a * b;
+        for (uint32_t c = first; c < first + count; c++) {
+            ax[c] += a * block->channels[c][i];
+            bx[c] += b * block->channels[c][i];
+        }
+    }
+
+    float determinant = aa * bb - ab * ab;
+    if (fabsf(determinant) < FLT_EPSILON) {
+        return false;
+    }
+    for (uint32_t c = first; c < first + count; c++) {
+        endpoints[0][c] = (ax[c] * bb - bx[c] * ab) / determinant;
+        endpoints[1][c] = (bx[c] * aa - ax[c] * ab) / determinant;
+    }
+    return true;
+}
+
+static inline uint32_t quantise(float value, uint32_t maximum) {
+    return (uint32_t)(fminf(fmaxf(value, 0.0f), 255.0f) * maximum / 255.0f +
+                      0.5f);
+}
+
+static inline uint32_t quantise565(const float colour[4]) {
+    return quantise(colour[0], 31) << 11 | quantise(colour[1], 63) << 5 |
+           quantise(colour[2], 31);
+}
+
+// the four colours a decoder makes of the endpoints, rounded as it rounds
+static void bc1Palette(uint32_t c0, uint32_t c1, float palette[4][4]) {
+    uint32_t colours[2] = {c0, c1}, expanded[4][3];
+    for (uint32_t e = 0; e < 2; e++) {
+        uint32_t r = (colours[e] >> 11) & 31, g = (colours[e] >> 5) & 63,
+                 b = colours[e] & 31;
+        expanded[e][0] = (r << 3) | (r >> 2);
+        expanded[e][1] = (g << 2) | (g >> 4);
+        expanded[e][2] = (b << 3) | (b >> 2);
+    }
+    for (uint32_t c = 0; c < 3; c++) {
+        expanded[2][c] = (2 * expanded[0][c] + expanded[1][c]) / 3;
+        expanded[3][c] = (expanded[0][c] + 2 * expanded[1][c]) / 3;
+    }
+    for (uint32_t p = 0; p < 4; p++) {
+        for (uint32_t c = 0; c < 3; c++) {
+            palette[p][c] = (float)expanded[p][c];
+        }
+    }
+}
+
+static float bc1Indices(const BcBlock *block, uint32_t c0, uint32_t c1,
+                        uint8_t indices[16]) {
+    float palette[4][4];
+    bc1Palette(c0, c1, palette);
+    return pickNearest(block, 0, 3, (const float(*)[4])palette, 4, indices);
+}
+
+// Endpoints along the principal axis, then refit to the indices they give
+// while that lowers the error. Always four colours, so the same block is
+// valid bc1 and bc3.
+static void encodeColourBlock(const BcBlock *block, unsigned char *data) {
+    float endpoints[2][4];
+    principalEndpoints(block, 0, 3, endpoints);
+
+    uint32_t c0 = quantise565(endpoints[1]);
+    uint32_t c1 = quantise565(endpoints[0]);
+    uint8_t indices[16];
+    float error = bc1Indices(block, c0, c1, indices);
+
+    for (uint32_t k = 0; k < 2 && error > 0.0f && c0 != c1; k++) {
+        if (!fitEndpoints(block, 0, 3, indices, bc1Weights, endpoints)) {
+            break;
+        }
+        uint32_t r0 = quantise565(endpoints[0]);
+        uint32_t r1 = quantise565(endpoints[1]);
+        uint8_t refined[16];
+        float refinedError = bc1Indices(block, r0, r1, refined);
+        if (refinedError >= error) {
+            break;
+        }
+        c0 = r0;
+        c1 = r1;
+        memcpy(indices, refined, sizeof(indices));
+        error = refinedError;
+    }
+
+    // four colour mode needs c0 > c1, swapping the endpoints swaps 0 with 1
+    // and 2 with 3
+    uint32_t packed = 0;
+    for (uint32_t i = 0; i < 16; i++) {
+        packed |= (uint32_t)indices[i] << (i * 2);
+    }
+    if (c0 < c1) {
+        uint32_t swap = c0;
+        c0 = c1;
+        c1 = swap;
+        packed ^= 0x55555555;
+    } else if (c0 == c1) {
+        packed = 0;
+    }
+
+    data[0] = (unsigned char)c0;
+    data[1] = (unsigned char)(c0 >> 8);
+    data[2] = (unsigned char)c1;
+    data[3] = (unsigned char)(c1 >> 8);
+    for (uint32_t i = 0; i < 4; i++) {
+        data[4 + i] = (unsigned char)(packed >> (i * 8));
+    }
+}
+
+// the eight alpha mode between the block's extremes
+static void encodeAlphaBlock(const BcBlock *block, unsigned char *data) {
+    float a0 = 0.0f, a1 = 255.0f;
+    for (uint32_t i = 0; i < 16; i++) {
+        a0 = fmaxf(a0, block->channels[3][i]);
+        a1 = fminf(a1, block->channels[3][i]);
+    }
+
+    memset(data, 0, 8);
+    data[0] = (unsigned char)a0;
+    data[1] = (unsigned char)a1;
+    if (a0 == a1) {
+        return;
+    }
+
+    float palette[8][4] = {{[3] = a0}, {[3] = a1}};
+    for (uint32_t i = 2; i < 8; i++) {
+        palette[i][3] =
+            (float)(((8 - i) * data[0] + (i - 1) * data[1]) / 7);
+    }
+
+    uint8_t indices[16];
+    pickNearest(block, 3, 1, (const float(*)[4])palette, 8, indices);
+
+    uint64_t packed = 0;
+    for (uint32_t i = 0; i < 16; i++) {
+        packed |= (uint64_t)indices[i] << (i * 3);
+    }
+    for (uint32_t i = 0; i < 6; i++) {
+        data[2 + i] = (unsigned char)(packed >> (i * 8));
+    }
+}
+
+// a bc7 mode's endpoints and indices, colour in the first index set and alpha
+// in the second when the mode has one
+typedef struct Bc7Candidate {
+    float error;
+    uint32_t endpoints[2][4]; // as stored, before any p-bit
+    uint32_t pBits[2];
+    uint8_t indices[16];
+    uint8_t alphaIndices[16];
+} Bc7Candidate;
+
+static inline uint32_t interpolate(uint32_t e0, uint32_t e1, uint32_t w) {
+    return ((64 - w) * e0 + w * e1 + 32) >> 6;
+}
+
+// mode 6's 7 bit endpoints each with its own p-bit, whichever is closer
+static void quantiseMode6(const float endpoint[4], uint32_t stored[4],
+                          uint32_t *pBit, uint32_t expanded[4]) {
+    float bestError = FLT_MAX;
+    for (uint32_t p = 0; p < 2; p++) {
+        uint32_t values[4];
+        float error = 0.0f;
+        for (uint32_t c = 0; c < 4; c++) {
+            float value = fminf(fmaxf(endpoint[c], 0.0f), 255.0f);
+            int32_t c7 = (int32_t)floorf((value - p) / 2.0f + 0.5f);
+            values[c] = (uint32_t)(c7 < 0 ? 0 : c7 > 127 ? 127 : c7);
+            float d = value - (float)(values[c] << 1 | p);
+            error += d * d;
+        }
+        if (error < bestError) {
+            bestError = error;
+            *pBit = p;
+            for (uint32_t c = 0; c < 4; c++) {
+                stored[c] = values[c];
+                expanded[c] = values[c] << 1 | p;
+            }
+        }
+    }
+}
+
+static void mode6Indices(const BcBlock *block, const float endpoints[2][4],
+                         Bc7Candidate *candidate) {
+    uint32_t expanded[2][4];
+    for (uint32_t e = 0; e < 2; e++) {
+        quantiseMode6(endpoints[e], candidate->endpoints[e],
+                      &candidate->pBits[e], expanded[e]);
+    }
+
+    float palette[16][4];
+    for (uint32_t p = 0; p < 16; p++) {
+        for (uint32_t c = 0; c < 4; c++) {
+            palette[p][c] = (float)interpolate(expanded[0][c], expanded[1][c],
+                                               weights4[p]);
+        }
+    }
+    candidate->error = pickNearest(block, 0, 4, (const float(*)[4])palette,
+                                   16, candidate->indices);
+}
+
+// one subset with rgba along one line and 16 steps between its endpoints
+static void encodeMode6(const BcBlock *block, Bc7Candidate *candidate) {
+    float endpoints[2][4], fractions[16];
+    for (uint32_t i = 0; i < 16; i++) {
+        fractions[i] = weights4[i] / 64.0f;
+    }
+
+    principalEndpoints(block, 0, 4, endpoints);
+    mode6Indices(block, endpoints, candidate);
+
+    if (candidate->error > 0.0f &&
+        fitEndpoints(block, 0, 4, candidate->indices, fractions, endpoints)) {
+        Bc7Candidate refined;
+        mode6Indices(block, endpoints, &refined);
+        if (refined.error < candidate->error) {
+            *candidate = refined;
+        }
+    }
+}
+
+// mode 5's colour and alpha apart, each with four steps, which keeps alpha
+// that doesn't follow the colour
+static void encodeMode5(const BcBlock *block, Bc7Candidate *candidate) {
+    float endpoints[2][4];
+    principalEndpoints(block, 0, 3, endpoints);
+
+    float palette[4][4];
+    uint32_t expanded[2][4];
+    for (uint32_t e = 0; e < 2; e++) {
+        for (uint32_t c = 0; c < 3; c++) {
+            candidate->endpoints[e][c] = quantise(endpoints[e][c], 127);
+            expanded[e][c] = candidate->endpoints[e][c] << 1 |
+                             candidate->endpoints[e][c] >> 6;
+        }
+    }
+
+    float a0 = 255.0f, a1 = 0.0f;
+    for (uint32_t i = 0; i < 16; i++) {
+        a0 = fminf(a0, block->channels[3][i]);
+        a1 = fmaxf(a1, block->channels[3][i]);
+    }
+    candidate->endpoints[0][3] = expanded[0][3] = (uint32_t)a0;
+    candidate->endpoints[1][3] = expanded[1][3] = (uint32_t)a1;
+
+    for (uint32_t p = 0; p < 4; p++) {
+        for (uint32_t c = 0; c < 4; c++) {
+            palette[p][c] = (float)interpolate(expanded[0][c], expanded[1][c],
+                                               weights2[p]);
+        }
+    }
+
+    candidate->pBits[0] = candidate->pBits[1] = 0;
+    candidate->error =
+        pickNearest(block, 0, 3, (const float(*)[4])palette, 4,
+                    candidate->indices) +
+        pickNearest(block, 3, 1, (const float(*)[4])palette, 4,
+                    candidate->alphaIndices);
+}
+
+// the first texel's index has its top bit implied clear, so endpoints are
+// swapped, and the indices reversed, until it is
+static void fixAnchor(uint32_t endpoints[2][4], uint32_t *pBits,
+                      uint32_t first, uint32_t count, uint8_t indices[16],
+                      uint32_t indexBits) {
+    uint32_t top = (1u << indexBits) - 1;
+    if (indices[0] <= top >> 1) {
+        return;
+    }
+    for (uint32_t c = first; c < first + count; c++) {
+        uint32_t swap = endpoints[0][c];
+        endpoints[0][c] = endpoints[1][c];
+        endpoints[1][c] = swap;
+    }
+    if (pBits) {
+        uint32_t swap = pBits[0];
+        pBits[0] = pBits[1];
+        pBits[1] = swap;
+    }
+    for (uint32_t i = 0; i < 16; i++) {
+        indices[i] = (uint8_t)(top - indices[i]);
+    }
+}
+
+static void writeIndices(BitWriter *writer, const uint8_t indices[16],
+                         uint32_t bits) {
+    writeBits(writer, indices[0], bits - 1);
+    for (uint32_t i = 1; i < 16; i++) {
+        writeBits(writer, indices[i], bits);
+    }
+}
+
+// Modes 6 and 5 of the eight, one subset each, whichever fits the block
+// better. Neither partitions, which is where most of the quality a slow
+// encoder gets over this one comes from.
+static void encodeBc7Block(const BcBlock *block, unsigned char *data) {
+    Bc7Candidate mode6, mode5;
+    encodeMode6(block, &mode6);
+    encodeMode5(block, &mode5);
+
+    memset(data, 0, 16);
+    BitWriter writer = {.data = data};
+
+    if (mode6.error <= mode5.error) {
+        fixAnchor(mode6.endpoints, mode6.pBits, 0, 4, mode6.indices, 4);
+        writeBits(&writer, 1 << 6, 7);
+        for (uint32_t c = 0; c < 4; c++) {
+            writeBits(&writer, mode6.endpoints[0][c], 7);
+            writeBits(&writer, mode6.endpoints[1][c], 7);
+        }
+        writeBits(&writer, mode6.pBits[0], 1);
+        writeBits(&writer, mode6.pBits[1], 1);
+        writeIndices(&writer, mode6.indices, 4);
+        return;
+    }
+
+    fixAnchor(mode5.endpoints, NULL, 0, 3, mode5.indices, 2);
+    fixAnchor(mode5.endpoints, NULL, 3, 1, mode5.alphaIndices, 2);
+    writeBits(&writer, 1 << 5, 6);
+    writeBits(&writer, 0, 2); // no channel rotated into alpha
+    for (uint32_t c = 0; c < 3; c++) {
+        writeBits(&writer, mode5.endpoints[0][c], 7);
+        writeBits(&writer, mode5.endpoints[1][c], 7);
+    }
+    writeBits(&writer, mode5.endpoints[0][3], 8);
+    writeBits(&writer, mode5.endpoints[1][3], 8);
+    writeIndices(&writer, mode5.indices, 2);
+    writeIndices(&writer, mode5.alphaIndices, 2);
+}
+
+static void encodeBlockRows(void *data, uint32_t first, uint32_t last) {
+    BcEncode *encode = data;
+    uint32_t blocksWide = (encode->width + 3) / 4;
+    VkFormat format = encode->imageFormat->format;
+    uint32_t blockBytes = encode->imageFormat->blockBytes;
+    bool bc7 = format == VK_FORMAT_BC7_UNORM_BLOCK ||
+               format == VK_FORMAT_BC7_SRGB_BLOCK;
+
+    for (uint32_t by = first; by < last; by++) {
+        unsigned char *output =
+            &encode->blocks[(size_t)by * blocksWide * blockBytes];
+        for (uint32_t bx = 0; bx < blocksWide; bx++, output += blockBytes) {
+            BcBlock block;
+            loadBlock(encode, bx, by, &block);
+            if (bc7) {
+                encodeBc7Block(&block, output);
+            } else if (blockBytes == 8) {
+                encodeColourBlock(&block, output);
+            } else {
+                encodeAlphaBlock(&block, output);
+                encodeColourBlock(&block, output + 8);
+            }
+        }
+    }
+}
+
+void encodeBcImage(const ImageFormat *imageFormat, const unsigned char *rgba,
+                   uint32_t width, uint32_t height, unsigned char *blocks) {
+    BcEncode encode = {
+        .imageFormat = imageFormat,
+        .rgba = rgba,
+        .width = width,
+        .height = height,
+        .blocks = blocks,
+    };
+    parallelFor((height + 3) / 4, BC_ENCODE_GRAIN, encodeBlockRows, &encode);
+}
@@ -0,0 +1,68 @@
+#include "image/format/format.h"
+#include "vulkan_handle/memory.h"
+
+#define PLAIN(f, srgb) {f, 1, 1, 4, srgb, false}
+#define BC(f, bytes, srgb) {f, 4, 4, bytes, srgb, true}
+#define ASTC(w, h)                                                             \
+    {VK_FORMAT_ASTC_##w##x##h##_UNORM_BLOCK, w, h, 16, false, false},          \
+        {VK_FORMAT_ASTC_##w##x##h##_SRGB_BLOCK, w, h, 16, true, false}
+
+static const ImageFormat imageFormats[] = {
+    PLAIN(VK_FORMAT_R8G8B8A8_UNORM, false),
+    PLAIN(VK_FORMAT_R8G8B8A8_SRGB, true),
+    BC(VK_FORMAT_BC1_RGB_UNORM_BLOCK, 8, false),
+    BC(VK_FORMAT_BC1_RGB_SRGB_BLOCK, 8, true),
+    BC(VK_FORMAT_BC1_RGBA_UNORM_BLOCK, 8, false),
+    BC(VK_FORMAT_BC1_RGBA_SRGB_BLOCK, 8, true),
+    BC(VK_FORMAT_BC3_UNORM_BLOCK, 16, false),
+    BC(VK_FORMAT_BC3_SRGB_BLOCK, 16, true),
+    BC(VK_FORMAT_BC7_UNORM_BLOCK, 16, false),
+    BC(VK_FORMAT_BC7_SRGB_BLOCK, 16, true),
+    ASTC(4, 4),
+    ASTC(5, 4),
+    ASTC(5, 5),
+    ASTC(6, 5),
+    ASTC(6, 6),
+    ASTC(8, 5),
+    ASTC(8, 6),
+    ASTC(8, 8),
+    ASTC(10, 5),
+    ASTC(10, 6),
+    ASTC(10, 8),
+    ASTC(10, 10),
+    ASTC(12, 10),
+    ASTC(12, 12),
+};
+
+const ImageFormat *findImageFormat(VkFormat format) {
+    for (uint32_t i = 0; i < SIZEOF(imageFormats); i++) {
+        if (imageFormats[i].format == format) {
+            return &imageFormats[i];
+        }
+    }
+    return NULL;
+}
+
+inline VkFormat decodedImageFormat(const ImageFormat *imageFormat) {
+    return imageFormat->srgb ? VK_FORMAT_R8G8B8A8_SRGB
+                             : VK_FORMAT_R8G8B8A8_UNORM;
+}
+
+// partial blocks at the edges are stored whole
+VkDeviceSize imageLevelSize(const ImageFormat *imageFormat, uint32_t width,
+                            uint32_t height) {
+    VkDeviceSize blocksWide =
+        (width + imageFormat->blockWidth - 1) / imageFormat->blockWidth;
+    VkDeviceSize blocksHigh =
+        (height + imageFormat->blockHeight - 1) / imageFormat->blockHeight;
+    return blocksWide * blocksHigh * imageFormat->blockBytes;
+}
+
+uint32_t fullMipLevels(uint32_t width, uint32_t height) {
+    uint32_t largest = width > height ? width : height;
+    uint32_t levels = 1;
+    while (largest >>= 1) {
+        levels++;
+    }
+    return levels;
+}
@@ -0,0 +1,248 @@
+#include "image/ktx/ktx.h"
+#include "image/format/format.h"
+#include "utility/error_handle.h"
+#include "utility/mapped_file.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const unsigned char ktx2Identifier[12] = {
+    0xab, 0x4b, 0x54, 0x58, 0x20, 0x32, 0x30, 0xbb, 0x0d, 0x0a, 0x1a, 0x0a,
+};
+
+typedef struct Ktx2Header {
+    unsigned char identifier[12];
+    uint32_t vkFormat;
+    uint32_t typeSize;
+    uint32_t pixelWidth;
+    uint32_t pixelHeight;
+    uint32_t pixelDepth;
+    uint32_t layerCount;
+    uint32_t faceCount;
+    uint32_t levelCount;
+    uint32_t supercompressionScheme;
+    uint32_t dfdByteOffset;
+    uint32_t dfdByteLength;
+    uint32_t kvdByteOffset;
+    uint32_t kvdByteLength;
+    uint64_t sgdByteOffset;
+    uint64_t sgdByteLength;
+} Ktx2Header;
+
+typedef struct Ktx2Level {
+    uint64_t byteOffset;
+    uint64_t byteLength;
+    uint64_t uncompressedByteLength;
+} Ktx2Level;
+
+inline bool isKtx2(const MappedFile *file) {
+    return file->size >= sizeof(Ktx2Header) &&
+           memcmp(file->data, ktx2Identifier, sizeof(ktx2Identifier)) == 0;
+}
+
+// Only what a sampled 2d texture needs, a single face and layer with no
+// supercompression, in a format findImageFormat knows. Every stored level is
+// checked to lie inside the file at the size its extent asks for.
+void readKtx2(const MappedFile *file, Ktx2Image *image) {
+    Ktx2Header header;
+    memcpy(&header, file->data, sizeof(header));
+
+    if (header.pixelDepth > 1 || header.layerCount > 1 ||
+        header.faceCount != 1 || !header.pixelWidth || !header.pixelHeight) {
+        THROW_ERROR("only 2d ktx2 textures are supported!\n");
+    }
+    if (header.supercompressionScheme) {
+        THROW_ERROR("supercompressed ktx2 textures are not supported!\n");
+    }
+
+    const ImageFormat *imageFormat = findImageFormat(header.vkFormat);
+    if (!imageFormat) {
+        THROW_ERROR("unsupported ktx2 texture format!\n");
+    }
+
+    // a level count of 0 asks for the chain to be generated from level 0
+    uint32_t levelsCount = header.levelCount ? header.levelCount : 1;
+    if (levelsCount > KTX2_MAX_LEVELS ||
+        levelsCount > fullMipLevels(header.pixelWidth, header.pixelHeight) ||
+        file->size < sizeof(header) + levelsCount * sizeof(Ktx2Level)) {
+        THROW_ERROR("malformed ktx2 level index!\n");
+    }
+
+    *image = (Ktx2Image){
+        .format = header.vkFormat,
+        .width = header.pixelWidth,
+        .height = header.pixelHeight,
+        .levelsCount = levelsCount,
+        .generateMips = header.levelCount == 0,
+    };
+
+    for (uint32_t i = 0; i < levelsCount; i++) {
+        Ktx2Level level;
+        memcpy(&level, file->data + sizeof(header) + i * sizeof(level),
+               sizeof(level));
+
+        VkDeviceSize size =
+            imageLevelSize(imageFormat, mipExtent(header.pixelWidth, i),
+                           mipExtent(header.pixelHeight, i));
+        if (level.byteLength != size || level.byteOffset > file->size ||
+            file->size - level.byteOffset < size) {
+            THROW_ERROR("malformed ktx2 level!\n");
+        }
+
+        image->levels[i] = (const unsigned char *)file->data + level.byteOffset;
+        image->levelSizes[i] = size;
+    }
+}
+
+// khronos data format descriptor, the parts a basic descriptor block needs
+#define KHR_DF_VERSION 2
+#define KHR_DF_MODEL_RGBSDA 1
+#define KHR_DF_MODEL_BC1A 128
+#define KHR_DF_MODEL_BC3 130
+#define KHR_DF_MODEL_BC7 134
+#define KHR_DF_MODEL_ASTC 162
+#define KHR_DF_PRIMARIES_BT709 1
+#define KHR_DF_TRANSFER_LINEAR 1
+#define KHR_DF_TRANSFER_SRGB 2
+#define KHR_DF_CHANNEL_ALPHA_PRESENT 1
+#define KHR_DF_CHANNEL_ALPHA 15
+#define KHR_DF_SAMPLE_LINEAR 0x10
+
+#define KTX2_MAX_SAMPLES 4
+
+typedef struct Ktx2Sample {
+    uint8_t channel;
+    uint8_t bitOffset;
+    uint8_t bitLength;
+} Ktx2Sample;
+
+typedef struct Ktx2Descriptor {
+    uint32_t model;
+    uint32_t samplesCount;
+    Ktx2Sample samples[KTX2_MAX_SAMPLES];
+} Ktx2Descriptor;
+
+static Ktx2Descriptor describeFormat(VkFormat format) {
+    switch (format) {
+    case VK_FORMAT_R8G8B8A8_UNORM:
+    case VK_FORMAT_R8G8B8A8_SRGB:
+        return (Ktx2Descriptor){
+            KHR_DF_MODEL_RGBSDA,
+            4,
+            {{0, 0, 8}, {1, 8, 8}, {2, 16, 8}, {KHR_DF_CHANNEL_ALPHA, 24, 8}},
+        };
+    case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+    case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+        return (Ktx2Descriptor){KHR_DF_MODEL_BC1A, 1, {{0, 0, 64}}};
+    case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+    case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+        return (Ktx2Descriptor){
+            KHR_DF_MODEL_BC1A, 1, {{KHR_DF_CHANNEL_ALPHA_PRESENT, 0, 64}}};
+    case VK_FORMAT_BC3_UNORM_BLOCK:
+    case VK_FORMAT_BC3_SRGB_BLOCK:
+        return (Ktx2Descriptor){
+            KHR_DF_MODEL_BC3, 2, {{KHR_DF_CHANNEL_ALPHA, 0, 64}, {0, 64, 64}}};
+    case VK_FORMAT_BC7_UNORM_BLOCK:
+    case VK_FORMAT_BC7_SRGB_BLOCK:
+        return (Ktx2Descriptor){KHR_DF_MODEL_BC7, 1, {{0, 0, 128}}};
+    default:
+        return (Ktx2Descriptor){KHR_DF_MODEL_ASTC, 1, {{0, 0, 128}}};
+    }
+}
+
+// the total size followed by one basic descriptor block, in words
+static uint32_t writeDescriptor(const ImageFormat *imageFormat,
+                                uint32_t *words) {
+    Ktx2Descriptor descriptor = describeFormat(imageFormat->format);
+    uint32_t blockSize = 24 + 16 * descriptor.samplesCount;
+
+    words[0] = 4 + blockSize;
+    words[1] = 0; // khronos vendor, basic descriptor type
+    words[2] = KHR_DF_VERSION | blockSize << 16;
+    words[3] = descriptor.model | KHR_DF_PRIMARIES_BT709 << 8 |
+               (imageFormat->srgb ? KHR_DF_TRANSFER_SRGB
+                                  : KHR_DF_TRANSFER_LINEAR)
+                   << 16;
+    words[4] = (uint32_t)(imageFormat->blockWidth - 1) |
+               (uint32_t)(imageFormat->blockHeight - 1) << 8;
+    words[5] = imageFormat->blockBytes;
+    words[6] = 0;
+
+    for (uint32_t i = 0; i < descriptor.samplesCount; i++) {
+        const Ktx2Sample *sample = &descriptor.samples[i];
+        uint32_t *sampleWords = &words[7 + i * 4];
+        // alpha is never srgb encoded, even in an srgb format
+        uint32_t qualifiers = sample->channel == KHR_DF_CHANNEL_ALPHA &&
+                                      imageFormat->srgb
+                                  ? KHR_DF_SAMPLE_LINEAR
+                                  : 0;
+        sampleWords[0] = sample->bitOffset |
+                         (uint32_t)(sample->bitLength - 1) << 16 |
+                         (sample->channel | qualifiers) << 24;
+        sampleWords[1] = 0;
+        sampleWords[2] = 0;
+        sampleWords[3] = sample->bitLength < 32
+                             ? (1u << sample->bitLength) - 1
+                             : UINT32_MAX;
+    }
+
+    return words[0];
+}
+
+// Levels go smallest first, each on a multiple of its block size and of 4 as
+// the specification asks, with no key/value data or supercompression.
+unsigned char *writeKtx2(const Ktx2Image *image, size_t *size) {
+    const ImageFormat *imageFormat = findImageFormat(image->format);
+    if (!imageFormat) {
+        THROW_ERROR("unsupported ktx2 texture format!\n");
+    }
+
+    uint32_t descriptorWords[7 + 4 * KTX2_MAX_SAMPLES];
+    uint32_t descriptorSize = writeDescriptor(imageFormat, descriptorWords);
+
+    size_t alignment = imageFormat->blockBytes % 4 == 0
+                           ? imageFormat->blockBytes
+                           : (size_t)imageFormat->blockBytes * 4;
+    size_t descriptorOffset =
+        sizeof(Ktx2Header) + image->levelsCount * sizeof(Ktx2Level);
+
+    Ktx2Level levels[KTX2_MAX_LEVELS];
+    size_t offset = descriptorOffset + descriptorSize;
+    for (uint32_t i = image->levelsCount; i-- > 0;) {
+        offset = (offset + alignment - 1) / alignment * alignment;
+        levels[i] = (Ktx2Level){
+            .byteOffset = offset,
+            .byteLength = image->levelSizes[i],
+            .uncompressedByteLength = image->levelSizes[i],
+        };
+        offset += image->levelSizes[i];
+    }
+
+    unsigned char *file = calloc(1, offset);
+    if (!file) {
+        THROW_ERROR("failed to allocate ktx2 file!\n");
+    }
+
+    Ktx2Header header = {
+        .vkFormat = image->format,
+        .typeSize = 1,
+        .pixelWidth = image->width,
+        .pixelHeight = image->height,
+        .faceCount = 1,
+        .levelCount = image->generateMips ? 0 : image->levelsCount,
+        .dfdByteOffset = (uint32_t)descriptorOffset,
+        .dfdByteLength = descriptorSize,
+    };
+    memcpy(header.identifier, ktx2Identifier, sizeof(ktx2Identifier));
+
+    memcpy(file, &header, sizeof(header));
+    memcpy(file + sizeof(header), levels,
+           image->levelsCount * sizeof(*levels));
+    memcpy(file + descriptorOffset, descriptorWords, descriptorSize);
+    for (uint32_t i = 0; i < image->levelsCount; i++) {
+        memcpy(file + levels[i].byteOffset, image->levels[i],
+               image->levelSizes[i]);
+    }
+
+    *size = offset;
+    return file;
+}
@@ -0,0 +1,314 @@
+#include "image/mip/mip.h"
+#include "image/format/format.h"
+#include "utility/error_handle.h"
+#include "utility/job.h"
+#include "vulkan_handle/memory.h"
+#include <cglm/util.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// source texels, at most, any destination texel reads along one axis
+#define MIP_MAX_TAPS (4 * MIP_LANCZOS_RADIUS * 3)
+
+// the taps of one destination texel along one axis
+typedef struct MipTaps {
+    uint32_t count;
+    uint32_t texels[MIP_MAX_TAPS];
+    float weights[MIP_MAX_TAPS];
+} MipTaps;
+
+// One level from the one above, horizontally into rows then vertically. The
+// texels are linear and premultiplied, so transparent texels don't bleed
+// their colour into the ones around them.
+typedef struct MipPass {
+    const float *source;
+    float *rows;
+    float *destination;
+    uint32_t sourceWidth;
+    uint32_t sourceHeight;
+    uint32_t width;
+    uint32_t height;
+    const MipTaps *columnTaps;
+    const MipTaps *rowTaps;
+} MipPass;
+
+static inline float lanczos(float x) {
+    x = fabsf(x);
+    if (x < 1e-6f) {
+        return 1.0f;
+    }
+    if (x >= MIP_LANCZOS_RADIUS) {
+        return 0.0f;
+    }
+    float px = GLM_PIf * x;
+    return MIP_LANCZOS_RADIUS * sinf(px) * sinf(px / MIP_LANCZOS_RADIUS) /
+           (px * px);
+}
+
+// the kernel widened by the reduction, wrapping around the edges as the
+// repeating sampler does
+static MipTaps *makeTaps(uint32_t sourceSize, uint32_t size) {
+    MipTaps *taps = malloc(size * sizeof(*taps));
+    float scale = (float)sourceSize / size;
+    float radius = MIP_LANCZOS_RADIUS * scale;
+
+    for (uint32_t i = 0; i < size; i++) {
+        float centre = (i + 0.5f) * scale - 0.5f;
+        int32_t first = (int32_t)ceilf(centre - radius);
+        int32_t last = (int32_t)floorf(centre + radius);
+
+        MipTaps *tap = &taps[i];
+        tap->count = 0;
+        float total = 0.0f;
+        for (int32_t j = first; j <= last && tap->count < MIP_MAX_TAPS; j++) {
+            float weight = lanczos((j - centre) / scale);
+            if (weight == 0.0f) {
+                continue;
+            }
+            int32_t wrapped = j % (int32_t)sourceSize;
+            tap->texels[tap->count] =
+                (uint32_t)(wrapped < 0 ? wrapped + (int32_t)sourceSize
+                                       : wrapped);
+            tap->weights[tap->count++] = weight;
+            total += weight;
+        }
+        for (uint32_t k = 0; k < tap->count; k++) {
+            tap->weights[k] /= total;
+        }
+    }
+
+    return taps;
+}
+
+// an rgba texel is one sse register, every tap a multiply and an add
+static void filterRows(void *data, uint32_t first, uint32_t last) {
+    MipPass *pass = data;
+    for (uint32_t y = first; y < last; y++) {
+        const float *source = &pass->source[(size_t)y * pass->sourceWidth * 4];
+        float *row = &pass->rows[(size_t)y * pass->width * 4];
+
+        for (uint32_t x = 0; x < pass->width; x++) {
+            const MipTaps *taps = &pass->columnTaps[x];
+#ifdef __SSE2__
+            __m128 sum = _mm_setzero_ps();
+            for (uint32_t k = 0; k < taps->count; k++) {
+                __m128 texel = _mm_loadu_ps(&source[taps->texels[k] * 4]);
+                sum = _mm_add_ps(
+                    sum, _mm_mul_ps(texel, _mm_set1_ps(taps->weights[k])));
+            }
+            _mm_storeu_ps(&row[x * 4], sum);
+#else
+            float sum[4] = {0};
+            for (uint32_t k = 0; k < taps->count; k++) {
+                const float *texel = &source[taps->texels[k] * 4];
+                for (uint32_t c = 0; c < 4; c++) {
+                    sum[c] += texel[c] * taps->weights[k];
+                }
+            }
+            memcpy(&row[x * 4], sum, sizeof(sum));
+#endif
+        }
+    }
+}
+
+static void filterColumns(void *data, uint32_t first, uint32_t last) {
+    MipPass *pass = data;
+    for (uint32_t y = first; y < last; y++) {
+        const MipTaps *taps = &pass->rowTaps[y];
+        float *destination = &pass->destination[(size_t)y * pass->width * 4];
+        memset(destination, 0, pass->width * 4 * sizeof(float));
+
+        for (uint32_t k = 0; k < taps->count; k++) {
+            const float *row =
+                &pass->rows[(size_t)taps->texels[k] * pass->width * 4];
+            float weight = taps->weights[k];
+#ifdef __SSE2__
+            // rows are whole texels, so a multiple of four floats
+            __m128 weights = _mm_set1_ps(weight);
+            for (uint32_t x = 0; x < pass->width * 4; x += 4) {
+                __m128 sum = _mm_add_ps(
+                    _mm_loadu_ps(&destination[x]),
+                    _mm_mul_ps(_mm_loadu_ps(&row[x]), weights));
+                _mm_storeu_ps(&destination[x], sum);
+            }
+#else
+            for (uint32_t x = 0; x < pass->width * 4; x++) {
+                destination[x] += row[x] * weight;
+            }
+#endif
+        }
+
+        // lanczos lobes can overshoot
+        for (uint32_t x = 0; x < pass->width; x++) {
+            float *texel = &destination[x * 4];
+            texel[3] = glm_clamp(texel[3], 0.0f, 1.0f);
+#ifdef __SSE2__
+            // the colour clamped to the alpha, which is already in range
+            __m128 clamped = _mm_min_ps(
+                _mm_max_ps(_mm_loadu_ps(texel), _mm_setzero_ps()),
+                _mm_set1_ps(texel[3]));
+            _mm_storeu_ps(texel, clamped);
+#else
+            for (uint32_t c = 0; c < 3; c++) {
+                texel[c] = glm_clamp(texel[c], 0.0f, texel[3]);
+            }
+#endif
+        }
+    }
+}
+
+static inline float linearFromSrgb(float value) {
+    return value <= 0.04045f ? value / 12.92f
+                             : powf((value + 0.055f) / 1.055f, 2.4f);
+}
+
+static inline float srgbFromLinear(float value) {
+    return value <= 0.0031308f ? value * 12.92f
+                               : 1.055f * powf(value, 1.0f / 2.4f) - 0.055f;
+}
+
+static inline unsigned char quantise(float value) {
+    return (unsigned char)(glm_clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+static float coverage(const float *texels, size_t count, float alphaScale) {
+    size_t covered = 0;
+    for (size_t i = 0; i < count; i++) {
+        covered += texels[i * 4 + 3] * alphaScale > MIP_ALPHA_REFERENCE;
+    }
+    return (float)covered / count;
+}
+
+// Castaño's alpha to coverage correction, the scale that brings the level's
+// coverage closest to the target, found by bisection since coverage only
+// grows with it
+static float coverageScale(const float *texels, size_t count, float target) {
+    float low = 0.0f, high = 4.0f, best = 1.0f;
+    float bestError = fabsf(coverage(texels, count, 1.0f) - target);
+
+    for (uint32_t i = 0; i < 12; i++) {
+        float scale = (low + high) * 0.5f;
+        float covered = coverage(texels, count, scale);
+        if (fabsf(covered - target) < bestError) {
+            bestError = fabsf(covered - target);
+            best = scale;
+        }
+        if (covered < target) {
+            low = scale;
+        } else {
+            high = scale;
+        }
+    }
+
+    return best;
+}
+
+static void writeLevel(const float *texels, size_t count, MipFlags flags,
+                       float alphaScale, unsigned char *level) {
+    for (size_t i = 0; i < count; i++) {
+        const float *texel = &texels[i * 4];
+        float alpha = texel[3];
+        for (uint32_t c = 0; c < 3; c++) {
+            float value = alpha > 0.0f ? texel[c] / alpha : 0.0f;
+            if (flags & MIP_SRGB) {
+                value = srgbFromLinear(value);
+            }
+            level[i * 4 + c] = quantise(value);
+        }
+        level[i * 4 + 3] = quantise(alpha * alphaScale);
+    }
+}
+
+// Every level filtered from the float one above it, so rounding doesn't add
+// up down the chain, with a lanczos kernel sharper than the box a blit gives.
+void generateMipChain(const unsigned char *rgba, uint32_t width,
+                      uint32_t height, MipFlags flags, MipChain *chain) {
+    chain->levelsCount = fullMipLevels(width, height);
+    if (chain->levelsCount > KTX2_MAX_LEVELS) {
+        THROW_ERROR("texture too large for a mip chain!\n");
+    }
+
+    size_t count = (size_t)width * height;
+    // no level, nor its horizontally filtered rows, outgrows level 0
+    float *source = malloc(count * 4 * sizeof(float));
+    float *destination = malloc(count * 4 * sizeof(float));
+    float *rows = malloc(count * 4 * sizeof(float));
+    if (!source || !destination || !rows) {
+        THROW_ERROR("failed to allocate mip chain!\n");
+    }
+
+    // a table rather than a pow for every channel of every texel
+    float linear[256];
+    for (uint32_t i = 0; i < SIZEOF(linear); i++) {
+        linear[i] =
+            flags & MIP_SRGB ? linearFromSrgb(i / 255.0f) : i / 255.0f;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        float alpha = rgba[i * 4 + 3] / 255.0f;
+        for (uint32_t c = 0; c < 3; c++) {
+            source[i * 4 + c] = linear[rgba[i * 4 + c]] * alpha;
+        }
+        source[i * 4 + 3] = alpha;
+    }
+
+    chain->widths[0] = width;
+    chain->heights[0] = height;
+    chain->levels[0] = malloc(count * 4);
+    memcpy(chain->levels[0], rgba, count * 4);
+
+    float target = flags & MIP_PRESERVE_COVERAGE
+                       ? coverage(source, count, 1.0f)
+                       : 0.0f;
+
+    for (uint32_t i = 1; i < chain->levelsCount; i++) {
+        MipPass pass = {
+            .source = source,
+            .rows = rows,
+            .destination = destination,
+            .sourceWidth = chain->widths[i - 1],
+            .sourceHeight = chain->heights[i - 1],
+            .width = mipExtent(width, i),
+            .height = mipExtent(height, i),
+        };
+        MipTaps *columnTaps = makeTaps(pass.sourceWidth, pass.width);
+        MipTaps *rowTaps = makeTaps(pass.sourceHeight, pass.height);
+        pass.columnTaps = columnTaps;
+        pass.rowTaps = rowTaps;
+
+        parallelFor(pass.sourceHeight, MIP_GRAIN, filterRows, &pass);
+        parallelFor(pass.height, MIP_GRAIN, filterColumns, &pass);
+
+        size_t levelCount = (size_t)pass.width * pass.height;
+        float alphaScale = flags & MIP_PRESERVE_COVERAGE
+                               ? coverageScale(destination, levelCount, target)
+                               : 1.0f;
+
+        chain->widths[i] = pass.width;
+        chain->heights[i] = pass.height;
+        chain->levels[i] = malloc(levelCount * 4);
+        writeLevel(destination, levelCount, flags, alphaScale,
+                   chain->levels[i]);
+
+        // this level is the next one's source
+        float *swap = source;
+        source = destination;
+        destination = swap;
+
+        freeMem(2, columnTaps, rowTaps);
+    }
+
+    freeMem(3, source, destination, rows);
+}
+
+void freeMipChain(MipChain *chain) {
+    for (uint32_t i = 0; i < chain->levelsCount; i++) {
+        freeMem(1, chain->levels[i]);
+    }
+    *chain = (MipChain){0};
+}
@@ -0,0 +1,157 @@
+// the stat timestamps are hidden by a strict -std=c18
+#define _POSIX_C_SOURCE 200809L
+
+#include "image/package/package.h"
+#include "geometry/cache/cache.h"
+#include "utility/mapped_file.h"
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+// the size and modification time of a source image, 0 when it isn't there
+uint64_t textureSourceStamp(const char *fileName) {
+    struct stat info;
+    if (stat(fileName, &info) != 0) {
+        return 0;
+    }
+
+    int64_t stamp[2] = {(int64_t)info.st_size, (int64_t)info.st_mtime};
+    return hashMeshCacheKey(MESH_CACHE_KEY_SEED, stamp, sizeof(stamp));
+}
+
+static const char *baseName(const char *fileName) {
+    const char *name = fileName;
+    for (const char *c = fileName; *c; c++) {
+        if (*c == '/' || *c == '\\') {
+            name = c + 1;
+        }
+    }
+    return name;
+}
+
+static bool validPackage(const MappedFile *package) {
+    if (package->size < sizeof(TexturePackageHeader)) {
+        return false;
+    }
+
+    TexturePackageHeader header;
+    memcpy(&header, package->data, sizeof(header));
+    return header.magic == TEXTURE_PACKAGE_MAGIC &&
+           header.version == TEXTURE_PACKAGE_VERSION &&
+           header.texturesCount <=
+               (package->size - sizeof(header)) / sizeof(TexturePackageEntry);
+}
+
+// The cooked texture standing in for an image, from the package in the same
+// directory. A source that changed since it was cooked is a miss, one that
+// isn't shipped at all is taken to match. On a hit the package stays mapped
+// and the view covers the texture's ktx2 file.
+bool findPackagedTexture(const char *fileName, MappedFile *package,
+                         MappedFile *view) {
+    const char *name = baseName(fileName);
+    if (strlen(name) >= TEXTURE_PACKAGE_MAX_NAME) {
+        return false;
+    }
+
+    char packageName[512];
+    if (snprintf(packageName, sizeof(packageName), "%.*s%s",
+                 (int)(name - fileName), fileName,
+                 TEXTURE_PACKAGE_NAME) >= (int)sizeof(packageName)) {
+        return false;
+    }
+
+    if (!mapFile(packageName, MAPPED_FILE_RANDOM, package)) {
+        return false;
+    }
+
+    if (validPackage(package)) {
+        TexturePackageHeader header;
+        memcpy(&header, package->data, sizeof(header));
+
+        for (uint32_t i = 0; i < header.texturesCount; i++) {
+            TexturePackageEntry entry;
+            memcpy(&entry,
+                   package->data + sizeof(header) + i * sizeof(entry),
+                   sizeof(entry));
+            if (strncmp(entry.name, name, sizeof(entry.name)) != 0) {
+                continue;
+            }
+
+            uint64_t stamp = textureSourceStamp(fileName);
+            if ((stamp && stamp != entry.stamp) ||
+                entry.offset > package->size ||
+                entry.size > package->size - entry.offset) {
+                break;
+            }
+
+            *view = (MappedFile){
+                .data = package->data + entry.offset,
+                .size = entry.size,
+            };
+            return true;
+        }
+    }
+
+    unmapFile(package);
+    *package = (MappedFile){0};
+    return false;
+}
+
+static bool writePadding(FILE *file, uint64_t *offset) {
+    static const unsigned char zeros[TEXTURE_PACKAGE_ALIGNMENT];
+    uint64_t padding = -*offset & (TEXTURE_PACKAGE_ALIGNMENT - 1);
+    *offset += padding;
+    return !padding || fwrite(zeros, 1, padding, file) == padding;
+}
+
+// the whole package in one go, nothing is left behind if it fails
+bool writeTexturePackage(const char *fileName,
+                         const PackagedTexture *textures,
+                         uint32_t texturesCount) {
+    FILE *file = fopen(fileName, "wb");
+    if (!file) {
+        return false;
+    }
+
+    TexturePackageHeader header = {
+        .magic = TEXTURE_PACKAGE_MAGIC,
+        .version = TEXTURE_PACKAGE_VERSION,
+        .texturesCount = texturesCount,
+    };
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1;
+
+    uint64_t offset =
+        sizeof(header) + (uint64_t)texturesCount * sizeof(TexturePackageEntry);
+    for (uint32_t i = 0; i < texturesCount && written; i++) {
+        TexturePackageEntry entry = {
+            .stamp = textures[i].stamp,
+            .size = textures[i].size,
+        };
+        if (strlen(textures[i].name) >= sizeof(entry.name)) {
+            written = false;
+            break;
+        }
+        strcpy(entry.name, textures[i].name);
+
+        offset += -offset & (TEXTURE_PACKAGE_ALIGNMENT - 1);
+        entry.offset = offset;
+        offset += textures[i].size;
+
+        written = fwrite(&entry, sizeof(entry), 1, file) == 1;
+    }
+
+    offset = sizeof(header) +
+             (uint64_t)texturesCount * sizeof(TexturePackageEntry);
+    for (uint32_t i = 0; i < texturesCount && written; i++) {
+        written = writePadding(file, &offset) &&
+                  fwrite(textures[i].data, 1, textures[i].size, file) ==
+                      textures[i].size;
+        offset += textures[i].size;
+    }
+
+    written &= fclose(file) == 0;
+    if (!written) {
+        remove(fileName);
+    }
+    return written;
+}
@@ -0,0 +1,21 @@
+#version 450
+
+layout(binding = 0) uniform ModelViewProjection {
+    mat4 model;
+    mat4 view;
+    mat4 proj;
+} mvp;
+
+// float positions arrive with w filled in as 1, packed ones store it
+layout(location = 0) in vec4 inPosition;
+
+// the colour pass tests less or equal against this depth without writing its
+// own, which only holds when every module computes the position bit for bit
+// alike, so each of them declares it invariant
+invariant gl_Position;
+
+void main() {
+    vec3 position = vec3(mvp.model * vec4(inPosition.xyz, 1.0));
+
+    gl_Position = mvp.proj * mvp.view * vec4(position, 1.0);
+}
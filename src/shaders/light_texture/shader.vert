@@ -16,6 +16,9 @@ layout(location = 1) out vec3 outColor;
 layout(location = 2) out vec3 outPosition;
 layout(location = 3) out vec2 outTexCoord;
 
+// the same depth as the prepass, see depth/shader.vert
+invariant gl_Position;
+
 void main() {
     outPosition = vec3(mvp.model * vec4(inPosition, 1.0));
     outColor = inColor;
@@ -0,0 +1,38 @@
+#version 450
+
+layout(binding = 0) uniform ModelViewProjection {
+    mat4 model;
+    mat4 view;
+    mat4 proj;
+} mvp;
+
+layout(location = 0) in vec4 inPosition;
+layout(location = 1) in vec4 inColor;
+layout(location = 2) in vec2 inNormal;
+layout(location = 3) in vec2 inTexCoord;
+
+layout(location = 0) out vec3 outNormal;
+layout(location = 1) out vec3 outColor;
+layout(location = 2) out vec3 outPosition;
+layout(location = 3) out vec2 outTexCoord;
+
+// the same depth as the prepass, see depth/shader.vert
+invariant gl_Position;
+
+// inverse of the octahedral fold applied by packVertices
+vec3 octahedralDecode(vec2 e) {
+    vec3 n = vec3(e.xy, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-n.z, 0.0);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}
+
+void main() {
+    outPosition = vec3(mvp.model * vec4(inPosition.xyz, 1.0));
+    outColor = inColor.rgb;
+    outNormal = mat3(mvp.model) * octahedralDecode(inNormal);
+    outTexCoord = inTexCoord;
+
+    gl_Position = mvp.proj * mvp.view * vec4(outPosition, 1.0);
+}
@@ -0,0 +1,447 @@
+// pthread_setaffinity_np is hidden by a strict -std=c18
+#define _GNU_SOURCE
+
+#include "utility/job.h"
+#include "error_handle.h"
+#include <SDL_cpuinfo.h>
+#include <SDL_mutex.h>
+#include <SDL_thread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#define JOB_QUEUE_MASK (JOB_QUEUE_CAPACITY - 1)
+
+// ranges a parallelFor makes per thread at most, a few so a slow one can be
+// balanced by stealing the rest
+#define JOB_RANGES_PER_THREAD 4
+
+typedef struct JobEntry {
+    JobFunction function;
+    void *data;
+    JobCounter *counter;
+} JobEntry;
+
+struct JobBatch {
+    JobBatch *next;
+    JobCounter *counter;
+    uint32_t jobsCount;
+    Job jobs[];
+};
+
+// Chase-Lev deque, the owner pushes and pops at the bottom, every other
+// thread steals from the top. The indices only grow and are compared by
+// their difference, so they may wrap.
+typedef struct JobQueue {
+    SDL_atomic_t top;
+    char padding[64 - sizeof(SDL_atomic_t)]; // keeps thieves off the owner's
+                                             // cache line
+    SDL_atomic_t bottom;
+    JobEntry entries[JOB_QUEUE_CAPACITY];
+} JobQueue;
+
+typedef struct JobSystem {
+    JobQueue *queues; // the starting thread's first, then one per worker
+    uint32_t queuesCount;
+    SDL_Thread **workers;
+    SDL_sem *wake;
+    SDL_atomic_t sleepers;
+    SDL_atomic_t quit;
+    JobSystemFlags flags;
+} JobSystem;
+
+static JobSystem jobSystem;
+
+// queue index + 1, 0 for threads outside the pool
+static _Thread_local uint32_t threadSlot;
+static _Thread_local uint32_t stealSeed;
+
+static inline int32_t queueSize(JobQueue *queue) {
+    return (int32_t)((uint32_t)SDL_AtomicGet(&queue->bottom) -
+                     (uint32_t)SDL_AtomicGet(&queue->top));
+}
+
+static bool pushJob(JobQueue *queue, const JobEntry *entry) {
+    uint32_t bottom = (uint32_t)SDL_AtomicGet(&queue->bottom);
+    uint32_t top = (uint32_t)SDL_AtomicGet(&queue->top);
+    if (bottom - top >= JOB_QUEUE_CAPACITY) {
+        return false;
+    }
+
+    queue->entries[bottom & JOB_QUEUE_MASK] = *entry;
+    SDL_AtomicSet(&queue->bottom, (int)(bottom + 1));
+    return true;
+}
+
+// newest first, which keeps a job's children close to it in the cache
+static bool popJob(JobQueue *queue, JobEntry *entry) {
+    uint32_t bottom = (uint32_t)SDL_AtomicGet(&queue->bottom) - 1;
+    SDL_AtomicSet(&queue->bottom, (int)bottom);
+    uint32_t top = (uint32_t)SDL_AtomicGet(&queue->top);
+
+    int32_t size = (int32_t)(bottom - top);
+    if (size < 0) {
+        SDL_AtomicSet(&queue->bottom, (int)top);
+        return false;
+    }
+
+    *entry = queue->entries[bottom & JOB_QUEUE_MASK];
+    if (size > 0) {
+        return true;
+    }
+
+    // the last job, which a thief may be taking at the same time
+    bool won = SDL_AtomicCAS(&queue->top, (int)top, (int)(top + 1));
+    SDL_AtomicSet(&queue->bottom, (int)(top + 1));
+    return won;
+}
+
+static bool stealJob(JobQueue *queue, JobEntry *entry) {
+    uint32_t top = (uint32_t)SDL_AtomicGet(&queue->top);
+    uint32_t bottom = (uint32_t)SDL_AtomicGet(&queue->bottom);
+    if ((int32_t)(bottom - top) <= 0) {
+        return false;
+    }
+
+    *entry = queue->entries[top & JOB_QUEUE_MASK];
+    return SDL_AtomicCAS(&queue->top, (int)top, (int)(top + 1));
+}
+
+// starts from a random queue, so thieves spread over their victims
+static bool stealAnyJob(uint32_t self, JobEntry *entry) {
+    stealSeed ^= stealSeed << 13;
+    stealSeed ^= stealSeed >> 17;
+    stealSeed ^= stealSeed << 5;
+
+    uint32_t first = stealSeed % jobSystem.queuesCount;
+    for (uint32_t i = 0; i < jobSystem.queuesCount; i++) {
+        uint32_t victim = (first + i) % jobSystem.queuesCount;
+        if (victim != self && stealJob(&jobSystem.queues[victim], entry)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool anyJobs(void) {
+    for (uint32_t i = 0; i < jobSystem.queuesCount; i++) {
+        if (queueSize(&jobSystem.queues[i]) > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void pushJobs(const Job *, uint32_t, JobCounter *);
+
+// The last job of a counter parks it at -1 until what waits on it has been
+// queued, so a waiter never sees zero while the counter is still in use.
+static void finishJob(JobCounter *counter) {
+    if (!counter) {
+        return;
+    }
+
+    int count;
+    do {
+        count = SDL_AtomicGet(&counter->count);
+    } while (!SDL_AtomicCAS(&counter->count, count, count == 1 ? -1
+                                                               : count - 1));
+    if (count != 1) {
+        return;
+    }
+
+    SDL_AtomicLock(&counter->lock);
+    JobBatch *waiting = counter->waiting;
+    counter->waiting = NULL;
+    SDL_AtomicUnlock(&counter->lock);
+
+    SDL_AtomicSet(&counter->count, 0);
+
+    while (waiting) {
+        JobBatch *next = waiting->next;
+        pushJobs(waiting->jobs, waiting->jobsCount, waiting->counter);
+        free(waiting);
+        waiting = next;
+    }
+}
+
+static inline void runEntry(const JobEntry *entry) {
+    entry->function(entry->data);
+    finishJob(entry->counter);
+}
+
+static bool runOneJob(uint32_t self) {
+    JobEntry entry;
+    if (!popJob(&jobSystem.queues[self], &entry) &&
+        !stealAnyJob(self, &entry)) {
+        return false;
+    }
+
+    runEntry(&entry);
+    return true;
+}
+
+// the calling thread's queue, a full one runs the job straight away
+static void pushJobs(const Job *jobs, uint32_t jobsCount,
+                     JobCounter *counter) {
+    JobQueue *queue = &jobSystem.queues[threadSlot - 1];
+
+    for (uint32_t i = 0; i < jobsCount; i++) {
+        JobEntry entry = {
+            .function = jobs[i].function,
+            .data = jobs[i].data,
+            .counter = counter,
+        };
+        if (!pushJob(queue, &entry)) {
+            runEntry(&entry);
+        }
+    }
+
+    // only pays for a wake up when a worker is asleep, one that is about to
+    // sleep looks at the queues again first
+    uint32_t sleepers = (uint32_t)SDL_AtomicGet(&jobSystem.sleepers);
+    for (uint32_t i = 0; i < sleepers && i < jobsCount; i++) {
+        SDL_SemPost(jobSystem.wake);
+    }
+}
+
+static void pinThread(uint32_t core) {
+#ifdef _WIN32
+    SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << core);
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    // macos has no affinity, only hints
+    (void)core;
+#endif
+}
+
+static int runWorker(void *data) {
+    uint32_t self = (uint32_t)(uintptr_t)data;
+    threadSlot = self + 1;
+    stealSeed = self * 0x9e3779b9u + 1;
+
+    if (jobSystem.flags & JOB_SYSTEM_PIN_THREADS) {
+        pinThread(self % (uint32_t)SDL_GetCPUCount());
+    }
+
+    while (!SDL_AtomicGet(&jobSystem.quit)) {
+        if (runOneJob(self)) {
+            continue;
+        }
+
+        SDL_AtomicAdd(&jobSystem.sleepers, 1);
+        if (!anyJobs() && !SDL_AtomicGet(&jobSystem.quit)) {
+            SDL_SemWait(jobSystem.wake);
+        }
+        SDL_AtomicAdd(&jobSystem.sleepers, -1);
+    }
+
+    return 0;
+}
+
+// The calling thread keeps queue 0 and helps whenever it waits, so with 0
+// workers there is one per remaining core.
+void startJobSystem(uint32_t workersCount, JobSystemFlags flags) {
+    if (jobSystem.queues) {
+        THROW_ERROR("job system already started!\n");
+    }
+
+    if (!workersCount) {
+        int cores = SDL_GetCPUCount();
+        workersCount = cores > 1 ? (uint32_t)cores - 1 : 1;
+    }
+
+    jobSystem.queuesCount = workersCount + 1;
+    jobSystem.queues =
+        calloc(jobSystem.queuesCount, sizeof(*jobSystem.queues));
+    jobSystem.workers = malloc(workersCount * sizeof(*jobSystem.workers));
+    jobSystem.wake = SDL_CreateSemaphore(0);
+    jobSystem.flags = flags;
+    SDL_AtomicSet(&jobSystem.sleepers, 0);
+    SDL_AtomicSet(&jobSystem.quit, 0);
+
+    if (!jobSystem.queues || !jobSystem.workers || !jobSystem.wake) {
+        THROW_ERROR("failed to start job system!\n");
+    }
+
+    threadSlot = 1;
+    stealSeed = 1;
+
+    for (uint32_t i = 0; i < workersCount; i++) {
+        jobSystem.workers[i] = SDL_CreateThread(runWorker, "worker",
+                                                (void *)(uintptr_t)(i + 1));
+        if (!jobSystem.workers[i]) {
+            THROW_ERROR("failed to create worker thread!\n");
+        }
+    }
+}
+
+// every job must have been waited on already
+void stopJobSystem(void) {
+    if (!jobSystem.queues) {
+        return;
+    }
+
+    uint32_t workersCount = jobSystem.queuesCount - 1;
+
+    SDL_AtomicSet(&jobSystem.quit, 1);
+    for (uint32_t i = 0; i < workersCount; i++) {
+        SDL_SemPost(jobSystem.wake);
+    }
+    for (uint32_t i = 0; i < workersCount; i++) {
+        SDL_WaitThread(jobSystem.workers[i], NULL);
+    }
+
+    SDL_DestroySemaphore(jobSystem.wake);
+    free(jobSystem.queues);
+    free(jobSystem.workers);
+    jobSystem = (JobSystem){0};
+    threadSlot = 0;
+}
+
+uint32_t jobWorkersCount(void) {
+    return jobSystem.queuesCount ? jobSystem.queuesCount - 1 : 0;
+}
+
+static inline bool jobsRunInline(void) {
+    if (!jobSystem.queues) {
+        return true;
+    }
+    if (!threadSlot) {
+        THROW_ERROR("jobs run from a thread outside the job system!\n");
+    }
+    return false;
+}
+
+void runJobs(const Job *jobs, uint32_t jobsCount, JobCounter *counter) {
+    if (jobsRunInline()) {
+        for (uint32_t i = 0; i < jobsCount; i++) {
+            jobs[i].function(jobs[i].data);
+        }
+        return;
+    }
+
+    if (counter) {
+        SDL_AtomicAdd(&counter->count, (int)jobsCount);
+    }
+    pushJobs(jobs, jobsCount, counter);
+}
+
+// The jobs are queued once the dependency's count reaches zero, by whichever
+// thread finishes its last job, and count towards the counter from now.
+void runJobsAfter(JobCounter *dependency, const Job *jobs, uint32_t jobsCount,
+                  JobCounter *counter) {
+    if (jobsRunInline()) {
+        runJobs(jobs, jobsCount, counter);
+        return;
+    }
+
+    if (counter) {
+        SDL_AtomicAdd(&counter->count, (int)jobsCount);
+    }
+
+    SDL_AtomicLock(&dependency->lock);
+    if (SDL_AtomicGet(&dependency->count) > 0) {
+        JobBatch *batch =
+            malloc(sizeof(*batch) + jobsCount * sizeof(*batch->jobs));
+        if (!batch) {
+            THROW_ERROR("failed to allocate job batch!\n");
+        }
+
+        batch->next = dependency->waiting;
+        batch->counter = counter;
+        batch->jobsCount = jobsCount;
+        memcpy(batch->jobs, jobs, jobsCount * sizeof(*jobs));
+        dependency->waiting = batch;
+
+        SDL_AtomicUnlock(&dependency->lock);
+        return;
+    }
+    SDL_AtomicUnlock(&dependency->lock);
+
+    pushJobs(jobs, jobsCount, counter);
+}
+
+// Helps with any job, not only the counter's own, so waiting inside a job
+// cannot deadlock the pool. With nothing left to take it naps on the same
+// semaphore as the workers, as the counter's jobs are running elsewhere.
+void waitForJobs(JobCounter *counter) {
+    if (jobsRunInline()) {
+        return;
+    }
+
+    uint32_t self = threadSlot - 1;
+
+    while (SDL_AtomicGet(&counter->count) != 0) {
+        if (runOneJob(self)) {
+            continue;
+        }
+
+        SDL_AtomicAdd(&jobSystem.sleepers, 1);
+        if (!anyJobs() && SDL_AtomicGet(&counter->count) != 0) {
+            SDL_SemWaitTimeout(jobSystem.wake, 1);
+        }
+        SDL_AtomicAdd(&jobSystem.sleepers, -1);
+    }
+}
+
+typedef struct JobRange {
+    ParallelForFunction function;
+    void *data;
+    uint32_t first;
+    uint32_t last;
+} JobRange;
+
+static void runRange(void *data) {
+    JobRange *range = data;
+    range->function(range->data, range->first, range->last);
+}
+
+void parallelFor(uint32_t count, uint32_t grain, ParallelForFunction function,
+                 void *data) {
+    grain = grain ? grain : 1;
+    uint32_t rangesCount = (uint32_t)(((uint64_t)count + grain - 1) / grain);
+    uint32_t most = jobSystem.queuesCount * JOB_RANGES_PER_THREAD;
+    rangesCount = rangesCount < most ? rangesCount : most;
+
+    if (rangesCount <= 1) {
+        if (count) {
+            function(data, 0, count);
+        }
+        return;
+    }
+
+    JobRange *ranges = malloc(rangesCount * sizeof(*ranges));
+    Job *jobs = malloc(rangesCount * sizeof(*jobs));
+    if (!ranges || !jobs) {
+        THROW_ERROR("failed to allocate parallel for!\n");
+    }
+
+    for (uint32_t i = 0; i < rangesCount; i++) {
+        ranges[i] = (JobRange){
+            .function = function,
+            .data = data,
+            .first = (uint32_t)((uint64_t)count * i / rangesCount),
+            .last = (uint32_t)((uint64_t)count * (i + 1) / rangesCount),
+        };
+        jobs[i] = (Job){.function = runRange, .data = &ranges[i]};
+    }
+
+    JobCounter counter = {0};
+    runJobs(jobs, rangesCount, &counter);
+    waitForJobs(&counter);
+
+    free(ranges);
+    free(jobs);
+}
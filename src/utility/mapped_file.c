@@ -0,0 +1,98 @@
+// mmap and posix_madvise are hidden by a strict -std=c18
+#define _POSIX_C_SOURCE 200809L
+
+#include "utility/mapped_file.h"
+#include <stddef.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+bool mapFile(const char *fileName, MappedFileAccess access,
+             MappedFile *file) {
+    *file = (MappedFile){0};
+
+    DWORD flags = access == MAPPED_FILE_SEQUENTIAL ? FILE_FLAG_SEQUENTIAL_SCAN
+                                                   : FILE_FLAG_RANDOM_ACCESS;
+    HANDLE handle = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, NULL,
+                                OPEN_EXISTING, flags, NULL);
+    if (handle == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(handle, &size) || size.QuadPart == 0) {
+        CloseHandle(handle);
+        return false;
+    }
+
+    HANDLE mapping =
+        CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(handle);
+    if (!mapping) {
+        return false;
+    }
+
+    file->data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!file->data) {
+        CloseHandle(mapping);
+        return false;
+    }
+
+    file->size = (size_t)size.QuadPart;
+    file->mapping = mapping;
+    return true;
+}
+
+void unmapFile(MappedFile *file) {
+    UnmapViewOfFile(file->data);
+    CloseHandle(file->mapping);
+    *file = (MappedFile){0};
+}
+#else
+bool mapFile(const char *fileName, MappedFileAccess access,
+             MappedFile *file) {
+    *file = (MappedFile){0};
+
+    int fd = open(fileName, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        close(fd);
+        return false;
+    }
+
+    void *data = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping holds its own reference to the file
+    close(fd);
+    if (data == MAP_FAILED) {
+        return false;
+    }
+
+    if (access == MAPPED_FILE_SEQUENTIAL) {
+        // parsed front to back, read ahead as far as the kernel will go
+        posix_madvise(data, info.st_size, POSIX_MADV_SEQUENTIAL);
+        posix_madvise(data, info.st_size, POSIX_MADV_WILLNEED);
+    } else {
+        posix_madvise(data, info.st_size, POSIX_MADV_RANDOM);
+    }
+
+    file->data = data;
+    file->size = info.st_size;
+    return true;
+}
+
+void unmapFile(MappedFile *file) {
+    munmap((void *)file->data, file->size);
+    *file = (MappedFile){0};
+}
+#endif
@@ -9,12 +9,16 @@
 #include <string.h>
 #include <vulkan/vulkan.h>
 
-static const uint32_t MAX_FAMILY = 1000;
-
 static const char *deviceExtensions[] = {
     VK_KHR_SWAPCHAIN_EXTENSION_NAME,
 };
 
+// enabled on top of the required ones when the texture table can be used
+static const char *bindlessExtensions[] = {
+    VK_KHR_MAINTENANCE3_EXTENSION_NAME,
+    VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME,
+};
+
 static inline bool isComplete(QueueFamilyIndices queueFamilyIndices) {
     return queueFamilyIndices.graphicsFamily != MAX_FAMILY &&
            queueFamilyIndices.presentFamily != MAX_FAMILY;
@@ -25,6 +29,7 @@ QueueFamilyIndices findQueueFamilies(VkPhysicalDevice device,
     QueueFamilyIndices queueFamilyIndices = {
         .graphicsFamily = MAX_FAMILY,
         .presentFamily = MAX_FAMILY,
+        .transferFamily = MAX_FAMILY,
     };
 
     uint32_t queueFamilyCount = 0;
@@ -55,6 +60,21 @@ QueueFamilyIndices findQueueFamilies(VkPhysicalDevice device,
         i++;
     }
 
+    // a dedicated dma engine if there is one, a compute family otherwise
+    bool transferOnly = false;
+    for (uint32_t j = 0; j < queueFamilyCount; j++) {
+        VkQueueFlags flags = queueFamilies[j].queueFlags;
+        if (!(flags & VK_QUEUE_TRANSFER_BIT) ||
+            (flags & VK_QUEUE_GRAPHICS_BIT)) {
+            continue;
+        }
+        if (queueFamilyIndices.transferFamily == MAX_FAMILY ||
+            (!transferOnly && !(flags & VK_QUEUE_COMPUTE_BIT))) {
+            queueFamilyIndices.transferFamily = j;
+            transferOnly = !(flags & VK_QUEUE_COMPUTE_BIT);
+        }
+    }
+
     return queueFamilyIndices;
 }
 
@@ -92,6 +112,89 @@ static bool checkDeviceExtensionSupport(VkPhysicalDevice device) {
     return empty;
 }
 
+static bool hasDeviceExtension(VkPhysicalDevice device, const char *name) {
+    uint32_t extensionCount;
+    vkEnumerateDeviceExtensionProperties(device, NULL, &extensionCount, NULL);
+
+    VkExtensionProperties availableExtensions[extensionCount];
+    vkEnumerateDeviceExtensionProperties(device, NULL, &extensionCount,
+                                         availableExtensions);
+
+    for (uint32_t i = 0; i < extensionCount; i++) {
+        if (strcmp(availableExtensions[i].extensionName, name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// how much of each heap the process may use, queried with a 1.1 entry point
+static bool supportsMemoryBudget(VkPhysicalDevice device) {
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(device, &properties);
+    return properties.apiVersion >= VK_API_VERSION_1_1 &&
+           hasDeviceExtension(device, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+}
+
+// signalled with increasing values, so uploads are waited on by number
+static bool supportsTimelineSemaphore(VkPhysicalDevice device) {
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(device, &properties);
+    if (properties.apiVersion < VK_API_VERSION_1_1 ||
+        !hasDeviceExtension(device, VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME)) {
+        return false;
+    }
+
+    VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timeline = {
+        .sType =
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR,
+    };
+    VkPhysicalDeviceFeatures2 features = {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+        .pNext = &timeline,
+    };
+    vkGetPhysicalDeviceFeatures2(device, &features);
+
+    return timeline.timelineSemaphore;
+}
+
+// A partially bound, update after bind array of every texture, indexed with
+// a push constant. Features2 is only queried on a 1.1 device, older ones
+// keep a descriptor set per shape.
+static bool supportsBindless(VkPhysicalDevice device) {
+#ifdef TEXTURE_TABLE_DISABLED
+    (void)device;
+    return false;
+#else
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(device, &properties);
+    if (properties.apiVersion < VK_API_VERSION_1_1) {
+        return false;
+    }
+    for (uint32_t i = 0; i < SIZEOF(bindlessExtensions); i++) {
+        if (!hasDeviceExtension(device, bindlessExtensions[i])) {
+            return false;
+        }
+    }
+
+    VkPhysicalDeviceDescriptorIndexingFeaturesEXT indexing = {
+        .sType =
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT,
+    };
+    VkPhysicalDeviceFeatures2 features = {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+        .pNext = &indexing,
+    };
+    vkGetPhysicalDeviceFeatures2(device, &features);
+
+    return features.features.shaderSampledImageArrayDynamicIndexing &&
+           indexing.runtimeDescriptorArray &&
+           indexing.descriptorBindingPartiallyBound &&
+           indexing.descriptorBindingSampledImageUpdateAfterBind &&
+           indexing.descriptorBindingUpdateUnusedWhilePending;
+#endif
+}
+
 static inline bool isDeviceSuitable(VkPhysicalDevice device,
                                     VkSurfaceKHR surface) {
     QueueFamilyIndices queueFamilyIndices = findQueueFamilies(device, surface);
@@ -175,14 +278,35 @@ void createLogicalDevice(Vulkan *vulkan) {
     QueueFamilyIndices queueFamilyIndices = findQueueFamilies(
         vulkan->device.physicalDevice, vulkan->window.surface);
 
-    uint32_t uniqueQueueFamilies[] = {
+    // the transfer family is only worth a queue when uploads to it can be
+    // waited on by value
+    bool transfer =
+        queueFamilyIndices.transferFamily != MAX_FAMILY &&
+        supportsTimelineSemaphore(vulkan->device.physicalDevice);
+
+    uint32_t families[] = {
         queueFamilyIndices.graphicsFamily,
         queueFamilyIndices.presentFamily,
+        queueFamilyIndices.transferFamily,
     };
+    uint32_t familiesCount = transfer ? 3 : 2;
+
+    // a family may only be named once
+    uint32_t uniqueQueueFamilies[SIZEOF(families)];
+    uint32_t uniqueCount = 0;
+    for (uint32_t i = 0; i < familiesCount; i++) {
+        bool seen = false;
+        for (uint32_t j = 0; j < uniqueCount; j++) {
+            seen |= uniqueQueueFamilies[j] == families[i];
+        }
+        if (!seen) {
+            uniqueQueueFamilies[uniqueCount++] = families[i];
+        }
+    }
     VkDeviceQueueCreateInfo queueCreateInfos[SIZEOF(uniqueQueueFamilies)];
 
     float queuePriority = 1.0f;
-    for (uint32_t i = 0; i < SIZEOF(uniqueQueueFamilies); i++) {
+    for (uint32_t i = 0; i < uniqueCount; i++) {
         VkDeviceQueueCreateInfo queueCreateInfo = {
             .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
             .queueFamilyIndex = uniqueQueueFamilies[i],
@@ -192,18 +316,89 @@ void createLogicalDevice(Vulkan *vulkan) {
         queueCreateInfos[i] = queueCreateInfo;
     }
 
+    VkPhysicalDeviceFeatures supportedFeatures;
+    vkGetPhysicalDeviceFeatures(vulkan->device.physicalDevice,
+                                &supportedFeatures);
+    vulkan->device.multiDrawIndirect = supportedFeatures.multiDrawIndirect;
+    vulkan->device.bindless = supportsBindless(vulkan->device.physicalDevice);
+    vulkan->device.memoryBudget =
+        supportsMemoryBudget(vulkan->device.physicalDevice);
+
+    // core from 1.1, VK_KHR_maintenance2 before it
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(vulkan->device.physicalDevice, &properties);
+    bool maintenance2 =
+        properties.apiVersion < VK_API_VERSION_1_1 &&
+        hasDeviceExtension(vulkan->device.physicalDevice,
+                           VK_KHR_MAINTENANCE2_EXTENSION_NAME);
+    vulkan->device.extendedUsage =
+        properties.apiVersion >= VK_API_VERSION_1_1 || maintenance2;
+
     VkPhysicalDeviceFeatures deviceFeatures = {
         .samplerAnisotropy = VK_TRUE,
         .sampleRateShading = VK_TRUE,
         .fillModeNonSolid = VK_TRUE,
+        .multiDrawIndirect = supportedFeatures.multiDrawIndirect,
+        // block compressed ktx2 textures, decoded on the cpu without them
+        .textureCompressionBC = supportedFeatures.textureCompressionBC,
+        .textureCompressionASTC_LDR =
+            supportedFeatures.textureCompressionASTC_LDR,
+        .shaderSampledImageArrayDynamicIndexing = vulkan->device.bindless,
+    };
+
+    VkPhysicalDeviceDescriptorIndexingFeaturesEXT indexingFeatures = {
+        .sType =
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT,
+        .runtimeDescriptorArray = VK_TRUE,
+        .descriptorBindingPartiallyBound = VK_TRUE,
+        .descriptorBindingSampledImageUpdateAfterBind = VK_TRUE,
+        .descriptorBindingUpdateUnusedWhilePending = VK_TRUE,
     };
 
+    VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timelineFeatures = {
+        .sType =
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR,
+        .timelineSemaphore = VK_TRUE,
+    };
+
+    void *features = NULL;
+    if (vulkan->device.bindless) {
+        indexingFeatures.pNext = features;
+        features = &indexingFeatures;
+    }
+    if (transfer) {
+        timelineFeatures.pNext = features;
+        features = &timelineFeatures;
+    }
+
+    const char *extensions[SIZEOF(deviceExtensions) +
+                           SIZEOF(bindlessExtensions) + 3];
+    uint32_t extensionCount = 0;
+    for (uint32_t i = 0; i < SIZEOF(deviceExtensions); i++) {
+        extensions[extensionCount++] = deviceExtensions[i];
+    }
+    if (vulkan->device.bindless) {
+        for (uint32_t i = 0; i < SIZEOF(bindlessExtensions); i++) {
+            extensions[extensionCount++] = bindlessExtensions[i];
+        }
+    }
+    if (vulkan->device.memoryBudget) {
+        extensions[extensionCount++] = VK_EXT_MEMORY_BUDGET_EXTENSION_NAME;
+    }
+    if (maintenance2) {
+        extensions[extensionCount++] = VK_KHR_MAINTENANCE2_EXTENSION_NAME;
+    }
+    if (transfer) {
+        extensions[extensionCount++] = VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME;
+    }
+
     VkDeviceCreateInfo createInfo = {
         .sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
-        .queueCreateInfoCount = SIZEOF(queueCreateInfos),
+        .pNext = features,
+        .queueCreateInfoCount = uniqueCount,
         .pQueueCreateInfos = queueCreateInfos,
-        .enabledExtensionCount = SIZEOF(deviceExtensions),
-        .ppEnabledExtensionNames = deviceExtensions,
+        .enabledExtensionCount = extensionCount,
+        .ppEnabledExtensionNames = extensions,
         .pEnabledFeatures = &deviceFeatures,
     };
 
@@ -223,4 +418,11 @@ void createLogicalDevice(Vulkan *vulkan) {
                      0, &vulkan->device.graphicsQueue);
     vkGetDeviceQueue(vulkan->device.device, queueFamilyIndices.presentFamily, 0,
                      &vulkan->device.presentQueue);
+
+    vulkan->device.transferQueue = VK_NULL_HANDLE;
+    if (transfer) {
+        vkGetDeviceQueue(vulkan->device.device,
+                         queueFamilyIndices.transferFamily, 0,
+                         &vulkan->device.transferQueue);
+    }
 }
@@ -0,0 +1,409 @@
+#include "vulkan_handle/mipmap.h"
+#include "geometry/geometry.h"
+#include "shaders/mip/mip_comp_shader.h"
+#include "utility/error_handle.h"
+#include "vulkan_handle/device.h"
+#include "vulkan_handle/memory.h"
+#include "vulkan_handle/texture.h"
+#include "vulkan_handle/vulkan_handle.h"
+#include <string.h>
+#include <vulkan/vulkan.h>
+
+// the shader's push constants
+typedef struct MipConstants {
+    int32_t size[2];
+    uint32_t mips;
+    uint32_t workGroups;
+    uint32_t srgb;
+} MipConstants;
+
+// the tile of level 0 each group reduces
+#define MIP_TILE_SIZE 64
+
+static bool canDispatch(Vulkan *vulkan) {
+    QueueFamilyIndices queueFamilyIndices = findQueueFamilies(
+        vulkan->device.physicalDevice, vulkan->window.surface);
+
+    uint32_t queueFamilyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(vulkan->device.physicalDevice,
+                                             &queueFamilyCount, NULL);
+    VkQueueFamilyProperties queueFamilies[queueFamilyCount];
+    vkGetPhysicalDeviceQueueFamilyProperties(vulkan->device.physicalDevice,
+                                             &queueFamilyCount, queueFamilies);
+
+    return queueFamilies[queueFamilyIndices.graphicsFamily].queueFlags &
+           VK_QUEUE_COMPUTE_BIT;
+}
+
+static void createMipPipeline(Vulkan *vulkan, MipGenerator *generator) {
+    VkDescriptorSetLayoutBinding bindings[] = {
+        {
+            .binding = 0,
+            .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+            .descriptorCount = MIP_COMPUTE_MAX_LEVELS + 1,
+            .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+        },
+        {
+            .binding = 1,
+            .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+            .descriptorCount = 1,
+            .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+        },
+    };
+
+    VkDescriptorSetLayoutCreateInfo layoutInfo = {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+        .bindingCount = SIZEOF(bindings),
+        .pBindings = bindings,
+    };
+
+    if (vkCreateDescriptorSetLayout(vulkan->device.device, &layoutInfo, NULL,
+                                    &generator->descriptorSetLayout) !=
+        VK_SUCCESS) {
+        THROW_ERROR("failed to create mip descriptor set layout!\n");
+    }
+
+    VkPushConstantRange pushConstantRange = {
+        .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+        .size = sizeof(MipConstants),
+    };
+
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo = {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+        .setLayoutCount = 1,
+        .pSetLayouts = &generator->descriptorSetLayout,
+        .pushConstantRangeCount = 1,
+        .pPushConstantRanges = &pushConstantRange,
+    };
+
+    if (vkCreatePipelineLayout(vulkan->device.device, &pipelineLayoutInfo,
+                               NULL,
+                               &generator->pipelineLayout) != VK_SUCCESS) {
+        THROW_ERROR("failed to create mip pipeline layout!\n");
+    }
+
+    VkShaderModuleCreateInfo moduleInfo = {
+        .sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+        .codeSize = SRC_SHADERS_MIP_COMP_SPV_LEN,
+        .pCode = (uint32_t *)SRC_SHADERS_MIP_COMP_SPV,
+    };
+
+    VkShaderModule shaderModule;
+    if (vkCreateShaderModule(vulkan->device.device, &moduleInfo, NULL,
+                             &shaderModule) != VK_SUCCESS) {
+        THROW_ERROR("failed to create shader module!\n");
+    }
+
+    VkComputePipelineCreateInfo pipelineInfo = {
+        .sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+        .stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+        .stage.stage = VK_SHADER_STAGE_COMPUTE_BIT,
+        .stage.module = shaderModule,
+        .stage.pName = "main",
+        .layout = generator->pipelineLayout,
+    };
+
+    if (vkCreateComputePipelines(vulkan->device.device, VK_NULL_HANDLE, 1,
+                                 &pipelineInfo, NULL,
+                                 &generator->pipeline) != VK_SUCCESS) {
+        THROW_ERROR("failed to create mip pipeline!\n");
+    }
+
+    vkDestroyShaderModule(vulkan->device.device, shaderModule, NULL);
+}
+
+// The pipeline, and the pool and counters every dispatch of a submission
+// takes its own descriptor set and slot from. Left empty when the graphics
+// queue can't dispatch, the blit chain or the cpu generate the mips then.
+void createMipGenerator(Vulkan *vulkan) {
+    MipGenerator *generator = &vulkan->mipGenerator;
+    *generator = (MipGenerator){0};
+
+    if (!canDispatch(vulkan)) {
+        return;
+    }
+
+    createMipPipeline(vulkan, generator);
+
+    VkDescriptorPoolSize poolSizes[] = {
+        {
+            .type = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+            .descriptorCount =
+                MIP_COMPUTE_MAX_DISPATCHES * (MIP_COMPUTE_MAX_LEVELS + 1),
+        },
+        {
+            .type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+            .descriptorCount = MIP_COMPUTE_MAX_DISPATCHES,
+        },
+    };
+
+    VkDescriptorPoolCreateInfo poolInfo = {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+        .poolSizeCount = SIZEOF(poolSizes),
+        .pPoolSizes = poolSizes,
+        .maxSets = MIP_COMPUTE_MAX_DISPATCHES,
+    };
+
+    if (vkCreateDescriptorPool(vulkan->device.device, &poolInfo, NULL,
+                               &generator->descriptorPool) != VK_SUCCESS) {
+        THROW_ERROR("failed to create descriptor pool!\n");
+    }
+
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(vulkan->device.physicalDevice, &properties);
+    generator->counterStride =
+        properties.limits.minStorageBufferOffsetAlignment;
+    if (generator->counterStride < sizeof(uint32_t)) {
+        generator->counterStride = sizeof(uint32_t);
+    }
+
+    createBuffer(generator->counterStride * MIP_COMPUTE_MAX_DISPATCHES,
+                 VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+                     VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                 VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, vulkan,
+                 &generator->counterBuffer, &generator->counterBufferMemory);
+}
+
+void destroyMipGenerator(Vulkan *vulkan) {
+    MipGenerator *generator = &vulkan->mipGenerator;
+    if (!generator->pipeline) {
+        return;
+    }
+
+    releaseMipScratch(vulkan);
+
+    vkDestroyBuffer(vulkan->device.device, generator->counterBuffer, NULL);
+    vkFreeMemory(vulkan->device.device, generator->counterBufferMemory, NULL);
+    vkDestroyDescriptorPool(vulkan->device.device, generator->descriptorPool,
+                            NULL);
+    vkDestroyPipeline(vulkan->device.device, generator->pipeline, NULL);
+    vkDestroyPipelineLayout(vulkan->device.device, generator->pipelineLayout,
+                            NULL);
+    vkDestroyDescriptorSetLayout(vulkan->device.device,
+                                 generator->descriptorSetLayout, NULL);
+
+    *generator = (MipGenerator){0};
+}
+
+// Compute for rgba8 textures small enough for one dispatch, written through
+// unorm views since srgb is rarely a storage format, then the blit chain,
+// then the cpu for whatever rgba8 is left. An srgb image can only be given
+// the storage usage its views need with extended usage, without it srgb
+// goes to the blit chain. Safe to call from any thread.
+MipGeneration chooseMipGeneration(Vulkan *vulkan, VkFormat format,
+                                  uint32_t width, uint32_t height) {
+    bool rgba8 = format == VK_FORMAT_R8G8B8A8_SRGB ||
+                 format == VK_FORMAT_R8G8B8A8_UNORM;
+    bool storable = format == VK_FORMAT_R8G8B8A8_UNORM ||
+                    (rgba8 && vulkan->device.extendedUsage);
+
+    VkFormatProperties storageProperties;
+    vkGetPhysicalDeviceFormatProperties(vulkan->device.physicalDevice,
+                                        VK_FORMAT_R8G8B8A8_UNORM,
+                                        &storageProperties);
+    if (storable && vulkan->mipGenerator.pipeline &&
+        width <= MIP_COMPUTE_MAX_SIZE && height <= MIP_COMPUTE_MAX_SIZE &&
+        storageProperties.optimalTilingFeatures &
+            VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT) {
+        return MIP_GENERATION_COMPUTE;
+    }
+
+    VkFormatProperties properties;
+    vkGetPhysicalDeviceFormatProperties(vulkan->device.physicalDevice, format,
+                                        &properties);
+    VkFormatFeatureFlags blit =
+        VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT |
+        VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT;
+    if ((properties.optimalTilingFeatures & blit) == blit) {
+        return MIP_GENERATION_BLIT;
+    }
+
+    return rgba8 ? MIP_GENERATION_CPU : MIP_GENERATION_NONE;
+}
+
+static VkImageView createLevelView(Vulkan *vulkan, VkImage image,
+                                   uint32_t level) {
+    VkImageViewCreateInfo viewInfo = {
+        .sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+        .image = image,
+        .viewType = VK_IMAGE_VIEW_TYPE_2D,
+        .format = VK_FORMAT_R8G8B8A8_UNORM,
+        .subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+        .subresourceRange.baseMipLevel = level,
+        .subresourceRange.levelCount = 1,
+        .subresourceRange.baseArrayLayer = 0,
+        .subresourceRange.layerCount = 1,
+    };
+
+    VkImageView imageView;
+    if (vkCreateImageView(vulkan->device.device, &viewInfo, NULL,
+                          &imageView) != VK_SUCCESS) {
+        THROW_ERROR("failed to create mip level view!\n");
+    }
+
+    return imageView;
+}
+
+// A view per level and a descriptor set pointing at them, the bindings past
+// the texture's last level repeat it so every one the shader names is valid.
+static VkDescriptorSet writeMipDescriptorSet(Vulkan *vulkan, uint32_t slot,
+                                             const Texture *texture) {
+    MipGenerator *generator = &vulkan->mipGenerator;
+    VkImageView *views = generator->views[slot];
+    for (uint32_t i = 0; i < texture->mipLevels; i++) {
+        views[i] = createLevelView(vulkan, texture->textureImage, i);
+    }
+
+    VkDescriptorSetAllocateInfo allocInfo = {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+        .descriptorPool = generator->descriptorPool,
+        .descriptorSetCount = 1,
+        .pSetLayouts = &generator->descriptorSetLayout,
+    };
+
+    VkDescriptorSet descriptorSet;
+    if (vkAllocateDescriptorSets(vulkan->device.device, &allocInfo,
+                                 &descriptorSet) != VK_SUCCESS) {
+        THROW_ERROR("failed to allocate mip descriptor set!\n");
+    }
+
+    VkDescriptorImageInfo imageInfos[MIP_COMPUTE_MAX_LEVELS + 1];
+    for (uint32_t i = 0; i < SIZEOF(imageInfos); i++) {
+        uint32_t level =
+            i < texture->mipLevels ? i : texture->mipLevels - 1;
+        imageInfos[i] = (VkDescriptorImageInfo){
+            .imageView = views[level],
+            .imageLayout = VK_IMAGE_LAYOUT_GENERAL,
+        };
+    }
+
+    VkDescriptorBufferInfo counterInfo = {
+        .buffer = generator->counterBuffer,
+        .offset = slot * generator->counterStride,
+        .range = sizeof(uint32_t),
+    };
+
+    VkWriteDescriptorSet descriptorWrites[] = {
+        {
+            .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+            .dstSet = descriptorSet,
+            .dstBinding = 0,
+            .descriptorCount = SIZEOF(imageInfos),
+            .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+            .pImageInfo = imageInfos,
+        },
+        {
+            .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+            .dstSet = descriptorSet,
+            .dstBinding = 1,
+            .descriptorCount = 1,
+            .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+            .pBufferInfo = &counterInfo,
+        },
+    };
+
+    vkUpdateDescriptorSets(vulkan->device.device, SIZEOF(descriptorWrites),
+                           descriptorWrites, 0, NULL);
+
+    return descriptorSet;
+}
+
+// Every level below the first in one dispatch and two barriers, rather than
+// a blit and two barriers per level. Level 0 must be in the transfer layout
+// with its copy recorded, the image is left ready to sample.
+void recordMipGeneration(Vulkan *vulkan, VkCommandBuffer commandBuffer,
+                         const Texture *texture, uint32_t width,
+                         uint32_t height) {
+    MipGenerator *generator = &vulkan->mipGenerator;
+    if (generator->dispatchesCount == MIP_COMPUTE_MAX_DISPATCHES) {
+        THROW_ERROR("too many mip dispatches in one submission!\n");
+    }
+    uint32_t slot = generator->dispatchesCount++;
+
+    VkDescriptorSet descriptorSet =
+        writeMipDescriptorSet(vulkan, slot, texture);
+
+    // the group that finishes last finds it from a count starting at zero
+    vkCmdFillBuffer(commandBuffer, generator->counterBuffer,
+                    slot * generator->counterStride, sizeof(uint32_t), 0);
+
+    VkBufferMemoryBarrier counterBarrier = {
+        .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+        .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .buffer = generator->counterBuffer,
+        .offset = slot * generator->counterStride,
+        .size = sizeof(uint32_t),
+    };
+
+    VkImageMemoryBarrier barrier = {
+        .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+        .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .image = texture->textureImage,
+        .subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+        .subresourceRange.baseMipLevel = 0,
+        .subresourceRange.levelCount = texture->mipLevels,
+        .subresourceRange.baseArrayLayer = 0,
+        .subresourceRange.layerCount = 1,
+    };
+
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, NULL, 1,
+                         &counterBarrier, 1, &barrier);
+
+    uint32_t groupsX = (width + MIP_TILE_SIZE - 1) / MIP_TILE_SIZE;
+    uint32_t groupsY = (height + MIP_TILE_SIZE - 1) / MIP_TILE_SIZE;
+    MipConstants constants = {
+        .size = {(int32_t)width, (int32_t)height},
+        .mips = texture->mipLevels - 1,
+        .workGroups = groupsX * groupsY,
+        .srgb = texture->format == VK_FORMAT_R8G8B8A8_SRGB,
+    };
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+                      generator->pipeline);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+                            generator->pipelineLayout, 0, 1, &descriptorSet,
+                            0, NULL);
+    vkCmdPushConstants(commandBuffer, generator->pipelineLayout,
+                       VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(constants),
+                       &constants);
+    vkCmdDispatch(commandBuffer, groupsX, groupsY, 1);
+
+    barrier.oldLayout = VK_IMAGE_LAYOUT_GENERAL;
+    barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                         VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, NULL, 0,
+                         NULL, 1, &barrier);
+}
+
+// once the submission the dispatches were recorded into has finished
+void releaseMipScratch(Vulkan *vulkan) {
+    MipGenerator *generator = &vulkan->mipGenerator;
+    if (!generator->dispatchesCount) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < generator->dispatchesCount; i++) {
+        for (uint32_t j = 0; j < SIZEOF(generator->views[i]); j++) {
+            if (generator->views[i][j]) {
+                vkDestroyImageView(vulkan->device.device,
+                                   generator->views[i][j], NULL);
+            }
+        }
+    }
+    memset(generator->views, 0, sizeof(generator->views));
+
+    vkResetDescriptorPool(vulkan->device.device, generator->descriptorPool, 0);
+    generator->dispatchesCount = 0;
+}
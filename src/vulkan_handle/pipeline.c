@@ -3,6 +3,7 @@
 #include "geometry/geometry.h"
 #include "shaders/shader.h"
 #include "vulkan_handle/memory.h"
+#include "vulkan_handle/texture_table.h"
 #include "vulkan_handle/vulkan_handle.h"
 #include <vulkan/vulkan.h>
 
@@ -32,18 +33,35 @@ createPipelineShaderInfo(VkShaderStageFlagBits stage, VkShaderModule module) {
     return shaderInfo;
 }
 
-void createGraphicsPipeline(Vulkan *vulkan,
-                            VkDescriptorSetLayout *descriptorSetLayout,
-                            GraphicsPipeline *graphicsPipeline) {
+// the depth only variant binds just the position stream, writes no colour and
+// runs without a fragment shader
+static void createPipeline(Vulkan *vulkan, GraphicsPipeline *graphicsPipeline,
+                           bool depthOnly, VkPipeline *pipeline) {
 
     VkShaderModule vertShaderModule;
-    createShaderModule(SRC_SHADERS_LIGHT_TEXTURE_VERT_SPV,
-                       SRC_SHADERS_LIGHT_TEXTURE_VERT_SPV_LEN,
-                       vulkan->device.device, &vertShaderModule);
-    VkShaderModule fragShaderModule;
-    createShaderModule(SRC_SHADERS_LIGHT_TEXTURE_FRAG_SPV,
-                       SRC_SHADERS_LIGHT_TEXTURE_FRAG_SPV_LEN,
-                       vulkan->device.device, &fragShaderModule);
+    if (depthOnly) {
+        createShaderModule(SRC_SHADERS_DEPTH_VERT_SPV,
+                           SRC_SHADERS_DEPTH_VERT_SPV_LEN,
+                           vulkan->device.device, &vertShaderModule);
+    } else if (graphicsPipeline->vertexFormat == VERTEX_FORMAT_PACKED) {
+        createShaderModule(SRC_SHADERS_LIGHT_TEXTURE_PACKED_VERT_SPV,
+                           SRC_SHADERS_LIGHT_TEXTURE_PACKED_VERT_SPV_LEN,
+                           vulkan->device.device, &vertShaderModule);
+    } else {
+        createShaderModule(SRC_SHADERS_LIGHT_TEXTURE_VERT_SPV,
+                           SRC_SHADERS_LIGHT_TEXTURE_VERT_SPV_LEN,
+                           vulkan->device.device, &vertShaderModule);
+    }
+    VkShaderModule fragShaderModule = VK_NULL_HANDLE;
+    if (!depthOnly && vulkan->device.bindless) {
+        createShaderModule(SRC_SHADERS_LIGHT_TEXTURE_BINDLESS_FRAG_SPV,
+                           SRC_SHADERS_LIGHT_TEXTURE_BINDLESS_FRAG_SPV_LEN,
+                           vulkan->device.device, &fragShaderModule);
+    } else if (!depthOnly) {
+        createShaderModule(SRC_SHADERS_LIGHT_TEXTURE_FRAG_SPV,
+                           SRC_SHADERS_LIGHT_TEXTURE_FRAG_SPV_LEN,
+                           vulkan->device.device, &fragShaderModule);
+    }
 
     VkPipelineShaderStageCreateInfo shaderStages[] = {
         createPipelineShaderInfo(VK_SHADER_STAGE_VERTEX_BIT, vertShaderModule),
@@ -51,23 +69,24 @@ void createGraphicsPipeline(Vulkan *vulkan,
                                  fragShaderModule),
     };
 
-    VkVertexInputBindingDescription bindingDescription =
-        getBindingDescription();
+    uint32_t bindingCount, attributeCount;
+    VkVertexInputBindingDescription *bindingDescriptions =
+        getBindingDescriptions(graphicsPipeline, depthOnly, &bindingCount);
     VkVertexInputAttributeDescription *attributeDescriptions =
-        getAttributeDescriptions();
+        getAttributeDescriptions(graphicsPipeline, depthOnly, &attributeCount);
 
     VkPipelineVertexInputStateCreateInfo vertexInputInfo = {
         .sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
-        .vertexBindingDescriptionCount = 1,
-        .vertexAttributeDescriptionCount = 4,
-        .pVertexBindingDescriptions = &bindingDescription,
+        .vertexBindingDescriptionCount = bindingCount,
+        .vertexAttributeDescriptionCount = attributeCount,
+        .pVertexBindingDescriptions = bindingDescriptions,
         .pVertexAttributeDescriptions = attributeDescriptions,
     };
 
     VkPipelineInputAssemblyStateCreateInfo inputAssembly = {
         .sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO,
         .topology = graphicsPipeline->topology,
-        .primitiveRestartEnable = VK_FALSE,
+        .primitiveRestartEnable = graphicsPipeline->primitiveRestart,
     };
 
     VkViewport viewport = {
@@ -115,19 +134,25 @@ void createGraphicsPipeline(Vulkan *vulkan,
         .alphaToOneEnable = VK_FALSE,      // Optional
     };
 
+    // after a prepass the colour pass only shades the surviving fragments
+    bool depthLaidDown = graphicsPipeline->depthPrepass && !depthOnly;
+
     VkPipelineDepthStencilStateCreateInfo depthStencil = {
         .sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO,
         .depthTestEnable = VK_TRUE,
-        .depthWriteEnable = VK_TRUE,
-        .depthCompareOp = VK_COMPARE_OP_LESS,
+        .depthWriteEnable = depthLaidDown ? VK_FALSE : VK_TRUE,
+        .depthCompareOp =
+            depthLaidDown ? VK_COMPARE_OP_LESS_OR_EQUAL : VK_COMPARE_OP_LESS,
         .depthBoundsTestEnable = VK_FALSE,
         .stencilTestEnable = VK_FALSE,
     };
 
     VkPipelineColorBlendAttachmentState colorBlendAttachment = {
-        .colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
-                          VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT,
-        .blendEnable = VK_TRUE,
+        .colorWriteMask =
+            depthOnly ? 0
+                      : VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
+                            VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT,
+        .blendEnable = depthOnly ? VK_FALSE : VK_TRUE,
         .srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA,
         .dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA,
         .colorBlendOp = VK_BLEND_OP_ADD,
@@ -145,19 +170,6 @@ void createGraphicsPipeline(Vulkan *vulkan,
         .blendConstants = {0.0f, 0.0f, 0.0f, 0.0f},
     };
 
-    VkPipelineLayoutCreateInfo pipelineLayoutInfo = {
-        .sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
-        .pushConstantRangeCount = 0,
-        .setLayoutCount = 1,
-        .pSetLayouts = descriptorSetLayout,
-    };
-
-    if (vkCreatePipelineLayout(vulkan->device.device, &pipelineLayoutInfo, NULL,
-                               &graphicsPipeline->pipelineLayout) !=
-        VK_SUCCESS) {
-        THROW_ERROR("failed to create pipeline layout!\n");
-    }
-
     VkDynamicState dynamicStates[] = {
         VK_DYNAMIC_STATE_VIEWPORT,
         VK_DYNAMIC_STATE_SCISSOR,
@@ -173,7 +185,7 @@ void createGraphicsPipeline(Vulkan *vulkan,
 
     VkGraphicsPipelineCreateInfo pipelineInfo = {
         .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
-        .stageCount = 2,
+        .stageCount = depthOnly ? 1 : 2,
         .pStages = shaderStages,
         .pVertexInputState = &vertexInputInfo,
         .pInputAssemblyState = &inputAssembly,
@@ -191,14 +203,51 @@ void createGraphicsPipeline(Vulkan *vulkan,
 
     if (vkCreateGraphicsPipelines(
             vulkan->device.device, VK_NULL_HANDLE, 1, &pipelineInfo, NULL,
-            &graphicsPipeline->graphicsPipeline) != VK_SUCCESS) {
+            pipeline) != VK_SUCCESS) {
         THROW_ERROR("failed to create graphics pipeline!\n");
     }
 
-    vkDestroyShaderModule(vulkan->device.device, fragShaderModule, NULL);
+    if (!depthOnly) {
+        vkDestroyShaderModule(vulkan->device.device, fragShaderModule, NULL);
+    }
     vkDestroyShaderModule(vulkan->device.device, vertShaderModule, NULL);
 
-    freeMem(1, attributeDescriptions);
+    freeMem(2, bindingDescriptions, attributeDescriptions);
+}
+
+void createGraphicsPipeline(Vulkan *vulkan,
+                            VkDescriptorSetLayout *descriptorSetLayout,
+                            GraphicsPipeline *graphicsPipeline) {
+    // the texture table's index, identical to its own layout's range so the
+    // table's set stays bound across every shape's pipeline
+    VkPushConstantRange pushConstantRange = {
+        .stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT,
+        .offset = 0,
+        .size = sizeof(TextureTableConstants),
+    };
+
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo = {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+        .pushConstantRangeCount = vulkan->device.bindless ? 1 : 0,
+        .pPushConstantRanges = &pushConstantRange,
+        .setLayoutCount = 1,
+        .pSetLayouts = descriptorSetLayout,
+    };
+
+    if (vkCreatePipelineLayout(vulkan->device.device, &pipelineLayoutInfo, NULL,
+                               &graphicsPipeline->pipelineLayout) !=
+        VK_SUCCESS) {
+        THROW_ERROR("failed to create pipeline layout!\n");
+    }
+
+    createPipeline(vulkan, graphicsPipeline, false,
+                   &graphicsPipeline->graphicsPipeline);
+
+    graphicsPipeline->depthPipeline = VK_NULL_HANDLE;
+    if (graphicsPipeline->depthPrepass) {
+        createPipeline(vulkan, graphicsPipeline, true,
+                       &graphicsPipeline->depthPipeline);
+    }
 }
 
 static inline VkFormat findSupportedFormat(const VkFormat *candidates,
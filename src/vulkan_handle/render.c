@@ -1,7 +1,10 @@
 #include "vulkan_handle/render.h"
 #include "geometry/geometry.h"
+#include "geometry/lod/lod.h"
 #include "utility/error_handle.h"
 #include "vulkan_handle/memory.h"
+#include "vulkan_handle/texture_stream.h"
+#include "vulkan_handle/texture_table.h"
 #include "vulkan_handle/vulkan_handle.h"
 #include "window/window.h"
 #include <SDL_events.h>
@@ -12,8 +15,10 @@ inline void createCommandPool(Vulkan *vulkan) {
     QueueFamilyIndices queueFamilyIndices = findQueueFamilies(
         vulkan->device.physicalDevice, vulkan->window.surface);
 
+    // a frame's buffer is recorded again when a streamed texture moves
     VkCommandPoolCreateInfo poolInfo = {
         .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+        .flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
         .queueFamilyIndex = queueFamilyIndices.graphicsFamily,
     };
 
@@ -23,24 +28,84 @@ inline void createCommandPool(Vulkan *vulkan) {
     }
 }
 
-void createCommandBuffers(Vulkan *vulkan) {
-    vulkan->renderBuffers.commandBuffers =
-        malloc(vulkan->swapchain.swapChainImagesCount *
-               sizeof(*vulkan->renderBuffers.commandBuffers));
+static inline void bindShapeVertexBuffers(VkCommandBuffer commandBuffer,
+                                          Vulkan *vulkan, uint32_t shapeIndex,
+                                          bool positionsOnly) {
+    Shape *shape = &vulkan->shapes[shapeIndex];
 
-    VkCommandBufferAllocateInfo allocInfo = {
-        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
-        .commandPool = vulkan->renderBuffers.commandPool,
-        .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
-        .commandBufferCount = vulkan->swapchain.swapChainImagesCount,
+    VkBuffer vertexBuffers[] = {
+        vulkan->shapeBuffers.vertexBuffer[shapeIndex],
+        vulkan->shapeBuffers.vertexBuffer[shapeIndex],
     };
+    VkDeviceSize offsets[] = {0, shape->attributesOffset};
 
-    if (vkAllocateCommandBuffers(vulkan->device.device, &allocInfo,
-                                 vulkan->renderBuffers.commandBuffers) !=
-        VK_SUCCESS) {
-        THROW_ERROR("failed to allocate command renderBuffers!\n");
+    uint32_t bindingCount =
+        shape->graphicsPipeline.splitStreams && !positionsOnly ? 2 : 1;
+
+    vkCmdBindVertexBuffers(commandBuffer, 0, bindingCount, vertexBuffers,
+                           offsets);
+}
+
+static inline void drawShape(VkCommandBuffer commandBuffer, Vulkan *vulkan,
+                             uint32_t shapeIndex, uint32_t imageIndex) {
+    Shape *shape = &vulkan->shapes[shapeIndex];
+
+    if (!shape->indexed) {
+        vkCmdDraw(commandBuffer, shape->verticesCount, 1, 0, 0);
+        return;
     }
 
+    vkCmdBindIndexBuffer(commandBuffer,
+                         vulkan->shapeBuffers.indexBuffer[shapeIndex], 0,
+                         shape->indexType);
+
+    if (shape->lodCount && vulkan->device.multiDrawIndirect) {
+        vkCmdDrawIndexedIndirect(commandBuffer,
+                                 shape->indirectBuffers[imageIndex], 0,
+                                 shape->drawsCount,
+                                 sizeof(VkDrawIndexedIndirectCommand));
+        return;
+    }
+
+    // without multi draw every command is its own draw
+    if (shape->lodCount) {
+        for (uint32_t i = 0; i < shape->drawsCount; i++) {
+            vkCmdDrawIndexedIndirect(
+                commandBuffer, shape->indirectBuffers[imageIndex],
+                i * sizeof(VkDrawIndexedIndirectCommand), 1,
+                sizeof(VkDrawIndexedIndirectCommand));
+        }
+        return;
+    }
+
+    vkCmdDrawIndexed(commandBuffer, shape->indicesCount, 1, 0, 0, 0);
+}
+
+// a shape's own set, or with a texture table the index of its texture, the
+// table's set being bound once for every shape
+static inline void bindShapeDescriptors(VkCommandBuffer commandBuffer,
+                                        Vulkan *vulkan, uint32_t shapeIndex,
+                                        uint32_t imageIndex) {
+    Shape *shape = &vulkan->shapes[shapeIndex];
+
+    if (vulkan->device.bindless) {
+        TextureTableConstants constants = {
+            .textureIndex = shape->texture.slot,
+        };
+        vkCmdPushConstants(commandBuffer,
+                           shape->graphicsPipeline.pipelineLayout,
+                           VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(constants),
+                           &constants);
+        return;
+    }
+
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                            shape->graphicsPipeline.pipelineLayout, 0, 1,
+                            &shape->descriptorSet.descriptorSets[imageIndex],
+                            0, NULL);
+}
+
+static void recordCommandBuffer(Vulkan *vulkan, uint32_t imageIndex) {
     int width, height;
     SDL_GetWindowSize(vulkan->window.win, &width, &height);
 
@@ -72,68 +137,90 @@ void createCommandBuffers(Vulkan *vulkan) {
         {{{1.0f, 0}}},
     };
 
-    VkDeviceSize offsets[] = {0};
+    VkCommandBuffer commandBuffer =
+        vulkan->renderBuffers.commandBuffers[imageIndex];
 
-    for (uint32_t i = 0; i < vulkan->swapchain.swapChainImagesCount; i++) {
+    if (vkBeginCommandBuffer(commandBuffer, &beginInfo) != VK_SUCCESS) {
+        THROW_ERROR("failed to begin recording command buffer!\n");
+    }
+
+    renderPassInfo.framebuffer =
+        vulkan->renderBuffers.swapChainFramebuffers[imageIndex];
+
+    renderPassInfo.clearValueCount = SIZEOF(clearValues);
+    renderPassInfo.pClearValues = clearValues;
 
-        if (vkBeginCommandBuffer(vulkan->renderBuffers.commandBuffers[i],
-                                 &beginInfo) != VK_SUCCESS) {
-            THROW_ERROR("failed to begin recording command buffer!\n");
+    vkCmdBeginRenderPass(commandBuffer, &renderPassInfo,
+                         VK_SUBPASS_CONTENTS_INLINE);
+
+    vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+
+    vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+
+    if (vulkan->device.bindless) {
+        vkCmdBindDescriptorSets(
+            commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+            vulkan->textureTable.pipelineLayout, 0, 1,
+            &vulkan->textureTable.descriptorSet.descriptorSets[imageIndex], 0,
+            NULL);
+    }
+
+    // lay down depth for the opaque shapes first using positions only
+    for (uint32_t j = 0; j < vulkan->shapeCount; j++) {
+        if (!vulkan->shapes[j].graphicsPipeline.depthPrepass) {
+            continue;
         }
 
-        renderPassInfo.framebuffer =
-            vulkan->renderBuffers.swapChainFramebuffers[i];
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                          vulkan->shapes[j].graphicsPipeline.depthPipeline);
 
-        renderPassInfo.clearValueCount = SIZEOF(clearValues);
-        renderPassInfo.pClearValues = clearValues;
+        if (!vulkan->device.bindless) {
+            bindShapeDescriptors(commandBuffer, vulkan, j, imageIndex);
+        }
 
-        vkCmdBeginRenderPass(vulkan->renderBuffers.commandBuffers[i],
-                             &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+        bindShapeVertexBuffers(commandBuffer, vulkan, j, true);
 
-        vkCmdSetViewport(vulkan->renderBuffers.commandBuffers[i], 0, 1,
-                         &viewport);
+        drawShape(commandBuffer, vulkan, j, imageIndex);
+    }
 
-        vkCmdSetScissor(vulkan->renderBuffers.commandBuffers[i], 0, 1,
-                        &scissor);
+    for (uint32_t j = 0; j < vulkan->shapeCount; j++) {
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                          vulkan->shapes[j].graphicsPipeline.graphicsPipeline);
 
-        for (uint32_t j = 0; j < vulkan->shapeCount; j++) {
-            vkCmdBindPipeline(
-                vulkan->renderBuffers.commandBuffers[i],
-                VK_PIPELINE_BIND_POINT_GRAPHICS,
-                vulkan->shapes[j].graphicsPipeline.graphicsPipeline);
+        bindShapeDescriptors(commandBuffer, vulkan, j, imageIndex);
 
-            vkCmdBindDescriptorSets(
-                vulkan->renderBuffers.commandBuffers[i],
-                VK_PIPELINE_BIND_POINT_GRAPHICS,
-                vulkan->shapes[j].graphicsPipeline.pipelineLayout, 0, 1,
-                &vulkan->shapes[j].descriptorSet.descriptorSets[i], 0, NULL);
+        bindShapeVertexBuffers(commandBuffer, vulkan, j, false);
 
-            VkBuffer vertexBuffers[] = {
-                vulkan->shapeBuffers.vertexBuffer[j],
-            };
+        drawShape(commandBuffer, vulkan, j, imageIndex);
+    }
 
-            vkCmdBindVertexBuffers(vulkan->renderBuffers.commandBuffers[i], 0,
-                                   1, vertexBuffers, offsets);
+    vkCmdEndRenderPass(commandBuffer);
 
-            vkCmdDraw(vulkan->renderBuffers.commandBuffers[i],
-                      vulkan->shapes[j].verticesCount, 1, 0, 0);
+    if (vkEndCommandBuffer(commandBuffer) != VK_SUCCESS) {
+        THROW_ERROR("failed to record command buffer!\n");
+    }
+}
 
-            if (vulkan->shapes[j].indexed) {
-                vkCmdBindIndexBuffer(vulkan->renderBuffers.commandBuffers[i],
-                                     vulkan->shapeBuffers.indexBuffer[j], 0,
-                                     VK_INDEX_TYPE_UINT16);
+void createCommandBuffers(Vulkan *vulkan) {
+    vulkan->renderBuffers.commandBuffers =
+        malloc(vulkan->swapchain.swapChainImagesCount *
+               sizeof(*vulkan->renderBuffers.commandBuffers));
 
-                vkCmdDrawIndexed(vulkan->renderBuffers.commandBuffers[i],
-                                 vulkan->shapes[j].indicesCount, 1, 0, 0, 0);
-            }
-        }
+    VkCommandBufferAllocateInfo allocInfo = {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+        .commandPool = vulkan->renderBuffers.commandPool,
+        .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+        .commandBufferCount = vulkan->swapchain.swapChainImagesCount,
+    };
 
-        vkCmdEndRenderPass(vulkan->renderBuffers.commandBuffers[i]);
+    if (vkAllocateCommandBuffers(vulkan->device.device, &allocInfo,
+                                 vulkan->renderBuffers.commandBuffers) !=
+        VK_SUCCESS) {
+        THROW_ERROR("failed to allocate command renderBuffers!\n");
+    }
 
-        if (vkEndCommandBuffer(vulkan->renderBuffers.commandBuffers[i]) !=
-            VK_SUCCESS) {
-            THROW_ERROR("failed to record command buffer!\n");
-        }
+    for (uint32_t i = 0; i < vulkan->swapchain.swapChainImagesCount; i++) {
+        recordCommandBuffer(vulkan, i);
     }
 }
 
@@ -192,12 +279,6 @@ void drawFrame(Vulkan *vulkan) {
     }
 
     updateUniformBuffer(vulkan);
-    for (uint32_t i = 0; i < vulkan->shapeCount; i++) {
-        mapMemory(
-            vulkan->device.device,
-            vulkan->shapes[i].descriptorSet.uniformBuffersMemory[imageIndex],
-            sizeof(vulkan->ubo), &vulkan->ubo);
-    }
 
     if (vulkan->semaphores.imagesInFlight[imageIndex] != VK_NULL_HANDLE) {
         vkWaitForFences(vulkan->device.device, 1,
@@ -207,6 +288,30 @@ void drawFrame(Vulkan *vulkan) {
     vulkan->semaphores.imagesInFlight[imageIndex] =
         vulkan->semaphores.inFlightFences[vulkan->currentFrame];
 
+    // the image's last frame is done, its uniforms, indirect draws, sets and
+    // buffer can change
+    if (vulkan->device.bindless) {
+        mapMemory(vulkan->device.device,
+                  vulkan->textureTable.descriptorSet
+                      .uniformBuffersMemory[imageIndex],
+                  sizeof(vulkan->ubo), &vulkan->ubo);
+    } else {
+        for (uint32_t i = 0; i < vulkan->shapeCount; i++) {
+            mapMemory(vulkan->device.device,
+                      vulkan->shapes[i]
+                          .descriptorSet.uniformBuffersMemory[imageIndex],
+                      sizeof(vulkan->ubo), &vulkan->ubo);
+        }
+    }
+    for (uint32_t i = 0; i < vulkan->shapeCount; i++) {
+        if (vulkan->shapes[i].lodCount) {
+            updateIndirectBuffer(vulkan, &vulkan->shapes[i], imageIndex);
+        }
+    }
+    if (updateTextureStreams(vulkan, imageIndex)) {
+        recordCommandBuffer(vulkan, imageIndex);
+    }
+
     VkSemaphore waitSemaphores[] = {
         vulkan->semaphores.imageAvailableSemaphores[vulkan->currentFrame],
     };
@@ -231,8 +336,10 @@ void drawFrame(Vulkan *vulkan) {
     vkResetFences(vulkan->device.device, 1,
                   &vulkan->semaphores.inFlightFences[vulkan->currentFrame]);
 
+    // the queue of the family the command buffers were allocated from, the
+    // stream uploads go to the same one ahead of it
     if (vkQueueSubmit(
-            vulkan->device.presentQueue, 1, &submitInfo,
+            vulkan->device.graphicsQueue, 1, &submitInfo,
             vulkan->semaphores.inFlightFences[vulkan->currentFrame]) !=
         VK_SUCCESS) {
         THROW_ERROR("failed to submit draw command buffer!\n");
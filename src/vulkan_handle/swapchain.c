@@ -1,7 +1,9 @@
 #include "vulkan_handle/swapchain.h"
 #include "error_handle.h"
+#include "geometry/lod/lod.h"
 #include "vulkan_handle/memory.h"
 #include "vulkan_handle/texture.h"
+#include "vulkan_handle/texture_table.h"
 #include "vulkan_handle/vulkan_handle.h"
 #include "window/window.h"
 #include <SDL_events.h>
@@ -98,15 +100,28 @@ void recreateSwapChain(Vulkan *vulkan) {
                          VK_IMAGE_ASPECT_COLOR_BIT, &vulkan->colour);
     createFramebuffers(vulkan);
 
+    if (vulkan->device.bindless) {
+        createTextureTableSets(vulkan);
+    }
+
     for (uint32_t i = 0; i < vulkan->shapeCount; i++) {
-        createGraphicsPipeline(
-            vulkan, &vulkan->shapes[i].descriptorSet.descriptorSetLayout,
-            &vulkan->shapes[i].graphicsPipeline);
-        createDescriptorPool(vulkan,
-                             &vulkan->shapes[i].descriptorSet.descriptorPool);
-        createUniformBuffers(vulkan, &vulkan->shapes[i].descriptorSet);
-        createDescriptorSets(vulkan, &vulkan->shapes[i].descriptorSet,
-                             &vulkan->shapes[i].texture);
+        if (vulkan->device.bindless) {
+            createGraphicsPipeline(
+                vulkan, &vulkan->textureTable.descriptorSet.descriptorSetLayout,
+                &vulkan->shapes[i].graphicsPipeline);
+        } else {
+            createGraphicsPipeline(
+                vulkan, &vulkan->shapes[i].descriptorSet.descriptorSetLayout,
+                &vulkan->shapes[i].graphicsPipeline);
+            createDescriptorPool(
+                vulkan, &vulkan->shapes[i].descriptorSet.descriptorPool);
+            createUniformBuffers(vulkan, &vulkan->shapes[i].descriptorSet);
+            createDescriptorSets(vulkan, &vulkan->shapes[i].descriptorSet,
+                                 &vulkan->shapes[i].texture);
+        }
+        if (vulkan->shapes[i].lodCount) {
+            createIndirectBuffers(vulkan, &vulkan->shapes[i]);
+        }
     }
 
     createCommandBuffers(vulkan);
@@ -239,6 +254,9 @@ void cleanupSwapChain(Vulkan *vulkan) {
         vkDestroyPipeline(vulkan->device.device,
                           vulkan->shapes[i].graphicsPipeline.graphicsPipeline,
                           NULL);
+        vkDestroyPipeline(vulkan->device.device,
+                          vulkan->shapes[i].graphicsPipeline.depthPipeline,
+                          NULL);
         vkDestroyPipelineLayout(
             vulkan->device.device,
             vulkan->shapes[i].graphicsPipeline.pipelineLayout, NULL);
@@ -253,8 +271,16 @@ void cleanupSwapChain(Vulkan *vulkan) {
     vkDestroySwapchainKHR(vulkan->device.device, vulkan->swapchain.swapChain,
                           NULL);
 
+    if (vulkan->device.bindless) {
+        destroyTextureTableSets(vulkan);
+    }
+
+    // bindless shapes have no uniform buffers of their own
+    uint32_t uniformBuffersCount =
+        vulkan->device.bindless ? 0 : vulkan->swapchain.swapChainImagesCount;
+
     for (uint32_t i = 0; i < vulkan->shapeCount; i++) {
-        for (uint32_t j = 0; j < vulkan->swapchain.swapChainImagesCount; j++) {
+        for (uint32_t j = 0; j < uniformBuffersCount; j++) {
             vkDestroyBuffer(vulkan->device.device,
                             vulkan->shapes[i].descriptorSet.uniformBuffers[j],
                             NULL);
@@ -265,6 +291,10 @@ void cleanupSwapChain(Vulkan *vulkan) {
         }
         freeMem(2, vulkan->shapes[i].descriptorSet.uniformBuffers,
                 vulkan->shapes[i].descriptorSet.uniformBuffersMemory);
+
+        if (vulkan->shapes[i].lodCount) {
+            destroyIndirectBuffers(vulkan, &vulkan->shapes[i]);
+        }
     }
 
     for (uint32_t i = 0; i < vulkan->swapchain.swapChainImagesCount; i++) {
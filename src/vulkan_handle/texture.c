@@ -1,23 +1,33 @@
 #include "vulkan_handle/texture.h"
+#include "image/bc/bc.h"
+#include "image/bc/encode.h"
+#include "image/format/format.h"
+#include "image/ktx/ktx.h"
+#include "image/mip/mip.h"
+#include "image/package/package.h"
 #include "utility/error_handle.h"
+#include "utility/mapped_file.h"
 #include "vulkan_handle/memory.h"
+#include "vulkan_handle/mipmap.h"
+#include "vulkan_handle/texture_cache.h"
 #include "vulkan_handle/vulkan_handle.h"
 #include <SDL.h>
 #include <SDL_image.h>
-#include <cglm/util.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
 #include <vulkan/vulkan.h>
 
-static inline void copyBufferToImage(Vulkan *vulkan, VkBuffer buffer,
-                                     VkImage image, uint32_t width,
-                                     uint32_t height) {
-    VkCommandBuffer commandBuffer = beginSingleTimeCommands(vulkan);
-
+static inline void copyBufferToImage(VkCommandBuffer commandBuffer,
+                                     VkBuffer buffer, VkDeviceSize offset,
+                                     VkImage image, uint32_t level,
+                                     uint32_t width, uint32_t height) {
     VkBufferImageCopy region = {
-        .bufferOffset = 0,
+        .bufferOffset = offset,
         .bufferRowLength = 0,
         .bufferImageHeight = 0,
         .imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
-        .imageSubresource.mipLevel = 0,
+        .imageSubresource.mipLevel = level,
         .imageSubresource.baseArrayLayer = 0,
         .imageSubresource.layerCount = 1,
         .imageOffset = (VkOffset3D){0, 0, 0},
@@ -26,17 +36,12 @@ static inline void copyBufferToImage(Vulkan *vulkan, VkBuffer buffer,
 
     vkCmdCopyBufferToImage(commandBuffer, buffer, image,
                            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
-
-    endSingleTimeCommands(vulkan, commandBuffer);
 }
 
-static void transitionImageLayout(Vulkan *vulkan, 
+static void transitionImageLayout(VkCommandBuffer commandBuffer,
                                   VkImage image,
-                                  VkFormat format,
                                   VkImageLayout oldLayout,
                                   VkImageLayout newLayout, uint32_t mipLevels) {
-    VkCommandBuffer commandBuffer = beginSingleTimeCommands(vulkan);
-
     VkImageMemoryBarrier barrier = {
         .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
         .oldLayout = oldLayout,
@@ -74,11 +79,10 @@ static void transitionImageLayout(Vulkan *vulkan,
 
     vkCmdPipelineBarrier(commandBuffer, sourceStage, destinationStage, 0, 0,
                          NULL, 0, NULL, 1, &barrier);
-
-    endSingleTimeCommands(vulkan, commandBuffer);
 }
 
-static void generateMipmaps(Vulkan *vulkan, VkImage image, VkFormat imageFormat,
+static void generateMipmaps(Vulkan *vulkan, VkCommandBuffer commandBuffer,
+                            VkImage image, VkFormat imageFormat,
                             int32_t texWidth, int32_t texHeight,
                             uint32_t mipLevels) {
     // Check if image format supports linear blitting
@@ -91,8 +95,6 @@ static void generateMipmaps(Vulkan *vulkan, VkImage image, VkFormat imageFormat,
         THROW_ERROR("Texture image format does not support linear blitting!\n");
     }
 
-    VkCommandBuffer commandBuffer = beginSingleTimeCommands(vulkan);
-
     VkImageMemoryBarrier barrier = {
         .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
         .image = image,
@@ -162,19 +164,47 @@ static void generateMipmaps(Vulkan *vulkan, VkImage image, VkFormat imageFormat,
     vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
                          VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, NULL, 0,
                          NULL, 1, &barrier);
-
-    endSingleTimeCommands(vulkan, commandBuffer);
 }
 
-inline void createTextureImageView(Vulkan *vulkan) {
-    vulkan->shapes[vulkan->shapeCount].texture.textureImageView =
-        createImageView(vulkan->device.device,
-                        vulkan->shapes[vulkan->shapeCount].texture.textureImage,
-                        VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_ASPECT_COLOR_BIT,
-                        vulkan->shapes[vulkan->shapeCount].texture.mipLevels);
+// Only ever sampled, which an srgb image written through storage views
+// has to say, as its own format has no storage support for the view to
+// inherit.
+void createTextureImageView(Vulkan *vulkan, Texture *texture) {
+    if (!vulkan->device.extendedUsage) {
+        texture->textureImageView = createImageView(
+            vulkan->device.device, texture->textureImage, texture->format,
+            VK_IMAGE_ASPECT_COLOR_BIT, texture->mipLevels);
+        return;
+    }
+
+    VkImageViewUsageCreateInfo usageInfo = {
+        .sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO,
+        .usage = VK_IMAGE_USAGE_SAMPLED_BIT,
+    };
+
+    VkImageViewCreateInfo viewInfo = {
+        .sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+        .pNext = &usageInfo,
+        .image = texture->textureImage,
+        .viewType = VK_IMAGE_VIEW_TYPE_2D,
+        .format = texture->format,
+        .subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+        .subresourceRange.baseMipLevel = 0,
+        .subresourceRange.levelCount = texture->mipLevels,
+        .subresourceRange.baseArrayLayer = 0,
+        .subresourceRange.layerCount = 1,
+    };
+
+    if (vkCreateImageView(vulkan->device.device, &viewInfo, NULL,
+                          &texture->textureImageView) != VK_SUCCESS) {
+        THROW_ERROR("failed to create texture image view!\n");
+    }
 }
 
-inline void createTextureSampler(Vulkan *vulkan) {
+// Shared by every texture with the same chain length. Levels finer than
+// minLod are never read, a streamed texture's that aren't resident yet.
+VkSampler acquireTextureSampler(Vulkan *vulkan, uint32_t mipLevels,
+                                float minLod) {
     VkPhysicalDeviceProperties properties = {};
     vkGetPhysicalDeviceProperties(vulkan->device.physicalDevice, &properties);
 
@@ -192,83 +222,431 @@ inline void createTextureSampler(Vulkan *vulkan) {
         .compareEnable = VK_FALSE,
         .compareOp = VK_COMPARE_OP_ALWAYS,
         .mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR,
-        .minLod = 0.0f, // Optional
-        .maxLod = (float)vulkan->shapes[vulkan->shapeCount].texture.mipLevels,
+        .minLod = minLod,
+        .maxLod = (float)mipLevels,
         .mipLodBias = 0.0f, // Optional
     };
 
-    if (vkCreateSampler(
-            vulkan->device.device, &samplerInfo, NULL,
-            &vulkan->shapes[vulkan->shapeCount].texture.textureSampler) !=
-        VK_SUCCESS) {
-        THROW_ERROR("failed to create texture sampler!\n");
+    return acquireSampler(vulkan, &samplerInfo);
+}
+
+inline void createTextureSampler(Vulkan *vulkan, Texture *texture) {
+    texture->textureSampler =
+        acquireTextureSampler(vulkan, texture->mipLevels, 0.0f);
+}
+
+// filtered sampling, how the chain is generated is chosen separately
+static bool canSample(Vulkan *vulkan, VkFormat format) {
+    VkFormatProperties properties;
+    vkGetPhysicalDeviceFormatProperties(vulkan->device.physicalDevice, format,
+                                        &properties);
+
+    VkFormatFeatureFlags needed =
+        VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT |
+        VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+    return (properties.optimalTilingFeatures & needed) == needed;
+}
+
+// every level starts on a whole block of any format
+static inline VkDeviceSize alignLevel(VkDeviceSize offset) {
+    return (offset + 15) & ~(VkDeviceSize)15;
+}
+
+static void layoutLevels(TexturePixels *pixels) {
+    const ImageFormat *stagedFormat = findImageFormat(pixels->format);
+    VkDeviceSize size = 0;
+    for (uint32_t i = 0; i < pixels->levelsCount; i++) {
+        pixels->levelOffsets[i] = size;
+        size = alignLevel(size + imageLevelSize(stagedFormat,
+                                                mipExtent(pixels->width, i),
+                                                mipExtent(pixels->height, i)));
+    }
+    pixels->size = size;
+}
+
+// Levels the file doesn't store made on the device when it can, otherwise,
+// or when the texture is streamed, every level is filtered on the cpu and
+// staged. Formats neither can generate are sampled with the levels they have.
+static void chooseMipLevels(Vulkan *vulkan, TextureFlags flags,
+                            TexturePixels *pixels) {
+    pixels->mipGeneration = chooseMipGeneration(
+        vulkan, pixels->format, pixels->width, pixels->height);
+    if ((flags & TEXTURE_STREAM) &&
+        pixels->mipGeneration != MIP_GENERATION_NONE) {
+        pixels->mipGeneration = MIP_GENERATION_CPU;
+    }
+
+    if (pixels->mipGeneration == MIP_GENERATION_NONE) {
+        pixels->mipLevels = pixels->levelsCount;
+    } else if (pixels->mipGeneration == MIP_GENERATION_CPU) {
+        pixels->levelsCount = pixels->mipLevels;
+    }
+    layoutLevels(pixels);
+}
+
+// Uploaded in the file's own format when the device samples it, otherwise bc
+// blocks are decoded to rgba8 as they are staged. Nothing decodes astc.
+static void loadKtx2Pixels(Vulkan *vulkan, const MappedFile *file,
+                           TextureFlags flags, TexturePixels *pixels) {
+    readKtx2(file, &pixels->ktx);
+
+    const ImageFormat *imageFormat = findImageFormat(pixels->ktx.format);
+    bool plain = imageFormat->blockWidth == 1;
+
+    pixels->format = pixels->ktx.format;
+    pixels->width = pixels->ktx.width;
+    pixels->height = pixels->ktx.height;
+    pixels->levelsCount = pixels->ktx.levelsCount;
+
+    // block formats can't be filtered, so their chain is only what is stored
+    bool generate = pixels->ktx.generateMips && plain;
+    pixels->mipLevels = generate ? fullMipLevels(pixels->width, pixels->height)
+                                 : pixels->levelsCount;
+
+    if (!canSample(vulkan, pixels->format)) {
+        if (!imageFormat->bc) {
+            THROW_ERROR("texture format not supported by the device!\n");
+        }
+        pixels->decode = true;
+        pixels->format = decodedImageFormat(imageFormat);
+    }
+
+    if (generate) {
+        // the chain comes from level 0 alone
+        pixels->levelsCount = 1;
+        chooseMipLevels(vulkan, flags, pixels);
+    } else {
+        layoutLevels(pixels);
     }
 }
 
-void createTextureImage(Vulkan *vulkan, const char *fileName) {
-    SDL_Surface *image = IMG_Load(fileName);
+// Bc7 when the image has alpha, whose coverage the mips keep, bc1 when it
+// doesn't, as long as the device samples it. The chain is filtered on the
+// cpu since neither can be blitted.
+static bool chooseEncoding(Vulkan *vulkan, TexturePixels *pixels) {
+    SDL_Surface *surface = pixels->surface;
+    bool alpha = surface->format->Amask || SDL_HasColorKey(surface);
+    VkFormat format =
+        alpha ? VK_FORMAT_BC7_SRGB_BLOCK : VK_FORMAT_BC1_RGB_SRGB_BLOCK;
+    if (!canSample(vulkan, format)) {
+        return false;
+    }
 
-    // convert to desired format
-    image = SDL_ConvertSurfaceFormat(image, SDL_PIXELFORMAT_ABGR8888, 0);
+    pixels->format = format;
+    pixels->encode = true;
+    pixels->levelsCount = pixels->mipLevels;
+    layoutLevels(pixels);
+    return true;
+}
 
-    VkDeviceSize imageSize = image->w * image->h * image->format->BytesPerPixel;
+// The cooked texture from the package next to the file when there is one,
+// then a ktx2 file as stored, anything else decoded by SDL_image in whatever
+// format the file holds and converted, or block compressed, as it is staged.
+// Safe to call from any thread.
+void loadTexturePixels(Vulkan *vulkan, const char *fileName,
+                       TextureFlags flags, TexturePixels *pixels) {
+    *pixels = (TexturePixels){0};
+
+    MappedFile packaged;
+    if (findPackagedTexture(fileName, &pixels->file, &packaged)) {
+        if (!isKtx2(&packaged)) {
+            THROW_ERROR("malformed texture package!\n");
+        }
+        loadKtx2Pixels(vulkan, &packaged, flags, pixels);
+        return;
+    }
 
-    vulkan->shapes[vulkan->shapeCount].texture.mipLevels =
-        (uint32_t)(floor(log2(glm_max(image->w, image->h)))) + 1;
+    if (mapFile(fileName, MAPPED_FILE_SEQUENTIAL, &pixels->file) &&
+        isKtx2(&pixels->file)) {
+        loadKtx2Pixels(vulkan, &pixels->file, flags, pixels);
+        return;
+    }
+    if (pixels->file.data) {
+        unmapFile(&pixels->file);
+        pixels->file = (MappedFile){0};
+    }
 
-    if (!image) {
+    pixels->surface = IMG_Load(fileName);
+    if (!pixels->surface) {
         printf("Could not load texture: %s", SDL_GetError());
         exit(EXIT_FAILURE);
     }
 
+    pixels->format = VK_FORMAT_R8G8B8A8_SRGB;
+    pixels->width = (uint32_t)pixels->surface->w;
+    pixels->height = (uint32_t)pixels->surface->h;
+    pixels->levelsCount = 1;
+    pixels->mipLevels = fullMipLevels(pixels->width, pixels->height);
+
+    if (!(flags & TEXTURE_COMPRESS) || !chooseEncoding(vulkan, pixels)) {
+        chooseMipLevels(vulkan, flags, pixels);
+    }
+}
+
+// Converts the decoded pixels to rgba8 straight into mapped staging memory
+// rather than through a converted surface and a copy.
+static void writeSurfacePixels(SDL_Surface *image, void *staging) {
+    SDL_Surface *target = SDL_CreateRGBSurfaceWithFormatFrom(
+        staging, image->w, image->h, 32, image->w * 4,
+        SDL_PIXELFORMAT_ABGR8888);
+    if (!target) {
+        printf("Could not convert texture: %s", SDL_GetError());
+        exit(EXIT_FAILURE);
+    }
+
+    // keyed pixels are skipped by the blit, left transparent as a converted
+    // surface would have them
+    if (SDL_HasColorKey(image)) {
+        memset(staging, 0, (size_t)image->w * image->h * 4);
+    }
+
+    SDL_SetSurfaceBlendMode(image, SDL_BLENDMODE_NONE);
+    if (SDL_BlitSurface(image, NULL, target, NULL) != 0) {
+        printf("Could not convert texture: %s", SDL_GetError());
+        exit(EXIT_FAILURE);
+    }
+
+    SDL_FreeSurface(target);
+}
+
+// Every level filtered from the decoded image and encoded straight into the
+// staging memory, on the job pool when it is running.
+static void writeEncodedPixels(const TexturePixels *pixels, void *staging) {
+#ifdef TEXTURE_STATS
+    struct timespec start;
+    timespec_get(&start, TIME_UTC);
+#endif
+
+    size_t count = (size_t)pixels->width * pixels->height;
+    unsigned char *rgba = malloc(count * 4);
+    if (!rgba) {
+        THROW_ERROR("failed to allocate texture pixels!\n");
+    }
+    writeSurfacePixels(pixels->surface, rgba);
+
+    const ImageFormat *imageFormat = findImageFormat(pixels->format);
+    MipFlags mipFlags = MIP_SRGB;
+    if (pixels->format == VK_FORMAT_BC7_SRGB_BLOCK) {
+        mipFlags |= MIP_PRESERVE_COVERAGE;
+    }
+
+    MipChain chain;
+    generateMipChain(rgba, pixels->width, pixels->height, mipFlags, &chain);
+
+#ifdef TEXTURE_STATS
+    struct timespec encodeStart;
+    timespec_get(&encodeStart, TIME_UTC);
+    size_t sourceSize = 0;
+#endif
+
+    for (uint32_t i = 0; i < pixels->levelsCount; i++) {
+        encodeBcImage(imageFormat, chain.levels[i], chain.widths[i],
+                      chain.heights[i],
+                      (unsigned char *)staging + pixels->levelOffsets[i]);
+#ifdef TEXTURE_STATS
+        sourceSize += (size_t)chain.widths[i] * chain.heights[i] * 4;
+#endif
+    }
+
+#ifdef TEXTURE_STATS
+    struct timespec end;
+    timespec_get(&end, TIME_UTC);
+    double mipMs = (encodeStart.tv_sec - start.tv_sec) * 1e3 +
+                   (encodeStart.tv_nsec - start.tv_nsec) / 1e6;
+    double encodeMs = (end.tv_sec - encodeStart.tv_sec) * 1e3 +
+                      (end.tv_nsec - encodeStart.tv_nsec) / 1e6;
+    printf("texture %ux%u, mips %.1f ms, %s %.1f ms at %.1f MB/s, "
+           "%.1f MB -> %.1f MB\n",
+           pixels->width, pixels->height, mipMs,
+           imageFormat->blockBytes == 8 ? "bc1" : "bc7", encodeMs,
+           sourceSize / 1e3 / encodeMs, sourceSize / 1e6, pixels->size / 1e6);
+#endif
+
+    freeMipChain(&chain);
+    free(rgba);
+}
+
+// Level 0 staged as it is, then the rest of the chain filtered from it on
+// the job pool, for devices that can neither blit nor write the format.
+static void writeGeneratedPixels(const TexturePixels *pixels, void *staging) {
+    unsigned char *level = staging;
+    if (pixels->surface) {
+        writeSurfacePixels(pixels->surface, level);
+    } else {
+        memcpy(level, pixels->ktx.levels[0], pixels->ktx.levelSizes[0]);
+    }
+
+    MipChain chain;
+    generateMipChain(level, pixels->width, pixels->height,
+                     pixels->format == VK_FORMAT_R8G8B8A8_SRGB ? MIP_SRGB : 0,
+                     &chain);
+    for (uint32_t i = 1; i < pixels->levelsCount; i++) {
+        memcpy(level + pixels->levelOffsets[i], chain.levels[i],
+               (size_t)chain.widths[i] * chain.heights[i] * 4);
+    }
+
+    freeMipChain(&chain);
+}
+
+// The size bytes of mapped staging memory the upload copies from. Safe to
+// call from any thread for different textures.
+void writeTexturePixels(const TexturePixels *pixels, void *staging) {
+    if (pixels->encode) {
+        writeEncodedPixels(pixels, staging);
+        return;
+    }
+    if (pixels->mipGeneration == MIP_GENERATION_CPU) {
+        writeGeneratedPixels(pixels, staging);
+        return;
+    }
+    if (pixels->surface) {
+        writeSurfacePixels(pixels->surface, staging);
+        return;
+    }
+
+    for (uint32_t i = 0; i < pixels->levelsCount; i++) {
+        writeTextureLevel(pixels, i,
+                          (unsigned char *)staging + pixels->levelOffsets[i]);
+    }
+}
+
+// One level of a ktx2 texture as it is stored, decoded when the device can't
+// sample its blocks. Safe to call from any thread.
+void writeTextureLevel(const TexturePixels *pixels, uint32_t level,
+                       void *staging) {
+    if (pixels->decode) {
+        decodeBcImage(findImageFormat(pixels->ktx.format),
+                      pixels->ktx.levels[level],
+                      mipExtent(pixels->width, level),
+                      mipExtent(pixels->height, level), staging);
+    } else {
+        memcpy(staging, pixels->ktx.levels[level],
+               pixels->ktx.levelSizes[level]);
+    }
+}
+
+void freeTexturePixels(TexturePixels *pixels) {
+    if (pixels->surface) {
+        SDL_FreeSurface(pixels->surface);
+    }
+    if (pixels->file.data) {
+        unmapFile(&pixels->file);
+    }
+    *pixels = (TexturePixels){0};
+}
+
+// the image with room for every mip level, filled by recordTextureUpload
+void createTextureImage(Vulkan *vulkan, Texture *texture,
+                        const TexturePixels *pixels) {
+    texture->format = pixels->format;
+    texture->mipLevels = pixels->mipLevels;
+
+    VkImageUsageFlags usage =
+        VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    VkImageCreateFlags flags = 0;
+    if (pixels->mipGeneration == MIP_GENERATION_BLIT) {
+        usage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    } else if (pixels->mipGeneration == MIP_GENERATION_COMPUTE) {
+        // written through unorm views of srgb images, which support storage
+        // where srgb itself doesn't
+        usage |= VK_IMAGE_USAGE_STORAGE_BIT;
+        flags |= VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT |
+                 VK_IMAGE_CREATE_EXTENDED_USAGE_BIT;
+    }
+
+    createImage(pixels->width, pixels->height, texture->mipLevels,
+                VK_SAMPLE_COUNT_1_BIT, texture->format, VK_IMAGE_TILING_OPTIMAL,
+                usage, flags, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, vulkan,
+                &texture->textureImage, &texture->textureImageMemory);
+}
+
+// copies the stored levels from the staging buffer at the offset and
+// generates any the texture doesn't have, leaving the image ready to sample.
+// Compute dispatches hold scratch until releaseMipScratch after the wait.
+void recordTextureUpload(Vulkan *vulkan, VkCommandBuffer commandBuffer,
+                         const Texture *texture, const TexturePixels *pixels,
+                         VkBuffer stagingBuffer, VkDeviceSize offset) {
+    transitionImageLayout(commandBuffer, texture->textureImage,
+                          VK_IMAGE_LAYOUT_UNDEFINED,
+                          VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                          texture->mipLevels);
+
+    for (uint32_t i = 0; i < pixels->levelsCount; i++) {
+        copyBufferToImage(commandBuffer, stagingBuffer,
+                          offset + pixels->levelOffsets[i],
+                          texture->textureImage, i,
+                          mipExtent(pixels->width, i),
+                          mipExtent(pixels->height, i));
+    }
+
+    if (pixels->levelsCount == texture->mipLevels) {
+        transitionImageLayout(commandBuffer, texture->textureImage,
+                              VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                              VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                              texture->mipLevels);
+    } else if (pixels->mipGeneration == MIP_GENERATION_COMPUTE) {
+        recordMipGeneration(vulkan, commandBuffer, texture, pixels->width,
+                            pixels->height);
+    } else {
+        generateMipmaps(vulkan, commandBuffer, texture->textureImage,
+                        texture->format, (int32_t)pixels->width,
+                        (int32_t)pixels->height, texture->mipLevels);
+    }
+}
+
+// everything a texture needs in one go, waiting for its upload, unless the
+// file is in the cache already
+void uploadTexture(Vulkan *vulkan, Texture *texture, const char *fileName) {
+    bool loading;
+    uint32_t entry = acquireTexture(vulkan, fileName, 0, &loading);
+    if (!loading) {
+        *texture = *cachedTexture(vulkan, entry);
+        return;
+    }
+
+    TexturePixels pixels;
+    loadTexturePixels(vulkan, fileName, 0, &pixels);
+
     VkBuffer stagingBuffer;
     VkDeviceMemory stagingBufferMemory;
-    createBuffer(imageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+    createBuffer(pixels.size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
                  VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
                      VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
                  vulkan, &stagingBuffer, &stagingBufferMemory);
 
-    mapMemory(vulkan->device.device, stagingBufferMemory, imageSize,
-              image->pixels);
-
-    createImage(
-        image->w, image->h,
-        vulkan->shapes[vulkan->shapeCount].texture.mipLevels,
-        VK_SAMPLE_COUNT_1_BIT, VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_TILING_OPTIMAL,
-        VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT |
-            VK_IMAGE_USAGE_SAMPLED_BIT,
-        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, vulkan,
-        &vulkan->shapes[vulkan->shapeCount].texture.textureImage,
-        &vulkan->shapes[vulkan->shapeCount].texture.textureImageMemory);
-
-    transitionImageLayout(
-        vulkan, vulkan->shapes[vulkan->shapeCount].texture.textureImage,
-        VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_LAYOUT_UNDEFINED,
-        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-        vulkan->shapes[vulkan->shapeCount].texture.mipLevels);
-
-    copyBufferToImage(vulkan, stagingBuffer,
-                      vulkan->shapes[vulkan->shapeCount].texture.textureImage,
-                      (uint32_t)image->w, (uint32_t)image->h);
+    void *staging;
+    vkMapMemory(vulkan->device.device, stagingBufferMemory, 0, pixels.size, 0,
+                &staging);
+    writeTexturePixels(&pixels, staging);
+    vkUnmapMemory(vulkan->device.device, stagingBufferMemory);
+
+    createTextureImage(vulkan, texture, &pixels);
+
+    VkCommandBuffer commandBuffer = beginSingleTimeCommands(vulkan);
+    recordTextureUpload(vulkan, commandBuffer, texture, &pixels, stagingBuffer,
+                        0);
+    endSingleTimeCommands(vulkan, commandBuffer);
+    releaseMipScratch(vulkan);
 
     vkDestroyBuffer(vulkan->device.device, stagingBuffer, NULL);
     vkFreeMemory(vulkan->device.device, stagingBufferMemory, NULL);
 
-    generateMipmaps(vulkan,
-                    vulkan->shapes[vulkan->shapeCount].texture.textureImage,
-                    VK_FORMAT_R8G8B8A8_SRGB, image->w, image->h,
-                    vulkan->shapes[vulkan->shapeCount].texture.mipLevels);
+    freeTexturePixels(&pixels);
 
-    SDL_FreeSurface(image);
+    createTextureImageView(vulkan, texture);
+    createTextureSampler(vulkan, texture);
+    storeCachedTexture(vulkan, entry, texture);
+    *texture = *cachedTexture(vulkan, entry);
 }
 
 void createImage(uint32_t width, uint32_t height, uint32_t mipLevels,
                  VkSampleCountFlagBits numSamples, VkFormat format,
                  VkImageTiling tiling, VkImageUsageFlags usage,
-                 VkMemoryPropertyFlags properties, Vulkan *vulkan,
-                 VkImage *image, VkDeviceMemory *imageMemory) {
+                 VkImageCreateFlags flags, VkMemoryPropertyFlags properties,
+                 Vulkan *vulkan, VkImage *image, VkDeviceMemory *imageMemory) {
     VkImageCreateInfo imageInfo = {
         .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+        .flags = flags,
         .imageType = VK_IMAGE_TYPE_2D,
         .extent.width = width,
         .extent.height = height,
@@ -356,7 +734,7 @@ inline void createResourceFormat(Vulkan *vulkan,
     createImage(vulkan->swapchain.swapChainExtent->width,
                 vulkan->swapchain.swapChainExtent->height, 1,
                 vulkan->msaaSamples, format, VK_IMAGE_TILING_OPTIMAL,
-                VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT | imageUsageFlags,
+                VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT | imageUsageFlags, 0,
                 VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT, vulkan,
                 &resource->image, &resource->memory);
 
@@ -0,0 +1,240 @@
+// realpath is hidden by a strict -std=c18
+#define _XOPEN_SOURCE 700
+
+#include "vulkan_handle/texture_cache.h"
+#include "geometry/cache/cache.h"
+#include "utility/error_handle.h"
+#include "utility/mapped_file.h"
+#include "vulkan_handle/texture.h"
+#include "vulkan_handle/texture_stream.h"
+#include "vulkan_handle/texture_table.h"
+#include "vulkan_handle/vulkan_handle.h"
+#include <stdlib.h>
+#include <string.h>
+
+// the same file however it is named, or the name as given when it isn't
+// there to resolve, as a cooked texture's source may not be
+static char *canonicalPath(const char *fileName) {
+#ifdef _WIN32
+    char *path = _fullpath(NULL, fileName, 0);
+#else
+    char *path = realpath(fileName, NULL);
+#endif
+    if (path) {
+        return path;
+    }
+
+    size_t length = strlen(fileName) + 1;
+    path = malloc(length);
+    memcpy(path, fileName, length);
+    return path;
+}
+
+// an edited file is a different texture even under the same path
+static uint64_t contentHash(const char *fileName) {
+    MappedFile file;
+    if (!mapFile(fileName, MAPPED_FILE_SEQUENTIAL, &file)) {
+        return 0;
+    }
+
+    uint64_t hash = hashMeshCacheKey(MESH_CACHE_KEY_SEED, file.data, file.size);
+    unmapFile(&file);
+    return hash;
+}
+
+// The entry for the file, with a reference taken. When loading is set the
+// caller is the first to ask for it and uploads it, then stores it with
+// storeCachedTexture, anyone else reads it from the entry once it has. The
+// index holds until a texture is released.
+uint32_t acquireTexture(Vulkan *vulkan, const char *fileName,
+                        TextureFlags flags, bool *loading) {
+    TextureCache *cache = &vulkan->textureCache;
+    char *path = canonicalPath(fileName);
+    uint64_t hash = contentHash(fileName);
+
+    for (uint32_t i = 0; i < cache->texturesCount; i++) {
+        CachedTexture *entry = &cache->textures[i];
+        if (entry->contentHash == hash && entry->flags == flags &&
+            strcmp(entry->path, path) == 0) {
+            entry->references++;
+            free(path);
+            *loading = false;
+            return i;
+        }
+    }
+
+    CachedTexture *textures = realloc(
+        cache->textures, (cache->texturesCount + 1) * sizeof(*textures));
+    if (!textures) {
+        THROW_ERROR("failed to grow texture cache!\n");
+    }
+    cache->textures = textures;
+    cache->textures[cache->texturesCount] = (CachedTexture){
+        .path = path,
+        .contentHash = hash,
+        .flags = flags,
+        .references = 1,
+    };
+
+    *loading = true;
+    return cache->texturesCount++;
+}
+
+// and gives it its index in the texture table, which every shape reading
+// the entry then shares. A texture that isn't streamed is held whole, so
+// the streams' budget shrinks by what it takes.
+void storeCachedTexture(Vulkan *vulkan, uint32_t index,
+                        const Texture *texture) {
+    CachedTexture *entry = &vulkan->textureCache.textures[index];
+    entry->texture = *texture;
+    if (vulkan->device.bindless) {
+        entry->texture.slot = addTableTexture(vulkan, &entry->texture);
+    }
+
+    if (!texture->stream) {
+        VkMemoryRequirements memoryRequirements;
+        vkGetImageMemoryRequirements(vulkan->device.device,
+                                     texture->textureImage,
+                                     &memoryRequirements);
+        entry->size = memoryRequirements.size;
+        vulkan->textureStreams.pinned += entry->size;
+    }
+}
+
+// A streamed texture's handles are whatever its stream holds now, the ones
+// it was stored with are retired and destroyed as soon as it grows or
+// shrinks.
+const Texture *cachedTexture(Vulkan *vulkan, uint32_t index) {
+    Texture *texture = &vulkan->textureCache.textures[index].texture;
+    if (texture->stream) {
+        const TextureResidency *resident = &texture->stream->resident;
+        texture->textureImage = resident->image;
+        texture->textureImageMemory = resident->memory;
+        texture->textureImageView = resident->view;
+        texture->textureSampler = resident->sampler;
+    }
+    return texture;
+}
+
+// a streamed texture's image changes under it, its stream doesn't
+static inline bool sameTexture(const Texture *a, const Texture *b) {
+    return a->stream || b->stream ? a->stream == b->stream
+                                  : a->textureImage == b->textureImage;
+}
+
+// drops a shape's reference, the last one destroys the texture
+void releaseTexture(Vulkan *vulkan, const Texture *texture) {
+    TextureCache *cache = &vulkan->textureCache;
+    for (uint32_t i = 0; i < cache->texturesCount; i++) {
+        CachedTexture *entry = &cache->textures[i];
+        if (!sameTexture(&entry->texture, texture)) {
+            continue;
+        }
+        if (--entry->references) {
+            return;
+        }
+
+        if (vulkan->device.bindless) {
+            removeTableTexture(vulkan, entry->texture.slot);
+        }
+        if (entry->texture.stream) {
+            closeTextureStream(vulkan, entry->texture.stream);
+        } else {
+            vulkan->textureStreams.pinned -= entry->size;
+            releaseSampler(vulkan, entry->texture.textureSampler);
+            vkDestroyImageView(vulkan->device.device,
+                               entry->texture.textureImageView, NULL);
+            vkDestroyImage(vulkan->device.device,
+                           entry->texture.textureImage, NULL);
+            vkFreeMemory(vulkan->device.device,
+                         entry->texture.textureImageMemory, NULL);
+        }
+        free(entry->path);
+
+        *entry = cache->textures[--cache->texturesCount];
+        return;
+    }
+}
+
+// every field, pNext included, so only chainless infos ever match
+static bool sameSamplerInfo(const VkSamplerCreateInfo *a,
+                            const VkSamplerCreateInfo *b) {
+    return a->pNext == b->pNext && a->flags == b->flags &&
+           a->magFilter == b->magFilter && a->minFilter == b->minFilter &&
+           a->mipmapMode == b->mipmapMode &&
+           a->addressModeU == b->addressModeU &&
+           a->addressModeV == b->addressModeV &&
+           a->addressModeW == b->addressModeW &&
+           a->mipLodBias == b->mipLodBias &&
+           a->anisotropyEnable == b->anisotropyEnable &&
+           a->maxAnisotropy == b->maxAnisotropy &&
+           a->compareEnable == b->compareEnable &&
+           a->compareOp == b->compareOp && a->minLod == b->minLod &&
+           a->maxLod == b->maxLod && a->borderColor == b->borderColor &&
+           a->unnormalizedCoordinates == b->unnormalizedCoordinates;
+}
+
+VkSampler acquireSampler(Vulkan *vulkan, const VkSamplerCreateInfo *info) {
+    TextureCache *cache = &vulkan->textureCache;
+    for (uint32_t i = 0; i < cache->samplersCount; i++) {
+        if (sameSamplerInfo(&cache->samplers[i].info, info)) {
+            cache->samplers[i].references++;
+            return cache->samplers[i].sampler;
+        }
+    }
+
+    VkSampler sampler;
+    if (vkCreateSampler(vulkan->device.device, info, NULL, &sampler) !=
+        VK_SUCCESS) {
+        THROW_ERROR("failed to create texture sampler!\n");
+    }
+
+    CachedSampler *samplers = realloc(
+        cache->samplers, (cache->samplersCount + 1) * sizeof(*samplers));
+    if (!samplers) {
+        THROW_ERROR("failed to grow sampler cache!\n");
+    }
+    cache->samplers = samplers;
+    cache->samplers[cache->samplersCount++] = (CachedSampler){
+        .info = *info,
+        .sampler = sampler,
+        .references = 1,
+    };
+
+    return sampler;
+}
+
+void releaseSampler(Vulkan *vulkan, VkSampler sampler) {
+    TextureCache *cache = &vulkan->textureCache;
+    for (uint32_t i = 0; i < cache->samplersCount; i++) {
+        CachedSampler *entry = &cache->samplers[i];
+        if (entry->sampler != sampler) {
+            continue;
+        }
+        if (--entry->references) {
+            return;
+        }
+
+        vkDestroySampler(vulkan->device.device, sampler, NULL);
+        *entry = cache->samplers[--cache->samplersCount];
+        return;
+    }
+}
+
+// whatever the shapes didn't release, then the tables themselves
+void destroyTextureCache(Vulkan *vulkan) {
+    TextureCache *cache = &vulkan->textureCache;
+    while (cache->texturesCount) {
+        CachedTexture *entry = &cache->textures[0];
+        entry->references = 1;
+        releaseTexture(vulkan, &entry->texture);
+    }
+    for (uint32_t i = 0; i < cache->samplersCount; i++) {
+        vkDestroySampler(vulkan->device.device, cache->samplers[i].sampler,
+                         NULL);
+    }
+
+    free(cache->textures);
+    free(cache->samplers);
+    *cache = (TextureCache){0};
+}
@@ -0,0 +1,987 @@
+#include "vulkan_handle/texture_stream.h"
+#include "geometry/geometry.h"
+#include "geometry/lod/lod.h"
+#include "image/format/format.h"
+#include "utility/error_handle.h"
+#include "vulkan_handle/memory.h"
+#include "vulkan_handle/texture_cache.h"
+#include "vulkan_handle/texture_table.h"
+#include "vulkan_handle/transfer.h"
+#include "vulkan_handle/uniforms.h"
+#include "vulkan_handle/vulkan_handle.h"
+#include <SDL.h>
+#include <cglm/vec3.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// What the streams may hold: the configured limit or the device's share,
+// whichever is lower, less the textures held whole.
+static VkDeviceSize streamBudget(const TextureStreams *streams) {
+    VkDeviceSize budget = streams->budget;
+    if (streams->deviceBudget &&
+        (!budget || streams->deviceBudget < budget)) {
+        budget = streams->deviceBudget;
+    }
+    if (!budget) {
+        budget = TEXTURE_STREAM_DEFAULT_BUDGET;
+    }
+    return budget > streams->pinned ? budget - streams->pinned : 0;
+}
+
+// What the streams hold once the replacements under way have settled: the
+// images already retired and those a resize is replacing are left out, the
+// resize's new one counts in their place. Growth and the over budget check
+// both go by it, so a replacement in flight is never held twice and a
+// shrink already submitted isn't followed by another.
+static VkDeviceSize settledSize(const TextureStreams *streams) {
+    VkDeviceSize pending = streams->retiredSize;
+    for (uint32_t i = 0; i < streams->streamsCount; i++) {
+        const TextureStream *stream = streams->streams[i];
+        if (stream->next.memory) {
+            pending += stream->resident.size;
+        }
+    }
+    return streams->used - pending;
+}
+
+// The largest device local heap's budget, as textures' share of it: what
+// they hold plus part of what is left, less whatever the process is over
+// it by, as other allocations or other processes grow.
+static void queryDeviceBudget(Vulkan *vulkan) {
+    TextureStreams *streams = &vulkan->textureStreams;
+
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT heapBudgets = {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT,
+    };
+    VkPhysicalDeviceMemoryProperties2 properties = {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2,
+        .pNext = &heapBudgets,
+    };
+    vkGetPhysicalDeviceMemoryProperties2(vulkan->device.physicalDevice,
+                                         &properties);
+
+    const VkPhysicalDeviceMemoryProperties *memory =
+        &properties.memoryProperties;
+    uint32_t heap = memory->memoryHeapCount;
+    for (uint32_t i = 0; i < memory->memoryHeapCount; i++) {
+        if ((memory->memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) &&
+            (heap == memory->memoryHeapCount ||
+             memory->memoryHeaps[i].size > memory->memoryHeaps[heap].size)) {
+            heap = i;
+        }
+    }
+    if (heap == memory->memoryHeapCount) {
+        return;
+    }
+
+    double held = (double)(streams->used + streams->pinned);
+    double left = (double)heapBudgets.heapBudget[heap] -
+                  (double)heapBudgets.heapUsage[heap];
+    double share = held + (left > 0.0 ? left * TEXTURE_STREAM_HEAP_SHARE
+                                      : left);
+
+    // never 0, which would stand for no budget at all
+    streams->deviceBudget = share > 1.0 ? (VkDeviceSize)share : 1;
+}
+
+static inline VkDeviceSize levelSize(const TexturePixels *pixels,
+                                     uint32_t level) {
+    return imageLevelSize(findImageFormat(pixels->format),
+                          mipExtent(pixels->width, level),
+                          mipExtent(pixels->height, level));
+}
+
+static inline uint32_t levelExtent(const TexturePixels *pixels,
+                                   uint32_t level) {
+    uint32_t width = mipExtent(pixels->width, level);
+    uint32_t height = mipExtent(pixels->height, level);
+    return width > height ? width : height;
+}
+
+// the texels of the chain from the level down, what the budget counts
+static VkDeviceSize residencySize(const TexturePixels *pixels,
+                                  uint32_t firstLevel) {
+    VkDeviceSize size = 0;
+    for (uint32_t i = firstLevel; i < pixels->mipLevels; i++) {
+        size += levelSize(pixels, i);
+    }
+    return size;
+}
+
+static void writeStreamLevel(const TextureStream *stream, uint32_t level,
+                             void *staging) {
+    if (stream->levels) {
+        memcpy(staging, stream->levels + stream->pixels.levelOffsets[level],
+               levelSize(&stream->pixels, level));
+    } else {
+        writeTextureLevel(&stream->pixels, level, staging);
+    }
+}
+
+// The texture's levels and where each comes from. A ktx2 file holding its
+// chain is read a level at a time, anything decoded, encoded or filtered
+// only comes whole, so it is written once here. Safe to call from any
+// thread.
+void loadTextureStream(Vulkan *vulkan, const char *fileName,
+                       TextureFlags flags, TextureStream **result) {
+    TextureStream *stream = calloc(1, sizeof(*stream));
+    TexturePixels *pixels = &stream->pixels;
+    loadTexturePixels(vulkan, fileName, flags | TEXTURE_STREAM, pixels);
+
+    if (pixels->surface || pixels->encode ||
+        pixels->mipGeneration == MIP_GENERATION_CPU) {
+        stream->levels = malloc(pixels->size);
+        if (!stream->levels) {
+            THROW_ERROR("failed to allocate texture levels!\n");
+        }
+        writeTexturePixels(pixels, stream->levels);
+    }
+    if (pixels->surface) {
+        SDL_FreeSurface(pixels->surface);
+        pixels->surface = NULL;
+    }
+
+    stream->tailLevel = pixels->mipLevels - 1;
+    while (stream->tailLevel > 0 &&
+           levelExtent(pixels, stream->tailLevel - 1) <=
+               TEXTURE_STREAM_TAIL_EXTENT) {
+        stream->tailLevel--;
+    }
+
+    *result = stream;
+}
+
+static void layoutAccess(VkImageLayout layout, VkAccessFlags *access,
+                         VkPipelineStageFlags *stage) {
+    switch (layout) {
+    case VK_IMAGE_LAYOUT_UNDEFINED:
+        *access = 0;
+        *stage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+        break;
+    case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:
+        *access = VK_ACCESS_TRANSFER_READ_BIT;
+        *stage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        break;
+    case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
+        *access = VK_ACCESS_TRANSFER_WRITE_BIT;
+        *stage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        break;
+    case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
+        *access = VK_ACCESS_SHADER_READ_BIT;
+        *stage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+        break;
+    default:
+        THROW_ERROR("unsupported layout transition!\n");
+    }
+}
+
+// count levels of the image from the first, ordered after whatever used
+// them in the old layout
+static void transitionLevels(VkCommandBuffer commandBuffer, VkImage image,
+                             uint32_t firstLevel, uint32_t count,
+                             VkImageLayout oldLayout,
+                             VkImageLayout newLayout) {
+    VkImageMemoryBarrier barrier = {
+        .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .oldLayout = oldLayout,
+        .newLayout = newLayout,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .image = image,
+        .subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+        .subresourceRange.baseMipLevel = firstLevel,
+        .subresourceRange.levelCount = count,
+        .subresourceRange.baseArrayLayer = 0,
+        .subresourceRange.layerCount = 1,
+    };
+
+    VkPipelineStageFlags sourceStage;
+    VkPipelineStageFlags destinationStage;
+    layoutAccess(oldLayout, &barrier.srcAccessMask, &sourceStage);
+    layoutAccess(newLayout, &barrier.dstAccessMask, &destinationStage);
+
+    vkCmdPipelineBarrier(commandBuffer, sourceStage, destinationStage, 0, 0,
+                         NULL, 0, NULL, 1, &barrier);
+}
+
+// One half of handing a level written on the transfer queue to the graphics
+// family, the same barrier recorded on each side. The release makes the copy
+// available, the acquire, after the timeline wait, visible to the shaders.
+static void transferLevel(VkCommandBuffer commandBuffer, VkImage image,
+                          uint32_t level, const Transfer *transfer,
+                          bool acquire) {
+    VkImageMemoryBarrier barrier = {
+        .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .srcAccessMask = acquire ? 0 : VK_ACCESS_TRANSFER_WRITE_BIT,
+        .dstAccessMask = acquire ? VK_ACCESS_SHADER_READ_BIT : 0,
+        .oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        .newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+        .srcQueueFamilyIndex = transfer->transferFamily,
+        .dstQueueFamilyIndex = transfer->graphicsFamily,
+        .image = image,
+        .subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+        .subresourceRange.baseMipLevel = level,
+        .subresourceRange.levelCount = 1,
+        .subresourceRange.baseArrayLayer = 0,
+        .subresourceRange.layerCount = 1,
+    };
+
+    VkPipelineStageFlags sourceStage =
+        acquire ? VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT
+                : VK_PIPELINE_STAGE_TRANSFER_BIT;
+    VkPipelineStageFlags destinationStage =
+        acquire ? VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT
+                : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+
+    vkCmdPipelineBarrier(commandBuffer, sourceStage, destinationStage, 0, 0,
+                         NULL, 0, NULL, 1, &barrier);
+}
+
+// chain level from the buffer into the image, whose first level is firstLevel
+static void copyLevel(VkCommandBuffer commandBuffer, VkBuffer buffer,
+                      VkDeviceSize offset, const TexturePixels *pixels,
+                      VkImage image, uint32_t firstLevel, uint32_t level) {
+    VkBufferImageCopy region = {
+        .bufferOffset = offset,
+        .imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+        .imageSubresource.mipLevel = level - firstLevel,
+        .imageSubresource.baseArrayLayer = 0,
+        .imageSubresource.layerCount = 1,
+        .imageExtent = (VkExtent3D){mipExtent(pixels->width, level),
+                                    mipExtent(pixels->height, level), 1},
+    };
+
+    vkCmdCopyBufferToImage(commandBuffer, buffer, image,
+                           VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+}
+
+// an image for the chain from the level down, without a sampler until it is
+// known how much of it is filled
+static TextureResidency createResidency(Vulkan *vulkan,
+                                        const TextureStream *stream,
+                                        uint32_t firstLevel) {
+    const TexturePixels *pixels = &stream->pixels;
+    uint32_t levels = pixels->mipLevels - firstLevel;
+    TextureResidency residency = {
+        .firstLevel = firstLevel,
+        .size = residencySize(pixels, firstLevel),
+    };
+
+    createImage(mipExtent(pixels->width, firstLevel),
+                mipExtent(pixels->height, firstLevel), levels,
+                VK_SAMPLE_COUNT_1_BIT, pixels->format, VK_IMAGE_TILING_OPTIMAL,
+                VK_IMAGE_USAGE_TRANSFER_SRC_BIT |
+                    VK_IMAGE_USAGE_TRANSFER_DST_BIT |
+                    VK_IMAGE_USAGE_SAMPLED_BIT,
+                0, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, vulkan,
+                &residency.image, &residency.memory);
+    residency.view =
+        createImageView(vulkan->device.device, residency.image,
+                        pixels->format, VK_IMAGE_ASPECT_COLOR_BIT, levels);
+
+    vulkan->textureStreams.used += residency.size;
+    return residency;
+}
+
+static void destroyResidency(Vulkan *vulkan, TextureResidency *residency) {
+    if (residency->sampler) {
+        releaseSampler(vulkan, residency->sampler);
+    }
+    if (residency->view) {
+        vkDestroyImageView(vulkan->device.device, residency->view, NULL);
+    }
+    if (residency->image) {
+        vkDestroyImage(vulkan->device.device, residency->image, NULL);
+    }
+    if (residency->memory) {
+        vkFreeMemory(vulkan->device.device, residency->memory, NULL);
+        vulkan->textureStreams.used -= residency->size;
+    }
+    *residency = (TextureResidency){0};
+}
+
+static void createStreamCommands(Vulkan *vulkan, TextureStream *stream) {
+    TextureStreams *streams = &vulkan->textureStreams;
+
+    if (!streams->commandPool) {
+        QueueFamilyIndices queueFamilyIndices = findQueueFamilies(
+            vulkan->device.physicalDevice, vulkan->window.surface);
+
+        VkCommandPoolCreateInfo poolInfo = {
+            .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+            .flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
+            .queueFamilyIndex = queueFamilyIndices.graphicsFamily,
+        };
+
+        if (vkCreateCommandPool(vulkan->device.device, &poolInfo, NULL,
+                                &streams->commandPool) != VK_SUCCESS) {
+            THROW_ERROR("failed to create texture stream command pool!\n");
+        }
+    }
+
+    VkCommandBufferAllocateInfo allocInfo = {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+        .commandPool = streams->commandPool,
+        .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+        .commandBufferCount = 1,
+    };
+
+    if (vkAllocateCommandBuffers(vulkan->device.device, &allocInfo,
+                                 &stream->commandBuffer) != VK_SUCCESS) {
+        THROW_ERROR("failed to allocate texture stream command buffer!\n");
+    }
+
+    if (vulkan->device.transferQueue) {
+        allocInfo.commandPool = vulkan->transfer.commandPool;
+        if (vkAllocateCommandBuffers(vulkan->device.device, &allocInfo,
+                                     &stream->transferCommandBuffer) !=
+            VK_SUCCESS) {
+            THROW_ERROR("failed to allocate texture transfer command "
+                        "buffer!\n");
+        }
+    }
+
+    VkFenceCreateInfo fenceInfo = {
+        .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+    };
+
+    if (vkCreateFence(vulkan->device.device, &fenceInfo, NULL,
+                      &stream->fence) != VK_SUCCESS) {
+        THROW_ERROR("failed to create texture stream fence!\n");
+    }
+}
+
+// The tail of the chain, through staging of its own and waited for, it is
+// small enough. The shape can be drawn straight after, the finer levels are
+// streamed in by updateTextureStreams.
+void createTextureStream(Vulkan *vulkan, TextureStream *stream,
+                         Texture *texture) {
+    TextureStreams *streams = &vulkan->textureStreams;
+    const TexturePixels *pixels = &stream->pixels;
+    uint32_t tailLevel = stream->tailLevel;
+    uint32_t levels = pixels->mipLevels - tailLevel;
+
+    createStreamCommands(vulkan, stream);
+
+    stream->resident = createResidency(vulkan, stream, tailLevel);
+    stream->resident.sampler = acquireTextureSampler(vulkan, levels, 0.0f);
+    stream->loadedLevel = tailLevel;
+    stream->wantedLevel = tailLevel;
+    stream->lastUsedFrame = streams->frame;
+
+    VkDeviceSize tailOffset = pixels->levelOffsets[tailLevel];
+    VkDeviceSize tailSize = pixels->size - tailOffset;
+
+    VkBuffer stagingBuffer;
+    VkDeviceMemory stagingBufferMemory;
+    createBuffer(tailSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                 VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                     VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                 vulkan, &stagingBuffer, &stagingBufferMemory);
+
+    unsigned char *staging;
+    vkMapMemory(vulkan->device.device, stagingBufferMemory, 0, tailSize, 0,
+                (void **)&staging);
+    for (uint32_t i = tailLevel; i < pixels->mipLevels; i++) {
+        writeStreamLevel(stream, i,
+                         staging + pixels->levelOffsets[i] - tailOffset);
+    }
+    vkUnmapMemory(vulkan->device.device, stagingBufferMemory);
+
+    VkImage image = stream->resident.image;
+    VkCommandBuffer commandBuffer = beginSingleTimeCommands(vulkan);
+    transitionLevels(commandBuffer, image, 0, levels,
+                     VK_IMAGE_LAYOUT_UNDEFINED,
+                     VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    for (uint32_t i = tailLevel; i < pixels->mipLevels; i++) {
+        copyLevel(commandBuffer, stagingBuffer,
+                  pixels->levelOffsets[i] - tailOffset, pixels, image,
+                  tailLevel, i);
+    }
+    transitionLevels(commandBuffer, image, 0, levels,
+                     VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                     VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    endSingleTimeCommands(vulkan, commandBuffer);
+
+    vkDestroyBuffer(vulkan->device.device, stagingBuffer, NULL);
+    vkFreeMemory(vulkan->device.device, stagingBufferMemory, NULL);
+
+    SDL_AtomicSet(&stream->state, TEXTURE_STREAM_IDLE);
+
+    TextureStream **registered =
+        realloc(streams->streams,
+                (streams->streamsCount + 1) * sizeof(*streams->streams));
+    if (!registered) {
+        THROW_ERROR("failed to grow texture streams!\n");
+    }
+    streams->streams = registered;
+    streams->streams[streams->streamsCount++] = stream;
+
+    *texture = (Texture){
+        .format = pixels->format,
+        .mipLevels = pixels->mipLevels,
+        .textureImage = stream->resident.image,
+        .textureImageMemory = stream->resident.memory,
+        .textureImageView = stream->resident.view,
+        .textureSampler = stream->resident.sampler,
+        .stream = stream,
+    };
+}
+
+static inline uint32_t swapchainImagesMask(const Vulkan *vulkan) {
+    uint32_t count = vulkan->swapchain.swapChainImagesCount;
+    return count >= 32 ? UINT32_MAX : (1u << count) - 1;
+}
+
+// Samples the stream through the replacement from now on, what of the old
+// it doesn't share is kept until every image's descriptor sets have moved
+// on. The shapes' copies follow, so sets written later name it too.
+static void replaceResidency(Vulkan *vulkan, TextureStream *stream,
+                             const TextureResidency *replacement) {
+    TextureStreams *streams = &vulkan->textureStreams;
+
+    RetiredResidency retired = {
+        .residency = stream->resident,
+        .pendingImages = swapchainImagesMask(vulkan),
+    };
+    if (replacement->image == stream->resident.image) {
+        retired.residency = (TextureResidency){
+            .sampler = stream->resident.sampler,
+        };
+    }
+
+    streams->retiredSize += retired.residency.size;
+
+    RetiredResidency *grown =
+        realloc(streams->retired,
+                (streams->retiredCount + 1) * sizeof(*streams->retired));
+    if (!grown) {
+        THROW_ERROR("failed to grow retired texture images!\n");
+    }
+    streams->retired = grown;
+    streams->retired[streams->retiredCount++] = retired;
+
+    stream->resident = *replacement;
+
+    for (uint32_t i = 0; i < vulkan->shapeCount; i++) {
+        Texture *texture = &vulkan->shapes[i].texture;
+        if (texture->stream != stream) {
+            continue;
+        }
+        texture->textureImage = replacement->image;
+        texture->textureImageMemory = replacement->memory;
+        texture->textureImageView = replacement->view;
+        texture->textureSampler = replacement->sampler;
+    }
+}
+
+static void beginCommands(VkCommandBuffer commandBuffer) {
+    VkCommandBufferBeginInfo beginInfo = {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+        .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+    };
+    vkBeginCommandBuffer(commandBuffer, &beginInfo);
+}
+
+static inline void beginStreamCommands(TextureStream *stream) {
+    beginCommands(stream->commandBuffer);
+}
+
+static void submitStreamCommands(Vulkan *vulkan, TextureStream *stream) {
+    vkEndCommandBuffer(stream->commandBuffer);
+
+    VkSubmitInfo submitInfo = {
+        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .commandBufferCount = 1,
+        .pCommandBuffers = &stream->commandBuffer,
+    };
+
+    // the same queue as the frame, submitted ahead of it, so the frame is
+    // ordered after the copy without a semaphore
+    if (vkQueueSubmit(vulkan->device.graphicsQueue, 1, &submitInfo,
+                      stream->fence) != VK_SUCCESS) {
+        THROW_ERROR("failed to submit texture stream upload!\n");
+    }
+}
+
+static void loadStreamLevel(void *data) {
+    TextureStream *stream = data;
+    writeStreamLevel(stream, stream->level, stream->staging);
+    SDL_AtomicSet(&stream->state, TEXTURE_STREAM_LOADED);
+}
+
+// staging sized for the level and a job to fill it
+static void requestLevel(Vulkan *vulkan, TextureStream *stream,
+                         uint32_t level) {
+    VkDeviceSize size = levelSize(&stream->pixels, level);
+    createBuffer(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                 VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                     VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                 vulkan, &stream->stagingBuffer, &stream->stagingBufferMemory);
+    vkMapMemory(vulkan->device.device, stream->stagingBufferMemory, 0, size, 0,
+                (void **)&stream->staging);
+
+    stream->level = level;
+    SDL_AtomicSet(&stream->state, TEXTURE_STREAM_LOADING);
+
+    Job load = {
+        .function = loadStreamLevel,
+        .data = stream,
+    };
+    runJobs(&load, 1, &stream->load);
+}
+
+static void destroyStaging(Vulkan *vulkan, TextureStream *stream) {
+    vkUnmapMemory(vulkan->device.device, stream->stagingBufferMemory);
+    vkDestroyBuffer(vulkan->device.device, stream->stagingBuffer, NULL);
+    vkFreeMemory(vulkan->device.device, stream->stagingBufferMemory, NULL);
+    stream->stagingBuffer = VK_NULL_HANDLE;
+    stream->stagingBufferMemory = VK_NULL_HANDLE;
+    stream->staging = NULL;
+}
+
+// The level copied on the transfer queue, released to the graphics family.
+// Frames never sampled it, the sampler's minLod hides it, so its contents
+// are discarded rather than handed over first.
+static void submitLevelTransfer(Vulkan *vulkan, TextureStream *stream) {
+    VkCommandBuffer commandBuffer = stream->transferCommandBuffer;
+    VkImage image = stream->resident.image;
+    uint32_t firstLevel = stream->resident.firstLevel;
+    uint32_t imageLevel = stream->level - firstLevel;
+
+    beginCommands(commandBuffer);
+    transitionLevels(commandBuffer, image, imageLevel, 1,
+                     VK_IMAGE_LAYOUT_UNDEFINED,
+                     VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    copyLevel(commandBuffer, stream->stagingBuffer, 0, &stream->pixels,
+              image, firstLevel, stream->level);
+    transferLevel(commandBuffer, image, imageLevel, &vulkan->transfer, false);
+    vkEndCommandBuffer(commandBuffer);
+
+    stream->transferValue = submitTransfer(vulkan, commandBuffer);
+    SDL_AtomicSet(&stream->state, TEXTURE_STREAM_TRANSFERRING);
+}
+
+// the level the transfer queue released, acquired ahead of the next frame
+// once it has been copied, finishing like any other upload
+static void submitLevelAcquire(Vulkan *vulkan, TextureStream *stream) {
+    uint32_t imageLevel = stream->level - stream->resident.firstLevel;
+
+    beginStreamCommands(stream);
+    transferLevel(stream->commandBuffer, stream->resident.image, imageLevel,
+                  &vulkan->transfer, true);
+    vkEndCommandBuffer(stream->commandBuffer);
+    submitTransferAcquire(vulkan, stream->commandBuffer,
+                          stream->transferValue, stream->fence);
+
+    SDL_AtomicSet(&stream->state, TEXTURE_STREAM_UPLOADING);
+}
+
+// the loaded level into the image it was requested for, the sampler keeps
+// frames from reading it until its fence has signalled
+static void submitLevelUpload(Vulkan *vulkan, TextureStream *stream) {
+    if (vulkan->device.transferQueue) {
+        submitLevelTransfer(vulkan, stream);
+        return;
+    }
+
+    VkImage image = stream->resident.image;
+    uint32_t firstLevel = stream->resident.firstLevel;
+    uint32_t imageLevel = stream->level - firstLevel;
+
+    beginStreamCommands(stream);
+    transitionLevels(stream->commandBuffer, image, imageLevel, 1,
+                     VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                     VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    copyLevel(stream->commandBuffer, stream->stagingBuffer, 0,
+              &stream->pixels, image, firstLevel, stream->level);
+    transitionLevels(stream->commandBuffer, image, imageLevel, 1,
+                     VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                     VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    submitStreamCommands(vulkan, stream);
+
+    SDL_AtomicSet(&stream->state, TEXTURE_STREAM_UPLOADING);
+}
+
+// A new image for the chain from the level down, finer or coarser, with the
+// loaded levels both hold copied across on the device. Levels it has room
+// for that aren't loaded yet are left for requestLevel.
+static void resizeResidency(Vulkan *vulkan, TextureStream *stream,
+                            uint32_t firstLevel) {
+    const TexturePixels *pixels = &stream->pixels;
+    const TextureResidency *old = &stream->resident;
+    uint32_t levels = pixels->mipLevels - firstLevel;
+    uint32_t kept = firstLevel > stream->loadedLevel ? firstLevel
+                                                     : stream->loadedLevel;
+    uint32_t keptCount = pixels->mipLevels - kept;
+
+    stream->next = createResidency(vulkan, stream, firstLevel);
+
+    VkImageCopy regions[KTX2_MAX_LEVELS];
+    for (uint32_t i = 0; i < keptCount; i++) {
+        uint32_t level = kept + i;
+        regions[i] = (VkImageCopy){
+            .srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+            .srcSubresource.mipLevel = level - old->firstLevel,
+            .srcSubresource.layerCount = 1,
+            .dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+            .dstSubresource.mipLevel = level - firstLevel,
+            .dstSubresource.layerCount = 1,
+            .extent = (VkExtent3D){mipExtent(pixels->width, level),
+                                   mipExtent(pixels->height, level), 1},
+        };
+    }
+
+    VkCommandBuffer commandBuffer = stream->commandBuffer;
+    beginStreamCommands(stream);
+    transitionLevels(commandBuffer, stream->next.image, 0, levels,
+                     VK_IMAGE_LAYOUT_UNDEFINED,
+                     VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    transitionLevels(commandBuffer, old->image, kept - old->firstLevel,
+                     keptCount, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                     VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+    vkCmdCopyImage(commandBuffer, old->image,
+                   VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, stream->next.image,
+                   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, keptCount, regions);
+    transitionLevels(commandBuffer, old->image, kept - old->firstLevel,
+                     keptCount, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                     VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    // the levels still to come too, the sampler never reads them
+    transitionLevels(commandBuffer, stream->next.image, 0, levels,
+                     VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                     VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    submitStreamCommands(vulkan, stream);
+
+    stream->level = kept;
+    SDL_AtomicSet(&stream->state, TEXTURE_STREAM_RESIZING);
+}
+
+// a submitted level or image once the device is done with it, with a
+// sampler whose minLod stops at the finest level now loaded
+static void finishStreamOperation(Vulkan *vulkan, TextureStream *stream) {
+    int state = SDL_AtomicGet(&stream->state);
+    if (state == TEXTURE_STREAM_LOADED) {
+        submitLevelUpload(vulkan, stream);
+        return;
+    }
+    if (state == TEXTURE_STREAM_TRANSFERRING) {
+        if (transferFinished(vulkan, stream->transferValue)) {
+            submitLevelAcquire(vulkan, stream);
+        }
+        return;
+    }
+    if ((state != TEXTURE_STREAM_UPLOADING &&
+         state != TEXTURE_STREAM_RESIZING) ||
+        vkGetFenceStatus(vulkan->device.device, stream->fence) !=
+            VK_SUCCESS) {
+        return;
+    }
+    vkResetFences(vulkan->device.device, 1, &stream->fence);
+
+    TextureResidency replacement = stream->resident;
+    if (state == TEXTURE_STREAM_UPLOADING) {
+        destroyStaging(vulkan, stream);
+    } else {
+        replacement = stream->next;
+        stream->next = (TextureResidency){0};
+    }
+
+    stream->loadedLevel = stream->level;
+    replacement.sampler = acquireTextureSampler(
+        vulkan, stream->pixels.mipLevels - replacement.firstLevel,
+        (float)(stream->loadedLevel - replacement.firstLevel));
+    replaceResidency(vulkan, stream, &replacement);
+
+    SDL_AtomicSet(&stream->state, TEXTURE_STREAM_IDLE);
+}
+
+// Coarsest level whose texels cover at most TEXTURE_STREAM_TEXEL_PIXELS on
+// screen, taking the texture to be spread once across the shape's bounding
+// sphere, the finest any of its shapes drawn this frame needs. How large
+// they are orders the streams. One not drawn keeps what it last wanted
+// until it has been idle for TEXTURE_STREAM_IDLE_FRAMES, then only wants
+// its tail.
+static void prioritiseStreams(Vulkan *vulkan) {
+    TextureStreams *streams = &vulkan->textureStreams;
+    float viewportHeight = vulkan->swapchain.swapChainExtent->height;
+
+    for (uint32_t i = 0; i < vulkan->shapeCount; i++) {
+        const Shape *shape = &vulkan->shapes[i];
+        TextureStream *stream = shape->texture.stream;
+        // every meshlet culled draws nothing, shapes without levels aren't
+        // culled
+        if (!stream || (shape->lodCount && !shape->visibleDraws)) {
+            continue;
+        }
+
+        if (stream->lastUsedFrame != streams->frame) {
+            stream->lastUsedFrame = streams->frame;
+            stream->wantedLevel = stream->tailLevel;
+            stream->priority = 0.0f;
+        }
+
+        float pixels = 0.0f;
+        if (shape->boundingRadius > 0.0f) {
+            pixels = 2.0f * shape->boundingRadius *
+                     projectedPixelsPerUnit(&vulkan->ubo, GLM_VEC3_ZERO,
+                                            shape->boundingRadius,
+                                            viewportHeight);
+        }
+
+        uint32_t level = stream->tailLevel;
+        while (level > 0 && levelExtent(&stream->pixels, level) *
+                                    TEXTURE_STREAM_TEXEL_PIXELS <
+                                pixels) {
+            level--;
+        }
+
+        if (level < stream->wantedLevel) {
+            stream->wantedLevel = level;
+        }
+        stream->priority = fmaxf(stream->priority, pixels);
+    }
+
+    for (uint32_t i = 0; i < streams->streamsCount; i++) {
+        TextureStream *stream = streams->streams[i];
+        if (streams->frame - stream->lastUsedFrame >
+            TEXTURE_STREAM_IDLE_FRAMES) {
+            stream->wantedLevel = stream->tailLevel;
+            stream->priority = 0.0f;
+        }
+    }
+}
+
+static int compareStreams(const void *a, const void *b) {
+    float pa = (*(TextureStream *const *)a)->priority;
+    float pb = (*(TextureStream *const *)b)->priority;
+    return (pa < pb) - (pa > pb);
+}
+
+// least recently drawn first, then the smallest on screen
+static inline bool lessUsed(const TextureStream *a, const TextureStream *b) {
+    if (a->lastUsedFrame != b->lastUsedFrame) {
+        return a->lastUsedFrame < b->lastUsedFrame;
+    }
+    return a->priority < b->priority;
+}
+
+// The finest level of the stream that can best do without it, those holding
+// more than they want first, idle ones included, then the least used. Never
+// one drawn this frame and larger than the stream asking for the room.
+static void dropLevel(Vulkan *vulkan, const TextureStream *requester) {
+    TextureStreams *streams = &vulkan->textureStreams;
+    TextureStream *victim = NULL;
+    bool victimSurplus = false;
+
+    for (uint32_t i = 0; i < streams->streamsCount; i++) {
+        TextureStream *stream = streams->streams[i];
+        if (stream == requester ||
+            SDL_AtomicGet(&stream->state) != TEXTURE_STREAM_IDLE ||
+            stream->resident.firstLevel >= stream->tailLevel) {
+            continue;
+        }
+
+        bool surplus = stream->wantedLevel > stream->resident.firstLevel;
+        if (!surplus && requester &&
+            stream->lastUsedFrame == streams->frame &&
+            stream->priority >= requester->priority) {
+            continue;
+        }
+        if (!victim || surplus > victimSurplus ||
+            (surplus == victimSurplus && lessUsed(stream, victim))) {
+            victim = stream;
+            victimSurplus = surplus;
+        }
+    }
+
+    if (victim) {
+        resizeResidency(vulkan, victim, victim->resident.firstLevel + 1);
+    }
+}
+
+// Finest level from the wanted one the budget has room for, counting the
+// image it replaces as freed, as settledSize does. When not even one more
+// level fits another stream starts giving up its finest, there's room in a
+// later frame.
+static uint32_t affordableLevel(Vulkan *vulkan, TextureStream *stream) {
+    TextureStreams *streams = &vulkan->textureStreams;
+    VkDeviceSize budget = streamBudget(streams);
+    VkDeviceSize others = settledSize(streams) - stream->resident.size;
+
+    for (uint32_t level = stream->wantedLevel;
+         level < stream->resident.firstLevel; level++) {
+        if (others + residencySize(&stream->pixels, level) <= budget) {
+            return level;
+        }
+    }
+
+    dropLevel(vulkan, stream);
+    return stream->resident.firstLevel;
+}
+
+// one operation at a time per stream: the levels its image has room for,
+// coarsest first, then a larger image once it wants finer ones
+static void scheduleStream(Vulkan *vulkan, TextureStream *stream) {
+    if (SDL_AtomicGet(&stream->state) != TEXTURE_STREAM_IDLE) {
+        return;
+    }
+
+    if (stream->loadedLevel > stream->resident.firstLevel) {
+        requestLevel(vulkan, stream, stream->loadedLevel - 1);
+        return;
+    }
+    if (stream->wantedLevel >= stream->resident.firstLevel) {
+        return;
+    }
+
+    uint32_t level = affordableLevel(vulkan, stream);
+    if (level < stream->resident.firstLevel) {
+        resizeResidency(vulkan, stream, level);
+    }
+}
+
+// Points the image's descriptor sets of every streamed shape at what they
+// sample now, once anything was replaced since they were last written, and
+// destroys what no image's sets name any more. True when it did, as the
+// image's command buffer has to be recorded again, unless the texture table
+// was rewritten instead, which is updated after bind.
+static bool rewriteDescriptors(Vulkan *vulkan, uint32_t imageIndex) {
+    TextureStreams *streams = &vulkan->textureStreams;
+    uint32_t image = 1u << imageIndex;
+
+    bool stale = false;
+    for (uint32_t i = 0; i < streams->retiredCount; i++) {
+        stale |= (streams->retired[i].pendingImages & image) != 0;
+    }
+    if (!stale) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < vulkan->shapeCount; i++) {
+        Shape *shape = &vulkan->shapes[i];
+        if (!shape->texture.stream) {
+            continue;
+        }
+        if (vulkan->device.bindless) {
+            updateTableTexture(vulkan, imageIndex, shape->texture.slot,
+                               &shape->texture);
+        } else {
+            updateTextureDescriptor(vulkan, &shape->descriptorSet, imageIndex,
+                                    &shape->texture);
+        }
+    }
+
+    // images a recreated swapchain no longer has are never acquired again
+    uint32_t remaining = swapchainImagesMask(vulkan) & ~image;
+    for (uint32_t i = 0; i < streams->retiredCount;) {
+        RetiredResidency *retired = &streams->retired[i];
+        retired->pendingImages &= remaining;
+        if (retired->pendingImages) {
+            i++;
+            continue;
+        }
+
+        streams->retiredSize -= retired->residency.size;
+        destroyResidency(vulkan, &retired->residency);
+        *retired = streams->retired[--streams->retiredCount];
+    }
+
+    return !vulkan->device.bindless;
+}
+
+// Called once the image's last frame is done with its command buffer, and
+// never waits: finished uploads take effect, the shapes on screen pick what
+// comes next, and the image's descriptor sets catch up with whatever was
+// replaced. True when its command buffer has to be recorded again.
+bool updateTextureStreams(Vulkan *vulkan, uint32_t imageIndex) {
+    TextureStreams *streams = &vulkan->textureStreams;
+
+    if (vulkan->device.memoryBudget &&
+        streams->frame % TEXTURE_STREAM_BUDGET_FRAMES == 0) {
+        queryDeviceBudget(vulkan);
+    }
+    streams->frame++;
+
+    for (uint32_t i = 0; i < streams->streamsCount; i++) {
+        finishStreamOperation(vulkan, streams->streams[i]);
+    }
+
+    prioritiseStreams(vulkan);
+    qsort(streams->streams, streams->streamsCount, sizeof(*streams->streams),
+          compareStreams);
+
+    for (uint32_t i = 0; i < streams->streamsCount; i++) {
+        scheduleStream(vulkan, streams->streams[i]);
+    }
+
+    // a budget lowered under what is held gives it back a level at a time,
+    // replacements still settling aren't counted twice
+    if (settledSize(streams) > streamBudget(streams)) {
+        dropLevel(vulkan, NULL);
+    }
+
+    return rewriteDescriptors(vulkan, imageIndex);
+}
+
+// Everything the stream holds, once the device no longer samples it. What
+// it retired is left to the next descriptor rewrite or
+// destroyTextureStreams.
+void closeTextureStream(Vulkan *vulkan, TextureStream *stream) {
+    TextureStreams *streams = &vulkan->textureStreams;
+
+    // the load writes into staging about to be unmapped
+    waitForJobs(&stream->load);
+
+    int state = SDL_AtomicGet(&stream->state);
+    if (state == TEXTURE_STREAM_TRANSFERRING) {
+        waitForTransfer(vulkan, stream->transferValue);
+    }
+    if (state == TEXTURE_STREAM_UPLOADING ||
+        state == TEXTURE_STREAM_RESIZING) {
+        vkWaitForFences(vulkan->device.device, 1, &stream->fence, VK_TRUE,
+                        UINT64_MAX);
+    }
+    if (stream->stagingBuffer) {
+        destroyStaging(vulkan, stream);
+    }
+
+    destroyResidency(vulkan, &stream->next);
+    destroyResidency(vulkan, &stream->resident);
+
+    vkDestroyFence(vulkan->device.device, stream->fence, NULL);
+    vkFreeCommandBuffers(vulkan->device.device, streams->commandPool, 1,
+                         &stream->commandBuffer);
+    if (stream->transferCommandBuffer) {
+        vkFreeCommandBuffers(vulkan->device.device,
+                             vulkan->transfer.commandPool, 1,
+                             &stream->transferCommandBuffer);
+    }
+
+    for (uint32_t i = 0; i < streams->streamsCount; i++) {
+        if (streams->streams[i] == stream) {
+            streams->streams[i] = streams->streams[--streams->streamsCount];
+            break;
+        }
+    }
+
+    freeTexturePixels(&stream->pixels);
+    freeMem(2, stream->levels, stream);
+}
+
+// what the streams retired and the pool their uploads were recorded from,
+// once every stream is closed
+void destroyTextureStreams(Vulkan *vulkan) {
+    TextureStreams *streams = &vulkan->textureStreams;
+
+    for (uint32_t i = 0; i < streams->retiredCount; i++) {
+        destroyResidency(vulkan, &streams->retired[i].residency);
+    }
+    if (streams->commandPool) {
+        vkDestroyCommandPool(vulkan->device.device, streams->commandPool,
+                             NULL);
+    }
+
+    freeMem(2, streams->retired, streams->streams);
+    *streams = (TextureStreams){0};
+}
@@ -0,0 +1,294 @@
+#include "vulkan_handle/texture_table.h"
+#include "utility/error_handle.h"
+#include "vulkan_handle/memory.h"
+#include "vulkan_handle/uniforms.h"
+#include "vulkan_handle/vulkan_handle.h"
+#include <stdlib.h>
+#include <vulkan/vulkan.h>
+
+static inline uint32_t minimum(uint32_t a, uint32_t b) {
+    return a < b ? a : b;
+}
+
+// combined image samplers count against both the sampler and the sampled
+// image limits
+static uint32_t tableCapacity(VkPhysicalDevice physicalDevice) {
+    VkPhysicalDeviceDescriptorIndexingPropertiesEXT indexing = {
+        .sType =
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT,
+    };
+    VkPhysicalDeviceProperties2 properties = {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2,
+        .pNext = &indexing,
+    };
+    vkGetPhysicalDeviceProperties2(physicalDevice, &properties);
+
+    uint32_t capacity = TEXTURE_TABLE_MAX_TEXTURES;
+    capacity = minimum(capacity,
+                       indexing.maxPerStageDescriptorUpdateAfterBindSamplers);
+    capacity = minimum(
+        capacity, indexing.maxPerStageDescriptorUpdateAfterBindSampledImages);
+    capacity =
+        minimum(capacity, indexing.maxDescriptorSetUpdateAfterBindSamplers);
+    capacity = minimum(capacity,
+                       indexing.maxDescriptorSetUpdateAfterBindSampledImages);
+    return capacity;
+}
+
+static inline VkDescriptorImageInfo tableImageInfo(const Texture *texture) {
+    return (VkDescriptorImageInfo){
+        .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+        .imageView = texture->textureImageView,
+        .sampler = texture->textureSampler,
+    };
+}
+
+static void writeSlot(Vulkan *vulkan, VkDescriptorSet descriptorSet,
+                      uint32_t slot) {
+    VkWriteDescriptorSet descriptorWrite = {
+        .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+        .dstSet = descriptorSet,
+        .dstBinding = 1,
+        .dstArrayElement = slot,
+        .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+        .descriptorCount = 1,
+        .pImageInfo = &vulkan->textureTable.slots[slot],
+    };
+
+    vkUpdateDescriptorSets(vulkan->device.device, 1, &descriptorWrite, 0,
+                           NULL);
+}
+
+// The layout every bindless pipeline is created with, the uniform buffer
+// and the array. Only the array is written after it is bound, so slots
+// can be filled while frames that don't sample them are in flight.
+void createTextureTable(Vulkan *vulkan) {
+    TextureTable *table = &vulkan->textureTable;
+    table->capacity = tableCapacity(vulkan->device.physicalDevice);
+
+    VkDescriptorSetLayoutBinding bindings[] = {
+        {
+            .binding = 0,
+            .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+            .descriptorCount = 1,
+            .stageFlags = VK_SHADER_STAGE_VERTEX_BIT,
+        },
+        {
+            .binding = 1,
+            .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+            .descriptorCount = table->capacity,
+            .stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT,
+        },
+    };
+
+    VkDescriptorBindingFlagsEXT bindingFlags[] = {
+        0,
+        VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT |
+            VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT |
+            VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT,
+    };
+
+    VkDescriptorSetLayoutBindingFlagsCreateInfoEXT bindingFlagsInfo = {
+        .sType =
+            VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT,
+        .bindingCount = SIZEOF(bindingFlags),
+        .pBindingFlags = bindingFlags,
+    };
+
+    VkDescriptorSetLayoutCreateInfo layoutInfo = {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+        .pNext = &bindingFlagsInfo,
+        .flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT,
+        .bindingCount = SIZEOF(bindings),
+        .pBindings = bindings,
+    };
+
+    if (vkCreateDescriptorSetLayout(
+            vulkan->device.device, &layoutInfo, NULL,
+            &table->descriptorSet.descriptorSetLayout) != VK_SUCCESS) {
+        THROW_ERROR("failed to create texture table layout!\n");
+    }
+
+    VkPushConstantRange pushConstantRange = {
+        .stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT,
+        .offset = 0,
+        .size = sizeof(TextureTableConstants),
+    };
+
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo = {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+        .pushConstantRangeCount = 1,
+        .pPushConstantRanges = &pushConstantRange,
+        .setLayoutCount = 1,
+        .pSetLayouts = &table->descriptorSet.descriptorSetLayout,
+    };
+
+    if (vkCreatePipelineLayout(vulkan->device.device, &pipelineLayoutInfo,
+                               NULL, &table->pipelineLayout) != VK_SUCCESS) {
+        THROW_ERROR("failed to create texture table pipeline layout!\n");
+    }
+
+    createTextureTableSets(vulkan);
+}
+
+// a set and uniform buffer per swapchain image, with every texture already
+// in the table written in
+void createTextureTableSets(Vulkan *vulkan) {
+    TextureTable *table = &vulkan->textureTable;
+    DescriptorSet *descriptorSet = &table->descriptorSet;
+    uint32_t imagesCount = vulkan->swapchain.swapChainImagesCount;
+
+    VkDescriptorPoolSize poolSizes[] = {
+        {
+            .type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+            .descriptorCount = imagesCount,
+        },
+        {
+            .type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+            .descriptorCount = imagesCount * table->capacity,
+        },
+    };
+
+    VkDescriptorPoolCreateInfo poolInfo = {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+        .flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT,
+        .poolSizeCount = SIZEOF(poolSizes),
+        .pPoolSizes = poolSizes,
+        .maxSets = imagesCount,
+    };
+
+    if (vkCreateDescriptorPool(vulkan->device.device, &poolInfo, NULL,
+                               &descriptorSet->descriptorPool) != VK_SUCCESS) {
+        THROW_ERROR("failed to create texture table pool!\n");
+    }
+
+    createUniformBuffers(vulkan, descriptorSet);
+
+    VkDescriptorSetLayout layouts[imagesCount];
+    for (uint32_t i = 0; i < imagesCount; i++) {
+        layouts[i] = descriptorSet->descriptorSetLayout;
+    }
+
+    VkDescriptorSetAllocateInfo allocInfo = {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+        .descriptorPool = descriptorSet->descriptorPool,
+        .descriptorSetCount = imagesCount,
+        .pSetLayouts = layouts,
+    };
+
+    descriptorSet->descriptorSets =
+        malloc(imagesCount * sizeof(*descriptorSet->descriptorSets));
+    if (vkAllocateDescriptorSets(vulkan->device.device, &allocInfo,
+                                 descriptorSet->descriptorSets) != VK_SUCCESS) {
+        THROW_ERROR("failed to allocate texture table sets!\n");
+    }
+
+    for (uint32_t i = 0; i < imagesCount; i++) {
+        VkDescriptorBufferInfo bufferInfo = {
+            .buffer = descriptorSet->uniformBuffers[i],
+            .offset = 0,
+            .range = sizeof(UniformBufferObject),
+        };
+
+        VkWriteDescriptorSet descriptorWrite = {
+            .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+            .dstSet = descriptorSet->descriptorSets[i],
+            .dstBinding = 0,
+            .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+            .descriptorCount = 1,
+            .pBufferInfo = &bufferInfo,
+        };
+        vkUpdateDescriptorSets(vulkan->device.device, 1, &descriptorWrite, 0,
+                               NULL);
+
+        for (uint32_t j = 0; j < table->slotsCount; j++) {
+            if (table->slots[j].imageView != VK_NULL_HANDLE) {
+                writeSlot(vulkan, descriptorSet->descriptorSets[i], j);
+            }
+        }
+    }
+}
+
+// The index the texture is sampled through, written into every image's set.
+// Textures are only added by the shapes that upload them, so a freed index
+// is reused before the table grows.
+uint32_t addTableTexture(Vulkan *vulkan, const Texture *texture) {
+    TextureTable *table = &vulkan->textureTable;
+
+    uint32_t slot = 0;
+    while (slot < table->slotsCount &&
+           table->slots[slot].imageView != VK_NULL_HANDLE) {
+        slot++;
+    }
+
+    if (slot == table->slotsCount) {
+        if (table->slotsCount == table->capacity) {
+            THROW_ERROR("texture table is full!\n");
+        }
+
+        VkDescriptorImageInfo *slots = realloc(
+            table->slots, (table->slotsCount + 1) * sizeof(*table->slots));
+        if (!slots) {
+            THROW_ERROR("failed to grow texture table!\n");
+        }
+        table->slots = slots;
+        table->slotsCount++;
+    }
+
+    table->slots[slot] = tableImageInfo(texture);
+    for (uint32_t i = 0; i < vulkan->swapchain.swapChainImagesCount; i++) {
+        writeSlot(vulkan, table->descriptorSet.descriptorSets[i], slot);
+    }
+
+    return slot;
+}
+
+// Points one swapchain image's slot at the texture as it is now, once that
+// image's last frame is done with it. Being update after bind, the image's
+// command buffer stays valid.
+void updateTableTexture(Vulkan *vulkan, uint32_t imageIndex, uint32_t slot,
+                        const Texture *texture) {
+    TextureTable *table = &vulkan->textureTable;
+    table->slots[slot] = tableImageInfo(texture);
+    writeSlot(vulkan, table->descriptorSet.descriptorSets[imageIndex], slot);
+}
+
+// partially bound, so what the slot still names is never read again
+void removeTableTexture(Vulkan *vulkan, uint32_t slot) {
+    vulkan->textureTable.slots[slot] = (VkDescriptorImageInfo){0};
+}
+
+void destroyTextureTableSets(Vulkan *vulkan) {
+    DescriptorSet *descriptorSet = &vulkan->textureTable.descriptorSet;
+
+    vkDestroyDescriptorPool(vulkan->device.device,
+                            descriptorSet->descriptorPool, NULL);
+
+    for (uint32_t i = 0; i < vulkan->swapchain.swapChainImagesCount; i++) {
+        vkDestroyBuffer(vulkan->device.device,
+                        descriptorSet->uniformBuffers[i], NULL);
+        vkFreeMemory(vulkan->device.device,
+                     descriptorSet->uniformBuffersMemory[i], NULL);
+    }
+
+    freeMem(3, descriptorSet->descriptorSets, descriptorSet->uniformBuffers,
+            descriptorSet->uniformBuffersMemory);
+    descriptorSet->descriptorPool = VK_NULL_HANDLE;
+    descriptorSet->descriptorSets = NULL;
+    descriptorSet->uniformBuffers = NULL;
+    descriptorSet->uniformBuffersMemory = NULL;
+}
+
+// after destroyTextureTableSets, with the swapchain
+void destroyTextureTable(Vulkan *vulkan) {
+    TextureTable *table = &vulkan->textureTable;
+
+    vkDestroyPipelineLayout(vulkan->device.device, table->pipelineLayout,
+                            NULL);
+    vkDestroyDescriptorSetLayout(vulkan->device.device,
+                                 table->descriptorSet.descriptorSetLayout,
+                                 NULL);
+
+    free(table->slots);
+    *table = (TextureTable){0};
+}
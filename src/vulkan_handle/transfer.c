@@ -0,0 +1,142 @@
+#include "vulkan_handle/transfer.h"
+#include "utility/error_handle.h"
+#include "vulkan_handle/device.h"
+#include "vulkan_handle/vulkan_handle.h"
+#include <vulkan/vulkan.h>
+
+// only called once createLogicalDevice has found the device a transfer
+// queue, with timeline semaphores enabled alongside it
+void createTransfer(Vulkan *vulkan) {
+    Transfer *transfer = &vulkan->transfer;
+    QueueFamilyIndices queueFamilyIndices = findQueueFamilies(
+        vulkan->device.physicalDevice, vulkan->window.surface);
+    transfer->graphicsFamily = queueFamilyIndices.graphicsFamily;
+    transfer->transferFamily = queueFamilyIndices.transferFamily;
+
+    VkCommandPoolCreateInfo poolInfo = {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+        .flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
+        .queueFamilyIndex = transfer->transferFamily,
+    };
+
+    if (vkCreateCommandPool(vulkan->device.device, &poolInfo, NULL,
+                            &transfer->commandPool) != VK_SUCCESS) {
+        THROW_ERROR("failed to create transfer command pool!\n");
+    }
+
+    VkSemaphoreTypeCreateInfoKHR typeInfo = {
+        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR,
+        .semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE_KHR,
+        .initialValue = 0,
+    };
+
+    VkSemaphoreCreateInfo semaphoreInfo = {
+        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+        .pNext = &typeInfo,
+    };
+
+    if (vkCreateSemaphore(vulkan->device.device, &semaphoreInfo, NULL,
+                          &transfer->timeline) != VK_SUCCESS) {
+        THROW_ERROR("failed to create transfer timeline semaphore!\n");
+    }
+
+    transfer->getCounterValue =
+        (PFN_vkGetSemaphoreCounterValueKHR)vkGetDeviceProcAddr(
+            vulkan->device.device, "vkGetSemaphoreCounterValueKHR");
+    transfer->waitSemaphores = (PFN_vkWaitSemaphoresKHR)vkGetDeviceProcAddr(
+        vulkan->device.device, "vkWaitSemaphoresKHR");
+    if (!transfer->getCounterValue || !transfer->waitSemaphores) {
+        THROW_ERROR("failed to load timeline semaphore functions!\n");
+    }
+}
+
+// the recorded commands on the transfer queue, returning the value the
+// timeline reaches once they have finished
+uint64_t submitTransfer(Vulkan *vulkan, VkCommandBuffer commandBuffer) {
+    Transfer *transfer = &vulkan->transfer;
+    uint64_t value = transfer->submitted + 1;
+
+    VkTimelineSemaphoreSubmitInfoKHR timelineInfo = {
+        .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR,
+        .signalSemaphoreValueCount = 1,
+        .pSignalSemaphoreValues = &value,
+    };
+
+    VkSubmitInfo submitInfo = {
+        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .pNext = &timelineInfo,
+        .commandBufferCount = 1,
+        .pCommandBuffers = &commandBuffer,
+        .signalSemaphoreCount = 1,
+        .pSignalSemaphores = &transfer->timeline,
+    };
+
+    if (vkQueueSubmit(vulkan->device.transferQueue, 1, &submitInfo,
+                      VK_NULL_HANDLE) != VK_SUCCESS) {
+        THROW_ERROR("failed to submit transfer!\n");
+    }
+
+    transfer->submitted = value;
+    return value;
+}
+
+bool transferFinished(Vulkan *vulkan, uint64_t value) {
+    uint64_t reached = 0;
+    vulkan->transfer.getCounterValue(vulkan->device.device,
+                                     vulkan->transfer.timeline, &reached);
+    return reached >= value;
+}
+
+void waitForTransfer(Vulkan *vulkan, uint64_t value) {
+    VkSemaphoreWaitInfoKHR waitInfo = {
+        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR,
+        .semaphoreCount = 1,
+        .pSemaphores = &vulkan->transfer.timeline,
+        .pValues = &value,
+    };
+    vulkan->transfer.waitSemaphores(vulkan->device.device, &waitInfo,
+                                    UINT64_MAX);
+}
+
+// The acquiring half of an ownership transfer, recorded from a graphics
+// family pool, once the release it matches has been submitted. It has to
+// run on the family the release named, the graphics queue the frames go to,
+// ahead of the next one, waiting on the transfer only in the stage that
+// samples it.
+void submitTransferAcquire(Vulkan *vulkan, VkCommandBuffer commandBuffer,
+                           uint64_t value, VkFence fence) {
+    VkTimelineSemaphoreSubmitInfoKHR timelineInfo = {
+        .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR,
+        .waitSemaphoreValueCount = 1,
+        .pWaitSemaphoreValues = &value,
+    };
+
+    VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+    VkSubmitInfo submitInfo = {
+        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .pNext = &timelineInfo,
+        .waitSemaphoreCount = 1,
+        .pWaitSemaphores = &vulkan->transfer.timeline,
+        .pWaitDstStageMask = &waitStage,
+        .commandBufferCount = 1,
+        .pCommandBuffers = &commandBuffer,
+    };
+
+    if (vkQueueSubmit(vulkan->device.graphicsQueue, 1, &submitInfo, fence) !=
+        VK_SUCCESS) {
+        THROW_ERROR("failed to submit transfer acquire!\n");
+    }
+}
+
+// once every upload submitted to it has finished
+void destroyTransfer(Vulkan *vulkan) {
+    Transfer *transfer = &vulkan->transfer;
+
+    if (transfer->submitted) {
+        waitForTransfer(vulkan, transfer->submitted);
+    }
+    vkDestroySemaphore(vulkan->device.device, transfer->timeline, NULL);
+    vkDestroyCommandPool(vulkan->device.device, transfer->commandPool, NULL);
+
+    *transfer = (Transfer){0};
+}
@@ -106,6 +106,25 @@ void createDescriptorSets(Vulkan *vulkan, DescriptorSet *descriptorSet,
     }
 }
 
+// Points one swapchain image's set at the texture as it is now, for textures
+// whose image changes while they are drawn. Only once that image's command
+// buffer has finished, which has to be recorded again after.
+void updateTextureDescriptor(Vulkan *vulkan, DescriptorSet *descriptorSet,
+                             uint32_t imageIndex, const Texture *texture) {
+    VkDescriptorImageInfo imageInfo = {
+        .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+        .imageView = texture->textureImageView,
+        .sampler = texture->textureSampler,
+    };
+
+    VkWriteDescriptorSet descriptorWrite = createWriteDescriptorInfo(
+        NULL, &imageInfo, descriptorSet->descriptorSets[imageIndex], 1,
+        VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
+
+    vkUpdateDescriptorSets(vulkan->device.device, 1, &descriptorWrite, 0,
+                           NULL);
+}
+
 static inline VkDescriptorSetLayoutBinding
 createDescriptorSetLayoutBinding(VkDescriptorType dType,
                                  VkShaderStageFlags sFlags, uint32_t binding) {
@@ -2,11 +2,18 @@
 #define GLM_FORCE_DEPTH_ZERO_TO_ONE
 
 #include "vulkan_handle/vulkan_handle.h"
+#include "geometry/stream/stream.h"
 #include "utility/error_handle.h"
+#include "utility/job.h"
 #include "vulkan_handle/device.h"
 #include "vulkan_handle/memory.h"
+#include "vulkan_handle/mipmap.h"
 #include "vulkan_handle/swapchain.h"
 #include "vulkan_handle/texture.h"
+#include "vulkan_handle/texture_cache.h"
+#include "vulkan_handle/texture_stream.h"
+#include "vulkan_handle/texture_table.h"
+#include "vulkan_handle/transfer.h"
 #include "vulkan_handle/validation.h"
 #include "window/window.h"
 #include <SDL.h>
@@ -27,7 +34,9 @@ void createInstance(Vulkan *vulkan) {
         .applicationVersion = VK_MAKE_VERSION(1, 0, 0),
         .pEngineName = "No Engine",
         .engineVersion = VK_MAKE_VERSION(1, 0, 0),
-        .apiVersion = VK_API_VERSION_1_0,
+        // 1.1 for querying descriptor indexing and timeline semaphores, the
+        // rest is 1.0
+        .apiVersion = VK_API_VERSION_1_1,
     };
 
     // Get the required extension count
@@ -95,10 +104,34 @@ void initVulkan(Vulkan *vulkan) {
 
     createCommandPool(vulkan);
 
-    // generateShape(vulkan, CUBE, "../assets/2k_saturn.jpg");
-    generateShape(vulkan, SPHERE, "../assets/2k_saturn.jpg");
-    // generateShape(vulkan, CIRCLE, "../assets//2k_saturn_ring_alpha.png");
-    generateShape(vulkan, RING, "../assets/2k_saturn_ring_alpha.png");
+    if (vulkan->device.transferQueue) {
+        createTransfer(vulkan);
+    }
+
+    createMipGenerator(vulkan);
+
+    if (vulkan->device.bindless) {
+        createTextureTable(vulkan);
+    }
+
+    ShapeCreateInfo scene[] = {
+        {
+            .shapeType = SPHERE,
+            .textureFileName = "../assets/2k_saturn.jpg",
+            .flags = SHAPE_PACKED_VERTICES | SHAPE_SPLIT_STREAMS |
+                     SHAPE_DEPTH_PREPASS | SHAPE_TRIANGLE_STRIPS |
+                     SHAPE_LOD_CHAIN | SHAPE_MESHLETS |
+                     SHAPE_COMPRESS_TEXTURE | SHAPE_STREAM_TEXTURE,
+        },
+        // {.shapeType = CIRCLE,
+        //  .textureFileName = "../assets//2k_saturn_ring_alpha.png"},
+        {
+            .shapeType = RING,
+            .textureFileName = "../assets/2k_saturn_ring_alpha.png",
+            .flags = SHAPE_COMPRESS_TEXTURE,
+        },
+    };
+    generateShapes(vulkan, scene, SIZEOF(scene));
 
     createCommandBuffers(vulkan);
 
@@ -111,6 +144,10 @@ void cleanUpVulkan(Vulkan *vulkan) {
     cleanupSwapChain(vulkan);
 
     for (uint32_t i = 0; i < vulkan->shapeCount; i++) {
+        if (vulkan->shapes[i].stream) {
+            closeMeshStream(vulkan, &vulkan->shapes[i]);
+        }
+
         if (vulkan->shapes[i].graphicsPipeline.graphicsPipeline ==
             VK_NULL_HANDLE) {
             vkDestroyPipeline(
@@ -124,15 +161,7 @@ void cleanUpVulkan(Vulkan *vulkan) {
                 vulkan->shapes[i].graphicsPipeline.pipelineLayout, NULL);
         }
 
-        vkDestroySampler(vulkan->device.device,
-                         vulkan->shapes[i].texture.textureSampler, NULL);
-        vkDestroyImageView(vulkan->device.device,
-                           vulkan->shapes[i].texture.textureImageView, NULL);
-
-        vkDestroyImage(vulkan->device.device,
-                       vulkan->shapes[i].texture.textureImage, NULL);
-        vkFreeMemory(vulkan->device.device,
-                     vulkan->shapes[i].texture.textureImageMemory, NULL);
+        releaseTexture(vulkan, &vulkan->shapes[i].texture);
 
         vkDestroyDescriptorSetLayout(
             vulkan->device.device,
@@ -148,7 +177,8 @@ void cleanUpVulkan(Vulkan *vulkan) {
         vkFreeMemory(vulkan->device.device,
                      vulkan->shapeBuffers.vertexBufferMemory[i], NULL);
 
-        freeMem(1, vulkan->shapes[i].descriptorSet.descriptorSets);
+        freeMem(3, vulkan->shapes[i].descriptorSet.descriptorSets,
+                vulkan->shapes[i].lods, vulkan->shapes[i].meshlets);
     }
 
     for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
@@ -168,6 +198,20 @@ void cleanUpVulkan(Vulkan *vulkan) {
             vulkan->semaphores.imagesInFlight,
             vulkan->renderBuffers.commandBuffers, vulkan->shapes);
 
+    destroyTextureCache(vulkan);
+
+    destroyTextureStreams(vulkan);
+
+    if (vulkan->device.transferQueue) {
+        destroyTransfer(vulkan);
+    }
+
+    if (vulkan->device.bindless) {
+        destroyTextureTable(vulkan);
+    }
+
+    destroyMipGenerator(vulkan);
+
     vkDestroyCommandPool(vulkan->device.device,
                          vulkan->renderBuffers.commandPool, NULL);
 
@@ -185,6 +229,8 @@ void cleanUpVulkan(Vulkan *vulkan) {
 inline Vulkan initialise() {
     initSDL();
 
+    startJobSystem(0, 0);
+
     Vulkan vulkan = {
         .window = createWindow(),
     };
@@ -197,6 +243,8 @@ inline Vulkan initialise() {
 inline void terminate(Vulkan *vulkan) {
     cleanUpVulkan(vulkan);
 
+    stopJobSystem();
+
     freeMem(1, vulkan->window.event);
 
     SDL_DestroyWindow(vulkan->window.win);
@@ -0,0 +1,123 @@
+#include "geometry/geometry.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// writes every default parametric shape into a header of const tables, the
+// way compile_shaders embeds the spir-v, run by the bake_meshes make target
+
+typedef struct BakeTarget {
+    ShapeType shapeType;
+    const char *name;
+} BakeTarget;
+
+static const BakeTarget targets[] = {
+    {SPHERE, "sphere"}, {ICOSPHERE, "icosphere"}, {OCTASPHERE, "octasphere"},
+    {CIRCLE, "circle"}, {RING, "ring"},
+};
+
+#define INDICES_PER_LINE 12
+
+static void upperCase(char *dst, const char *src) {
+    while ((*dst++ = toupper((unsigned char)*src++))) {
+    }
+}
+
+// nine significant digits bring every float back exactly, whole numbers get a
+// decimal point so a negative zero stays a float
+static void writeFloat(FILE *file, float value) {
+    char text[32];
+    snprintf(text, sizeof(text), "%.9g", value);
+    fputs(text, file);
+    if (!strpbrk(text, ".e")) {
+        fputs(".0", file);
+    }
+}
+
+static void writeFloats(FILE *file, const float *values, uint32_t count) {
+    fputc('{', file);
+    for (uint32_t i = 0; i < count; i++) {
+        if (i) {
+            fputs(", ", file);
+        }
+        writeFloat(file, values[i]);
+    }
+    fputc('}', file);
+}
+
+static void writeMesh(FILE *file, const char *name, const Shape *shape,
+                      const ShapeParameters *parameters) {
+    fprintf(file, "static const ShapeParameters BAKED_%s_PARAMETERS = {\n",
+            name);
+    fprintf(file, "    .detail = {%u, %u},\n", parameters->detail[0],
+            parameters->detail[1]);
+    fputs("    .radius = ", file);
+    writeFloat(file, parameters->radius);
+    fputs(",\n};\n\n", file);
+
+    fprintf(file, "static const Vertex BAKED_%s_VERTICES[] = {\n", name);
+    for (uint32_t i = 0; i < shape->verticesCount; i++) {
+        const Vertex *vertex = &shape->vertices[i];
+        fputs("    {", file);
+        writeFloats(file, vertex->pos, 3);
+        fputs(", ", file);
+        writeFloats(file, vertex->colour, 3);
+        fputs(", ", file);
+        writeFloats(file, vertex->normal, 3);
+        fputs(", ", file);
+        writeFloats(file, vertex->texCoord, 2);
+        fputs("},\n", file);
+    }
+    fputs("};\n\n", file);
+
+    fprintf(file, "static const uint32_t BAKED_%s_INDICES[] = {", name);
+    for (uint32_t i = 0; i < shape->indicesCount; i++) {
+        fputs(i % INDICES_PER_LINE ? " " : "\n    ", file);
+        fprintf(file, "%u,", shape->indices[i]);
+    }
+    fputs("\n};\n", file);
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <output directory>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    for (size_t i = 0; i < sizeof(targets) / sizeof(*targets); i++) {
+        char name[32];
+        upperCase(name, targets[i].name);
+
+        char fileName[256];
+        snprintf(fileName, sizeof(fileName), "%s/%s_mesh.h", argv[1],
+                 targets[i].name);
+
+        FILE *file = fopen(fileName, "w");
+        if (!file) {
+            fprintf(stderr, "failed to open %s!\n", fileName);
+            return EXIT_FAILURE;
+        }
+
+        Shape shape = {0};
+        makeDefaultShape(&shape, targets[i].shapeType);
+
+        fprintf(file,
+                "#ifndef INCLUDE_GEOMETRY_BAKED_%s_MESH\n"
+                "#define INCLUDE_GEOMETRY_BAKED_%s_MESH\n\n"
+                "// generated by tools/bake_meshes.c, do not edit\n\n"
+                "#include \"geometry/geometry.h\"\n\n",
+                name, name);
+        writeMesh(file, name, &shape, &shapeParameters[targets[i].shapeType]);
+        fprintf(file, "\n#endif /* INCLUDE_GEOMETRY_BAKED_%s_MESH */\n", name);
+
+        fclose(file);
+        free(shape.vertices);
+        free(shape.indices);
+
+        printf("%s: %u vertices, %u indices\n", fileName, shape.verticesCount,
+               shape.indicesCount);
+    }
+
+    return EXIT_SUCCESS;
+}
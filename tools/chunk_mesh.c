@@ -0,0 +1,30 @@
+#include "geometry/geometry.h"
+#include "geometry/mesh/mesh.h"
+#include "geometry/stream/chunks.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// splits an obj, gltf or glb file into the chunked format generateStreamedMesh
+// pages in, run by the chunk_mesh make target
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s <mesh> <output>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    Shape shape = {0};
+    loadMesh(&shape, argv[1]);
+
+    if (!writeChunkedMesh(&shape, argv[2])) {
+        fprintf(stderr, "failed to write %s!\n", argv[2]);
+        return EXIT_FAILURE;
+    }
+
+    printf("%u triangles chunked into %s\n", shape.indicesCount / 3, argv[2]);
+
+    free(shape.vertices);
+    free(shape.indices);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,187 @@
+#include "image/bc/bc.h"
+#include "image/bc/encode.h"
+#include "image/format/format.h"
+#include "image/ktx/ktx.h"
+#include "image/mip/mip.h"
+#include "image/package/package.h"
+#include "utility/job.h"
+#include <SDL.h>
+#include <SDL_image.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// cooks png and jpeg textures into the package loadTexturePixels reads before
+// decoding anything, run by the cook make target. Every level is filtered on
+// the cpu and block compressed, bc3 for textures with alpha, whose coverage
+// is kept down the chain, and bc1 for the rest.
+
+static double elapsedMs(const struct timespec *start) {
+    struct timespec end;
+    timespec_get(&end, TIME_UTC);
+    return (end.tv_sec - start->tv_sec) * 1e3 +
+           (end.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+static const char *baseName(const char *fileName) {
+    const char *name = fileName;
+    for (const char *c = fileName; *c; c++) {
+        if (*c == '/' || *c == '\\') {
+            name = c + 1;
+        }
+    }
+    return name;
+}
+
+// tightly packed rgba8, as the mip filter reads it
+static unsigned char *loadRgba(const char *fileName, uint32_t *width,
+                               uint32_t *height) {
+    SDL_Surface *image = IMG_Load(fileName);
+    if (!image) {
+        fprintf(stderr, "could not load %s: %s\n", fileName, SDL_GetError());
+        return NULL;
+    }
+
+    SDL_Surface *converted =
+        SDL_ConvertSurfaceFormat(image, SDL_PIXELFORMAT_ABGR8888, 0);
+    SDL_FreeSurface(image);
+    if (!converted) {
+        fprintf(stderr, "could not convert %s: %s\n", fileName,
+                SDL_GetError());
+        return NULL;
+    }
+
+    *width = (uint32_t)converted->w;
+    *height = (uint32_t)converted->h;
+    unsigned char *rgba = malloc((size_t)*width * *height * 4);
+    const unsigned char *pixels = converted->pixels;
+    for (uint32_t y = 0; y < *height; y++) {
+        memcpy(&rgba[(size_t)y * *width * 4],
+               &pixels[(size_t)y * converted->pitch], (size_t)*width * 4);
+    }
+
+    SDL_FreeSurface(converted);
+    return rgba;
+}
+
+static bool hasAlpha(const unsigned char *rgba, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (rgba[i * 4 + 3] != 255) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// of level 0 through the same decoder the runtime falls back on
+static double levelPsnr(const ImageFormat *imageFormat,
+                        const unsigned char *rgba, const unsigned char *blocks,
+                        uint32_t width, uint32_t height) {
+    size_t count = (size_t)width * height;
+    unsigned char *decoded = malloc(count * 4);
+    decodeBcImage(imageFormat, blocks, width, height, decoded);
+
+    uint32_t channels = imageFormat->blockBytes == 8 ? 3 : 4;
+    double error = 0.0;
+    for (size_t i = 0; i < count; i++) {
+        for (uint32_t c = 0; c < channels; c++) {
+            double d = (double)rgba[i * 4 + c] - decoded[i * 4 + c];
+            error += d * d;
+        }
+    }
+
+    free(decoded);
+    error /= count * channels;
+    return error > 0.0 ? 10.0 * log10(255.0 * 255.0 / error) : INFINITY;
+}
+
+static bool cookTexture(const char *fileName, PackagedTexture *texture) {
+    struct timespec start;
+    timespec_get(&start, TIME_UTC);
+
+    uint32_t width, height;
+    unsigned char *rgba = loadRgba(fileName, &width, &height);
+    if (!rgba) {
+        return false;
+    }
+
+    bool alpha = hasAlpha(rgba, (size_t)width * height);
+    const ImageFormat *imageFormat = findImageFormat(
+        alpha ? VK_FORMAT_BC3_SRGB_BLOCK : VK_FORMAT_BC1_RGB_SRGB_BLOCK);
+
+    MipChain chain;
+    generateMipChain(rgba, width, height,
+                     MIP_SRGB | (alpha ? MIP_PRESERVE_COVERAGE : 0), &chain);
+
+    Ktx2Image image = {
+        .format = imageFormat->format,
+        .width = width,
+        .height = height,
+        .levelsCount = chain.levelsCount,
+    };
+    unsigned char *blocks[KTX2_MAX_LEVELS];
+    for (uint32_t i = 0; i < chain.levelsCount; i++) {
+        image.levelSizes[i] =
+            imageLevelSize(imageFormat, chain.widths[i], chain.heights[i]);
+        blocks[i] = malloc(image.levelSizes[i]);
+        encodeBcImage(imageFormat, chain.levels[i], chain.widths[i],
+                      chain.heights[i], blocks[i]);
+        image.levels[i] = blocks[i];
+    }
+
+    double psnr = levelPsnr(imageFormat, rgba, blocks[0], width, height);
+
+    *texture = (PackagedTexture){
+        .name = baseName(fileName),
+        .stamp = textureSourceStamp(fileName),
+    };
+    texture->data = writeKtx2(&image, &texture->size);
+
+    printf("%-28s %5ux%-5u %2u levels %s %8.1f KB %6.2f dB %8.1f ms\n",
+           texture->name, width, height, chain.levelsCount,
+           alpha ? "bc3" : "bc1", texture->size / 1024.0, psnr,
+           elapsedMs(&start));
+
+    for (uint32_t i = 0; i < chain.levelsCount; i++) {
+        free(blocks[i]);
+    }
+    freeMipChain(&chain);
+    free(rgba);
+
+    return true;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s <package> <image>...\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    startJobSystem(0, 0);
+
+    uint32_t texturesCount = (uint32_t)argc - 2;
+    PackagedTexture *textures = calloc(texturesCount, sizeof(*textures));
+
+    bool cooked = true;
+    for (uint32_t i = 0; i < texturesCount && cooked; i++) {
+        cooked = cookTexture(argv[i + 2], &textures[i]);
+    }
+
+    if (cooked && !writeTexturePackage(argv[1], textures, texturesCount)) {
+        fprintf(stderr, "failed to write %s!\n", argv[1]);
+        cooked = false;
+    } else if (cooked) {
+        printf("%u textures cooked into %s\n", texturesCount, argv[1]);
+    }
+
+    for (uint32_t i = 0; i < texturesCount; i++) {
+        free((void *)textures[i].data);
+    }
+    free(textures);
+
+    stopJobSystem();
+
+    return cooked ? EXIT_SUCCESS : EXIT_FAILURE;
+}